@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/3rd-party/dparser/arg.c" "3rd-party/dparser/CMakeFiles/dparser.dir/arg.c.o" "gcc" "3rd-party/dparser/CMakeFiles/dparser.dir/arg.c.o.d"
+  "/root/repo/3rd-party/dparser/dparse_tree.c" "3rd-party/dparser/CMakeFiles/dparser.dir/dparse_tree.c.o" "gcc" "3rd-party/dparser/CMakeFiles/dparser.dir/dparse_tree.c.o.d"
+  "/root/repo/3rd-party/dparser/dsymtab.c" "3rd-party/dparser/CMakeFiles/dparser.dir/dsymtab.c.o" "gcc" "3rd-party/dparser/CMakeFiles/dparser.dir/dsymtab.c.o.d"
+  "/root/repo/3rd-party/dparser/parse.c" "3rd-party/dparser/CMakeFiles/dparser.dir/parse.c.o" "gcc" "3rd-party/dparser/CMakeFiles/dparser.dir/parse.c.o.d"
+  "/root/repo/3rd-party/dparser/read_binary.c" "3rd-party/dparser/CMakeFiles/dparser.dir/read_binary.c.o" "gcc" "3rd-party/dparser/CMakeFiles/dparser.dir/read_binary.c.o.d"
+  "/root/repo/3rd-party/dparser/scan.c" "3rd-party/dparser/CMakeFiles/dparser.dir/scan.c.o" "gcc" "3rd-party/dparser/CMakeFiles/dparser.dir/scan.c.o.d"
+  "/root/repo/3rd-party/dparser/util.c" "3rd-party/dparser/CMakeFiles/dparser.dir/util.c.o" "gcc" "3rd-party/dparser/CMakeFiles/dparser.dir/util.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
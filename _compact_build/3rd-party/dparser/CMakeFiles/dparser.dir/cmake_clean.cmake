@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "../../stage/lib/libdparser.a"
+  "../../stage/lib/libdparser.pdb"
+  "CMakeFiles/dparser.dir/arg.c.o"
+  "CMakeFiles/dparser.dir/arg.c.o.d"
+  "CMakeFiles/dparser.dir/dparse_tree.c.o"
+  "CMakeFiles/dparser.dir/dparse_tree.c.o.d"
+  "CMakeFiles/dparser.dir/dsymtab.c.o"
+  "CMakeFiles/dparser.dir/dsymtab.c.o.d"
+  "CMakeFiles/dparser.dir/parse.c.o"
+  "CMakeFiles/dparser.dir/parse.c.o.d"
+  "CMakeFiles/dparser.dir/read_binary.c.o"
+  "CMakeFiles/dparser.dir/read_binary.c.o.d"
+  "CMakeFiles/dparser.dir/scan.c.o"
+  "CMakeFiles/dparser.dir/scan.c.o.d"
+  "CMakeFiles/dparser.dir/util.c.o"
+  "CMakeFiles/dparser.dir/util.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dparser.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
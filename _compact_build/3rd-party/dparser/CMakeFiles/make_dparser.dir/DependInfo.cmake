@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/3rd-party/dparser/make_dparser.c" "3rd-party/dparser/CMakeFiles/make_dparser.dir/make_dparser.c.o" "gcc" "3rd-party/dparser/CMakeFiles/make_dparser.dir/make_dparser.c.o.d"
+  "/root/repo/3rd-party/dparser/version.c" "3rd-party/dparser/CMakeFiles/make_dparser.dir/version.c.o" "gcc" "3rd-party/dparser/CMakeFiles/make_dparser.dir/version.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_compact_build/3rd-party/dparser/CMakeFiles/mkdparse.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/3rd-party/dparser/CMakeFiles/dparser.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
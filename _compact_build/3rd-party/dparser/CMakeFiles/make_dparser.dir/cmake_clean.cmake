@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../stage/bin/make_dparser"
+  "../../stage/bin/make_dparser.pdb"
+  "CMakeFiles/make_dparser.dir/make_dparser.c.o"
+  "CMakeFiles/make_dparser.dir/make_dparser.c.o.d"
+  "CMakeFiles/make_dparser.dir/version.c.o"
+  "CMakeFiles/make_dparser.dir/version.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/make_dparser.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/3rd-party/dparser/gram.c" "3rd-party/dparser/CMakeFiles/mkdparse.dir/gram.c.o" "gcc" "3rd-party/dparser/CMakeFiles/mkdparse.dir/gram.c.o.d"
+  "/root/repo/3rd-party/dparser/grammar.g.c" "3rd-party/dparser/CMakeFiles/mkdparse.dir/grammar.g.c.o" "gcc" "3rd-party/dparser/CMakeFiles/mkdparse.dir/grammar.g.c.o.d"
+  "/root/repo/3rd-party/dparser/lex.c" "3rd-party/dparser/CMakeFiles/mkdparse.dir/lex.c.o" "gcc" "3rd-party/dparser/CMakeFiles/mkdparse.dir/lex.c.o.d"
+  "/root/repo/3rd-party/dparser/lr.c" "3rd-party/dparser/CMakeFiles/mkdparse.dir/lr.c.o" "gcc" "3rd-party/dparser/CMakeFiles/mkdparse.dir/lr.c.o.d"
+  "/root/repo/3rd-party/dparser/mkdparse.c" "3rd-party/dparser/CMakeFiles/mkdparse.dir/mkdparse.c.o" "gcc" "3rd-party/dparser/CMakeFiles/mkdparse.dir/mkdparse.c.o.d"
+  "/root/repo/3rd-party/dparser/version.c" "3rd-party/dparser/CMakeFiles/mkdparse.dir/version.c.o" "gcc" "3rd-party/dparser/CMakeFiles/mkdparse.dir/version.c.o.d"
+  "/root/repo/3rd-party/dparser/write_tables.c" "3rd-party/dparser/CMakeFiles/mkdparse.dir/write_tables.c.o" "gcc" "3rd-party/dparser/CMakeFiles/mkdparse.dir/write_tables.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "../../stage/lib/libmkdparse.a"
+  "../../stage/lib/libmkdparse.pdb"
+  "CMakeFiles/mkdparse.dir/gram.c.o"
+  "CMakeFiles/mkdparse.dir/gram.c.o.d"
+  "CMakeFiles/mkdparse.dir/grammar.g.c.o"
+  "CMakeFiles/mkdparse.dir/grammar.g.c.o.d"
+  "CMakeFiles/mkdparse.dir/lex.c.o"
+  "CMakeFiles/mkdparse.dir/lex.c.o.d"
+  "CMakeFiles/mkdparse.dir/lr.c.o"
+  "CMakeFiles/mkdparse.dir/lr.c.o.d"
+  "CMakeFiles/mkdparse.dir/mkdparse.c.o"
+  "CMakeFiles/mkdparse.dir/mkdparse.c.o.d"
+  "CMakeFiles/mkdparse.dir/version.c.o"
+  "CMakeFiles/mkdparse.dir/version.c.o.d"
+  "CMakeFiles/mkdparse.dir/write_tables.c.o"
+  "CMakeFiles/mkdparse.dir/write_tables.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mkdparse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/3rd-party/dparser
+# Build directory: /root/repo/_compact_build/3rd-party/dparser
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/3rd-party/sylvan/src/lace.c" "3rd-party/sylvan/src/CMakeFiles/sylvan.dir/lace.c.o" "gcc" "3rd-party/sylvan/src/CMakeFiles/sylvan.dir/lace.c.o.d"
+  "/root/repo/3rd-party/sylvan/src/sha2.c" "3rd-party/sylvan/src/CMakeFiles/sylvan.dir/sha2.c.o" "gcc" "3rd-party/sylvan/src/CMakeFiles/sylvan.dir/sha2.c.o.d"
+  "/root/repo/3rd-party/sylvan/src/sylvan_bdd.c" "3rd-party/sylvan/src/CMakeFiles/sylvan.dir/sylvan_bdd.c.o" "gcc" "3rd-party/sylvan/src/CMakeFiles/sylvan.dir/sylvan_bdd.c.o.d"
+  "/root/repo/3rd-party/sylvan/src/sylvan_cache.c" "3rd-party/sylvan/src/CMakeFiles/sylvan.dir/sylvan_cache.c.o" "gcc" "3rd-party/sylvan/src/CMakeFiles/sylvan.dir/sylvan_cache.c.o.d"
+  "/root/repo/3rd-party/sylvan/src/sylvan_common.c" "3rd-party/sylvan/src/CMakeFiles/sylvan.dir/sylvan_common.c.o" "gcc" "3rd-party/sylvan/src/CMakeFiles/sylvan.dir/sylvan_common.c.o.d"
+  "/root/repo/3rd-party/sylvan/src/sylvan_hash.c" "3rd-party/sylvan/src/CMakeFiles/sylvan.dir/sylvan_hash.c.o" "gcc" "3rd-party/sylvan/src/CMakeFiles/sylvan.dir/sylvan_hash.c.o.d"
+  "/root/repo/3rd-party/sylvan/src/sylvan_ldd.c" "3rd-party/sylvan/src/CMakeFiles/sylvan.dir/sylvan_ldd.c.o" "gcc" "3rd-party/sylvan/src/CMakeFiles/sylvan.dir/sylvan_ldd.c.o.d"
+  "/root/repo/3rd-party/sylvan/src/sylvan_mt.c" "3rd-party/sylvan/src/CMakeFiles/sylvan.dir/sylvan_mt.c.o" "gcc" "3rd-party/sylvan/src/CMakeFiles/sylvan.dir/sylvan_mt.c.o.d"
+  "/root/repo/3rd-party/sylvan/src/sylvan_mtbdd.c" "3rd-party/sylvan/src/CMakeFiles/sylvan.dir/sylvan_mtbdd.c.o" "gcc" "3rd-party/sylvan/src/CMakeFiles/sylvan.dir/sylvan_mtbdd.c.o.d"
+  "/root/repo/3rd-party/sylvan/src/sylvan_refs.c" "3rd-party/sylvan/src/CMakeFiles/sylvan.dir/sylvan_refs.c.o" "gcc" "3rd-party/sylvan/src/CMakeFiles/sylvan.dir/sylvan_refs.c.o.d"
+  "/root/repo/3rd-party/sylvan/src/sylvan_sl.c" "3rd-party/sylvan/src/CMakeFiles/sylvan.dir/sylvan_sl.c.o" "gcc" "3rd-party/sylvan/src/CMakeFiles/sylvan.dir/sylvan_sl.c.o.d"
+  "/root/repo/3rd-party/sylvan/src/sylvan_stats.c" "3rd-party/sylvan/src/CMakeFiles/sylvan.dir/sylvan_stats.c.o" "gcc" "3rd-party/sylvan/src/CMakeFiles/sylvan.dir/sylvan_stats.c.o.d"
+  "/root/repo/3rd-party/sylvan/src/sylvan_table.c" "3rd-party/sylvan/src/CMakeFiles/sylvan.dir/sylvan_table.c.o" "gcc" "3rd-party/sylvan/src/CMakeFiles/sylvan.dir/sylvan_table.c.o.d"
+  "/root/repo/3rd-party/sylvan/src/sylvan_obj.cpp" "3rd-party/sylvan/src/CMakeFiles/sylvan.dir/sylvan_obj.cpp.o" "gcc" "3rd-party/sylvan/src/CMakeFiles/sylvan.dir/sylvan_obj.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,37 @@
+file(REMOVE_RECURSE
+  "../../../stage/lib/libsylvan.a"
+  "../../../stage/lib/libsylvan.pdb"
+  "CMakeFiles/sylvan.dir/lace.c.o"
+  "CMakeFiles/sylvan.dir/lace.c.o.d"
+  "CMakeFiles/sylvan.dir/sha2.c.o"
+  "CMakeFiles/sylvan.dir/sha2.c.o.d"
+  "CMakeFiles/sylvan.dir/sylvan_bdd.c.o"
+  "CMakeFiles/sylvan.dir/sylvan_bdd.c.o.d"
+  "CMakeFiles/sylvan.dir/sylvan_cache.c.o"
+  "CMakeFiles/sylvan.dir/sylvan_cache.c.o.d"
+  "CMakeFiles/sylvan.dir/sylvan_common.c.o"
+  "CMakeFiles/sylvan.dir/sylvan_common.c.o.d"
+  "CMakeFiles/sylvan.dir/sylvan_hash.c.o"
+  "CMakeFiles/sylvan.dir/sylvan_hash.c.o.d"
+  "CMakeFiles/sylvan.dir/sylvan_ldd.c.o"
+  "CMakeFiles/sylvan.dir/sylvan_ldd.c.o.d"
+  "CMakeFiles/sylvan.dir/sylvan_mt.c.o"
+  "CMakeFiles/sylvan.dir/sylvan_mt.c.o.d"
+  "CMakeFiles/sylvan.dir/sylvan_mtbdd.c.o"
+  "CMakeFiles/sylvan.dir/sylvan_mtbdd.c.o.d"
+  "CMakeFiles/sylvan.dir/sylvan_obj.cpp.o"
+  "CMakeFiles/sylvan.dir/sylvan_obj.cpp.o.d"
+  "CMakeFiles/sylvan.dir/sylvan_refs.c.o"
+  "CMakeFiles/sylvan.dir/sylvan_refs.c.o.d"
+  "CMakeFiles/sylvan.dir/sylvan_sl.c.o"
+  "CMakeFiles/sylvan.dir/sylvan_sl.c.o.d"
+  "CMakeFiles/sylvan.dir/sylvan_stats.c.o"
+  "CMakeFiles/sylvan.dir/sylvan_stats.c.o.d"
+  "CMakeFiles/sylvan.dir/sylvan_table.c.o"
+  "CMakeFiles/sylvan.dir/sylvan_table.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/sylvan.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,570 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/3rd-party/dparser/CMakeLists.txt"
+  "/root/repo/3rd-party/sylvan/src/CMakeLists.txt"
+  "/root/repo/CMakeLists.txt"
+  "/root/repo/COPYING"
+  "/root/repo/README.md"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/build/SourceVersion.in"
+  "/root/repo/build/cmake/AddFlag.cmake"
+  "/root/repo/build/cmake/AddMCRL2Binary.cmake"
+  "/root/repo/build/cmake/ConfigureCompiler.cmake"
+  "/root/repo/build/cmake/ConfigureGNU.cmake"
+  "/root/repo/build/cmake/ConfigurePlatform.cmake"
+  "/root/repo/build/cmake/FindPythonModules.cmake"
+  "/root/repo/build/cmake/GenerateToolTests.cmake"
+  "/root/repo/build/cmake/MCRL2Version.cmake"
+  "/root/repo/build/cmake/PrintBuildInfo.cmake"
+  "/root/repo/build/packaging/CMakeLists.txt"
+  "/root/repo/examples/academic/abp/abp.mcrl2"
+  "/root/repo/examples/modal-formulas/nodeadlock.mcf"
+  "/root/repo/examples/modal-formulas/nolivelock.mcf"
+  "/root/repo/libraries/CMakeLists.txt"
+  "/root/repo/libraries/atermpp/CMakeLists.txt"
+  "/root/repo/libraries/atermpp/example/CMakeLists.txt"
+  "/root/repo/libraries/bes/CMakeLists.txt"
+  "/root/repo/libraries/bes/example/CMakeLists.txt"
+  "/root/repo/libraries/core/CMakeLists.txt"
+  "/root/repo/libraries/data/CMakeLists.txt"
+  "/root/repo/libraries/data/CompilingRewriter.cmake"
+  "/root/repo/libraries/data/example/CMakeLists.txt"
+  "/root/repo/libraries/data/source/mcrl2compilerewriter.in"
+  "/root/repo/libraries/gui/CMakeLists.txt"
+  "/root/repo/libraries/lps/CMakeLists.txt"
+  "/root/repo/libraries/lps/example/CMakeLists.txt"
+  "/root/repo/libraries/lts/CMakeLists.txt"
+  "/root/repo/libraries/modal_formula/CMakeLists.txt"
+  "/root/repo/libraries/pbes/CMakeLists.txt"
+  "/root/repo/libraries/pbes/example/CMakeLists.txt"
+  "/root/repo/libraries/pg/CMakeLists.txt"
+  "/root/repo/libraries/pg/example/CMakeLists.txt"
+  "/root/repo/libraries/process/CMakeLists.txt"
+  "/root/repo/libraries/smt/CMakeLists.txt"
+  "/root/repo/libraries/smt/example/CMakeLists.txt"
+  "/root/repo/libraries/symbolic/CMakeLists.txt"
+  "/root/repo/libraries/utilities/CMakeLists.txt"
+  "/root/repo/libraries/utilities/example/CMakeLists.txt"
+  "/root/repo/libraries/utilities/include/mcrl2/utilities/toolset_version_const.h.in"
+  "/root/repo/tests/CMakeLists.txt"
+  "/root/repo/tools/CMakeLists.txt"
+  "/root/repo/tools/deprecated/CMakeLists.txt"
+  "/root/repo/tools/developer/CMakeLists.txt"
+  "/root/repo/tools/developer/confcheck/CMakeLists.txt"
+  "/root/repo/tools/developer/lps2ltsdeprecated/CMakeLists.txt"
+  "/root/repo/tools/developer/lpstransform/CMakeLists.txt"
+  "/root/repo/tools/developer/ltsconvertsymbolic/CMakeLists.txt"
+  "/root/repo/tools/developer/mcrl2rewrite/CMakeLists.txt"
+  "/root/repo/tools/developer/mcrl2transform/CMakeLists.txt"
+  "/root/repo/tools/developer/mcrl2typecheck/CMakeLists.txt"
+  "/root/repo/tools/developer/pbes2bdd/CMakeLists.txt"
+  "/root/repo/tools/developer/pbesbddsolve/CMakeLists.txt"
+  "/root/repo/tools/developer/pbestransform/CMakeLists.txt"
+  "/root/repo/tools/developer/reduce_pbes/CMakeLists.txt"
+  "/root/repo/tools/developer/reduce_process/CMakeLists.txt"
+  "/root/repo/tools/experimental/CMakeLists.txt"
+  "/root/repo/tools/release/CMakeLists.txt"
+  "/root/repo/tools/release/besinfo/CMakeLists.txt"
+  "/root/repo/tools/release/bespp/CMakeLists.txt"
+  "/root/repo/tools/release/bessolve/CMakeLists.txt"
+  "/root/repo/tools/release/diagraphica/CMakeLists.txt"
+  "/root/repo/tools/release/lps2lts/CMakeLists.txt"
+  "/root/repo/tools/release/lps2pbes/CMakeLists.txt"
+  "/root/repo/tools/release/lpsactionrename/CMakeLists.txt"
+  "/root/repo/tools/release/lpsbinary/CMakeLists.txt"
+  "/root/repo/tools/release/lpsbisim2pbes/CMakeLists.txt"
+  "/root/repo/tools/release/lpsconfcheck/CMakeLists.txt"
+  "/root/repo/tools/release/lpsconstelm/CMakeLists.txt"
+  "/root/repo/tools/release/lpsinfo/CMakeLists.txt"
+  "/root/repo/tools/release/lpsinvelm/CMakeLists.txt"
+  "/root/repo/tools/release/lpsparelm/CMakeLists.txt"
+  "/root/repo/tools/release/lpsparunfold/CMakeLists.txt"
+  "/root/repo/tools/release/lpspp/CMakeLists.txt"
+  "/root/repo/tools/release/lpsreach/CMakeLists.txt"
+  "/root/repo/tools/release/lpsrewr/CMakeLists.txt"
+  "/root/repo/tools/release/lpssim/CMakeLists.txt"
+  "/root/repo/tools/release/lpsstategraph/CMakeLists.txt"
+  "/root/repo/tools/release/lpssumelm/CMakeLists.txt"
+  "/root/repo/tools/release/lpssuminst/CMakeLists.txt"
+  "/root/repo/tools/release/lpsuntime/CMakeLists.txt"
+  "/root/repo/tools/release/lpsxsim/CMakeLists.txt"
+  "/root/repo/tools/release/lts2lps/CMakeLists.txt"
+  "/root/repo/tools/release/lts2pbes/CMakeLists.txt"
+  "/root/repo/tools/release/ltscompare/CMakeLists.txt"
+  "/root/repo/tools/release/ltsconvert/CMakeLists.txt"
+  "/root/repo/tools/release/ltsgraph/CMakeLists.txt"
+  "/root/repo/tools/release/ltsinfo/CMakeLists.txt"
+  "/root/repo/tools/release/ltspbisim/CMakeLists.txt"
+  "/root/repo/tools/release/ltspcompare/CMakeLists.txt"
+  "/root/repo/tools/release/ltsview/CMakeLists.txt"
+  "/root/repo/tools/release/mcrl2-gui/CMakeLists.txt"
+  "/root/repo/tools/release/mcrl22lps/CMakeLists.txt"
+  "/root/repo/tools/release/mcrl2i/CMakeLists.txt"
+  "/root/repo/tools/release/mcrl2ide/CMakeLists.txt"
+  "/root/repo/tools/release/mcrl2xi/CMakeLists.txt"
+  "/root/repo/tools/release/pbes2bes/CMakeLists.txt"
+  "/root/repo/tools/release/pbes2bool/CMakeLists.txt"
+  "/root/repo/tools/release/pbesconstelm/CMakeLists.txt"
+  "/root/repo/tools/release/pbesinfo/CMakeLists.txt"
+  "/root/repo/tools/release/pbesinst/CMakeLists.txt"
+  "/root/repo/tools/release/pbesparelm/CMakeLists.txt"
+  "/root/repo/tools/release/pbespgsolve/CMakeLists.txt"
+  "/root/repo/tools/release/pbespp/CMakeLists.txt"
+  "/root/repo/tools/release/pbesrewr/CMakeLists.txt"
+  "/root/repo/tools/release/pbessolve/CMakeLists.txt"
+  "/root/repo/tools/release/pbessolvesymbolic/CMakeLists.txt"
+  "/root/repo/tools/release/pbesstategraph/CMakeLists.txt"
+  "/root/repo/tools/release/tracepp/CMakeLists.txt"
+  "/root/repo/tools/release/txt2bes/CMakeLists.txt"
+  "/root/repo/tools/release/txt2lps/CMakeLists.txt"
+  "/root/repo/tools/release/txt2pbes/CMakeLists.txt"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseArguments.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindBoost.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGit.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPythonInterp.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/InstallRequiredSystemLibraries.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "/root/repo/build/SourceVersion"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "3rd-party/dparser/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "3rd-party/sylvan/src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libraries/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libraries/atermpp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libraries/atermpp/example/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libraries/bes/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libraries/bes/example/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libraries/core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "stage/bin/mcrl2compilerewriter.install"
+  "stage/bin/mcrl2compilerewriter"
+  "libraries/data/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libraries/data/example/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libraries/gui/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libraries/lps/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libraries/lps/example/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libraries/lts/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libraries/modal_formula/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libraries/pbes/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libraries/pbes/example/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libraries/pg/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libraries/pg/example/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libraries/process/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libraries/smt/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libraries/smt/example/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libraries/symbolic/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libraries/utilities/mcrl2/utilities/toolset_version_const.h"
+  "libraries/utilities/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libraries/utilities/example/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/besinfo/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/bespp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/diagraphica/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/lps2lts/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/lps2pbes/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/lpsactionrename/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/lpsbinary/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/lpsconfcheck/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/lpsconstelm/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/lpsinfo/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/lpsinvelm/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/lpsparelm/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/lpsparunfold/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/lpspp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/lpsrewr/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/lpssim/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/lpsstategraph/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/lpssumelm/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/lpssuminst/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/lpsuntime/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/lpsxsim/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/lts2lps/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/lts2pbes/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/ltscompare/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/ltsconvert/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/ltsgraph/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/ltsinfo/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/ltspbisim/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/ltspcompare/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/ltsview/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/mcrl2-gui/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/mcrl22lps/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/mcrl2i/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/mcrl2ide/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/mcrl2xi/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/pbes2bes/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/pbes2bool/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/pbesconstelm/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/pbesinfo/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/pbesparelm/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/pbespgsolve/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/pbespp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/pbesrewr/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/pbessolve/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/pbesstategraph/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/tracepp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/txt2lps/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/txt2pbes/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/bessolve/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/txt2bes/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/pbesinst/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/lpsbisim2pbes/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/lpsreach/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/release/pbessolvesymbolic/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/experimental/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/deprecated/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/developer/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/developer/confcheck/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/developer/lps2ltsdeprecated/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/developer/lpstransform/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/developer/mcrl2rewrite/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/developer/mcrl2transform/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/developer/mcrl2typecheck/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/developer/pbes2bdd/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/developer/pbestransform/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/developer/reduce_pbes/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/developer/reduce_process/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/developer/ltsconvertsymbolic/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/developer/pbesbddsolve/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "mcrl2-testoutput/abp.mcrl2"
+  "mcrl2-testoutput/nodeadlock.mcf"
+  "mcrl2-testoutput/nolivelock.mcf"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "COPYING.txt"
+  "README.txt"
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "build/packaging/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "3rd-party/dparser/CMakeFiles/make_dparser.dir/DependInfo.cmake"
+  "3rd-party/dparser/CMakeFiles/mkdparse.dir/DependInfo.cmake"
+  "3rd-party/dparser/CMakeFiles/dparser.dir/DependInfo.cmake"
+  "3rd-party/sylvan/src/CMakeFiles/sylvan.dir/DependInfo.cmake"
+  "libraries/atermpp/CMakeFiles/mcrl2_atermpp.dir/DependInfo.cmake"
+  "libraries/atermpp/CMakeFiles/librarytest_mcrl2_atermpp_algorithm_test.dir/DependInfo.cmake"
+  "libraries/atermpp/CMakeFiles/librarytest_mcrl2_atermpp_aterm_balanced_tree_test.dir/DependInfo.cmake"
+  "libraries/atermpp/CMakeFiles/librarytest_mcrl2_atermpp_aterm_io_binary_test.dir/DependInfo.cmake"
+  "libraries/atermpp/CMakeFiles/librarytest_mcrl2_atermpp_aterm_list_test.dir/DependInfo.cmake"
+  "libraries/atermpp/CMakeFiles/librarytest_mcrl2_atermpp_aterm_test.dir/DependInfo.cmake"
+  "libraries/atermpp/CMakeFiles/librarytest_mcrl2_atermpp_constructors.dir/DependInfo.cmake"
+  "libraries/atermpp/CMakeFiles/librarytest_mcrl2_atermpp_down_cast_test.dir/DependInfo.cmake"
+  "libraries/atermpp/CMakeFiles/librarytest_mcrl2_atermpp_function_symbol_generator_test.dir/DependInfo.cmake"
+  "libraries/atermpp/CMakeFiles/librarytest_mcrl2_atermpp_function_test.dir/DependInfo.cmake"
+  "libraries/atermpp/CMakeFiles/librarytest_mcrl2_atermpp_hooks_test.dir/DependInfo.cmake"
+  "libraries/atermpp/CMakeFiles/librarytest_mcrl2_atermpp_operators.dir/DependInfo.cmake"
+  "libraries/atermpp/CMakeFiles/librarytest_mcrl2_atermpp_parallel_container_test.dir/DependInfo.cmake"
+  "libraries/atermpp/CMakeFiles/librarytest_mcrl2_atermpp_replace_test.dir/DependInfo.cmake"
+  "libraries/atermpp/CMakeFiles/libraryexample_mcrl2_atermpp_algorithm.dir/DependInfo.cmake"
+  "libraries/atermpp/example/CMakeFiles/example_atermpp_algorithm.dir/DependInfo.cmake"
+  "libraries/bes/CMakeFiles/bes_pg_syntax.dir/DependInfo.cmake"
+  "libraries/bes/CMakeFiles/mcrl2_bes.dir/DependInfo.cmake"
+  "libraries/bes/CMakeFiles/librarytest_mcrl2_bes_bdd_test.dir/DependInfo.cmake"
+  "libraries/bes/CMakeFiles/librarytest_mcrl2_bes_bes_io_test.dir/DependInfo.cmake"
+  "libraries/bes/CMakeFiles/librarytest_mcrl2_bes_bes_test.dir/DependInfo.cmake"
+  "libraries/bes/CMakeFiles/librarytest_mcrl2_bes_boolean_expression_test.dir/DependInfo.cmake"
+  "libraries/bes/CMakeFiles/librarytest_mcrl2_bes_find_test.dir/DependInfo.cmake"
+  "libraries/bes/CMakeFiles/librarytest_mcrl2_bes_gauss_elimination_test.dir/DependInfo.cmake"
+  "libraries/bes/CMakeFiles/librarytest_mcrl2_bes_normal_form_test.dir/DependInfo.cmake"
+  "libraries/bes/CMakeFiles/librarytest_mcrl2_bes_pg_parse_test.dir/DependInfo.cmake"
+  "libraries/bes/CMakeFiles/librarytest_mcrl2_bes_solve_test.dir/DependInfo.cmake"
+  "libraries/bes/CMakeFiles/librarytest_mcrl2_bes_traverser_test.dir/DependInfo.cmake"
+  "libraries/bes/CMakeFiles/libraryexample_mcrl2_bes_bestranslate.dir/DependInfo.cmake"
+  "libraries/bes/example/CMakeFiles/example_bes_bestranslate.dir/DependInfo.cmake"
+  "libraries/core/CMakeFiles/core_mcrl2_syntax.dir/DependInfo.cmake"
+  "libraries/core/CMakeFiles/mcrl2_core.dir/DependInfo.cmake"
+  "libraries/core/CMakeFiles/librarytest_mcrl2_core_identifier_string_test.dir/DependInfo.cmake"
+  "libraries/core/CMakeFiles/librarytest_mcrl2_core_print_test.dir/DependInfo.cmake"
+  "libraries/data/CMakeFiles/mcrl2_data.dir/DependInfo.cmake"
+  "libraries/data/CMakeFiles/librarytest_mcrl2_data_bag_test.dir/DependInfo.cmake"
+  "libraries/data/CMakeFiles/librarytest_mcrl2_data_bool_test.dir/DependInfo.cmake"
+  "libraries/data/CMakeFiles/librarytest_mcrl2_data_builder_test.dir/DependInfo.cmake"
+  "libraries/data/CMakeFiles/librarytest_mcrl2_data_compatibility_test.dir/DependInfo.cmake"
+  "libraries/data/CMakeFiles/librarytest_mcrl2_data_data_equation_test.dir/DependInfo.cmake"
+  "libraries/data/CMakeFiles/librarytest_mcrl2_data_data_expression_test.dir/DependInfo.cmake"
+  "libraries/data/CMakeFiles/librarytest_mcrl2_data_data_specification_test.dir/DependInfo.cmake"
+  "libraries/data/CMakeFiles/librarytest_mcrl2_data_enumerator_test.dir/DependInfo.cmake"
+  "libraries/data/CMakeFiles/librarytest_mcrl2_data_find_test.dir/DependInfo.cmake"
+  "libraries/data/CMakeFiles/librarytest_mcrl2_data_identifier_generator_test.dir/DependInfo.cmake"
+  "libraries/data/CMakeFiles/librarytest_mcrl2_data_index_traits_test.dir/DependInfo.cmake"
+  "libraries/data/CMakeFiles/librarytest_mcrl2_data_int_test.dir/DependInfo.cmake"
+  "libraries/data/CMakeFiles/librarytest_mcrl2_data_linear_inequalities_test.dir/DependInfo.cmake"
+  "libraries/data/CMakeFiles/librarytest_mcrl2_data_list_test.dir/DependInfo.cmake"
+  "libraries/data/CMakeFiles/librarytest_mcrl2_data_normalize_sorts_test.dir/DependInfo.cmake"
+  "libraries/data/CMakeFiles/librarytest_mcrl2_data_parser_test.dir/DependInfo.cmake"
+  "libraries/data/CMakeFiles/librarytest_mcrl2_data_print_test.dir/DependInfo.cmake"
+  "libraries/data/CMakeFiles/librarytest_mcrl2_data_quantifier_test.dir/DependInfo.cmake"
+  "libraries/data/CMakeFiles/librarytest_mcrl2_data_replace_test.dir/DependInfo.cmake"
+  "libraries/data/CMakeFiles/librarytest_mcrl2_data_representative_generator_test.dir/DependInfo.cmake"
+  "libraries/data/CMakeFiles/librarytest_mcrl2_data_rewriter_test.dir/DependInfo.cmake"
+  "libraries/data/CMakeFiles/librarytest_mcrl2_data_rewriting_test.dir/DependInfo.cmake"
+  "libraries/data/CMakeFiles/librarytest_mcrl2_data_set_test.dir/DependInfo.cmake"
+  "libraries/data/CMakeFiles/librarytest_mcrl2_data_sort_expression_test.dir/DependInfo.cmake"
+  "libraries/data/CMakeFiles/librarytest_mcrl2_data_substitution_test.dir/DependInfo.cmake"
+  "libraries/data/CMakeFiles/librarytest_mcrl2_data_template_test.dir/DependInfo.cmake"
+  "libraries/data/CMakeFiles/librarytest_mcrl2_data_ticket_1300.dir/DependInfo.cmake"
+  "libraries/data/CMakeFiles/librarytest_mcrl2_data_type_check_tree_test.dir/DependInfo.cmake"
+  "libraries/data/CMakeFiles/librarytest_mcrl2_data_typecheck_test.dir/DependInfo.cmake"
+  "libraries/data/CMakeFiles/librarytest_mcrl2_data_utility_test.dir/DependInfo.cmake"
+  "libraries/data/CMakeFiles/libraryexample_mcrl2_data_example1.dir/DependInfo.cmake"
+  "libraries/data/CMakeFiles/libraryexample_mcrl2_data_example2.dir/DependInfo.cmake"
+  "libraries/data/CMakeFiles/libraryexample_mcrl2_data_example3.dir/DependInfo.cmake"
+  "libraries/data/CMakeFiles/libraryexample_mcrl2_data_example4.dir/DependInfo.cmake"
+  "libraries/data/CMakeFiles/libraryexample_mcrl2_data_parse_data.dir/DependInfo.cmake"
+  "libraries/data/CMakeFiles/libraryexample_mcrl2_data_rewriter.dir/DependInfo.cmake"
+  "libraries/data/example/CMakeFiles/example_data_example1.dir/DependInfo.cmake"
+  "libraries/data/example/CMakeFiles/example_data_example2.dir/DependInfo.cmake"
+  "libraries/data/example/CMakeFiles/example_data_example3.dir/DependInfo.cmake"
+  "libraries/data/example/CMakeFiles/example_data_example4.dir/DependInfo.cmake"
+  "libraries/data/example/CMakeFiles/example_data_parse_data.dir/DependInfo.cmake"
+  "libraries/lps/CMakeFiles/mcrl2_lps.dir/DependInfo.cmake"
+  "libraries/lps/CMakeFiles/librarytest_mcrl2_lps_action_rename_test.dir/DependInfo.cmake"
+  "libraries/lps/CMakeFiles/librarytest_mcrl2_lps_binary_test.dir/DependInfo.cmake"
+  "libraries/lps/CMakeFiles/librarytest_mcrl2_lps_confcheck_test.dir/DependInfo.cmake"
+  "libraries/lps/CMakeFiles/librarytest_mcrl2_lps_constelm_test.dir/DependInfo.cmake"
+  "libraries/lps/CMakeFiles/librarytest_mcrl2_lps_data_specification_test.dir/DependInfo.cmake"
+  "libraries/lps/CMakeFiles/librarytest_mcrl2_lps_external_state_map_test.dir/DependInfo.cmake"
+  "libraries/lps/CMakeFiles/librarytest_mcrl2_lps_find_test.dir/DependInfo.cmake"
+  "libraries/lps/CMakeFiles/librarytest_mcrl2_lps_invelm_test.dir/DependInfo.cmake"
+  "libraries/lps/CMakeFiles/librarytest_mcrl2_lps_linear_process_conversion_test.dir/DependInfo.cmake"
+  "libraries/lps/CMakeFiles/librarytest_mcrl2_lps_linearization_stochastic_test.dir/DependInfo.cmake"
+  "libraries/lps/CMakeFiles/librarytest_mcrl2_lps_linearization_test1.dir/DependInfo.cmake"
+  "libraries/lps/CMakeFiles/librarytest_mcrl2_lps_linearization_test2.dir/DependInfo.cmake"
+  "libraries/lps/CMakeFiles/librarytest_mcrl2_lps_linearization_test3.dir/DependInfo.cmake"
+  "libraries/lps/CMakeFiles/librarytest_mcrl2_lps_lps_algorithm_test.dir/DependInfo.cmake"
+  "libraries/lps/CMakeFiles/librarytest_mcrl2_lps_lpsparunfold_test.dir/DependInfo.cmake"
+  "libraries/lps/CMakeFiles/librarytest_mcrl2_lps_ltsmin_test.dir/DependInfo.cmake"
+  "libraries/lps/CMakeFiles/librarytest_mcrl2_lps_multi_action_test.dir/DependInfo.cmake"
+  "libraries/lps/CMakeFiles/librarytest_mcrl2_lps_next_state_generator_test.dir/DependInfo.cmake"
+  "libraries/lps/CMakeFiles/librarytest_mcrl2_lps_parelm_test.dir/DependInfo.cmake"
+  "libraries/lps/CMakeFiles/librarytest_mcrl2_lps_print_test.dir/DependInfo.cmake"
+  "libraries/lps/CMakeFiles/librarytest_mcrl2_lps_remove_parameters_test.dir/DependInfo.cmake"
+  "libraries/lps/CMakeFiles/librarytest_mcrl2_lps_rename_test.dir/DependInfo.cmake"
+  "libraries/lps/CMakeFiles/librarytest_mcrl2_lps_replace_test.dir/DependInfo.cmake"
+  "libraries/lps/CMakeFiles/librarytest_mcrl2_lps_resolve_name_clash_test.dir/DependInfo.cmake"
+  "libraries/lps/CMakeFiles/librarytest_mcrl2_lps_rewriter_test.dir/DependInfo.cmake"
+  "libraries/lps/CMakeFiles/librarytest_mcrl2_lps_short_vector_explorer_test.dir/DependInfo.cmake"
+  "libraries/lps/CMakeFiles/librarytest_mcrl2_lps_specification_property_map_test.dir/DependInfo.cmake"
+  "libraries/lps/CMakeFiles/librarytest_mcrl2_lps_specification_test.dir/DependInfo.cmake"
+  "libraries/lps/CMakeFiles/librarytest_mcrl2_lps_stochastic_specification_test.dir/DependInfo.cmake"
+  "libraries/lps/CMakeFiles/librarytest_mcrl2_lps_sumelm_test.dir/DependInfo.cmake"
+  "libraries/lps/CMakeFiles/librarytest_mcrl2_lps_suminst_test.dir/DependInfo.cmake"
+  "libraries/lps/CMakeFiles/librarytest_mcrl2_lps_symbolic_reachability_test.dir/DependInfo.cmake"
+  "libraries/lps/CMakeFiles/librarytest_mcrl2_lps_timed_linearization_test.dir/DependInfo.cmake"
+  "libraries/lps/CMakeFiles/librarytest_mcrl2_lps_untime_test.dir/DependInfo.cmake"
+  "libraries/lps/CMakeFiles/libraryexample_mcrl2_lps_next_state_generator.dir/DependInfo.cmake"
+  "libraries/lps/CMakeFiles/libraryexample_mcrl2_lps_parelm_test.dir/DependInfo.cmake"
+  "libraries/lps/example/CMakeFiles/example_lps_next_state_generator.dir/DependInfo.cmake"
+  "libraries/lps/example/CMakeFiles/example_lps_parelm_test.dir/DependInfo.cmake"
+  "libraries/lts/CMakeFiles/mcrl2_lts.dir/DependInfo.cmake"
+  "libraries/lts/CMakeFiles/librarytest_mcrl2_lts_compare.dir/DependInfo.cmake"
+  "libraries/lts/CMakeFiles/librarytest_mcrl2_lts_linearization_instantiation_compare_test.dir/DependInfo.cmake"
+  "libraries/lts/CMakeFiles/librarytest_mcrl2_lts_lps2lts_test.dir/DependInfo.cmake"
+  "libraries/lts/CMakeFiles/librarytest_mcrl2_lts_lts_pbisim_test.dir/DependInfo.cmake"
+  "libraries/lts/CMakeFiles/librarytest_mcrl2_lts_lts_test.dir/DependInfo.cmake"
+  "libraries/lts/CMakeFiles/librarytest_mcrl2_lts_ltsconvert_test.dir/DependInfo.cmake"
+  "libraries/lts/CMakeFiles/librarytest_mcrl2_lts_parse_test.dir/DependInfo.cmake"
+  "libraries/lts/CMakeFiles/librarytest_mcrl2_lts_probabilistic_arbitrary_precision_fraction_test.dir/DependInfo.cmake"
+  "libraries/lts/CMakeFiles/librarytest_mcrl2_lts_read_mcrl2.dir/DependInfo.cmake"
+  "libraries/lts/CMakeFiles/librarytest_mcrl2_lts_read_plain.dir/DependInfo.cmake"
+  "libraries/modal_formula/CMakeFiles/mcrl2_modal_formula.dir/DependInfo.cmake"
+  "libraries/modal_formula/CMakeFiles/librarytest_mcrl2_modal_formula_modal_formula_find_test.dir/DependInfo.cmake"
+  "libraries/modal_formula/CMakeFiles/librarytest_mcrl2_modal_formula_monotonicity_test.dir/DependInfo.cmake"
+  "libraries/modal_formula/CMakeFiles/librarytest_mcrl2_modal_formula_print_test.dir/DependInfo.cmake"
+  "libraries/modal_formula/CMakeFiles/librarytest_mcrl2_modal_formula_state_formula_test.dir/DependInfo.cmake"
+  "libraries/pbes/CMakeFiles/mcrl2_pbes.dir/DependInfo.cmake"
+  "libraries/pbes/CMakeFiles/librarytest_mcrl2_pbes_absinthe_test.dir/DependInfo.cmake"
+  "libraries/pbes/CMakeFiles/librarytest_mcrl2_pbes_abstract_test.dir/DependInfo.cmake"
+  "libraries/pbes/CMakeFiles/librarytest_mcrl2_pbes_bisimulation_test.dir/DependInfo.cmake"
+  "libraries/pbes/CMakeFiles/librarytest_mcrl2_pbes_boolean_operator_test.dir/DependInfo.cmake"
+  "libraries/pbes/CMakeFiles/librarytest_mcrl2_pbes_bqnf_quantifier_rewriter_test.dir/DependInfo.cmake"
+  "libraries/pbes/CMakeFiles/librarytest_mcrl2_pbes_constelm_test.dir/DependInfo.cmake"
+  "libraries/pbes/CMakeFiles/librarytest_mcrl2_pbes_enumerator_test.dir/DependInfo.cmake"
+  "libraries/pbes/CMakeFiles/librarytest_mcrl2_pbes_eqelm_test.dir/DependInfo.cmake"
+  "libraries/pbes/CMakeFiles/librarytest_mcrl2_pbes_find_test.dir/DependInfo.cmake"
+  "libraries/pbes/CMakeFiles/librarytest_mcrl2_pbes_lps2pbes_test.dir/DependInfo.cmake"
+  "libraries/pbes/CMakeFiles/librarytest_mcrl2_pbes_monotonicity_test.dir/DependInfo.cmake"
+  "libraries/pbes/CMakeFiles/librarytest_mcrl2_pbes_normalize_test.dir/DependInfo.cmake"
+  "libraries/pbes/CMakeFiles/librarytest_mcrl2_pbes_one_point_rewriter_test.dir/DependInfo.cmake"
+  "libraries/pbes/CMakeFiles/librarytest_mcrl2_pbes_parelm_test.dir/DependInfo.cmake"
+  "libraries/pbes/CMakeFiles/librarytest_mcrl2_pbes_parity_game_test.dir/DependInfo.cmake"
+  "libraries/pbes/CMakeFiles/librarytest_mcrl2_pbes_parse_test.dir/DependInfo.cmake"
+  "libraries/pbes/CMakeFiles/librarytest_mcrl2_pbes_pbes_explorer_test.dir/DependInfo.cmake"
+  "libraries/pbes/CMakeFiles/librarytest_mcrl2_pbes_pbes_expression_test.dir/DependInfo.cmake"
+  "libraries/pbes/CMakeFiles/librarytest_mcrl2_pbes_pbes_property_map_test.dir/DependInfo.cmake"
+  "libraries/pbes/CMakeFiles/librarytest_mcrl2_pbes_pbes_test.dir/DependInfo.cmake"
+  "libraries/pbes/CMakeFiles/librarytest_mcrl2_pbes_pbesinst_test.dir/DependInfo.cmake"
+  "libraries/pbes/CMakeFiles/librarytest_mcrl2_pbes_pbesrewr_test.dir/DependInfo.cmake"
+  "libraries/pbes/CMakeFiles/librarytest_mcrl2_pbes_pfnf_rewriter_test.dir/DependInfo.cmake"
+  "libraries/pbes/CMakeFiles/librarytest_mcrl2_pbes_ppg_rewriter_test.dir/DependInfo.cmake"
+  "libraries/pbes/CMakeFiles/librarytest_mcrl2_pbes_print_test.dir/DependInfo.cmake"
+  "libraries/pbes/CMakeFiles/librarytest_mcrl2_pbes_quantifier_propagate_test.dir/DependInfo.cmake"
+  "libraries/pbes/CMakeFiles/librarytest_mcrl2_pbes_remove_equations_test.dir/DependInfo.cmake"
+  "libraries/pbes/CMakeFiles/librarytest_mcrl2_pbes_remove_parameters_test.dir/DependInfo.cmake"
+  "libraries/pbes/CMakeFiles/librarytest_mcrl2_pbes_rewriter_test.dir/DependInfo.cmake"
+  "libraries/pbes/CMakeFiles/librarytest_mcrl2_pbes_sort_traverser_test.dir/DependInfo.cmake"
+  "libraries/pbes/CMakeFiles/librarytest_mcrl2_pbes_stategraph_test.dir/DependInfo.cmake"
+  "libraries/pbes/CMakeFiles/librarytest_mcrl2_pbes_substitute_test.dir/DependInfo.cmake"
+  "libraries/pbes/CMakeFiles/librarytest_mcrl2_pbes_symbolic_parity_game_test.dir/DependInfo.cmake"
+  "libraries/pbes/CMakeFiles/librarytest_mcrl2_pbes_txt2pbes_test.dir/DependInfo.cmake"
+  "libraries/pbes/CMakeFiles/librarytest_mcrl2_pbes_typecheck_test.dir/DependInfo.cmake"
+  "libraries/pg/CMakeFiles/mcrl2_pg.dir/DependInfo.cmake"
+  "libraries/pg/CMakeFiles/libraryexample_mcrl2_pg_pg_solving.dir/DependInfo.cmake"
+  "libraries/pg/example/CMakeFiles/example_pg_solve_pg.dir/DependInfo.cmake"
+  "libraries/process/CMakeFiles/mcrl2_process.dir/DependInfo.cmake"
+  "libraries/process/CMakeFiles/librarytest_mcrl2_process_action_test.dir/DependInfo.cmake"
+  "libraries/process/CMakeFiles/librarytest_mcrl2_process_alphabet_test.dir/DependInfo.cmake"
+  "libraries/process/CMakeFiles/librarytest_mcrl2_process_find_test.dir/DependInfo.cmake"
+  "libraries/process/CMakeFiles/librarytest_mcrl2_process_parse_test.dir/DependInfo.cmake"
+  "libraries/process/CMakeFiles/librarytest_mcrl2_process_print_test.dir/DependInfo.cmake"
+  "libraries/process/CMakeFiles/librarytest_mcrl2_process_process_test.dir/DependInfo.cmake"
+  "libraries/process/CMakeFiles/librarytest_mcrl2_process_replace_test.dir/DependInfo.cmake"
+  "libraries/process/CMakeFiles/librarytest_mcrl2_process_sort_traverser_test.dir/DependInfo.cmake"
+  "libraries/process/CMakeFiles/librarytest_mcrl2_process_typecheck_test.dir/DependInfo.cmake"
+  "libraries/smt/CMakeFiles/mcrl2_smt.dir/DependInfo.cmake"
+  "libraries/smt/CMakeFiles/libraryexample_mcrl2_smt_example1.dir/DependInfo.cmake"
+  "libraries/smt/CMakeFiles/libraryexample_mcrl2_smt_run_solver.dir/DependInfo.cmake"
+  "libraries/smt/example/CMakeFiles/example_smt_example1.dir/DependInfo.cmake"
+  "libraries/smt/example/CMakeFiles/example_smt_run_solver.dir/DependInfo.cmake"
+  "libraries/symbolic/CMakeFiles/mcrl2_symbolic.dir/DependInfo.cmake"
+  "libraries/symbolic/CMakeFiles/librarytest_mcrl2_symbolic_ldd_stream_test.dir/DependInfo.cmake"
+  "libraries/symbolic/CMakeFiles/librarytest_mcrl2_symbolic_ordering_test.dir/DependInfo.cmake"
+  "libraries/utilities/CMakeFiles/mcrl2_utilities.dir/DependInfo.cmake"
+  "libraries/utilities/CMakeFiles/librarytest_mcrl2_utilities_big_natural_number_test.dir/DependInfo.cmake"
+  "libraries/utilities/CMakeFiles/librarytest_mcrl2_utilities_bitstream_test.dir/DependInfo.cmake"
+  "libraries/utilities/CMakeFiles/librarytest_mcrl2_utilities_bucket_test.dir/DependInfo.cmake"
+  "libraries/utilities/CMakeFiles/librarytest_mcrl2_utilities_command_line_interface_test.dir/DependInfo.cmake"
+  "libraries/utilities/CMakeFiles/librarytest_mcrl2_utilities_consolidate_test.dir/DependInfo.cmake"
+  "libraries/utilities/CMakeFiles/librarytest_mcrl2_utilities_file_utility_test.dir/DependInfo.cmake"
+  "libraries/utilities/CMakeFiles/librarytest_mcrl2_utilities_fixed_size_cache_test.dir/DependInfo.cmake"
+  "libraries/utilities/CMakeFiles/librarytest_mcrl2_utilities_identifier_generator_test.dir/DependInfo.cmake"
+  "libraries/utilities/CMakeFiles/librarytest_mcrl2_utilities_indexed_set_test.dir/DependInfo.cmake"
+  "libraries/utilities/CMakeFiles/librarytest_mcrl2_utilities_logger_test.dir/DependInfo.cmake"
+  "libraries/utilities/CMakeFiles/librarytest_mcrl2_utilities_logger_test_macro.dir/DependInfo.cmake"
+  "libraries/utilities/CMakeFiles/librarytest_mcrl2_utilities_parse_numbers_test.dir/DependInfo.cmake"
+  "libraries/utilities/CMakeFiles/librarytest_mcrl2_utilities_reachable_nodes_test.dir/DependInfo.cmake"
+  "libraries/utilities/CMakeFiles/librarytest_mcrl2_utilities_sequence_test.dir/DependInfo.cmake"
+  "libraries/utilities/CMakeFiles/librarytest_mcrl2_utilities_swap_test.dir/DependInfo.cmake"
+  "libraries/utilities/CMakeFiles/librarytest_mcrl2_utilities_text_utility_test.dir/DependInfo.cmake"
+  "libraries/utilities/CMakeFiles/librarytest_mcrl2_utilities_unordered_set_test.dir/DependInfo.cmake"
+  "libraries/utilities/CMakeFiles/libraryexample_mcrl2_utilities_cmdline1.dir/DependInfo.cmake"
+  "libraries/utilities/CMakeFiles/libraryexample_mcrl2_utilities_logger.dir/DependInfo.cmake"
+  "libraries/utilities/example/CMakeFiles/example_utilities_cmdline1.dir/DependInfo.cmake"
+  "libraries/utilities/example/CMakeFiles/example_utilities_logger.dir/DependInfo.cmake"
+  "tools/release/besinfo/CMakeFiles/besinfo.dir/DependInfo.cmake"
+  "tools/release/bespp/CMakeFiles/bespp.dir/DependInfo.cmake"
+  "tools/release/lps2lts/CMakeFiles/lps2lts.dir/DependInfo.cmake"
+  "tools/release/lps2pbes/CMakeFiles/lps2pbes.dir/DependInfo.cmake"
+  "tools/release/lpsactionrename/CMakeFiles/lpsactionrename.dir/DependInfo.cmake"
+  "tools/release/lpsbinary/CMakeFiles/lpsbinary.dir/DependInfo.cmake"
+  "tools/release/lpsconfcheck/CMakeFiles/lpsconfcheck.dir/DependInfo.cmake"
+  "tools/release/lpsconstelm/CMakeFiles/lpsconstelm.dir/DependInfo.cmake"
+  "tools/release/lpsinfo/CMakeFiles/lpsinfo.dir/DependInfo.cmake"
+  "tools/release/lpsinvelm/CMakeFiles/lpsinvelm.dir/DependInfo.cmake"
+  "tools/release/lpsparelm/CMakeFiles/lpsparelm.dir/DependInfo.cmake"
+  "tools/release/lpsparunfold/CMakeFiles/lpsparunfold.dir/DependInfo.cmake"
+  "tools/release/lpspp/CMakeFiles/lpspp.dir/DependInfo.cmake"
+  "tools/release/lpsrewr/CMakeFiles/lpsrewr.dir/DependInfo.cmake"
+  "tools/release/lpssim/CMakeFiles/lpssim.dir/DependInfo.cmake"
+  "tools/release/lpsstategraph/CMakeFiles/lpsstategraph.dir/DependInfo.cmake"
+  "tools/release/lpssumelm/CMakeFiles/lpssumelm.dir/DependInfo.cmake"
+  "tools/release/lpssuminst/CMakeFiles/lpssuminst.dir/DependInfo.cmake"
+  "tools/release/lpsuntime/CMakeFiles/lpsuntime.dir/DependInfo.cmake"
+  "tools/release/lts2lps/CMakeFiles/lts2lps.dir/DependInfo.cmake"
+  "tools/release/lts2pbes/CMakeFiles/lts2pbes.dir/DependInfo.cmake"
+  "tools/release/ltscompare/CMakeFiles/ltscompare.dir/DependInfo.cmake"
+  "tools/release/ltsconvert/CMakeFiles/ltsconvert.dir/DependInfo.cmake"
+  "tools/release/ltsinfo/CMakeFiles/ltsinfo.dir/DependInfo.cmake"
+  "tools/release/ltspbisim/CMakeFiles/ltspbisim.dir/DependInfo.cmake"
+  "tools/release/ltspcompare/CMakeFiles/ltspcompare.dir/DependInfo.cmake"
+  "tools/release/mcrl2-gui/CMakeFiles/mcrl2-gui-shared.dir/DependInfo.cmake"
+  "tools/release/mcrl22lps/CMakeFiles/mcrl22lps.dir/DependInfo.cmake"
+  "tools/release/mcrl2i/CMakeFiles/mcrl2i.dir/DependInfo.cmake"
+  "tools/release/pbes2bes/CMakeFiles/pbes2bes.dir/DependInfo.cmake"
+  "tools/release/pbes2bool/CMakeFiles/pbes2bool.dir/DependInfo.cmake"
+  "tools/release/pbesconstelm/CMakeFiles/pbesconstelm.dir/DependInfo.cmake"
+  "tools/release/pbesinfo/CMakeFiles/pbesinfo.dir/DependInfo.cmake"
+  "tools/release/pbesparelm/CMakeFiles/pbesparelm.dir/DependInfo.cmake"
+  "tools/release/pbespgsolve/CMakeFiles/pbespgsolve.dir/DependInfo.cmake"
+  "tools/release/pbespp/CMakeFiles/pbespp.dir/DependInfo.cmake"
+  "tools/release/pbesrewr/CMakeFiles/pbesrewr.dir/DependInfo.cmake"
+  "tools/release/pbessolve/CMakeFiles/pbessolve.dir/DependInfo.cmake"
+  "tools/release/pbesstategraph/CMakeFiles/pbesstategraph.dir/DependInfo.cmake"
+  "tools/release/tracepp/CMakeFiles/tracepp.dir/DependInfo.cmake"
+  "tools/release/txt2lps/CMakeFiles/txt2lps.dir/DependInfo.cmake"
+  "tools/release/txt2pbes/CMakeFiles/txt2pbes.dir/DependInfo.cmake"
+  "tools/release/bessolve/CMakeFiles/bessolve.dir/DependInfo.cmake"
+  "tools/release/txt2bes/CMakeFiles/txt2bes.dir/DependInfo.cmake"
+  "tools/release/pbesinst/CMakeFiles/pbesinst.dir/DependInfo.cmake"
+  "tools/release/lpsbisim2pbes/CMakeFiles/lpsbisim2pbes.dir/DependInfo.cmake"
+  "tools/release/lpsreach/CMakeFiles/lpsreach.dir/DependInfo.cmake"
+  "tools/release/pbessolvesymbolic/CMakeFiles/pbessolvesymbolic.dir/DependInfo.cmake"
+  "tools/developer/confcheck/CMakeFiles/confcheck.dir/DependInfo.cmake"
+  "tools/developer/lps2ltsdeprecated/CMakeFiles/lps2ltsdeprecated.dir/DependInfo.cmake"
+  "tools/developer/lpstransform/CMakeFiles/lpstransform.dir/DependInfo.cmake"
+  "tools/developer/mcrl2rewrite/CMakeFiles/mcrl2rewrite.dir/DependInfo.cmake"
+  "tools/developer/mcrl2transform/CMakeFiles/mcrl2transform.dir/DependInfo.cmake"
+  "tools/developer/mcrl2typecheck/CMakeFiles/mcrl2typecheck.dir/DependInfo.cmake"
+  "tools/developer/pbes2bdd/CMakeFiles/pbes2bdd.dir/DependInfo.cmake"
+  "tools/developer/pbestransform/CMakeFiles/pbestransform.dir/DependInfo.cmake"
+  "tools/developer/reduce_pbes/CMakeFiles/reduce_pbes.dir/DependInfo.cmake"
+  "tools/developer/reduce_process/CMakeFiles/reduce_process.dir/DependInfo.cmake"
+  "tools/developer/ltsconvertsymbolic/CMakeFiles/ltsconvertsymbolic.dir/DependInfo.cmake"
+  "tools/developer/pbesbddsolve/CMakeFiles/pbesbddsolve.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_compact_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("3rd-party/dparser")
+subdirs("3rd-party/sylvan/src")
+subdirs("libraries")
+subdirs("tools")
+subdirs("tests")
+subdirs("build/packaging")
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/build/packaging
+# Build directory: /root/repo/_compact_build/build/packaging
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
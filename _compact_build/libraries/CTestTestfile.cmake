@@ -0,0 +1,20 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libraries
+# Build directory: /root/repo/_compact_build/libraries
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("atermpp")
+subdirs("bes")
+subdirs("core")
+subdirs("data")
+subdirs("gui")
+subdirs("lps")
+subdirs("lts")
+subdirs("modal_formula")
+subdirs("pbes")
+subdirs("pg")
+subdirs("process")
+subdirs("smt")
+subdirs("symbolic")
+subdirs("utilities")
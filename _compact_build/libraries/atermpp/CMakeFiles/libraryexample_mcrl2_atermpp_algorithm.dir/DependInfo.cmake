@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libraries/atermpp/example/algorithm.cpp" "libraries/atermpp/CMakeFiles/libraryexample_mcrl2_atermpp_algorithm.dir/example/algorithm.cpp.o" "gcc" "libraries/atermpp/CMakeFiles/libraryexample_mcrl2_atermpp_algorithm.dir/example/algorithm.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_compact_build/libraries/atermpp/CMakeFiles/mcrl2_atermpp.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/libraries/utilities/CMakeFiles/mcrl2_utilities.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../stage/bin/libraryexample/libraryexample_mcrl2_atermpp_algorithm"
+  "../../stage/bin/libraryexample/libraryexample_mcrl2_atermpp_algorithm.pdb"
+  "CMakeFiles/libraryexample_mcrl2_atermpp_algorithm.dir/example/algorithm.cpp.o"
+  "CMakeFiles/libraryexample_mcrl2_atermpp_algorithm.dir/example/algorithm.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libraryexample_mcrl2_atermpp_algorithm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
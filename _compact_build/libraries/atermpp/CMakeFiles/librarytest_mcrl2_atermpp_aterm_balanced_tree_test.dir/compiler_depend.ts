@@ -0,0 +1,2 @@
+# CMAKE generated file: DO NOT EDIT!
+# Timestamp file for compiler generated dependencies management for librarytest_mcrl2_atermpp_aterm_balanced_tree_test.
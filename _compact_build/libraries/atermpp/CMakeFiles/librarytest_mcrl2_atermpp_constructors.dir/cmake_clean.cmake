@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../stage/bin/librarytest/librarytest_mcrl2_atermpp_constructors"
+  "../../stage/bin/librarytest/librarytest_mcrl2_atermpp_constructors.pdb"
+  "CMakeFiles/librarytest_mcrl2_atermpp_constructors.dir/test/constructors.cpp.o"
+  "CMakeFiles/librarytest_mcrl2_atermpp_constructors.dir/test/constructors.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/librarytest_mcrl2_atermpp_constructors.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
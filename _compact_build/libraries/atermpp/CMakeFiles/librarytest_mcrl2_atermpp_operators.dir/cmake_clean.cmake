@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../stage/bin/librarytest/librarytest_mcrl2_atermpp_operators"
+  "../../stage/bin/librarytest/librarytest_mcrl2_atermpp_operators.pdb"
+  "CMakeFiles/librarytest_mcrl2_atermpp_operators.dir/test/operators.cpp.o"
+  "CMakeFiles/librarytest_mcrl2_atermpp_operators.dir/test/operators.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/librarytest_mcrl2_atermpp_operators.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
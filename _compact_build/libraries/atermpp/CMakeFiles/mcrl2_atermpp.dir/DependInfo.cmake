@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libraries/atermpp/source/aterm_implementation.cpp" "libraries/atermpp/CMakeFiles/mcrl2_atermpp.dir/source/aterm_implementation.cpp.o" "gcc" "libraries/atermpp/CMakeFiles/mcrl2_atermpp.dir/source/aterm_implementation.cpp.o.d"
+  "/root/repo/libraries/atermpp/source/aterm_io_binary.cpp" "libraries/atermpp/CMakeFiles/mcrl2_atermpp.dir/source/aterm_io_binary.cpp.o" "gcc" "libraries/atermpp/CMakeFiles/mcrl2_atermpp.dir/source/aterm_io_binary.cpp.o.d"
+  "/root/repo/libraries/atermpp/source/aterm_io_text.cpp" "libraries/atermpp/CMakeFiles/mcrl2_atermpp.dir/source/aterm_io_text.cpp.o" "gcc" "libraries/atermpp/CMakeFiles/mcrl2_atermpp.dir/source/aterm_io_text.cpp.o.d"
+  "/root/repo/libraries/atermpp/source/function_symbol.cpp" "libraries/atermpp/CMakeFiles/mcrl2_atermpp.dir/source/function_symbol.cpp.o" "gcc" "libraries/atermpp/CMakeFiles/mcrl2_atermpp.dir/source/function_symbol.cpp.o.d"
+  "/root/repo/libraries/atermpp/source/function_symbol_pool.cpp" "libraries/atermpp/CMakeFiles/mcrl2_atermpp.dir/source/function_symbol_pool.cpp.o" "gcc" "libraries/atermpp/CMakeFiles/mcrl2_atermpp.dir/source/function_symbol_pool.cpp.o.d"
+  "/root/repo/libraries/atermpp/source/term_arena.cpp" "libraries/atermpp/CMakeFiles/mcrl2_atermpp.dir/source/term_arena.cpp.o" "gcc" "libraries/atermpp/CMakeFiles/mcrl2_atermpp.dir/source/term_arena.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_compact_build/libraries/utilities/CMakeFiles/mcrl2_utilities.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
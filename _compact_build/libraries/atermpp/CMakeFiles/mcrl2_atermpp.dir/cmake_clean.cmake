@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "../../stage/lib/libmcrl2_atermpp.pdb"
+  "../../stage/lib/libmcrl2_atermpp.so"
+  "CMakeFiles/mcrl2_atermpp.dir/source/aterm_implementation.cpp.o"
+  "CMakeFiles/mcrl2_atermpp.dir/source/aterm_implementation.cpp.o.d"
+  "CMakeFiles/mcrl2_atermpp.dir/source/aterm_io_binary.cpp.o"
+  "CMakeFiles/mcrl2_atermpp.dir/source/aterm_io_binary.cpp.o.d"
+  "CMakeFiles/mcrl2_atermpp.dir/source/aterm_io_text.cpp.o"
+  "CMakeFiles/mcrl2_atermpp.dir/source/aterm_io_text.cpp.o.d"
+  "CMakeFiles/mcrl2_atermpp.dir/source/function_symbol.cpp.o"
+  "CMakeFiles/mcrl2_atermpp.dir/source/function_symbol.cpp.o.d"
+  "CMakeFiles/mcrl2_atermpp.dir/source/function_symbol_pool.cpp.o"
+  "CMakeFiles/mcrl2_atermpp.dir/source/function_symbol_pool.cpp.o.d"
+  "CMakeFiles/mcrl2_atermpp.dir/source/term_arena.cpp.o"
+  "CMakeFiles/mcrl2_atermpp.dir/source/term_arena.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mcrl2_atermpp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,35 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libraries/atermpp
+# Build directory: /root/repo/_compact_build/libraries/atermpp
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(librarytest_mcrl2_atermpp_algorithm_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_atermpp_algorithm_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_atermpp_algorithm_test")
+set_tests_properties(librarytest_mcrl2_atermpp_algorithm_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/atermpp/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/atermpp/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_atermpp_aterm_balanced_tree_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_atermpp_aterm_balanced_tree_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_atermpp_aterm_balanced_tree_test")
+set_tests_properties(librarytest_mcrl2_atermpp_aterm_balanced_tree_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/atermpp/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/atermpp/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_atermpp_aterm_io_binary_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_atermpp_aterm_io_binary_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_atermpp_aterm_io_binary_test")
+set_tests_properties(librarytest_mcrl2_atermpp_aterm_io_binary_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/atermpp/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/atermpp/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_atermpp_aterm_list_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_atermpp_aterm_list_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_atermpp_aterm_list_test")
+set_tests_properties(librarytest_mcrl2_atermpp_aterm_list_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/atermpp/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/atermpp/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_atermpp_aterm_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_atermpp_aterm_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_atermpp_aterm_test")
+set_tests_properties(librarytest_mcrl2_atermpp_aterm_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/atermpp/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/atermpp/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_atermpp_constructors "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_atermpp_constructors" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_atermpp_constructors")
+set_tests_properties(librarytest_mcrl2_atermpp_constructors PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/atermpp/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/atermpp/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_atermpp_down_cast_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_atermpp_down_cast_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_atermpp_down_cast_test")
+set_tests_properties(librarytest_mcrl2_atermpp_down_cast_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/atermpp/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/atermpp/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_atermpp_function_symbol_generator_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_atermpp_function_symbol_generator_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_atermpp_function_symbol_generator_test")
+set_tests_properties(librarytest_mcrl2_atermpp_function_symbol_generator_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/atermpp/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/atermpp/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_atermpp_function_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_atermpp_function_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_atermpp_function_test")
+set_tests_properties(librarytest_mcrl2_atermpp_function_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/atermpp/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/atermpp/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_atermpp_hooks_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_atermpp_hooks_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_atermpp_hooks_test")
+set_tests_properties(librarytest_mcrl2_atermpp_hooks_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/atermpp/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/atermpp/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_atermpp_operators "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_atermpp_operators" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_atermpp_operators")
+set_tests_properties(librarytest_mcrl2_atermpp_operators PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/atermpp/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/atermpp/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_atermpp_parallel_container_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_atermpp_parallel_container_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_atermpp_parallel_container_test")
+set_tests_properties(librarytest_mcrl2_atermpp_parallel_container_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/atermpp/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/atermpp/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_atermpp_replace_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_atermpp_replace_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_atermpp_replace_test")
+set_tests_properties(librarytest_mcrl2_atermpp_replace_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/atermpp/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/atermpp/CMakeLists.txt;0;")
+add_test(libraryexample_mcrl2_atermpp_algorithm "/usr/bin/cmake" "--build" "/root/repo/_compact_build" "--target" "libraryexample_mcrl2_atermpp_algorithm")
+set_tests_properties(libraryexample_mcrl2_atermpp_algorithm PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "libraryexample" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;42;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/atermpp/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/atermpp/CMakeLists.txt;0;")
+subdirs("example")
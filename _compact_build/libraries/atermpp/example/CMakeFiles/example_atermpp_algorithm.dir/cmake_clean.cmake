@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/example_atermpp_algorithm"
+  "../../../stage/bin/example_atermpp_algorithm.pdb"
+  "CMakeFiles/example_atermpp_algorithm.dir/algorithm.cpp.o"
+  "CMakeFiles/example_atermpp_algorithm.dir/algorithm.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_atermpp_algorithm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
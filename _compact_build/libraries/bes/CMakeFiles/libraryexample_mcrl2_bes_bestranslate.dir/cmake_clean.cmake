@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../stage/bin/libraryexample/libraryexample_mcrl2_bes_bestranslate"
+  "../../stage/bin/libraryexample/libraryexample_mcrl2_bes_bestranslate.pdb"
+  "CMakeFiles/libraryexample_mcrl2_bes_bestranslate.dir/example/bestranslate.cpp.o"
+  "CMakeFiles/libraryexample_mcrl2_bes_bestranslate.dir/example/bestranslate.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libraryexample_mcrl2_bes_bestranslate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
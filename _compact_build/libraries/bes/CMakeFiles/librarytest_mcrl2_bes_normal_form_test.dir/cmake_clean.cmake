@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../stage/bin/librarytest/librarytest_mcrl2_bes_normal_form_test"
+  "../../stage/bin/librarytest/librarytest_mcrl2_bes_normal_form_test.pdb"
+  "CMakeFiles/librarytest_mcrl2_bes_normal_form_test.dir/test/normal_form_test.cpp.o"
+  "CMakeFiles/librarytest_mcrl2_bes_normal_form_test.dir/test/normal_form_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/librarytest_mcrl2_bes_normal_form_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
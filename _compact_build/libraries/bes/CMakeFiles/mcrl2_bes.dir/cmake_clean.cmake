@@ -0,0 +1,18 @@
+file(REMOVE_RECURSE
+  "../../stage/lib/libmcrl2_bes.pdb"
+  "../../stage/lib/libmcrl2_bes.so"
+  "CMakeFiles/mcrl2_bes.dir/source/bes.cpp.o"
+  "CMakeFiles/mcrl2_bes.dir/source/bes.cpp.o.d"
+  "CMakeFiles/mcrl2_bes.dir/source/io.cpp.o"
+  "CMakeFiles/mcrl2_bes.dir/source/io.cpp.o.d"
+  "CMakeFiles/mcrl2_bes.dir/source/pg_syntax.c.o"
+  "CMakeFiles/mcrl2_bes.dir/source/pg_syntax.c.o.d"
+  "CMakeFiles/mcrl2_bes.dir/source/pgsolver.cpp.o"
+  "CMakeFiles/mcrl2_bes.dir/source/pgsolver.cpp.o.d"
+  "source/pg_syntax.c"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/mcrl2_bes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
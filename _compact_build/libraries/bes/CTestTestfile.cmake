@@ -0,0 +1,29 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libraries/bes
+# Build directory: /root/repo/_compact_build/libraries/bes
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(librarytest_mcrl2_bes_bdd_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_bes_bdd_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_bes_bdd_test")
+set_tests_properties(librarytest_mcrl2_bes_bdd_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/bes/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/bes/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_bes_bes_io_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_bes_bes_io_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_bes_bes_io_test")
+set_tests_properties(librarytest_mcrl2_bes_bes_io_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/bes/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/bes/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_bes_bes_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_bes_bes_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_bes_bes_test")
+set_tests_properties(librarytest_mcrl2_bes_bes_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/bes/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/bes/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_bes_boolean_expression_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_bes_boolean_expression_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_bes_boolean_expression_test")
+set_tests_properties(librarytest_mcrl2_bes_boolean_expression_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/bes/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/bes/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_bes_find_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_bes_find_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_bes_find_test")
+set_tests_properties(librarytest_mcrl2_bes_find_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/bes/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/bes/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_bes_gauss_elimination_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_bes_gauss_elimination_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_bes_gauss_elimination_test")
+set_tests_properties(librarytest_mcrl2_bes_gauss_elimination_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/bes/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/bes/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_bes_normal_form_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_bes_normal_form_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_bes_normal_form_test")
+set_tests_properties(librarytest_mcrl2_bes_normal_form_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/bes/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/bes/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_bes_pg_parse_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_bes_pg_parse_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_bes_pg_parse_test")
+set_tests_properties(librarytest_mcrl2_bes_pg_parse_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/bes/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/bes/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_bes_solve_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_bes_solve_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_bes_solve_test")
+set_tests_properties(librarytest_mcrl2_bes_solve_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/bes/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/bes/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_bes_traverser_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_bes_traverser_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_bes_traverser_test")
+set_tests_properties(librarytest_mcrl2_bes_traverser_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/bes/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/bes/CMakeLists.txt;0;")
+add_test(libraryexample_mcrl2_bes_bestranslate "/usr/bin/cmake" "--build" "/root/repo/_compact_build" "--target" "libraryexample_mcrl2_bes_bestranslate")
+set_tests_properties(libraryexample_mcrl2_bes_bestranslate PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "libraryexample" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;42;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/bes/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/bes/CMakeLists.txt;0;")
+subdirs("example")
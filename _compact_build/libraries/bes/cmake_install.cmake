@@ -0,0 +1,213 @@
+# Install script for directory: /root/repo/libraries/bes
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Release")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Libraries" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libmcrl2_bes.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libmcrl2_bes.so")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libmcrl2_bes.so"
+         RPATH "$ORIGIN/../lib")
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES "/root/repo/_compact_build/stage/lib/libmcrl2_bes.so")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libmcrl2_bes.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libmcrl2_bes.so")
+    file(RPATH_CHANGE
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libmcrl2_bes.so"
+         OLD_RPATH "/root/repo/_compact_build/stage/lib:"
+         NEW_RPATH "$ORIGIN/../lib")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libmcrl2_bes.so")
+    endif()
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Libraries" OR NOT CMAKE_INSTALL_COMPONENT)
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mcrl2/bes" TYPE FILE FILES "/root/repo/libraries/bes/include/mcrl2/bes/bdd_expression.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mcrl2/bes" TYPE FILE FILES "/root/repo/libraries/bes/include/mcrl2/bes/bdd_operations.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mcrl2/bes" TYPE FILE FILES "/root/repo/libraries/bes/include/mcrl2/bes/bes2pbes.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mcrl2/bes" TYPE FILE FILES "/root/repo/libraries/bes/include/mcrl2/bes/boolean_equation.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mcrl2/bes" TYPE FILE FILES "/root/repo/libraries/bes/include/mcrl2/bes/boolean_equation_system.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mcrl2/bes" TYPE FILE FILES "/root/repo/libraries/bes/include/mcrl2/bes/boolean_expression.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mcrl2/bes" TYPE FILE FILES "/root/repo/libraries/bes/include/mcrl2/bes/builder.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mcrl2/bes" TYPE FILE FILES "/root/repo/libraries/bes/include/mcrl2/bes/consistent_correlation.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mcrl2/bes/detail" TYPE FILE FILES "/root/repo/libraries/bes/include/mcrl2/bes/detail/bes_algorithm.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mcrl2/bes/detail" TYPE FILE FILES "/root/repo/libraries/bes/include/mcrl2/bes/detail/bes_property_map.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mcrl2/bes/detail" TYPE FILE FILES "/root/repo/libraries/bes/include/mcrl2/bes/detail/boolean_expression2pbes_expression_traverser.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mcrl2/bes/detail" TYPE FILE FILES "/root/repo/libraries/bes/include/mcrl2/bes/detail/io.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mcrl2/bes/detail" TYPE FILE FILES "/root/repo/libraries/bes/include/mcrl2/bes/detail/pbes_expression2boolean_expression_traverser.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mcrl2/bes" TYPE FILE FILES "/root/repo/libraries/bes/include/mcrl2/bes/find.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mcrl2/bes" TYPE FILE FILES "/root/repo/libraries/bes/include/mcrl2/bes/gauss_elimination.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mcrl2/bes" TYPE FILE FILES "/root/repo/libraries/bes/include/mcrl2/bes/io.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mcrl2/bes" TYPE FILE FILES "/root/repo/libraries/bes/include/mcrl2/bes/join.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mcrl2/bes" TYPE FILE FILES "/root/repo/libraries/bes/include/mcrl2/bes/justification.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mcrl2/bes" TYPE FILE FILES "/root/repo/libraries/bes/include/mcrl2/bes/local_fixpoints.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mcrl2/bes" TYPE FILE FILES "/root/repo/libraries/bes/include/mcrl2/bes/normal_forms.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mcrl2/bes" TYPE FILE FILES "/root/repo/libraries/bes/include/mcrl2/bes/parse.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mcrl2/bes" TYPE FILE FILES "/root/repo/libraries/bes/include/mcrl2/bes/pbes_input_output_tool.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mcrl2/bes" TYPE FILE FILES "/root/repo/libraries/bes/include/mcrl2/bes/pbes_input_tool.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mcrl2/bes" TYPE FILE FILES "/root/repo/libraries/bes/include/mcrl2/bes/pbes_output_tool.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mcrl2/bes" TYPE FILE FILES "/root/repo/libraries/bes/include/mcrl2/bes/pbes_rewriter_tool.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mcrl2/bes" TYPE FILE FILES "/root/repo/libraries/bes/include/mcrl2/bes/pbesinst_conversion.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mcrl2/bes" TYPE FILE FILES "/root/repo/libraries/bes/include/mcrl2/bes/pg_parse.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mcrl2/bes" TYPE FILE FILES "/root/repo/libraries/bes/include/mcrl2/bes/print.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mcrl2/bes" TYPE FILE FILES "/root/repo/libraries/bes/include/mcrl2/bes/remove_level.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mcrl2/bes" TYPE FILE FILES "/root/repo/libraries/bes/include/mcrl2/bes/replace.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mcrl2/bes" TYPE FILE FILES "/root/repo/libraries/bes/include/mcrl2/bes/simplify_rewriter.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mcrl2/bes" TYPE FILE FILES "/root/repo/libraries/bes/include/mcrl2/bes/small_progress_measures.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mcrl2/bes" TYPE FILE FILES "/root/repo/libraries/bes/include/mcrl2/bes/solution_strategy.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mcrl2/bes" TYPE FILE FILES "/root/repo/libraries/bes/include/mcrl2/bes/to_bdd.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Headers" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mcrl2/bes" TYPE FILE FILES "/root/repo/libraries/bes/include/mcrl2/bes/traverser.h")
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for each subdirectory.
+  include("/root/repo/_compact_build/libraries/bes/example/cmake_install.cmake")
+
+endif()
+
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/example_bes_bestranslate"
+  "../../../stage/bin/example_bes_bestranslate.pdb"
+  "CMakeFiles/example_bes_bestranslate.dir/bestranslate.cpp.o"
+  "CMakeFiles/example_bes_bestranslate.dir/bestranslate.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_bes_bestranslate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
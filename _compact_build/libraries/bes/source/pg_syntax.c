@@ -0,0 +1,527 @@
+/*
+  Generated by Make DParser Version 1.26.4ab9d43046e5d22ffb365ec5f5184a7cfee09b30
+  Available at https://github.com/jplevyak/dparser
+*/
+
+#line 7 "/root/repo/_compact_build/libraries/bes/source/pg_syntax.c"
+#include "dparse.h"
+
+D_Reduction d_reduction_0_pg = {1, 0, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_1_pg = {3, 1, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_2_pg = {1, 2, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_3_pg = {0, 2, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_4_pg = {3, 3, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_5_pg = {1, 4, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_6_pg = {0, 4, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_7_pg = {3, 5, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_8_pg = {1, 6, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_9_pg = {2, 7, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_10_pg = {1, 7, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_11_pg = {6, 8, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_12_pg = {1, 9, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_13_pg = {0, 9, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_14_pg = {1, 10, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_15_pg = {1, 11, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_16_pg = {1, 12, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_17_pg = {2, 13, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_18_pg = {2, 14, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_19_pg = {0, 14, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_20_pg = {2, 15, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_21_pg = {1, 16, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_22_pg = {1, 17, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_23_pg = {1, 18, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Shift d_shift_0_pg = {19, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_1_pg = {20, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_2_pg = {21, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_3_pg = {22, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_4_pg = {23, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_5_pg = {24, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_6_pg = {25, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_7_pg = {26, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_8_pg = {27, 1, 0, 0, -1, 0, NULL};
+D_Shift d_shift_9_pg = {28, 1, 0, 0, 0, 0, NULL};
+
+D_Shift * d_accepts_diff_0_0_pg[] = {0};
+D_Shift ** d_accepts_diff_0_pg[] = {
+d_accepts_diff_0_0_pg
+};
+
+unsigned char d_scanner_0_0_0_pg[SCANNER_BLOCK_SIZE] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_0_1_pg[SCANNER_BLOCK_SIZE] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_1_1_pg[SCANNER_BLOCK_SIZE] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_2_1_pg[SCANNER_BLOCK_SIZE] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_3_1_pg[SCANNER_BLOCK_SIZE] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_4_1_pg[SCANNER_BLOCK_SIZE] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_5_1_pg[SCANNER_BLOCK_SIZE] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 
+};
+
+D_Shift * d_shift_0_6_pg[] = {&d_shift_0_pg,NULL};
+
+D_Shift * d_accepts_diff_2_0_pg[] = {0};
+D_Shift ** d_accepts_diff_2_pg[] = {
+d_accepts_diff_2_0_pg
+};
+
+unsigned char d_scanner_2_0_0_pg[SCANNER_BLOCK_SIZE] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 
+};
+
+D_Shift * d_shift_2_1_pg[] = {&d_shift_8_pg,NULL};
+
+unsigned char d_scanner_2_2_0_pg[SCANNER_BLOCK_SIZE] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 
+};
+
+D_Shift * d_accepts_diff_6_0_pg[] = {0};
+D_Shift ** d_accepts_diff_6_pg[] = {
+d_accepts_diff_6_0_pg
+};
+
+unsigned char d_scanner_6_0_0_pg[SCANNER_BLOCK_SIZE] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+D_Shift * d_shift_6_1_pg[] = {&d_shift_5_pg,NULL};
+
+D_Shift * d_accepts_diff_8_0_pg[] = {0};
+D_Shift ** d_accepts_diff_8_pg[] = {
+d_accepts_diff_8_0_pg
+};
+
+unsigned char d_scanner_8_0_0_pg[SCANNER_BLOCK_SIZE] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_8_1_0_pg[SCANNER_BLOCK_SIZE] = {
+0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+};
+
+unsigned char d_scanner_8_1_1_pg[SCANNER_BLOCK_SIZE] = {
+2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+};
+
+D_Shift * d_shift_8_2_pg[] = {&d_shift_7_pg,NULL};
+
+D_Shift * d_accepts_diff_10_0_pg[] = {0};
+D_Shift ** d_accepts_diff_10_pg[] = {
+d_accepts_diff_10_0_pg
+};
+
+unsigned char d_scanner_10_0_0_pg[SCANNER_BLOCK_SIZE] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 2, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+2, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+D_Shift * d_shift_10_0_pg[] = {&d_shift_9_pg,NULL};
+
+unsigned char d_scanner_10_2_0_pg[SCANNER_BLOCK_SIZE] = {
+0, 3, 3, 3, 3, 3, 3, 3, 3, 4, 2, 3, 3, 2, 3, 3, 
+3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 
+4, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 
+3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 
+};
+
+unsigned char d_scanner_10_2_1_pg[SCANNER_BLOCK_SIZE] = {
+3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 
+3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 
+3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 
+3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 
+};
+
+D_Shift * d_accepts_diff_13_0_pg[] = {0};
+D_Shift ** d_accepts_diff_13_pg[] = {
+d_accepts_diff_13_0_pg
+};
+
+unsigned char d_scanner_13_0_1_pg[SCANNER_BLOCK_SIZE] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_13_1_1_pg[SCANNER_BLOCK_SIZE] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_13_2_1_pg[SCANNER_BLOCK_SIZE] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_13_3_1_pg[SCANNER_BLOCK_SIZE] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+D_Shift * d_shift_13_5_pg[] = {&d_shift_2_pg,NULL};
+
+D_Shift * d_accepts_diff_35_0_pg[] = {0};
+D_Shift ** d_accepts_diff_35_pg[] = {
+d_accepts_diff_35_0_pg
+};
+
+unsigned char d_scanner_35_0_0_pg[SCANNER_BLOCK_SIZE] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 
+};
+
+D_Shift * d_shift_35_1_pg[] = {&d_shift_1_pg,NULL};
+
+D_Shift * d_accepts_diff_41_0_pg[] = {0};
+D_Shift ** d_accepts_diff_41_pg[] = {
+d_accepts_diff_41_0_pg
+};
+
+unsigned char d_scanner_41_0_0_pg[SCANNER_BLOCK_SIZE] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+D_Shift * d_shift_41_1_pg[] = {&d_shift_6_pg,NULL};
+
+SB_uint8 d_scanner_0_pg[7] = {
+{NULL, {d_scanner_0_0_0_pg, d_scanner_0_0_1_pg
+ , d_scanner_0_0_0_pg, d_scanner_0_0_0_pg}},
+{NULL, {d_scanner_0_0_0_pg, d_scanner_0_1_1_pg
+ , d_scanner_0_0_0_pg, d_scanner_0_0_0_pg}},
+{NULL, {d_scanner_0_0_0_pg, d_scanner_0_2_1_pg
+ , d_scanner_0_0_0_pg, d_scanner_0_0_0_pg}},
+{NULL, {d_scanner_0_0_0_pg, d_scanner_0_3_1_pg
+ , d_scanner_0_0_0_pg, d_scanner_0_0_0_pg}},
+{NULL, {d_scanner_0_0_0_pg, d_scanner_0_4_1_pg
+ , d_scanner_0_0_0_pg, d_scanner_0_0_0_pg}},
+{NULL, {d_scanner_0_0_0_pg, d_scanner_0_5_1_pg
+ , d_scanner_0_0_0_pg, d_scanner_0_0_0_pg}},
+{d_shift_0_6_pg, {d_scanner_0_0_0_pg, d_scanner_0_0_0_pg
+ , d_scanner_0_0_0_pg, d_scanner_0_0_0_pg}}
+};
+
+SB_uint8 d_scanner_2_pg[3] = {
+{NULL, {d_scanner_2_0_0_pg, d_scanner_0_0_0_pg
+ , d_scanner_0_0_0_pg, d_scanner_0_0_0_pg}},
+{d_shift_2_1_pg, {d_scanner_0_0_0_pg, d_scanner_0_0_0_pg
+ , d_scanner_0_0_0_pg, d_scanner_0_0_0_pg}},
+{d_shift_2_1_pg, {d_scanner_2_2_0_pg, d_scanner_0_0_0_pg
+ , d_scanner_0_0_0_pg, d_scanner_0_0_0_pg}}
+};
+
+SB_uint8 d_scanner_6_pg[2] = {
+{NULL, {d_scanner_6_0_0_pg, d_scanner_0_0_0_pg
+ , d_scanner_0_0_0_pg, d_scanner_0_0_0_pg}},
+{d_shift_6_1_pg, {d_scanner_0_0_0_pg, d_scanner_0_0_0_pg
+ , d_scanner_0_0_0_pg, d_scanner_0_0_0_pg}}
+};
+
+SB_uint8 d_scanner_8_pg[3] = {
+{NULL, {d_scanner_8_0_0_pg, d_scanner_0_0_0_pg
+ , d_scanner_0_0_0_pg, d_scanner_0_0_0_pg}},
+{NULL, {d_scanner_8_1_0_pg, d_scanner_8_1_1_pg
+ , d_scanner_8_1_1_pg, d_scanner_8_1_1_pg}},
+{d_shift_8_2_pg, {d_scanner_0_0_0_pg, d_scanner_0_0_0_pg
+ , d_scanner_0_0_0_pg, d_scanner_0_0_0_pg}}
+};
+
+SB_uint8 d_scanner_10_pg[4] = {
+{d_shift_10_0_pg, {d_scanner_10_0_0_pg, d_scanner_0_0_0_pg
+ , d_scanner_0_0_0_pg, d_scanner_0_0_0_pg}},
+{d_shift_10_0_pg, {d_scanner_10_0_0_pg, d_scanner_0_0_0_pg
+ , d_scanner_0_0_0_pg, d_scanner_0_0_0_pg}},
+{d_shift_10_0_pg, {d_scanner_10_2_0_pg, d_scanner_10_2_1_pg
+ , d_scanner_10_2_1_pg, d_scanner_10_2_1_pg}},
+{d_shift_10_0_pg, {d_scanner_10_2_0_pg, d_scanner_10_2_1_pg
+ , d_scanner_10_2_1_pg, d_scanner_10_2_1_pg}}
+};
+
+SB_uint8 d_scanner_13_pg[6] = {
+{NULL, {d_scanner_0_0_0_pg, d_scanner_13_0_1_pg
+ , d_scanner_0_0_0_pg, d_scanner_0_0_0_pg}},
+{NULL, {d_scanner_0_0_0_pg, d_scanner_13_1_1_pg
+ , d_scanner_0_0_0_pg, d_scanner_0_0_0_pg}},
+{NULL, {d_scanner_0_0_0_pg, d_scanner_13_2_1_pg
+ , d_scanner_0_0_0_pg, d_scanner_0_0_0_pg}},
+{NULL, {d_scanner_0_0_0_pg, d_scanner_13_3_1_pg
+ , d_scanner_0_0_0_pg, d_scanner_0_0_0_pg}},
+{NULL, {d_scanner_0_0_0_pg, d_scanner_0_4_1_pg
+ , d_scanner_0_0_0_pg, d_scanner_0_0_0_pg}},
+{d_shift_13_5_pg, {d_scanner_0_0_0_pg, d_scanner_0_0_0_pg
+ , d_scanner_0_0_0_pg, d_scanner_0_0_0_pg}}
+};
+
+SB_uint8 d_scanner_35_pg[2] = {
+{NULL, {d_scanner_35_0_0_pg, d_scanner_0_0_0_pg
+ , d_scanner_0_0_0_pg, d_scanner_0_0_0_pg}},
+{d_shift_35_1_pg, {d_scanner_0_0_0_pg, d_scanner_0_0_0_pg
+ , d_scanner_0_0_0_pg, d_scanner_0_0_0_pg}}
+};
+
+SB_uint8 d_scanner_41_pg[2] = {
+{NULL, {d_scanner_41_0_0_pg, d_scanner_0_0_0_pg
+ , d_scanner_0_0_0_pg, d_scanner_0_0_0_pg}},
+{d_shift_41_1_pg, {d_scanner_0_0_0_pg, d_scanner_0_0_0_pg
+ , d_scanner_0_0_0_pg, d_scanner_0_0_0_pg}}
+};
+
+unsigned char d_goto_valid_0_pg[] = {
+0x32,0x0,0x8,0x0};
+D_Reduction * d_reductions_0_pg[] = {&d_reduction_6_pg};
+unsigned char d_goto_valid_1_pg[] = {
+0x32,0x0,0x8,0x0};
+D_Reduction * d_reductions_1_pg[] = {&d_reduction_6_pg};
+unsigned char d_goto_valid_2_pg[] = {
+0xc0,0x5,0x2,0x8};
+unsigned char d_goto_valid_3_pg[] = {
+0x0,0x5,0x2,0x8};
+unsigned char d_goto_valid_4_pg[] = {
+0x0,0x4,0x2,0x8};
+unsigned char d_goto_valid_5_pg[] = {
+0x0,0x8,0x2,0x8};
+unsigned char d_goto_valid_6_pg[] = {
+0x0,0x10,0x0,0x1};
+unsigned char d_goto_valid_7_pg[] = {
+0x0,0x24,0x2,0x8};
+unsigned char d_goto_valid_8_pg[] = {
+0x0,0x0,0x1,0x4};
+unsigned char d_goto_valid_9_pg[] = {
+0x0,0x0,0x2,0x8};
+unsigned char d_goto_valid_10_pg[] = {
+0x0,0x0,0x4,0x10};
+unsigned char d_goto_valid_11_pg[] = {
+0x0,0x4,0x2,0x8};
+unsigned char d_goto_valid_13_pg[] = {
+0xc,0x0,0x20,0x0};
+D_Reduction * d_reductions_13_pg[] = {&d_reduction_3_pg};
+D_Reduction * d_reductions_14_pg[] = {&d_reduction_5_pg};
+D_Reduction * d_reductions_16_pg[] = {&d_reduction_22_pg};
+unsigned char d_goto_valid_18_pg[] = {
+0x0,0x5,0x2,0x8};
+D_Reduction * d_reductions_18_pg[] = {&d_reduction_8_pg};
+D_Reduction * d_reductions_19_pg[] = {&d_reduction_10_pg};
+unsigned char d_goto_valid_20_pg[] = {
+0x0,0x8,0x2,0x8};
+D_Reduction * d_reductions_21_pg[] = {&d_reduction_14_pg};
+D_Reduction * d_reductions_25_pg[] = {&d_reduction_15_pg};
+D_Reduction * d_reductions_26_pg[] = {&d_reduction_16_pg};
+unsigned char d_goto_valid_28_pg[] = {
+0x0,0x40,0x0,0x0};
+D_Reduction * d_reductions_28_pg[] = {&d_reduction_19_pg};
+D_RightEpsilonHint d_right_epsilon_hints_28_pg[] = {{0, 41, &d_reduction_17_pg}};
+D_Reduction * d_reductions_30_pg[] = {&d_reduction_21_pg};
+D_Reduction * d_reductions_33_pg[] = {&d_reduction_23_pg};
+unsigned char d_goto_valid_35_pg[] = {
+0x0,0x0,0x10,0x0};
+unsigned char d_goto_valid_36_pg[] = {
+0x0,0x4,0x2,0x8};
+unsigned char d_goto_valid_37_pg[] = {
+0xc0,0x5,0x2,0x8};
+D_Reduction * d_reductions_38_pg[] = {&d_reduction_2_pg};
+D_Reduction * d_reductions_39_pg[] = {&d_reduction_9_pg};
+unsigned char d_goto_valid_40_pg[] = {
+0x0,0x10,0x0,0x1};
+unsigned char d_goto_valid_41_pg[] = {
+0x0,0x80,0x0,0x2};
+D_Reduction * d_reductions_41_pg[] = {&d_reduction_17_pg};
+D_Reduction * d_reductions_42_pg[] = {&d_reduction_7_pg};
+unsigned char d_goto_valid_43_pg[] = {
+0x0,0x0,0x10,0x0};
+D_Reduction * d_reductions_44_pg[] = {&d_reduction_1_pg};
+unsigned char d_goto_valid_45_pg[] = {
+0x0,0x24,0x2,0x8};
+unsigned char d_goto_valid_46_pg[] = {
+0x0,0x4,0x2,0x8};
+D_Reduction * d_reductions_47_pg[] = {&d_reduction_18_pg};
+D_Reduction * d_reductions_48_pg[] = {&d_reduction_4_pg};
+unsigned char d_goto_valid_49_pg[] = {
+0x0,0x2,0x1,0x4};
+D_Reduction * d_reductions_49_pg[] = {&d_reduction_13_pg};
+D_Reduction * d_reductions_50_pg[] = {&d_reduction_20_pg};
+unsigned char d_goto_valid_51_pg[] = {
+0x0,0x0,0x10,0x0};
+D_Reduction * d_reductions_52_pg[] = {&d_reduction_12_pg};
+D_Reduction * d_reductions_53_pg[] = {&d_reduction_11_pg};
+unsigned short d_gotos_pg[87] = {
+13,42,16,14,15,14,15,24,18,19,20,25,21,23,22,21,
+28,26,12,22,12,32,22,29,17,33,30,17,27,17,22,31,
+17,35,36,17,38,39,43,48,17,22,41,34,40,44,21,46,
+26,47,49,17,22,22,29,37,54,50,17,27,51,22,17,17,
+45,19,20,22,21,52,0,17,0,0,0,22,53,17,0,0,
+0,0,0,0,0,17,31};
+
+D_ErrorRecoveryHint d_error_recovery_hints_0_pg[] = {{0, 5, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_2_pg[] = {{0, 8, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_11_pg[] = {{1, 5, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_13_pg[] = {{0, 3, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_20_pg[] = {{1, 8, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_35_pg[] = {{2, 5, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_36_pg[] = {{1, 3, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_40_pg[] = {{2, 8, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_42_pg[] = {{3, 5, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_43_pg[] = {{2, 3, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_45_pg[] = {{3, 8, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_48_pg[] = {{3, 3, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_49_pg[] = {{4, 8, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_51_pg[] = {{5, 8, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_53_pg[] = {{6, 8, ";"}};
+
+D_State d_states_pg[] = {
+{d_goto_valid_0_pg, 1, {1, d_reductions_0_pg}, {0, NULL}, {1, d_error_recovery_hints_0_pg}, 1, NULL, (void*)d_scanner_0_pg, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_1_pg, -1, {1, d_reductions_1_pg}, {0, NULL}, {1, d_error_recovery_hints_0_pg}, 1, NULL, (void*)d_scanner_0_pg, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_2_pg, -2, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_2_pg}, 1, NULL, (void*)d_scanner_2_pg, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_3_pg, -5, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_2_pg}, 1, NULL, (void*)d_scanner_2_pg, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_4_pg, 3, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_2_pg, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_5_pg, 0, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_2_pg, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_6_pg, -4, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_6_pg, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_7_pg, -13, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_2_pg, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_8_pg, -5, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_8_pg, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_9_pg, -8, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_2_pg, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_10_pg, -15, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_10_pg, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_11_pg, -24, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_11_pg}, 1, NULL, (void*)d_scanner_2_pg, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_13_pg, -34, {1, d_reductions_13_pg}, {0, NULL}, {1, d_error_recovery_hints_13_pg}, 1, NULL, (void*)d_scanner_13_pg, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_14_pg}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_16_pg}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_18_pg, -36, {1, d_reductions_18_pg}, {0, NULL}, {1, d_error_recovery_hints_2_pg}, 1, NULL, (void*)d_scanner_2_pg, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_19_pg}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_20_pg, -31, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_20_pg}, 1, NULL, (void*)d_scanner_2_pg, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_21_pg}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_25_pg}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_26_pg}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_28_pg, 13, {1, d_reductions_28_pg}, {1, d_right_epsilon_hints_28_pg}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_30_pg}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_33_pg}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_35_pg, -18, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_35_pg}, 1, NULL, (void*)d_scanner_35_pg, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_36_pg, -35, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_36_pg}, 1, NULL, (void*)d_scanner_2_pg, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_37_pg, -58, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_2_pg}, 1, NULL, (void*)d_scanner_2_pg, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_38_pg}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_39_pg}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_40_pg, -35, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_40_pg}, 1, NULL, (void*)d_scanner_6_pg, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_41_pg, -24, {1, d_reductions_41_pg}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_41_pg, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_42_pg}, {0, NULL}, {1, d_error_recovery_hints_42_pg}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_43_pg, -30, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_43_pg}, 1, NULL, (void*)d_scanner_35_pg, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_44_pg}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_45_pg, -44, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_45_pg}, 1, NULL, (void*)d_scanner_2_pg, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_46_pg, -50, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_2_pg, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_47_pg}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_48_pg}, {0, NULL}, {1, d_error_recovery_hints_48_pg}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_49_pg, -60, {1, d_reductions_49_pg}, {0, NULL}, {1, d_error_recovery_hints_49_pg}, 1, NULL, (void*)d_scanner_8_pg, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_50_pg}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_51_pg, -36, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_51_pg}, 1, NULL, (void*)d_scanner_35_pg, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_52_pg}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_53_pg}, {0, NULL}, {1, d_error_recovery_hints_53_pg}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1}
+};
+
+D_Symbol d_symbols_pg[] = {
+{D_SYMBOL_EBNF, "0 Start", 7, -1},
+{D_SYMBOL_NTERM, "ParityGame", 10, 1},
+{D_SYMBOL_INTERNAL, "ParityGame__5", 13, -1},
+{D_SYMBOL_EBNF, "ParityGame__4", 13, -1},
+{D_SYMBOL_INTERNAL, "ParityGame__3", 13, -1},
+{D_SYMBOL_EBNF, "ParityGame__2", 13, -1},
+{D_SYMBOL_NTERM, "NodeSpecList", 12, 2},
+{D_SYMBOL_INTERNAL, "NodeSpecList__7", 15, -1},
+{D_SYMBOL_NTERM, "NodeSpec", 8, 3},
+{D_SYMBOL_INTERNAL, "NodeSpec__9", 11, -1},
+{D_SYMBOL_NTERM, "Id", 2, 4},
+{D_SYMBOL_NTERM, "Priority", 8, 5},
+{D_SYMBOL_NTERM, "Owner", 5, 6},
+{D_SYMBOL_NTERM, "Successors", 10, 7},
+{D_SYMBOL_INTERNAL, "Successors__15", 14, -1},
+{D_SYMBOL_EBNF, "Successors__14", 14, -1},
+{D_SYMBOL_NTERM, "Name", 4, 8},
+{D_SYMBOL_NTERM, "Number", 6, 9},
+{D_SYMBOL_NTERM, "whitespace", 10, 10},
+{D_SYMBOL_STRING, "parity", 6, -1},
+{D_SYMBOL_STRING, ";", 1, -1},
+{D_SYMBOL_STRING, "start", 5, -1},
+{D_SYMBOL_STRING, ";", 1, -1},
+{D_SYMBOL_STRING, ";", 1, -1},
+{D_SYMBOL_REGEX, "[01]", 4, -1},
+{D_SYMBOL_STRING, ",", 1, -1},
+{D_SYMBOL_REGEX, "\\\"[^\\\"]*\\\"", 16, -1},
+{D_SYMBOL_REGEX, "0|([1-9][0-9]*)", 15, -1},
+{D_SYMBOL_REGEX, "([ \\t\\n\\r]|(%[^\\n\\r]*))*", 29, -1},
+};
+
+D_ParserTables parser_tables_pg = {
+54, d_states_pg, d_gotos_pg, 10, 29, d_symbols_pg, NULL, 0, NULL, 0};
@@ -0,0 +1,5 @@
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/core_mcrl2_syntax.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_compact_build/libraries/core/source/mcrl2_syntax.c" "libraries/core/CMakeFiles/mcrl2_core.dir/source/mcrl2_syntax.c.o" "gcc" "libraries/core/CMakeFiles/mcrl2_core.dir/source/mcrl2_syntax.c.o.d"
+  "/root/repo/libraries/core/source/core.cpp" "libraries/core/CMakeFiles/mcrl2_core.dir/source/core.cpp.o" "gcc" "libraries/core/CMakeFiles/mcrl2_core.dir/source/core.cpp.o.d"
+  "/root/repo/libraries/core/source/dparser.cpp" "libraries/core/CMakeFiles/mcrl2_core.dir/source/dparser.cpp.o" "gcc" "libraries/core/CMakeFiles/mcrl2_core.dir/source/dparser.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_compact_build/libraries/atermpp/CMakeFiles/mcrl2_atermpp.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/libraries/utilities/CMakeFiles/mcrl2_utilities.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/3rd-party/dparser/CMakeFiles/dparser.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
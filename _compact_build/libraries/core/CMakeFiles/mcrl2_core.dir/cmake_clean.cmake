@@ -0,0 +1,16 @@
+file(REMOVE_RECURSE
+  "../../stage/lib/libmcrl2_core.pdb"
+  "../../stage/lib/libmcrl2_core.so"
+  "CMakeFiles/mcrl2_core.dir/source/core.cpp.o"
+  "CMakeFiles/mcrl2_core.dir/source/core.cpp.o.d"
+  "CMakeFiles/mcrl2_core.dir/source/dparser.cpp.o"
+  "CMakeFiles/mcrl2_core.dir/source/dparser.cpp.o.d"
+  "CMakeFiles/mcrl2_core.dir/source/mcrl2_syntax.c.o"
+  "CMakeFiles/mcrl2_core.dir/source/mcrl2_syntax.c.o.d"
+  "source/mcrl2_syntax.c"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/mcrl2_core.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libraries/core
+# Build directory: /root/repo/_compact_build/libraries/core
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(librarytest_mcrl2_core_identifier_string_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_core_identifier_string_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_core_identifier_string_test")
+set_tests_properties(librarytest_mcrl2_core_identifier_string_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/core/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/core/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_core_print_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_core_print_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_core_print_test")
+set_tests_properties(librarytest_mcrl2_core_print_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/core/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/core/CMakeLists.txt;0;")
@@ -0,0 +1,6191 @@
+/*
+  Generated by Make DParser Version 1.26.4ab9d43046e5d22ffb365ec5f5184a7cfee09b30
+  Available at https://github.com/jplevyak/dparser
+*/
+
+#line 7 "/root/repo/_compact_build/libraries/core/source/mcrl2_syntax.c"
+#include "dparse.h"
+
+D_Reduction d_reduction_0_mcrl2 = {1, 0, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_1_mcrl2 = {1, 1, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_6_mcrl2 = {4, 1, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_12_mcrl2 = {3, 1, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_13_mcrl2 = {2, 1, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_16_mcrl2 = {1, 2, NULL, NULL, 17, 0, 1, 0, -1, 0, NULL};
+D_Reduction d_reduction_17_mcrl2 = {1, 3, NULL, NULL, 18, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_18_mcrl2 = {1, 4, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_19_mcrl2 = {2, 5, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_20_mcrl2 = {2, 6, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_21_mcrl2 = {1, 6, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_22_mcrl2 = {2, 7, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_23_mcrl2 = {4, 7, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_24_mcrl2 = {3, 8, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_25_mcrl2 = {1, 9, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_26_mcrl2 = {0, 9, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_27_mcrl2 = {2, 10, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_28_mcrl2 = {1, 11, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_29_mcrl2 = {0, 11, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_30_mcrl2 = {3, 12, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_31_mcrl2 = {2, 13, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_32_mcrl2 = {2, 14, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_33_mcrl2 = {0, 14, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_34_mcrl2 = {2, 15, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_35_mcrl2 = {2, 16, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_36_mcrl2 = {1, 17, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_37_mcrl2 = {0, 17, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_38_mcrl2 = {2, 18, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_39_mcrl2 = {2, 19, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_40_mcrl2 = {2, 20, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_41_mcrl2 = {0, 20, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_42_mcrl2 = {2, 21, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_43_mcrl2 = {3, 22, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_44_mcrl2 = {2, 23, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_45_mcrl2 = {2, 24, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_46_mcrl2 = {1, 24, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_47_mcrl2 = {2, 25, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_48_mcrl2 = {2, 26, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_49_mcrl2 = {2, 27, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_50_mcrl2 = {1, 27, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_51_mcrl2 = {2, 28, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_52_mcrl2 = {2, 29, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_53_mcrl2 = {2, 30, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_54_mcrl2 = {1, 30, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_55_mcrl2 = {2, 31, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_56_mcrl2 = {2, 32, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_57_mcrl2 = {2, 33, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_58_mcrl2 = {1, 33, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_59_mcrl2 = {2, 34, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_60_mcrl2 = {3, 35, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_61_mcrl2 = {2, 36, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_62_mcrl2 = {1, 36, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_63_mcrl2 = {1, 37, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_64_mcrl2 = {0, 37, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_65_mcrl2 = {5, 38, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_66_mcrl2 = {1, 39, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_67_mcrl2 = {0, 39, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_68_mcrl2 = {2, 40, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_69_mcrl2 = {3, 41, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_70_mcrl2 = {3, 42, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_71_mcrl2 = {2, 43, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_72_mcrl2 = {2, 44, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_73_mcrl2 = {0, 44, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_74_mcrl2 = {2, 45, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_75_mcrl2 = {1, 46, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_77_mcrl2 = {1, 46, NULL, NULL, 0, 5, 0, 20, 0, 0, NULL};
+D_Reduction d_reduction_79_mcrl2 = {2, 46, NULL, NULL, 0, 5, 0, 20, 0, 0, NULL};
+D_Reduction d_reduction_81_mcrl2 = {3, 46, NULL, NULL, 0, 5, 0, 20, 0, 0, NULL};
+D_Reduction d_reduction_84_mcrl2 = {5, 46, NULL, NULL, 0, 5, 0, 20, 0, 0, NULL};
+D_Reduction d_reduction_86_mcrl2 = {3, 46, NULL, NULL, 0, 5, 0, 50, 0, 0, NULL};
+D_Reduction d_reduction_87_mcrl2 = {6, 46, NULL, NULL, 0, 9, 0, 13, 0, 0, NULL};
+D_Reduction d_reduction_88_mcrl2 = {4, 46, NULL, NULL, 0, 9, 0, 13, 0, 0, NULL};
+D_Reduction d_reduction_89_mcrl2 = {2, 46, NULL, NULL, 0, 10, 0, 12, 0, 0, NULL};
+D_Reduction d_reduction_92_mcrl2 = {4, 46, NULL, NULL, 0, 10, 0, 1, 0, 0, NULL};
+D_Reduction d_reduction_95_mcrl2 = {3, 46, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_115_mcrl2 = {4, 46, NULL, NULL, 0, 9, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_116_mcrl2 = {1, 47, NULL, NULL, 17, 0, 12, 0, -1, 0, NULL};
+D_Reduction d_reduction_117_mcrl2 = {1, 48, NULL, NULL, 17, 0, 12, 0, -1, 0, NULL};
+D_Reduction d_reduction_118_mcrl2 = {1, 49, NULL, NULL, 17, 0, 11, 0, -1, 0, NULL};
+D_Reduction d_reduction_119_mcrl2 = {1, 50, NULL, NULL, 17, 0, 11, 0, -1, 0, NULL};
+D_Reduction d_reduction_120_mcrl2 = {1, 51, NULL, NULL, 17, 0, 11, 0, -1, 0, NULL};
+D_Reduction d_reduction_121_mcrl2 = {1, 52, NULL, NULL, 17, 0, 10, 0, -1, 0, NULL};
+D_Reduction d_reduction_122_mcrl2 = {1, 53, NULL, NULL, 17, 0, 10, 0, -1, 0, NULL};
+D_Reduction d_reduction_123_mcrl2 = {1, 54, NULL, NULL, 17, 0, 9, 0, -1, 0, NULL};
+D_Reduction d_reduction_124_mcrl2 = {1, 55, NULL, NULL, 17, 0, 8, 0, -1, 0, NULL};
+D_Reduction d_reduction_125_mcrl2 = {1, 56, NULL, NULL, 18, 0, 7, 0, -1, 0, NULL};
+D_Reduction d_reduction_126_mcrl2 = {1, 57, NULL, NULL, 17, 0, 6, 0, -1, 0, NULL};
+D_Reduction d_reduction_127_mcrl2 = {1, 58, NULL, NULL, 17, 0, 6, 0, -1, 0, NULL};
+D_Reduction d_reduction_128_mcrl2 = {1, 59, NULL, NULL, 17, 0, 6, 0, -1, 0, NULL};
+D_Reduction d_reduction_129_mcrl2 = {1, 60, NULL, NULL, 17, 0, 6, 0, -1, 0, NULL};
+D_Reduction d_reduction_130_mcrl2 = {1, 61, NULL, NULL, 17, 0, 6, 0, -1, 0, NULL};
+D_Reduction d_reduction_131_mcrl2 = {1, 62, NULL, NULL, 17, 0, 5, 0, -1, 0, NULL};
+D_Reduction d_reduction_132_mcrl2 = {1, 63, NULL, NULL, 17, 0, 5, 0, -1, 0, NULL};
+D_Reduction d_reduction_133_mcrl2 = {1, 64, NULL, NULL, 18, 0, 4, 0, -1, 0, NULL};
+D_Reduction d_reduction_134_mcrl2 = {1, 65, NULL, NULL, 18, 0, 3, 0, -1, 0, NULL};
+D_Reduction d_reduction_135_mcrl2 = {1, 66, NULL, NULL, 18, 0, 2, 0, -1, 0, NULL};
+D_Reduction d_reduction_136_mcrl2 = {1, 67, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_140_mcrl2 = {3, 67, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_141_mcrl2 = {4, 67, NULL, NULL, 0, 9, 0, 14, 0, 0, NULL};
+D_Reduction d_reduction_142_mcrl2 = {2, 67, NULL, NULL, 0, 10, 0, 13, 0, 0, NULL};
+D_Reduction d_reduction_145_mcrl2 = {3, 68, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_146_mcrl2 = {2, 69, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_147_mcrl2 = {2, 70, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_148_mcrl2 = {0, 70, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_149_mcrl2 = {2, 71, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_150_mcrl2 = {2, 72, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_151_mcrl2 = {2, 73, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_152_mcrl2 = {0, 73, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_153_mcrl2 = {2, 74, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_154_mcrl2 = {3, 75, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_155_mcrl2 = {2, 76, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_156_mcrl2 = {2, 77, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_157_mcrl2 = {0, 77, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_158_mcrl2 = {2, 78, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_159_mcrl2 = {3, 79, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_160_mcrl2 = {2, 80, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_161_mcrl2 = {2, 81, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_162_mcrl2 = {0, 81, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_163_mcrl2 = {2, 82, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_164_mcrl2 = {2, 83, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_165_mcrl2 = {2, 84, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_166_mcrl2 = {0, 84, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_167_mcrl2 = {2, 85, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_168_mcrl2 = {3, 86, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_169_mcrl2 = {1, 87, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_170_mcrl2 = {0, 87, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_171_mcrl2 = {5, 88, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_172_mcrl2 = {2, 89, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_173_mcrl2 = {2, 90, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_174_mcrl2 = {0, 90, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_175_mcrl2 = {2, 91, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_176_mcrl2 = {3, 92, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_177_mcrl2 = {1, 93, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_178_mcrl2 = {0, 93, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_179_mcrl2 = {3, 94, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_180_mcrl2 = {2, 95, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_181_mcrl2 = {2, 96, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_182_mcrl2 = {0, 96, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_183_mcrl2 = {2, 97, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_184_mcrl2 = {3, 98, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_185_mcrl2 = {1, 99, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_186_mcrl2 = {0, 99, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_187_mcrl2 = {1, 100, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_188_mcrl2 = {4, 100, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_191_mcrl2 = {6, 100, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_196_mcrl2 = {3, 100, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_198_mcrl2 = {2, 100, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_208_mcrl2 = {6, 101, NULL, NULL, 10, 0, 2, 0, -1, 0, NULL};
+D_Reduction d_reduction_209_mcrl2 = {1, 102, NULL, NULL, 17, 0, 11, 0, -1, 0, NULL};
+D_Reduction d_reduction_210_mcrl2 = {1, 103, NULL, NULL, 17, 0, 10, 0, -1, 0, NULL};
+D_Reduction d_reduction_211_mcrl2 = {1, 104, NULL, NULL, 18, 0, 9, 0, -1, 0, NULL};
+D_Reduction d_reduction_212_mcrl2 = {1, 105, NULL, NULL, 17, 0, 8, 0, -1, 0, NULL};
+D_Reduction d_reduction_213_mcrl2 = {3, 106, NULL, NULL, 10, 0, 5, 0, -1, 0, NULL};
+D_Reduction d_reduction_214_mcrl2 = {2, 107, NULL, NULL, 10, 0, 6, 0, -1, 0, NULL};
+D_Reduction d_reduction_215_mcrl2 = {2, 108, NULL, NULL, 10, 0, 5, 0, -1, 0, NULL};
+D_Reduction d_reduction_216_mcrl2 = {1, 109, NULL, NULL, 18, 0, 4, 0, -1, 0, NULL};
+D_Reduction d_reduction_217_mcrl2 = {1, 110, NULL, NULL, 18, 0, 3, 0, -1, 0, NULL};
+D_Reduction d_reduction_218_mcrl2 = {3, 111, NULL, NULL, 10, 0, 2, 0, -1, 0, NULL};
+D_Reduction d_reduction_219_mcrl2 = {1, 112, NULL, NULL, 17, 0, 1, 0, -1, 0, NULL};
+D_Reduction d_reduction_220_mcrl2 = {1, 113, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_221_mcrl2 = {0, 113, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_222_mcrl2 = {2, 114, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_223_mcrl2 = {1, 115, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_224_mcrl2 = {0, 115, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_225_mcrl2 = {3, 116, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_226_mcrl2 = {3, 117, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_227_mcrl2 = {1, 118, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_228_mcrl2 = {0, 118, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_229_mcrl2 = {2, 119, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_230_mcrl2 = {2, 120, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_231_mcrl2 = {2, 121, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_232_mcrl2 = {1, 121, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_233_mcrl2 = {1, 122, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_235_mcrl2 = {2, 123, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_236_mcrl2 = {2, 124, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_237_mcrl2 = {0, 124, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_238_mcrl2 = {2, 125, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_239_mcrl2 = {5, 126, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_240_mcrl2 = {1, 127, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_241_mcrl2 = {0, 127, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_242_mcrl2 = {3, 128, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_243_mcrl2 = {2, 129, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_244_mcrl2 = {2, 130, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_245_mcrl2 = {1, 130, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_246_mcrl2 = {3, 131, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_247_mcrl2 = {1, 132, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_248_mcrl2 = {2, 133, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_249_mcrl2 = {1, 133, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_250_mcrl2 = {1, 134, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_254_mcrl2 = {3, 135, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_255_mcrl2 = {2, 136, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_256_mcrl2 = {0, 136, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_257_mcrl2 = {2, 137, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_258_mcrl2 = {0, 137, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_259_mcrl2 = {1, 138, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_266_mcrl2 = {2, 139, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_267_mcrl2 = {2, 140, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_268_mcrl2 = {2, 141, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_269_mcrl2 = {1, 141, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_270_mcrl2 = {5, 142, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_271_mcrl2 = {1, 143, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_272_mcrl2 = {1, 144, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_275_mcrl2 = {3, 144, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_278_mcrl2 = {2, 144, NULL, NULL, 0, 10, 0, 5, 0, 0, NULL};
+D_Reduction d_reduction_280_mcrl2 = {1, 145, NULL, NULL, 18, 0, 4, 0, -1, 0, NULL};
+D_Reduction d_reduction_281_mcrl2 = {1, 146, NULL, NULL, 18, 0, 3, 0, -1, 0, NULL};
+D_Reduction d_reduction_282_mcrl2 = {1, 147, NULL, NULL, 18, 0, 2, 0, -1, 0, NULL};
+D_Reduction d_reduction_283_mcrl2 = {3, 148, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_284_mcrl2 = {4, 149, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_285_mcrl2 = {1, 150, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_286_mcrl2 = {0, 150, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_287_mcrl2 = {1, 151, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_288_mcrl2 = {0, 151, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_289_mcrl2 = {2, 152, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_290_mcrl2 = {2, 153, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_291_mcrl2 = {1, 153, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_292_mcrl2 = {5, 154, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_293_mcrl2 = {1, 155, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_295_mcrl2 = {2, 156, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_296_mcrl2 = {1, 157, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_297_mcrl2 = {0, 157, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_298_mcrl2 = {3, 158, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_299_mcrl2 = {2, 159, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_300_mcrl2 = {1, 160, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_301_mcrl2 = {0, 160, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_302_mcrl2 = {3, 161, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_303_mcrl2 = {3, 162, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_304_mcrl2 = {4, 163, NULL, NULL, 0, 5, 0, 20, 0, 0, NULL};
+D_Reduction d_reduction_305_mcrl2 = {1, 164, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_306_mcrl2 = {3, 164, NULL, NULL, 0, 5, 0, 50, 0, 0, NULL};
+D_Reduction d_reduction_307_mcrl2 = {1, 164, NULL, NULL, 0, 5, 0, 30, 0, 0, NULL};
+D_Reduction d_reduction_309_mcrl2 = {2, 164, NULL, NULL, 0, 5, 0, 30, 0, 0, NULL};
+D_Reduction d_reduction_310_mcrl2 = {4, 164, NULL, NULL, 0, 10, 0, 21, 0, 0, NULL};
+D_Reduction d_reduction_312_mcrl2 = {3, 164, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_315_mcrl2 = {2, 164, NULL, NULL, 0, 10, 0, 25, 0, 0, NULL};
+D_Reduction d_reduction_316_mcrl2 = {1, 165, NULL, NULL, 18, 0, 24, 0, -1, 0, NULL};
+D_Reduction d_reduction_317_mcrl2 = {1, 166, NULL, NULL, 18, 0, 23, 0, -1, 0, NULL};
+D_Reduction d_reduction_318_mcrl2 = {1, 167, NULL, NULL, 18, 0, 22, 0, -1, 0, NULL};
+D_Reduction d_reduction_319_mcrl2 = {1, 168, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_320_mcrl2 = {0, 168, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_321_mcrl2 = {3, 169, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_322_mcrl2 = {1, 170, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_324_mcrl2 = {3, 170, NULL, NULL, 0, 5, 0, 50, 0, 0, NULL};
+D_Reduction d_reduction_325_mcrl2 = {1, 170, NULL, NULL, 0, 5, 0, 30, 0, 0, NULL};
+D_Reduction d_reduction_327_mcrl2 = {4, 170, NULL, NULL, 0, 10, 0, 21, 0, 0, NULL};
+D_Reduction d_reduction_329_mcrl2 = {3, 170, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_333_mcrl2 = {2, 170, NULL, NULL, 0, 10, 0, 26, 0, 0, NULL};
+D_Reduction d_reduction_334_mcrl2 = {1, 171, NULL, NULL, 17, 0, 25, 0, -1, 0, NULL};
+D_Reduction d_reduction_335_mcrl2 = {1, 172, NULL, NULL, 18, 0, 24, 0, -1, 0, NULL};
+D_Reduction d_reduction_336_mcrl2 = {1, 173, NULL, NULL, 18, 0, 23, 0, -1, 0, NULL};
+D_Reduction d_reduction_337_mcrl2 = {1, 174, NULL, NULL, 18, 0, 22, 0, -1, 0, NULL};
+D_Reduction d_reduction_338_mcrl2 = {1, 175, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_339_mcrl2 = {3, 175, NULL, NULL, 0, 5, 0, 50, 0, 0, NULL};
+D_Reduction d_reduction_340_mcrl2 = {3, 175, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_342_mcrl2 = {2, 175, NULL, NULL, 0, 10, 0, 33, 0, 0, NULL};
+D_Reduction d_reduction_344_mcrl2 = {1, 176, NULL, NULL, 18, 0, 32, 0, -1, 0, NULL};
+D_Reduction d_reduction_345_mcrl2 = {1, 177, NULL, NULL, 17, 0, 31, 0, -1, 0, NULL};
+D_Reduction d_reduction_346_mcrl2 = {1, 178, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_347_mcrl2 = {3, 178, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_348_mcrl2 = {1, 179, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_349_mcrl2 = {2, 180, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_350_mcrl2 = {0, 180, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_351_mcrl2 = {1, 181, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_352_mcrl2 = {2, 182, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_353_mcrl2 = {0, 182, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_354_mcrl2 = {3, 183, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_355_mcrl2 = {1, 184, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_360_mcrl2 = {1, 185, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_361_mcrl2 = {3, 185, NULL, NULL, 0, 5, 0, 50, 0, 0, NULL};
+D_Reduction d_reduction_362_mcrl2 = {1, 185, NULL, NULL, 0, 5, 0, 50, 0, 0, NULL};
+D_Reduction d_reduction_364_mcrl2 = {2, 185, NULL, NULL, 0, 5, 0, 50, 0, 0, NULL};
+D_Reduction d_reduction_367_mcrl2 = {4, 185, NULL, NULL, 0, 10, 0, 41, 0, 0, NULL};
+D_Reduction d_reduction_369_mcrl2 = {4, 185, NULL, NULL, 0, 10, 0, 42, 0, 0, NULL};
+D_Reduction d_reduction_371_mcrl2 = {3, 185, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_374_mcrl2 = {4, 185, NULL, NULL, 0, 10, 0, 46, 0, 0, NULL};
+D_Reduction d_reduction_376_mcrl2 = {2, 185, NULL, NULL, 0, 10, 0, 47, 0, 0, NULL};
+D_Reduction d_reduction_377_mcrl2 = {1, 186, NULL, NULL, 18, 0, 45, 0, -1, 0, NULL};
+D_Reduction d_reduction_378_mcrl2 = {1, 187, NULL, NULL, 18, 0, 44, 0, -1, 0, NULL};
+D_Reduction d_reduction_379_mcrl2 = {1, 188, NULL, NULL, 18, 0, 43, 0, -1, 0, NULL};
+D_Reduction d_reduction_380_mcrl2 = {1, 189, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_381_mcrl2 = {0, 189, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_382_mcrl2 = {2, 190, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_383_mcrl2 = {1, 191, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_384_mcrl2 = {0, 191, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_385_mcrl2 = {2, 192, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_386_mcrl2 = {1, 193, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_387_mcrl2 = {0, 193, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_388_mcrl2 = {3, 194, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_389_mcrl2 = {2, 195, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_390_mcrl2 = {1, 196, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_391_mcrl2 = {0, 196, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_392_mcrl2 = {3, 197, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_393_mcrl2 = {5, 198, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_394_mcrl2 = {2, 199, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_395_mcrl2 = {2, 200, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_396_mcrl2 = {0, 200, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_397_mcrl2 = {2, 201, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_398_mcrl2 = {1, 202, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_399_mcrl2 = {2, 203, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_400_mcrl2 = {1, 203, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_401_mcrl2 = {1, 204, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_407_mcrl2 = {3, 205, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_408_mcrl2 = {2, 206, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_409_mcrl2 = {1, 206, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_410_mcrl2 = {1, 207, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_411_mcrl2 = {0, 207, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_412_mcrl2 = {5, 208, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_413_mcrl2 = {1, 209, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_414_mcrl2 = {0, 209, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_415_mcrl2 = {2, 210, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_416_mcrl2 = {1, 211, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_419_mcrl2 = {2, 212, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_420_mcrl2 = {2, 213, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_421_mcrl2 = {0, 213, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_422_mcrl2 = {2, 214, NULL, NULL, 0, 0, 0, 0, -1, 0, NULL};
+D_Reduction d_reduction_423_mcrl2 = {1, 215, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_424_mcrl2 = {1, 216, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Reduction d_reduction_425_mcrl2 = {1, 217, NULL, NULL, 0, 0, 0, 0, 0, 0, NULL};
+D_Shift d_shift_0_mcrl2 = {218, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_1_mcrl2 = {219, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_2_mcrl2 = {220, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_3_mcrl2 = {221, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_4_mcrl2 = {222, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_5_mcrl2 = {223, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_6_mcrl2 = {224, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_7_mcrl2 = {225, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_8_mcrl2 = {226, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_9_mcrl2 = {227, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_10_mcrl2 = {228, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_11_mcrl2 = {229, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_12_mcrl2 = {230, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_13_mcrl2 = {231, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_14_mcrl2 = {232, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_15_mcrl2 = {233, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_16_mcrl2 = {234, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_17_mcrl2 = {235, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_18_mcrl2 = {236, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_19_mcrl2 = {237, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_20_mcrl2 = {238, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_21_mcrl2 = {239, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_22_mcrl2 = {240, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_23_mcrl2 = {241, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_24_mcrl2 = {242, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_25_mcrl2 = {243, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_26_mcrl2 = {244, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_27_mcrl2 = {245, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_28_mcrl2 = {246, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_29_mcrl2 = {247, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_30_mcrl2 = {248, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_31_mcrl2 = {249, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_32_mcrl2 = {250, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_33_mcrl2 = {251, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_34_mcrl2 = {252, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_35_mcrl2 = {253, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_36_mcrl2 = {254, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_37_mcrl2 = {255, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_38_mcrl2 = {256, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_39_mcrl2 = {257, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_40_mcrl2 = {258, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_41_mcrl2 = {259, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_42_mcrl2 = {260, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_43_mcrl2 = {261, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_44_mcrl2 = {262, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_45_mcrl2 = {263, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_46_mcrl2 = {264, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_47_mcrl2 = {265, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_48_mcrl2 = {266, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_49_mcrl2 = {267, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_50_mcrl2 = {268, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_51_mcrl2 = {269, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_52_mcrl2 = {270, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_53_mcrl2 = {271, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_54_mcrl2 = {272, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_55_mcrl2 = {273, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_56_mcrl2 = {274, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_57_mcrl2 = {275, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_58_mcrl2 = {276, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_59_mcrl2 = {277, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_60_mcrl2 = {278, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_61_mcrl2 = {279, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_62_mcrl2 = {280, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_63_mcrl2 = {281, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_64_mcrl2 = {282, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_65_mcrl2 = {283, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_66_mcrl2 = {284, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_67_mcrl2 = {285, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_68_mcrl2 = {286, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_69_mcrl2 = {287, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_70_mcrl2 = {288, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_71_mcrl2 = {289, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_72_mcrl2 = {290, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_73_mcrl2 = {291, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_74_mcrl2 = {292, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_75_mcrl2 = {293, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_76_mcrl2 = {294, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_77_mcrl2 = {295, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_78_mcrl2 = {296, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_79_mcrl2 = {297, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_80_mcrl2 = {298, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_81_mcrl2 = {299, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_82_mcrl2 = {300, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_83_mcrl2 = {301, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_84_mcrl2 = {302, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_85_mcrl2 = {303, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_86_mcrl2 = {304, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_87_mcrl2 = {305, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_88_mcrl2 = {306, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_89_mcrl2 = {307, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_90_mcrl2 = {308, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_91_mcrl2 = {309, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_92_mcrl2 = {310, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_93_mcrl2 = {311, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_94_mcrl2 = {312, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_95_mcrl2 = {313, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_96_mcrl2 = {314, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_97_mcrl2 = {315, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_98_mcrl2 = {316, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_99_mcrl2 = {317, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_100_mcrl2 = {318, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_101_mcrl2 = {319, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_102_mcrl2 = {320, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_103_mcrl2 = {321, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_104_mcrl2 = {322, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_105_mcrl2 = {323, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_106_mcrl2 = {324, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_107_mcrl2 = {325, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_108_mcrl2 = {326, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_109_mcrl2 = {327, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_110_mcrl2 = {328, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_111_mcrl2 = {329, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_112_mcrl2 = {330, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_113_mcrl2 = {331, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_114_mcrl2 = {332, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_115_mcrl2 = {333, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_116_mcrl2 = {334, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_117_mcrl2 = {335, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_118_mcrl2 = {336, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_119_mcrl2 = {337, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_120_mcrl2 = {338, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_121_mcrl2 = {339, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_122_mcrl2 = {340, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_123_mcrl2 = {341, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_124_mcrl2 = {342, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_125_mcrl2 = {343, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_126_mcrl2 = {344, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_127_mcrl2 = {345, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_128_mcrl2 = {346, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_129_mcrl2 = {347, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_130_mcrl2 = {348, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_131_mcrl2 = {349, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_132_mcrl2 = {350, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_133_mcrl2 = {351, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_134_mcrl2 = {352, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_135_mcrl2 = {353, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_136_mcrl2 = {354, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_137_mcrl2 = {355, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_138_mcrl2 = {356, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_139_mcrl2 = {357, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_140_mcrl2 = {358, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_141_mcrl2 = {359, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_142_mcrl2 = {360, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_143_mcrl2 = {361, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_144_mcrl2 = {362, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_145_mcrl2 = {363, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_146_mcrl2 = {364, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_147_mcrl2 = {365, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_148_mcrl2 = {366, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_149_mcrl2 = {367, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_150_mcrl2 = {368, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_151_mcrl2 = {369, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_152_mcrl2 = {370, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_153_mcrl2 = {371, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_154_mcrl2 = {372, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_155_mcrl2 = {373, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_156_mcrl2 = {374, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_157_mcrl2 = {375, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_158_mcrl2 = {376, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_159_mcrl2 = {377, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_160_mcrl2 = {378, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_161_mcrl2 = {379, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_162_mcrl2 = {380, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_163_mcrl2 = {381, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_164_mcrl2 = {382, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_165_mcrl2 = {383, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_166_mcrl2 = {384, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_167_mcrl2 = {385, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_168_mcrl2 = {386, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_169_mcrl2 = {387, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_170_mcrl2 = {388, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_171_mcrl2 = {389, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_172_mcrl2 = {390, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_173_mcrl2 = {391, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_174_mcrl2 = {392, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_175_mcrl2 = {393, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_176_mcrl2 = {394, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_177_mcrl2 = {395, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_178_mcrl2 = {396, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_179_mcrl2 = {397, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_180_mcrl2 = {398, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_181_mcrl2 = {399, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_182_mcrl2 = {400, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_183_mcrl2 = {401, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_184_mcrl2 = {402, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_185_mcrl2 = {403, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_186_mcrl2 = {404, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_187_mcrl2 = {405, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_188_mcrl2 = {406, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_189_mcrl2 = {407, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_190_mcrl2 = {408, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_191_mcrl2 = {409, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_192_mcrl2 = {410, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_193_mcrl2 = {411, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_194_mcrl2 = {412, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_195_mcrl2 = {413, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_196_mcrl2 = {414, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_197_mcrl2 = {415, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_198_mcrl2 = {416, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_199_mcrl2 = {417, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_200_mcrl2 = {418, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_201_mcrl2 = {419, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_202_mcrl2 = {420, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_203_mcrl2 = {421, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_204_mcrl2 = {422, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_205_mcrl2 = {423, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_206_mcrl2 = {424, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_207_mcrl2 = {425, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_208_mcrl2 = {426, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_209_mcrl2 = {427, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_210_mcrl2 = {428, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_211_mcrl2 = {429, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_212_mcrl2 = {430, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_213_mcrl2 = {431, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_214_mcrl2 = {432, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_215_mcrl2 = {433, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_216_mcrl2 = {434, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_217_mcrl2 = {435, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_218_mcrl2 = {436, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_219_mcrl2 = {437, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_220_mcrl2 = {438, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_221_mcrl2 = {439, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_222_mcrl2 = {440, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_223_mcrl2 = {441, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_224_mcrl2 = {442, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_225_mcrl2 = {443, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_226_mcrl2 = {444, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_227_mcrl2 = {445, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_228_mcrl2 = {446, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_229_mcrl2 = {447, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_230_mcrl2 = {448, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_231_mcrl2 = {449, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_232_mcrl2 = {450, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_233_mcrl2 = {451, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_234_mcrl2 = {452, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_235_mcrl2 = {453, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_236_mcrl2 = {454, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_237_mcrl2 = {455, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_238_mcrl2 = {456, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_239_mcrl2 = {457, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_240_mcrl2 = {458, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_241_mcrl2 = {459, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_242_mcrl2 = {460, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_243_mcrl2 = {461, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_244_mcrl2 = {462, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_245_mcrl2 = {463, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_246_mcrl2 = {464, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_247_mcrl2 = {465, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_248_mcrl2 = {466, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_249_mcrl2 = {467, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_250_mcrl2 = {468, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_251_mcrl2 = {469, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_252_mcrl2 = {470, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_253_mcrl2 = {471, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_254_mcrl2 = {472, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_255_mcrl2 = {473, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_256_mcrl2 = {474, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_257_mcrl2 = {475, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_258_mcrl2 = {476, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_259_mcrl2 = {477, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_260_mcrl2 = {478, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_261_mcrl2 = {479, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_262_mcrl2 = {480, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_263_mcrl2 = {481, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_264_mcrl2 = {482, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_265_mcrl2 = {483, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_266_mcrl2 = {484, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_267_mcrl2 = {485, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_268_mcrl2 = {486, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_269_mcrl2 = {487, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_270_mcrl2 = {488, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_271_mcrl2 = {489, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_272_mcrl2 = {490, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_273_mcrl2 = {491, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_274_mcrl2 = {492, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_275_mcrl2 = {493, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_276_mcrl2 = {494, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_277_mcrl2 = {495, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_278_mcrl2 = {496, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_279_mcrl2 = {497, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_280_mcrl2 = {498, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_281_mcrl2 = {499, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_282_mcrl2 = {500, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_283_mcrl2 = {501, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_284_mcrl2 = {502, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_285_mcrl2 = {503, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_286_mcrl2 = {504, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_287_mcrl2 = {505, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_288_mcrl2 = {506, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_289_mcrl2 = {507, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_290_mcrl2 = {508, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_291_mcrl2 = {509, 1, 0, 0, 0, 0, NULL};
+D_Shift d_shift_292_mcrl2 = {510, 1, 0, 0, -1, 0, NULL};
+D_Shift d_shift_293_mcrl2 = {511, 1, 0, 0, -1, 0, NULL};
+D_Shift d_shift_294_mcrl2 = {512, 1, 0, 0, 0, 0, NULL};
+
+D_Shift * d_accepts_diff_0_0_mcrl2[] = {0};
+D_Shift * d_accepts_diff_0_1_mcrl2[] = {&d_shift_27_mcrl2,0};
+D_Shift * d_accepts_diff_0_2_mcrl2[] = {&d_shift_0_mcrl2,0};
+D_Shift * d_accepts_diff_0_3_mcrl2[] = {&d_shift_1_mcrl2,0};
+D_Shift * d_accepts_diff_0_4_mcrl2[] = {&d_shift_2_mcrl2,0};
+D_Shift * d_accepts_diff_0_5_mcrl2[] = {&d_shift_3_mcrl2,0};
+D_Shift * d_accepts_diff_0_6_mcrl2[] = {&d_shift_4_mcrl2,0};
+D_Shift * d_accepts_diff_0_7_mcrl2[] = {&d_shift_5_mcrl2,0};
+D_Shift * d_accepts_diff_0_8_mcrl2[] = {&d_shift_36_mcrl2,0};
+D_Shift * d_accepts_diff_0_9_mcrl2[] = {&d_shift_8_mcrl2,0};
+D_Shift * d_accepts_diff_0_10_mcrl2[] = {&d_shift_105_mcrl2,0};
+D_Shift * d_accepts_diff_0_11_mcrl2[] = {&d_shift_38_mcrl2,0};
+D_Shift * d_accepts_diff_0_12_mcrl2[] = {&d_shift_11_mcrl2,0};
+D_Shift * d_accepts_diff_0_13_mcrl2[] = {&d_shift_40_mcrl2,0};
+D_Shift * d_accepts_diff_0_14_mcrl2[] = {&d_shift_14_mcrl2,0};
+D_Shift * d_accepts_diff_0_15_mcrl2[] = {&d_shift_42_mcrl2,0};
+D_Shift * d_accepts_diff_0_16_mcrl2[] = {&d_shift_17_mcrl2,0};
+D_Shift * d_accepts_diff_0_17_mcrl2[] = {&d_shift_102_mcrl2,0};
+D_Shift * d_accepts_diff_0_18_mcrl2[] = {&d_shift_101_mcrl2,0};
+D_Shift * d_accepts_diff_0_19_mcrl2[] = {&d_shift_22_mcrl2,0};
+D_Shift * d_accepts_diff_0_20_mcrl2[] = {&d_shift_51_mcrl2,0};
+D_Shift * d_accepts_diff_0_21_mcrl2[] = {&d_shift_98_mcrl2,0};
+D_Shift * d_accepts_diff_0_22_mcrl2[] = {&d_shift_192_mcrl2,0};
+D_Shift * d_accepts_diff_0_23_mcrl2[] = {&d_shift_52_mcrl2,0};
+D_Shift * d_accepts_diff_0_24_mcrl2[] = {&d_shift_208_mcrl2,0};
+D_Shift * d_accepts_diff_0_25_mcrl2[] = {&d_shift_209_mcrl2,0};
+D_Shift * d_accepts_diff_0_26_mcrl2[] = {&d_shift_94_mcrl2,0};
+D_Shift * d_accepts_diff_0_27_mcrl2[] = {&d_shift_76_mcrl2,0};
+D_Shift * d_accepts_diff_0_28_mcrl2[] = {&d_shift_93_mcrl2,0};
+D_Shift * d_accepts_diff_0_29_mcrl2[] = {&d_shift_77_mcrl2,0};
+D_Shift * d_accepts_diff_0_30_mcrl2[] = {&d_shift_79_mcrl2,0};
+D_Shift * d_accepts_diff_0_31_mcrl2[] = {&d_shift_81_mcrl2,0};
+D_Shift * d_accepts_diff_0_32_mcrl2[] = {&d_shift_138_mcrl2,0};
+D_Shift * d_accepts_diff_0_33_mcrl2[] = {&d_shift_83_mcrl2,0};
+D_Shift * d_accepts_diff_0_34_mcrl2[] = {&d_shift_139_mcrl2,0};
+D_Shift * d_accepts_diff_0_35_mcrl2[] = {&d_shift_140_mcrl2,0};
+D_Shift * d_accepts_diff_0_36_mcrl2[] = {&d_shift_144_mcrl2,0};
+D_Shift * d_accepts_diff_0_37_mcrl2[] = {&d_shift_86_mcrl2,0};
+D_Shift * d_accepts_diff_0_38_mcrl2[] = {&d_shift_148_mcrl2,0};
+D_Shift * d_accepts_diff_0_39_mcrl2[] = {&d_shift_32_mcrl2,0};
+D_Shift * d_accepts_diff_0_40_mcrl2[] = {&d_shift_152_mcrl2,0};
+D_Shift * d_accepts_diff_0_41_mcrl2[] = {&d_shift_156_mcrl2,0};
+D_Shift * d_accepts_diff_0_42_mcrl2[] = {&d_shift_44_mcrl2,0};
+D_Shift * d_accepts_diff_0_43_mcrl2[] = {&d_shift_260_mcrl2,0};
+D_Shift * d_accepts_diff_0_44_mcrl2[] = {&d_shift_174_mcrl2,0};
+D_Shift * d_accepts_diff_0_45_mcrl2[] = {&d_shift_106_mcrl2,0};
+D_Shift * d_accepts_diff_0_46_mcrl2[] = {&d_shift_262_mcrl2,0};
+D_Shift * d_accepts_diff_0_47_mcrl2[] = {&d_shift_163_mcrl2,0};
+D_Shift * d_accepts_diff_0_48_mcrl2[] = {&d_shift_205_mcrl2,0};
+D_Shift * d_accepts_diff_0_49_mcrl2[] = {&d_shift_182_mcrl2,0};
+D_Shift * d_accepts_diff_0_50_mcrl2[] = {&d_shift_90_mcrl2,0};
+D_Shift * d_accepts_diff_0_51_mcrl2[] = {&d_shift_252_mcrl2,0};
+D_Shift * d_accepts_diff_0_52_mcrl2[] = {&d_shift_216_mcrl2,0};
+D_Shift * d_accepts_diff_0_53_mcrl2[] = {&d_shift_25_mcrl2,0};
+D_Shift * d_accepts_diff_0_54_mcrl2[] = {&d_shift_189_mcrl2,0};
+D_Shift * d_accepts_diff_0_55_mcrl2[] = {&d_shift_190_mcrl2,0};
+D_Shift ** d_accepts_diff_0_mcrl2[] = {
+d_accepts_diff_0_0_mcrl2,
+d_accepts_diff_0_1_mcrl2,
+d_accepts_diff_0_2_mcrl2,
+d_accepts_diff_0_3_mcrl2,
+d_accepts_diff_0_4_mcrl2,
+d_accepts_diff_0_5_mcrl2,
+d_accepts_diff_0_6_mcrl2,
+d_accepts_diff_0_7_mcrl2,
+d_accepts_diff_0_8_mcrl2,
+d_accepts_diff_0_9_mcrl2,
+d_accepts_diff_0_10_mcrl2,
+d_accepts_diff_0_11_mcrl2,
+d_accepts_diff_0_12_mcrl2,
+d_accepts_diff_0_13_mcrl2,
+d_accepts_diff_0_14_mcrl2,
+d_accepts_diff_0_15_mcrl2,
+d_accepts_diff_0_16_mcrl2,
+d_accepts_diff_0_17_mcrl2,
+d_accepts_diff_0_18_mcrl2,
+d_accepts_diff_0_19_mcrl2,
+d_accepts_diff_0_20_mcrl2,
+d_accepts_diff_0_21_mcrl2,
+d_accepts_diff_0_22_mcrl2,
+d_accepts_diff_0_23_mcrl2,
+d_accepts_diff_0_24_mcrl2,
+d_accepts_diff_0_25_mcrl2,
+d_accepts_diff_0_26_mcrl2,
+d_accepts_diff_0_27_mcrl2,
+d_accepts_diff_0_28_mcrl2,
+d_accepts_diff_0_29_mcrl2,
+d_accepts_diff_0_30_mcrl2,
+d_accepts_diff_0_31_mcrl2,
+d_accepts_diff_0_32_mcrl2,
+d_accepts_diff_0_33_mcrl2,
+d_accepts_diff_0_34_mcrl2,
+d_accepts_diff_0_35_mcrl2,
+d_accepts_diff_0_36_mcrl2,
+d_accepts_diff_0_37_mcrl2,
+d_accepts_diff_0_38_mcrl2,
+d_accepts_diff_0_39_mcrl2,
+d_accepts_diff_0_40_mcrl2,
+d_accepts_diff_0_41_mcrl2,
+d_accepts_diff_0_42_mcrl2,
+d_accepts_diff_0_43_mcrl2,
+d_accepts_diff_0_44_mcrl2,
+d_accepts_diff_0_45_mcrl2,
+d_accepts_diff_0_46_mcrl2,
+d_accepts_diff_0_47_mcrl2,
+d_accepts_diff_0_48_mcrl2,
+d_accepts_diff_0_49_mcrl2,
+d_accepts_diff_0_50_mcrl2,
+d_accepts_diff_0_51_mcrl2,
+d_accepts_diff_0_52_mcrl2,
+d_accepts_diff_0_53_mcrl2,
+d_accepts_diff_0_54_mcrl2,
+d_accepts_diff_0_55_mcrl2
+};
+
+unsigned char d_scanner_0_0_0_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 2, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+2, 3, 0, 4, 0, 5, 6, 0, 7, 8, 9, 10, 11, 12, 13, 14, 
+15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 18, 19, 20, 21, 22, 
+};
+
+unsigned char d_scanner_0_0_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+23, 24, 25, 24, 24, 24, 26, 24, 24, 27, 24, 24, 28, 24, 29, 24, 
+30, 24, 31, 32, 24, 24, 24, 24, 24, 24, 24, 33, 0, 34, 0, 24, 
+0, 35, 36, 37, 38, 39, 40, 41, 42, 43, 24, 24, 44, 45, 46, 24, 
+47, 24, 48, 49, 50, 24, 51, 52, 24, 53, 24, 54, 55, 56, 0, 0, 
+};
+
+unsigned char d_scanner_0_0_2_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+D_Shift * d_shift_0_0_mcrl2[] = {&d_shift_294_mcrl2,NULL};
+
+unsigned char d_scanner_0_1_0_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 2, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+2, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_2_0_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 57, 0, 0, 
+};
+
+D_Shift * d_shift_0_2_mcrl2[] = {&d_shift_76_mcrl2,NULL};
+
+D_Shift * d_shift_0_3_mcrl2[] = {&d_shift_24_mcrl2,NULL};
+
+unsigned char d_scanner_0_4_0_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 5, 5, 5, 5, 5, 5, 5, 5, 58, 2, 5, 5, 2, 5, 5, 
+5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 
+58, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 
+5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 
+};
+
+unsigned char d_scanner_0_4_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 
+5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 
+5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 
+5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 
+};
+
+unsigned char d_scanner_0_5_0_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+D_Shift * d_shift_0_6_mcrl2[] = {&d_shift_6_mcrl2,NULL};
+
+D_Shift * d_shift_0_7_mcrl2[] = {&d_shift_7_mcrl2,NULL};
+
+D_Shift * d_shift_0_8_mcrl2[] = {&d_shift_103_mcrl2,NULL};
+
+unsigned char d_scanner_0_9_0_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+D_Shift * d_shift_0_9_mcrl2[] = {&d_shift_98_mcrl2,NULL};
+
+D_Shift * d_shift_0_10_mcrl2[] = {&d_shift_34_mcrl2,NULL};
+
+unsigned char d_scanner_0_11_0_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 61, 0, 
+};
+
+D_Shift * d_shift_0_11_mcrl2[] = {&d_shift_77_mcrl2,NULL};
+
+D_Shift * d_shift_0_12_mcrl2[] = {&d_shift_80_mcrl2,NULL};
+
+D_Shift * d_shift_0_13_mcrl2[] = {&d_shift_100_mcrl2,NULL};
+
+D_Shift * d_shift_0_14_mcrl2[] = {&d_shift_293_mcrl2,NULL};
+
+unsigned char d_scanner_0_15_0_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 
+};
+
+D_Shift * d_shift_0_16_mcrl2[] = {&d_shift_33_mcrl2,NULL};
+
+D_Shift * d_shift_0_17_mcrl2[] = {&d_shift_26_mcrl2,NULL};
+
+unsigned char d_scanner_0_18_0_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 63, 64, 0, 
+};
+
+unsigned char d_scanner_0_18_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65, 0, 0, 0, 
+};
+
+D_Shift * d_shift_0_18_mcrl2[] = {&d_shift_90_mcrl2,NULL};
+
+unsigned char d_scanner_0_19_0_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 67, 0, 
+};
+
+D_Shift * d_shift_0_19_mcrl2[] = {&d_shift_27_mcrl2,NULL};
+
+unsigned char d_scanner_0_20_0_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 0, 0, 
+};
+
+D_Shift * d_shift_0_20_mcrl2[] = {&d_shift_93_mcrl2,NULL};
+
+D_Shift * d_shift_0_21_mcrl2[] = {&d_shift_31_mcrl2,NULL};
+
+D_Shift * d_shift_0_22_mcrl2[] = {&d_shift_172_mcrl2,NULL};
+
+unsigned char d_scanner_0_23_0_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_23_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+D_Shift * d_shift_0_23_mcrl2[] = {&d_shift_292_mcrl2,NULL};
+
+unsigned char d_scanner_0_24_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 69, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 70, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_25_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 71, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 72, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_26_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 73, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_27_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 74, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_28_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 75, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_29_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 76, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_30_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 77, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_31_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 78, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+D_Shift * d_shift_0_32_mcrl2[] = {&d_shift_53_mcrl2,NULL};
+
+D_Shift * d_shift_0_33_mcrl2[] = {&d_shift_54_mcrl2,NULL};
+
+unsigned char d_scanner_0_34_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 79, 24, 24, 24, 24, 24, 24, 24, 24, 80, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_35_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 81, 24, 24, 24, 24, 24, 24, 82, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_36_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 83, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_37_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 84, 24, 24, 24, 85, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_38_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 86, 24, 
+24, 87, 24, 24, 24, 24, 24, 24, 88, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_39_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 89, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 90, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_40_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 91, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_41_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 92, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_42_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 93, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_43_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 94, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_44_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 95, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 96, 
+24, 24, 24, 24, 24, 97, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_45_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 98, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_46_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 99, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 100, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_47_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 101, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_48_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 102, 
+24, 24, 24, 24, 103, 104, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_49_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 105, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 106, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_50_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 107, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_51_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 108, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_52_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 109, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+D_Shift * d_shift_0_53_mcrl2[] = {&d_shift_55_mcrl2,NULL};
+
+unsigned char d_scanner_0_54_0_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 110, 0, 
+};
+
+unsigned char d_scanner_0_54_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 111, 0, 0, 0, 
+};
+
+D_Shift * d_shift_0_54_mcrl2[] = {&d_shift_32_mcrl2,NULL};
+
+D_Shift * d_shift_0_55_mcrl2[] = {&d_shift_56_mcrl2,NULL};
+
+D_Shift * d_shift_0_56_mcrl2[] = {&d_shift_89_mcrl2,NULL};
+
+D_Shift * d_shift_0_58_mcrl2[] = {&d_shift_87_mcrl2,NULL};
+
+D_Shift * d_shift_0_59_mcrl2[] = {&d_shift_97_mcrl2,NULL};
+
+D_Shift * d_shift_0_60_mcrl2[] = {&d_shift_23_mcrl2,NULL};
+
+D_Shift * d_shift_0_61_mcrl2[] = {&d_shift_170_mcrl2,NULL};
+
+D_Shift * d_shift_0_62_mcrl2[] = {&d_shift_91_mcrl2,NULL};
+
+D_Shift * d_shift_0_63_mcrl2[] = {&d_shift_169_mcrl2,NULL};
+
+D_Shift * d_shift_0_64_mcrl2[] = {&d_shift_96_mcrl2,NULL};
+
+D_Shift * d_shift_0_65_mcrl2[] = {&d_shift_88_mcrl2,NULL};
+
+D_Shift * d_shift_0_66_mcrl2[] = {&d_shift_85_mcrl2,NULL};
+
+D_Shift * d_shift_0_67_mcrl2[] = {&d_shift_92_mcrl2,NULL};
+
+unsigned char d_scanner_0_68_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 112, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_69_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 113, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_70_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 114, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_71_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 115, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_72_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 116, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_73_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 117, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_74_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 118, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_75_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 119, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_76_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 120, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_77_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 121, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_78_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 122, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_79_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 123, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_80_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 124, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_81_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 125, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_82_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 126, 127, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_83_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 128, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_84_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 129, 24, 24, 130, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_85_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 131, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_86_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 132, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_87_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 133, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_88_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 134, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_89_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 135, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_90_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 136, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_91_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 137, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_92_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 138, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+D_Shift * d_shift_0_92_mcrl2[] = {&d_shift_94_mcrl2,NULL};
+
+unsigned char d_scanner_0_93_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 139, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_94_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+140, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_95_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 141, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+D_Shift * d_shift_0_96_mcrl2[] = {&d_shift_208_mcrl2,NULL};
+
+D_Shift * d_shift_0_97_mcrl2[] = {&d_shift_209_mcrl2,NULL};
+
+unsigned char d_scanner_0_98_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 142, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_99_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 143, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_100_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 144, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_101_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 145, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_102_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 146, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_103_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 147, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_104_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 148, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_105_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 149, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_106_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 150, 24, 24, 24, 
+24, 24, 151, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_107_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 152, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_108_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 153, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+D_Shift * d_shift_0_109_mcrl2[] = {&d_shift_95_mcrl2,NULL};
+
+unsigned char d_scanner_0_110_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 154, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+D_Shift * d_shift_0_110_mcrl2[] = {&d_shift_86_mcrl2,NULL};
+
+D_Shift * d_shift_0_111_mcrl2[] = {&d_shift_11_mcrl2,NULL};
+
+unsigned char d_scanner_0_112_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 155, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_113_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 156, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_114_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 157, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+D_Shift * d_shift_0_115_mcrl2[] = {&d_shift_3_mcrl2,NULL};
+
+unsigned char d_scanner_0_116_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 158, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+D_Shift * d_shift_0_117_mcrl2[] = {&d_shift_2_mcrl2,NULL};
+
+D_Shift * d_shift_0_118_mcrl2[] = {&d_shift_1_mcrl2,NULL};
+
+unsigned char d_scanner_0_119_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 159, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+D_Shift * d_shift_0_120_mcrl2[] = {&d_shift_8_mcrl2,NULL};
+
+D_Shift * d_shift_0_121_mcrl2[] = {&d_shift_182_mcrl2,NULL};
+
+unsigned char d_scanner_0_122_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 160, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+D_Shift * d_shift_0_123_mcrl2[] = {&d_shift_192_mcrl2,NULL};
+
+unsigned char d_scanner_0_124_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 161, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_125_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 162, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_126_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 163, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_127_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 164, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 165, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_128_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 166, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+D_Shift * d_shift_0_129_mcrl2[] = {&d_shift_101_mcrl2,NULL};
+
+D_Shift * d_shift_0_130_mcrl2[] = {&d_shift_106_mcrl2,NULL};
+
+D_Shift * d_shift_0_131_mcrl2[] = {&d_shift_44_mcrl2,NULL};
+
+unsigned char d_scanner_0_132_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 167, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_133_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 168, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_134_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 169, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 170, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_135_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 171, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_136_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 172, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_137_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 173, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_138_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 174, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+D_Shift * d_shift_0_139_mcrl2[] = {&d_shift_38_mcrl2,NULL};
+
+D_Shift * d_shift_0_140_mcrl2[] = {&d_shift_102_mcrl2,NULL};
+
+unsigned char d_scanner_0_141_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 175, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_142_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 176, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_143_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 177, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_144_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 178, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_145_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 179, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+D_Shift * d_shift_0_146_mcrl2[] = {&d_shift_163_mcrl2,NULL};
+
+D_Shift * d_shift_0_147_mcrl2[] = {&d_shift_139_mcrl2,NULL};
+
+unsigned char d_scanner_0_148_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 180, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+D_Shift * d_shift_0_149_mcrl2[] = {&d_shift_216_mcrl2,NULL};
+
+D_Shift * d_shift_0_150_mcrl2[] = {&d_shift_42_mcrl2,NULL};
+
+D_Shift * d_shift_0_151_mcrl2[] = {&d_shift_105_mcrl2,NULL};
+
+unsigned char d_scanner_0_152_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 181, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+D_Shift * d_shift_0_153_mcrl2[] = {&d_shift_166_mcrl2,NULL};
+
+D_Shift * d_shift_0_154_mcrl2[] = {&d_shift_0_mcrl2,NULL};
+
+D_Shift * d_shift_0_155_mcrl2[] = {&d_shift_17_mcrl2,NULL};
+
+D_Shift * d_shift_0_156_mcrl2[] = {&d_shift_14_mcrl2,NULL};
+
+D_Shift * d_shift_0_157_mcrl2[] = {&d_shift_5_mcrl2,NULL};
+
+D_Shift * d_shift_0_158_mcrl2[] = {&d_shift_4_mcrl2,NULL};
+
+unsigned char d_scanner_0_159_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 182, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_160_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 183, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+D_Shift * d_shift_0_161_mcrl2[] = {&d_shift_156_mcrl2,NULL};
+
+D_Shift * d_shift_0_162_mcrl2[] = {&d_shift_36_mcrl2,NULL};
+
+unsigned char d_scanner_0_163_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 184, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_164_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 185, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+D_Shift * d_shift_0_165_mcrl2[] = {&d_shift_174_mcrl2,NULL};
+
+unsigned char d_scanner_0_166_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 186, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_167_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 187, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_168_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 188, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+D_Shift * d_shift_0_169_mcrl2[] = {&d_shift_252_mcrl2,NULL};
+
+D_Shift * d_shift_0_170_mcrl2[] = {&d_shift_40_mcrl2,NULL};
+
+D_Shift * d_shift_0_171_mcrl2[] = {&d_shift_148_mcrl2,NULL};
+
+D_Shift * d_shift_0_172_mcrl2[] = {&d_shift_190_mcrl2,NULL};
+
+unsigned char d_scanner_0_173_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 189, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+D_Shift * d_shift_0_174_mcrl2[] = {&d_shift_205_mcrl2,NULL};
+
+D_Shift * d_shift_0_175_mcrl2[] = {&d_shift_189_mcrl2,NULL};
+
+unsigned char d_scanner_0_176_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 190, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+D_Shift * d_shift_0_177_mcrl2[] = {&d_shift_25_mcrl2,NULL};
+
+unsigned char d_scanner_0_178_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 191, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+D_Shift * d_shift_0_179_mcrl2[] = {&d_shift_51_mcrl2,NULL};
+
+unsigned char d_scanner_0_180_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 192, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+D_Shift * d_shift_0_181_mcrl2[] = {&d_shift_144_mcrl2,NULL};
+
+D_Shift * d_shift_0_182_mcrl2[] = {&d_shift_140_mcrl2,NULL};
+
+D_Shift * d_shift_0_183_mcrl2[] = {&d_shift_260_mcrl2,NULL};
+
+D_Shift * d_shift_0_184_mcrl2[] = {&d_shift_138_mcrl2,NULL};
+
+unsigned char d_scanner_0_185_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 193, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+D_Shift * d_shift_0_186_mcrl2[] = {&d_shift_52_mcrl2,NULL};
+
+unsigned char d_scanner_0_187_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 194, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_188_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 195, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_189_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 196, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+unsigned char d_scanner_0_190_1_mcrl2[SCANNER_BLOCK_SIZE] = {
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 24, 
+0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
+24, 24, 24, 24, 197, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 
+};
+
+D_Shift * d_shift_0_191_mcrl2[] = {&d_shift_262_mcrl2,NULL};
+
+D_Shift * d_shift_0_192_mcrl2[] = {&d_shift_81_mcrl2,NULL};
+
+D_Shift * d_shift_0_193_mcrl2[] = {&d_shift_79_mcrl2,NULL};
+
+D_Shift * d_shift_0_194_mcrl2[] = {&d_shift_83_mcrl2,NULL};
+
+D_Shift * d_shift_0_195_mcrl2[] = {&d_shift_152_mcrl2,NULL};
+
+D_Shift * d_shift_0_196_mcrl2[] = {&d_shift_22_mcrl2,NULL};
+
+SB_uint8 d_scanner_0_mcrl2[197] = {
+{d_shift_0_0_mcrl2, {d_scanner_0_0_0_mcrl2, d_scanner_0_0_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_0_mcrl2, {d_scanner_0_1_0_mcrl2, d_scanner_0_0_2_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_2_mcrl2, {d_scanner_0_2_0_mcrl2, d_scanner_0_0_2_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_3_mcrl2, {d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_0_mcrl2, {d_scanner_0_4_0_mcrl2, d_scanner_0_4_1_mcrl2
+ , d_scanner_0_4_1_mcrl2, d_scanner_0_4_1_mcrl2}},
+{NULL, {d_scanner_0_5_0_mcrl2, d_scanner_0_0_2_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_6_mcrl2, {d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_7_mcrl2, {d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_8_mcrl2, {d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_9_mcrl2, {d_scanner_0_9_0_mcrl2, d_scanner_0_0_2_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_10_mcrl2, {d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_11_mcrl2, {d_scanner_0_11_0_mcrl2, d_scanner_0_0_2_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_12_mcrl2, {d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_13_mcrl2, {d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_14_mcrl2, {d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_14_mcrl2, {d_scanner_0_15_0_mcrl2, d_scanner_0_0_2_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_16_mcrl2, {d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_17_mcrl2, {d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_18_mcrl2, {d_scanner_0_18_0_mcrl2, d_scanner_0_18_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_19_mcrl2, {d_scanner_0_19_0_mcrl2, d_scanner_0_0_2_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_20_mcrl2, {d_scanner_0_20_0_mcrl2, d_scanner_0_0_2_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_21_mcrl2, {d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_22_mcrl2, {d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_24_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_25_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_26_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_27_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_28_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_29_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_30_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_31_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_32_mcrl2, {d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_33_mcrl2, {d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_34_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_35_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_36_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_37_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_38_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_39_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_40_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_41_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_42_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_43_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_44_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_45_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_46_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_47_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_48_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_49_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_50_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_51_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_52_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_53_mcrl2, {d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_54_mcrl2, {d_scanner_0_54_0_mcrl2, d_scanner_0_54_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_55_mcrl2, {d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_56_mcrl2, {d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_0_mcrl2, {d_scanner_0_4_0_mcrl2, d_scanner_0_4_1_mcrl2
+ , d_scanner_0_4_1_mcrl2, d_scanner_0_4_1_mcrl2}},
+{d_shift_0_58_mcrl2, {d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_59_mcrl2, {d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_60_mcrl2, {d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_61_mcrl2, {d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_62_mcrl2, {d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_63_mcrl2, {d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_64_mcrl2, {d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_65_mcrl2, {d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_66_mcrl2, {d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_67_mcrl2, {d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_68_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_69_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_70_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_71_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_72_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_73_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_74_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_75_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_76_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_77_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_78_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_79_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_80_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_81_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_82_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_83_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_84_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_85_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_86_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_87_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_88_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_89_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_90_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_91_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_92_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_92_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_93_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_94_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_95_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_96_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_97_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_98_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_99_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_100_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_101_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_102_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_103_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_104_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_105_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_106_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_107_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_108_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_109_mcrl2, {d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_110_mcrl2, {d_scanner_0_0_2_mcrl2, d_scanner_0_110_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_111_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_112_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_113_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_114_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_115_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_116_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_117_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_118_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_119_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_120_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_121_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_122_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_123_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_124_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_125_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_126_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_127_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_128_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_129_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_130_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_131_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_132_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_133_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_134_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_135_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_136_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_137_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_138_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_139_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_140_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_141_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_142_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_143_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_144_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_145_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_146_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_147_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_148_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_149_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_150_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_151_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_152_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_153_mcrl2, {d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_154_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_155_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_156_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_157_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_158_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_159_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_160_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_161_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_162_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_163_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_164_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_165_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_166_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_167_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_168_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_169_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_170_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_171_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_172_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_173_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_174_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_175_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_176_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_177_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_178_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_179_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_180_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_181_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_182_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_183_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_184_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_185_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_186_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_187_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_188_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_189_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_23_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_190_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_191_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_192_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_193_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_194_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_195_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}},
+{d_shift_0_196_mcrl2, {d_scanner_0_23_0_mcrl2, d_scanner_0_23_1_mcrl2
+ , d_scanner_0_0_2_mcrl2, d_scanner_0_0_2_mcrl2}}
+};
+
+unsigned char d_goto_valid_0_mcrl2[] = {
+0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xfc,0x25,0x9,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_1_mcrl2[] = {
+0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xfc,0x25,0x9,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_2_mcrl2[] = {
+0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xfc,0x25,0x9,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_3_mcrl2[] = {
+0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_4_mcrl2[] = {
+0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_5_mcrl2[] = {
+0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_6_mcrl2[] = {
+0x0,0x21,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_7_mcrl2[] = {
+0x0,0x0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_7_mcrl2[] = {&d_reduction_37_mcrl2};
+unsigned char d_goto_valid_8_mcrl2[] = {
+0x0,0x0,0xf,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_8_mcrl2[] = {&d_reduction_37_mcrl2};
+unsigned char d_goto_valid_9_mcrl2[] = {
+0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_10_mcrl2[] = {
+0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_11_mcrl2[] = {
+0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_12_mcrl2[] = {
+0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_13_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_14_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x29,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_14_mcrl2[] = {&d_reduction_64_mcrl2};
+unsigned char d_goto_valid_15_mcrl2[] = {
+0x0,0x0,0x0,0x0,0xc0,0x41,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+D_Reduction * d_reductions_15_mcrl2[] = {&d_reduction_67_mcrl2};
+unsigned char d_goto_valid_16_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_17_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_18_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_19_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_20_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0x60,0x0,0x0,0xc0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_21_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_22_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_23_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_24_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_25_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_26_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_27_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_28_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_29_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_30_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_31_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_32_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_33_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_34_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_35_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_36_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x30,0x9c,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0x60,0x0,0x0,0xc0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x44,0x44,0x20,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_37_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_38_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_39_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_40_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_41_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_42_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_43_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_44_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_45_mcrl2[] = {
+0x20,0x0,0x80,0x4,0x29,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x40,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_45_mcrl2[] = {&d_reduction_64_mcrl2};
+unsigned char d_goto_valid_46_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_46_mcrl2[] = {&d_reduction_258_mcrl2};
+unsigned char d_goto_valid_47_mcrl2[] = {
+0x20,0x0,0x80,0x24,0x29,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x2,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x40,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x81,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_47_mcrl2[] = {&d_reduction_64_mcrl2};
+unsigned char d_goto_valid_48_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_49_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_50_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_51_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_52_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_53_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_54_mcrl2[] = {
+0x20,0x0,0x80,0x4,0x29,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x0,0xa0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x40,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_54_mcrl2[] = {&d_reduction_64_mcrl2,&d_reduction_288_mcrl2};
+unsigned char d_goto_valid_55_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_56_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_57_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_58_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_59_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_60_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_61_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_62_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x40,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_63_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0xc,0x0,0x0,0x0,0x0,0x8,0x4,0x0,0x0,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x40,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_64_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0xc,0x0,0x0,0x0,0x0,0x8,0x84,0x0,0x0,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x40,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_65_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x64,0x2,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0xe0,0x0,0x0,0x40,0xa,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x4,0x0,0x0,0x0,0x0,0x40,0x1,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_65_mcrl2[] = {&d_reduction_353_mcrl2};
+D_RightEpsilonHint d_right_epsilon_hints_65_mcrl2[] = {{0, 314, &d_reduction_351_mcrl2}};
+unsigned char d_goto_valid_66_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_67_mcrl2[] = {
+0x20,0x0,0x80,0x4,0x29,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x40,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_67_mcrl2[] = {&d_reduction_64_mcrl2};
+unsigned char d_goto_valid_68_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x2,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0xe0,0x0,0x0,0x40,0xa,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x4,0x0,0x0,0x0,0x0,0x40,0x1,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_69_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_70_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_71_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_72_mcrl2[] = {
+0x20,0x0,0x80,0x4,0x29,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xbc,0x0,0x0,0x0,0x0,0x8,0x40,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_72_mcrl2[] = {&d_reduction_64_mcrl2,&d_reduction_411_mcrl2};
+unsigned char d_goto_valid_73_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_73_mcrl2[] = {&d_reduction_411_mcrl2};
+unsigned char d_goto_valid_74_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x87,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+D_Reduction * d_reductions_74_mcrl2[] = {&d_reduction_414_mcrl2};
+unsigned char d_goto_valid_75_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x88,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_76_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_77_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_78_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0};
+unsigned char d_goto_valid_79_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1};
+D_Reduction * d_reductions_80_mcrl2[] = {&d_reduction_1_mcrl2};
+D_Reduction * d_reductions_81_mcrl2[] = {&d_reduction_1_mcrl2};
+D_Reduction * d_reductions_82_mcrl2[] = {&d_reduction_1_mcrl2};
+D_Reduction * d_reductions_83_mcrl2[] = {&d_reduction_1_mcrl2};
+D_Reduction * d_reductions_84_mcrl2[] = {&d_reduction_1_mcrl2};
+unsigned char d_goto_valid_85_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_86_mcrl2[] = {
+0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xfc,0x25,0x9,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_87_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_88_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_89_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_90_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_91_mcrl2[] = {
+0x0,0x21,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_92_mcrl2[] = {&d_reduction_423_mcrl2};
+unsigned char d_goto_valid_93_mcrl2[] = {
+0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_94_mcrl2[] = {&d_reduction_1_mcrl2};
+unsigned char d_goto_valid_95_mcrl2[] = {
+0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_96_mcrl2[] = {
+0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_96_mcrl2[] = {&d_reduction_18_mcrl2};
+unsigned char d_goto_valid_98_mcrl2[] = {
+0xc0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_101_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_102_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_102_mcrl2[] = {&d_reduction_421_mcrl2};
+D_RightEpsilonHint d_right_epsilon_hints_102_mcrl2[] = {{0, 373, &d_reduction_419_mcrl2}};
+unsigned char d_goto_valid_104_mcrl2[] = {
+0x0,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_104_mcrl2[] = {&d_reduction_29_mcrl2};
+D_RightEpsilonHint d_right_epsilon_hints_104_mcrl2[] = {{1, 644, &d_reduction_24_mcrl2}};
+unsigned char d_goto_valid_105_mcrl2[] = {
+0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_105_mcrl2[] = {&d_reduction_33_mcrl2};
+D_RightEpsilonHint d_right_epsilon_hints_105_mcrl2[] = {{0, 377, &d_reduction_31_mcrl2}};
+unsigned char d_goto_valid_108_mcrl2[] = {
+0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xfc,0x25,0x9,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_109_mcrl2[] = {&d_reduction_36_mcrl2};
+unsigned char d_goto_valid_110_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_111_mcrl2[] = {
+0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_111_mcrl2[] = {&d_reduction_41_mcrl2};
+D_RightEpsilonHint d_right_epsilon_hints_111_mcrl2[] = {{0, 380, &d_reduction_39_mcrl2}};
+unsigned char d_goto_valid_114_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_115_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_115_mcrl2[] = {&d_reduction_421_mcrl2};
+D_RightEpsilonHint d_right_epsilon_hints_115_mcrl2[] = {{0, 373, &d_reduction_419_mcrl2}};
+unsigned char d_goto_valid_116_mcrl2[] = {
+0x0,0x0,0x40,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_118_mcrl2[] = {
+0x0,0x0,0x40,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_120_mcrl2[] = {
+0x0,0x0,0x0,0xc0,0x0,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_122_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x6,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_124_mcrl2[] = {&d_reduction_63_mcrl2};
+unsigned char d_goto_valid_126_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_127_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_128_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+D_Reduction * d_reductions_129_mcrl2[] = {&d_reduction_77_mcrl2};
+D_Reduction * d_reductions_130_mcrl2[] = {&d_reduction_77_mcrl2};
+unsigned char d_goto_valid_131_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x3,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_132_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x42,0x0,0x0,0x0,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x8,0x0,0xe0,0x6,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_133_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_134_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_135_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_136_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_137_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_138_mcrl2[] = {&d_reduction_424_mcrl2};
+unsigned char d_goto_valid_140_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+D_Reduction * d_reductions_141_mcrl2[] = {&d_reduction_66_mcrl2};
+unsigned char d_goto_valid_142_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x2,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_143_mcrl2[] = {&d_reduction_75_mcrl2};
+D_Reduction * d_reductions_144_mcrl2[] = {&d_reduction_75_mcrl2};
+unsigned char d_goto_valid_146_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_148_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_149_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_149_mcrl2[] = {&d_reduction_73_mcrl2};
+D_RightEpsilonHint d_right_epsilon_hints_149_mcrl2[] = {{0, 458, &d_reduction_71_mcrl2}};
+unsigned char d_goto_valid_151_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_152_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_153_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0x60,0x0,0x0,0xc0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+D_Reduction * d_reductions_154_mcrl2[] = {&d_reduction_136_mcrl2};
+D_Reduction * d_reductions_155_mcrl2[] = {&d_reduction_136_mcrl2};
+unsigned char d_goto_valid_156_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0x60,0x0,0x0,0xc0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_157_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0x60,0x0,0x0,0xc0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_158_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_159_mcrl2[] = {&d_reduction_136_mcrl2};
+D_Reduction * d_reductions_160_mcrl2[] = {&d_reduction_136_mcrl2};
+unsigned char d_goto_valid_162_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_163_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_163_mcrl2[] = {&d_reduction_148_mcrl2};
+D_RightEpsilonHint d_right_epsilon_hints_163_mcrl2[] = {{0, 465, &d_reduction_146_mcrl2}};
+unsigned char d_goto_valid_165_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_165_mcrl2[] = {&d_reduction_152_mcrl2};
+D_RightEpsilonHint d_right_epsilon_hints_165_mcrl2[] = {{0, 466, &d_reduction_150_mcrl2}};
+unsigned char d_goto_valid_167_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x8,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_169_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_169_mcrl2[] = {&d_reduction_157_mcrl2};
+D_RightEpsilonHint d_right_epsilon_hints_169_mcrl2[] = {{0, 468, &d_reduction_155_mcrl2}};
+unsigned char d_goto_valid_171_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_174_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_174_mcrl2[] = {&d_reduction_162_mcrl2};
+D_RightEpsilonHint d_right_epsilon_hints_174_mcrl2[] = {{0, 470, &d_reduction_160_mcrl2}};
+unsigned char d_goto_valid_175_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_175_mcrl2[] = {&d_reduction_166_mcrl2};
+D_RightEpsilonHint d_right_epsilon_hints_175_mcrl2[] = {{0, 471, &d_reduction_164_mcrl2}};
+unsigned char d_goto_valid_177_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x89,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_177_mcrl2[] = {&d_reduction_170_mcrl2};
+unsigned char d_goto_valid_180_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_181_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_181_mcrl2[] = {&d_reduction_174_mcrl2};
+D_RightEpsilonHint d_right_epsilon_hints_181_mcrl2[] = {{0, 475, &d_reduction_172_mcrl2}};
+unsigned char d_goto_valid_183_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_183_mcrl2[] = {&d_reduction_178_mcrl2};
+unsigned char d_goto_valid_186_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_187_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_187_mcrl2[] = {&d_reduction_182_mcrl2};
+D_RightEpsilonHint d_right_epsilon_hints_187_mcrl2[] = {{0, 479, &d_reduction_180_mcrl2}};
+unsigned char d_goto_valid_189_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_189_mcrl2[] = {&d_reduction_186_mcrl2};
+unsigned char d_goto_valid_191_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x8,0x0,0x0,0x0,0x30,0x9c,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x44,0x44,0x20,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+D_Reduction * d_reductions_192_mcrl2[] = {&d_reduction_187_mcrl2};
+D_Reduction * d_reductions_193_mcrl2[] = {&d_reduction_187_mcrl2};
+unsigned char d_goto_valid_194_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_195_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_196_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_197_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_198_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_199_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_200_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_201_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_202_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x63,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x4,0x1,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_203_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x30,0x9c,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0x60,0x0,0x0,0xc0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x44,0x44,0x20,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_204_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x30,0x9c,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0x60,0x0,0x0,0xc0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x44,0x44,0x20,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_205_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x30,0x9c,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0x60,0x0,0x0,0xc0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x44,0x44,0x20,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_206_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x30,0x9c,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0x60,0x0,0x0,0xc0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x44,0x44,0x20,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_207_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x30,0x9c,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0x60,0x0,0x0,0xc0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x44,0x44,0x20,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+D_Reduction * d_reductions_208_mcrl2[] = {&d_reduction_187_mcrl2};
+unsigned char d_goto_valid_209_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_209_mcrl2[] = {&d_reduction_136_mcrl2,&d_reduction_224_mcrl2};
+D_RightEpsilonHint d_right_epsilon_hints_209_mcrl2[] = {{0, 519, &d_reduction_222_mcrl2}};
+unsigned char d_goto_valid_211_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_211_mcrl2[] = {&d_reduction_224_mcrl2};
+D_RightEpsilonHint d_right_epsilon_hints_211_mcrl2[] = {{0, 519, &d_reduction_222_mcrl2}};
+unsigned char d_goto_valid_213_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_213_mcrl2[] = {&d_reduction_228_mcrl2};
+unsigned char d_goto_valid_214_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_216_mcrl2[] = {&d_reduction_233_mcrl2};
+unsigned char d_goto_valid_217_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_217_mcrl2[] = {&d_reduction_237_mcrl2};
+D_RightEpsilonHint d_right_epsilon_hints_217_mcrl2[] = {{0, 527, &d_reduction_235_mcrl2}};
+D_Reduction * d_reductions_219_mcrl2[] = {&d_reduction_233_mcrl2};
+unsigned char d_goto_valid_222_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_222_mcrl2[] = {&d_reduction_241_mcrl2};
+unsigned char d_goto_valid_223_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_225_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x30,0x9c,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0x60,0x0,0x0,0xc0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x44,0x44,0x20,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+D_Reduction * d_reductions_227_mcrl2[] = {&d_reduction_250_mcrl2};
+D_Reduction * d_reductions_228_mcrl2[] = {&d_reduction_250_mcrl2};
+D_Reduction * d_reductions_229_mcrl2[] = {&d_reduction_250_mcrl2};
+D_Reduction * d_reductions_230_mcrl2[] = {&d_reduction_250_mcrl2};
+unsigned char d_goto_valid_232_mcrl2[] = {
+0x20,0x0,0x80,0x4,0x29,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x40,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_232_mcrl2[] = {&d_reduction_64_mcrl2,&d_reduction_247_mcrl2};
+D_Reduction * d_reductions_233_mcrl2[] = {&d_reduction_249_mcrl2};
+unsigned char d_goto_valid_235_mcrl2[] = {
+0x20,0x0,0x80,0x24,0x29,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0xa,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x40,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x81,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_235_mcrl2[] = {&d_reduction_64_mcrl2};
+D_Reduction * d_reductions_236_mcrl2[] = {&d_reduction_259_mcrl2};
+D_Reduction * d_reductions_237_mcrl2[] = {&d_reduction_259_mcrl2};
+D_Reduction * d_reductions_238_mcrl2[] = {&d_reduction_259_mcrl2};
+D_Reduction * d_reductions_239_mcrl2[] = {&d_reduction_259_mcrl2};
+D_Reduction * d_reductions_240_mcrl2[] = {&d_reduction_259_mcrl2};
+D_Reduction * d_reductions_241_mcrl2[] = {&d_reduction_259_mcrl2};
+D_Reduction * d_reductions_242_mcrl2[] = {&d_reduction_259_mcrl2};
+unsigned char d_goto_valid_244_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_246_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_248_mcrl2[] = {&d_reduction_293_mcrl2};
+D_Reduction * d_reductions_249_mcrl2[] = {&d_reduction_293_mcrl2};
+unsigned char d_goto_valid_251_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_253_mcrl2[] = {&d_reduction_271_mcrl2};
+unsigned char d_goto_valid_254_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_255_mcrl2[] = {&d_reduction_272_mcrl2};
+D_Reduction * d_reductions_256_mcrl2[] = {&d_reduction_272_mcrl2};
+unsigned char d_goto_valid_257_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_258_mcrl2[] = {&d_reduction_272_mcrl2};
+unsigned char d_goto_valid_259_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_260_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_262_mcrl2[] = {&d_reduction_287_mcrl2};
+unsigned char d_goto_valid_264_mcrl2[] = {
+0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_264_mcrl2[] = {&d_reduction_286_mcrl2};
+unsigned char d_goto_valid_265_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_268_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_271_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_271_mcrl2[] = {&d_reduction_297_mcrl2};
+D_RightEpsilonHint d_right_epsilon_hints_271_mcrl2[] = {{0, 556, &d_reduction_295_mcrl2}};
+unsigned char d_goto_valid_273_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_273_mcrl2[] = {&d_reduction_301_mcrl2};
+D_RightEpsilonHint d_right_epsilon_hints_273_mcrl2[] = {{0, 559, &d_reduction_299_mcrl2}};
+unsigned char d_goto_valid_274_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_276_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_278_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x40,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_279_mcrl2[] = {&d_reduction_307_mcrl2};
+D_Reduction * d_reductions_280_mcrl2[] = {&d_reduction_307_mcrl2};
+unsigned char d_goto_valid_281_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x40,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_282_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_283_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_284_mcrl2[] = {&d_reduction_305_mcrl2};
+unsigned char d_goto_valid_285_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_286_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_286_mcrl2[] = {&d_reduction_320_mcrl2};
+D_RightEpsilonHint d_right_epsilon_hints_286_mcrl2[] = {{0, 574, &d_reduction_309_mcrl2}};
+unsigned char d_goto_valid_287_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0xc,0x0,0x0,0x0,0x0,0x8,0x4,0x0,0x0,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x40,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_288_mcrl2[] = {&d_reduction_325_mcrl2};
+D_Reduction * d_reductions_289_mcrl2[] = {&d_reduction_325_mcrl2};
+unsigned char d_goto_valid_290_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0xc,0x0,0x0,0x0,0x0,0x8,0x4,0x0,0x0,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x40,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_291_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_292_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_293_mcrl2[] = {&d_reduction_322_mcrl2};
+D_Reduction * d_reductions_294_mcrl2[] = {&d_reduction_322_mcrl2};
+unsigned char d_goto_valid_295_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x78,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_296_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0xc,0x0,0x0,0x0,0x0,0x8,0x84,0x0,0x0,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x40,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_297_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x78,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_297_mcrl2[] = {&d_reduction_338_mcrl2};
+unsigned char d_goto_valid_298_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x10,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_299_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x2,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0xe0,0x0,0x0,0x40,0xa,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x4,0x0,0x0,0x0,0x0,0x40,0x1,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_300_mcrl2[] = {&d_reduction_362_mcrl2};
+D_Reduction * d_reductions_301_mcrl2[] = {&d_reduction_362_mcrl2};
+unsigned char d_goto_valid_302_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0xc,0x0,0x0,0x0,0x0,0x8,0x84,0x0,0x0,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x40,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_303_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x2,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0xe0,0x0,0x0,0x40,0xa,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x4,0x0,0x0,0x0,0x0,0x40,0x1,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_304_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_305_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_306_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0xc,0x0,0x0,0x0,0x0,0x8,0x84,0x0,0x0,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x40,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_307_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_308_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_309_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_309_mcrl2[] = {&d_reduction_384_mcrl2};
+D_RightEpsilonHint d_right_epsilon_hints_309_mcrl2[] = {{0, 604, &d_reduction_364_mcrl2}};
+unsigned char d_goto_valid_310_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_310_mcrl2[] = {&d_reduction_381_mcrl2};
+D_RightEpsilonHint d_right_epsilon_hints_310_mcrl2[] = {{0, 607, &d_reduction_364_mcrl2}};
+D_Reduction * d_reductions_311_mcrl2[] = {&d_reduction_360_mcrl2};
+unsigned char d_goto_valid_313_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_314_mcrl2[] = {
+0x20,0x0,0x80,0x4,0x29,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x40,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_314_mcrl2[] = {&d_reduction_64_mcrl2,&d_reduction_351_mcrl2};
+unsigned char d_goto_valid_315_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_315_mcrl2[] = {&d_reduction_346_mcrl2};
+unsigned char d_goto_valid_316_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_316_mcrl2[] = {&d_reduction_387_mcrl2};
+D_RightEpsilonHint d_right_epsilon_hints_316_mcrl2[] = {{0, 618, &d_reduction_364_mcrl2}};
+unsigned char d_goto_valid_317_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x2,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0xe0,0x0,0x0,0x40,0xa,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x4,0x0,0x0,0x0,0x0,0x40,0x1,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_319_mcrl2[] = {&d_reduction_355_mcrl2};
+D_Reduction * d_reductions_320_mcrl2[] = {&d_reduction_355_mcrl2};
+D_Reduction * d_reductions_321_mcrl2[] = {&d_reduction_355_mcrl2};
+D_Reduction * d_reductions_322_mcrl2[] = {&d_reduction_355_mcrl2};
+D_Reduction * d_reductions_323_mcrl2[] = {&d_reduction_355_mcrl2};
+unsigned char d_goto_valid_325_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_327_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_327_mcrl2[] = {&d_reduction_391_mcrl2};
+D_RightEpsilonHint d_right_epsilon_hints_327_mcrl2[] = {{0, 622, &d_reduction_389_mcrl2}};
+unsigned char d_goto_valid_329_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_330_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_330_mcrl2[] = {&d_reduction_396_mcrl2};
+D_RightEpsilonHint d_right_epsilon_hints_330_mcrl2[] = {{0, 625, &d_reduction_394_mcrl2}};
+D_Reduction * d_reductions_332_mcrl2[] = {&d_reduction_401_mcrl2};
+D_Reduction * d_reductions_333_mcrl2[] = {&d_reduction_401_mcrl2};
+D_Reduction * d_reductions_334_mcrl2[] = {&d_reduction_401_mcrl2};
+D_Reduction * d_reductions_335_mcrl2[] = {&d_reduction_63_mcrl2,&d_reduction_410_mcrl2};
+D_Reduction * d_reductions_336_mcrl2[] = {&d_reduction_401_mcrl2};
+D_Reduction * d_reductions_337_mcrl2[] = {&d_reduction_401_mcrl2};
+unsigned char d_goto_valid_339_mcrl2[] = {
+0x20,0x0,0x80,0x4,0x29,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb0,0x0,0x0,0x0,0x0,0x8,0x40,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_339_mcrl2[] = {&d_reduction_64_mcrl2,&d_reduction_398_mcrl2,&d_reduction_411_mcrl2};
+D_Reduction * d_reductions_340_mcrl2[] = {&d_reduction_400_mcrl2};
+D_Reduction * d_reductions_341_mcrl2[] = {&d_reduction_401_mcrl2};
+unsigned char d_goto_valid_342_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_343_mcrl2[] = {&d_reduction_410_mcrl2};
+unsigned char d_goto_valid_345_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x2,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_347_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_348_mcrl2[] = {&d_reduction_413_mcrl2};
+D_Reduction * d_reductions_349_mcrl2[] = {&d_reduction_416_mcrl2};
+D_Reduction * d_reductions_350_mcrl2[] = {&d_reduction_416_mcrl2};
+D_Reduction * d_reductions_351_mcrl2[] = {&d_reduction_416_mcrl2};
+D_Reduction * d_reductions_356_mcrl2[] = {&d_reduction_425_mcrl2};
+unsigned char d_goto_valid_358_mcrl2[] = {
+0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xfc,0x25,0x9,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_359_mcrl2[] = {
+0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_360_mcrl2[] = {
+0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xfc,0x25,0x9,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_361_mcrl2[] = {
+0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xfc,0x25,0x9,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_362_mcrl2[] = {
+0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xfc,0x25,0x9,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_363_mcrl2[] = {
+0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xfc,0x25,0x9,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_364_mcrl2[] = {&d_reduction_13_mcrl2};
+D_Reduction * d_reductions_365_mcrl2[] = {&d_reduction_17_mcrl2};
+D_Reduction * d_reductions_366_mcrl2[] = {&d_reduction_16_mcrl2};
+unsigned char d_goto_valid_367_mcrl2[] = {
+0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xfc,0x25,0x9,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_368_mcrl2[] = {
+0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xfc,0x25,0x9,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_369_mcrl2[] = {
+0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_369_mcrl2[] = {&d_reduction_19_mcrl2};
+D_Reduction * d_reductions_370_mcrl2[] = {&d_reduction_21_mcrl2};
+D_Reduction * d_reductions_371_mcrl2[] = {&d_reduction_22_mcrl2};
+unsigned char d_goto_valid_372_mcrl2[] = {
+0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xfc,0x25,0x9,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_373_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_373_mcrl2[] = {&d_reduction_419_mcrl2};
+unsigned char d_goto_valid_374_mcrl2[] = {
+0x0,0x0,0xf,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_374_mcrl2[] = {&d_reduction_37_mcrl2};
+unsigned char d_goto_valid_375_mcrl2[] = {
+0x0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_375_mcrl2[] = {&d_reduction_26_mcrl2};
+D_RightEpsilonHint d_right_epsilon_hints_375_mcrl2[] = {{0, 644, &d_reduction_24_mcrl2}};
+D_Reduction * d_reductions_376_mcrl2[] = {&d_reduction_28_mcrl2};
+unsigned char d_goto_valid_377_mcrl2[] = {
+0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_377_mcrl2[] = {&d_reduction_31_mcrl2};
+unsigned char d_goto_valid_378_mcrl2[] = {
+0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_378_mcrl2[] = {&d_reduction_35_mcrl2};
+D_Reduction * d_reductions_379_mcrl2[] = {&d_reduction_38_mcrl2};
+unsigned char d_goto_valid_380_mcrl2[] = {
+0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_380_mcrl2[] = {&d_reduction_39_mcrl2};
+unsigned char d_goto_valid_381_mcrl2[] = {
+0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xfc,0x25,0x9,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_382_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_383_mcrl2[] = {
+0x0,0x0,0x40,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_383_mcrl2[] = {&d_reduction_44_mcrl2};
+D_Reduction * d_reductions_384_mcrl2[] = {&d_reduction_46_mcrl2};
+unsigned char d_goto_valid_385_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_386_mcrl2[] = {
+0x0,0x0,0x40,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_386_mcrl2[] = {&d_reduction_48_mcrl2};
+D_Reduction * d_reductions_387_mcrl2[] = {&d_reduction_50_mcrl2};
+unsigned char d_goto_valid_388_mcrl2[] = {
+0x0,0x0,0x0,0x80,0x0,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_388_mcrl2[] = {&d_reduction_52_mcrl2};
+D_Reduction * d_reductions_389_mcrl2[] = {&d_reduction_54_mcrl2};
+unsigned char d_goto_valid_390_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_391_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x4,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_391_mcrl2[] = {&d_reduction_56_mcrl2};
+D_Reduction * d_reductions_392_mcrl2[] = {&d_reduction_58_mcrl2};
+unsigned char d_goto_valid_393_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_394_mcrl2[] = {
+0x0,0x0,0x0,0x0,0xd0,0x41,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+D_Reduction * d_reductions_394_mcrl2[] = {&d_reduction_67_mcrl2};
+unsigned char d_goto_valid_395_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_396_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_396_mcrl2[] = {&d_reduction_89_mcrl2};
+D_Reduction * d_reductions_397_mcrl2[] = {&d_reduction_79_mcrl2};
+unsigned char d_goto_valid_398_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_399_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_400_mcrl2[] = {&d_reduction_79_mcrl2};
+unsigned char d_goto_valid_401_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_402_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x8,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_402_mcrl2[] = {&d_reduction_152_mcrl2};
+D_RightEpsilonHint d_right_epsilon_hints_402_mcrl2[] = {{0, 466, &d_reduction_150_mcrl2}};
+unsigned char d_goto_valid_403_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_404_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_405_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_405_mcrl2[] = {&d_reduction_75_mcrl2};
+unsigned char d_goto_valid_406_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_406_mcrl2[] = {&d_reduction_89_mcrl2};
+unsigned char d_goto_valid_407_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_407_mcrl2[] = {&d_reduction_89_mcrl2};
+unsigned char d_goto_valid_408_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_409_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_410_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_411_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x20,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_412_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+D_Reduction * d_reductions_413_mcrl2[] = {&d_reduction_68_mcrl2};
+unsigned char d_goto_valid_414_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+D_Reduction * d_reductions_415_mcrl2[] = {&d_reduction_121_mcrl2};
+D_Reduction * d_reductions_416_mcrl2[] = {&d_reduction_116_mcrl2};
+D_Reduction * d_reductions_417_mcrl2[] = {&d_reduction_135_mcrl2};
+D_Reduction * d_reductions_418_mcrl2[] = {&d_reduction_134_mcrl2};
+D_Reduction * d_reductions_419_mcrl2[] = {&d_reduction_133_mcrl2};
+D_Reduction * d_reductions_420_mcrl2[] = {&d_reduction_132_mcrl2};
+D_Reduction * d_reductions_421_mcrl2[] = {&d_reduction_131_mcrl2};
+D_Reduction * d_reductions_422_mcrl2[] = {&d_reduction_130_mcrl2};
+D_Reduction * d_reductions_423_mcrl2[] = {&d_reduction_129_mcrl2};
+D_Reduction * d_reductions_424_mcrl2[] = {&d_reduction_128_mcrl2};
+D_Reduction * d_reductions_425_mcrl2[] = {&d_reduction_127_mcrl2};
+D_Reduction * d_reductions_426_mcrl2[] = {&d_reduction_126_mcrl2};
+D_Reduction * d_reductions_427_mcrl2[] = {&d_reduction_125_mcrl2};
+D_Reduction * d_reductions_428_mcrl2[] = {&d_reduction_124_mcrl2};
+D_Reduction * d_reductions_429_mcrl2[] = {&d_reduction_123_mcrl2};
+D_Reduction * d_reductions_430_mcrl2[] = {&d_reduction_122_mcrl2};
+D_Reduction * d_reductions_431_mcrl2[] = {&d_reduction_120_mcrl2};
+D_Reduction * d_reductions_432_mcrl2[] = {&d_reduction_119_mcrl2};
+D_Reduction * d_reductions_433_mcrl2[] = {&d_reduction_118_mcrl2};
+D_Reduction * d_reductions_434_mcrl2[] = {&d_reduction_117_mcrl2};
+unsigned char d_goto_valid_435_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_436_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_437_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_438_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_439_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_440_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_441_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_442_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_443_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_444_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_445_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_446_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_447_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_448_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_449_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_450_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_451_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_452_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_453_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_454_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_455_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_456_mcrl2[] = {
+0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xfc,0x25,0x9,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_457_mcrl2[] = {
+0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xfc,0x25,0x9,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_458_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_458_mcrl2[] = {&d_reduction_71_mcrl2};
+unsigned char d_goto_valid_459_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_460_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_460_mcrl2[] = {&d_reduction_142_mcrl2};
+unsigned char d_goto_valid_461_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_461_mcrl2[] = {&d_reduction_142_mcrl2};
+unsigned char d_goto_valid_462_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_462_mcrl2[] = {&d_reduction_142_mcrl2};
+unsigned char d_goto_valid_463_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_464_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_465_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_465_mcrl2[] = {&d_reduction_146_mcrl2};
+unsigned char d_goto_valid_466_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_466_mcrl2[] = {&d_reduction_150_mcrl2};
+unsigned char d_goto_valid_467_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_468_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_468_mcrl2[] = {&d_reduction_155_mcrl2};
+unsigned char d_goto_valid_469_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_470_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_470_mcrl2[] = {&d_reduction_160_mcrl2};
+unsigned char d_goto_valid_471_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_471_mcrl2[] = {&d_reduction_164_mcrl2};
+D_Reduction * d_reductions_472_mcrl2[] = {&d_reduction_169_mcrl2};
+unsigned char d_goto_valid_473_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_474_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_475_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_475_mcrl2[] = {&d_reduction_172_mcrl2};
+D_Reduction * d_reductions_476_mcrl2[] = {&d_reduction_177_mcrl2};
+unsigned char d_goto_valid_477_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_478_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_479_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_479_mcrl2[] = {&d_reduction_180_mcrl2};
+D_Reduction * d_reductions_480_mcrl2[] = {&d_reduction_185_mcrl2};
+unsigned char d_goto_valid_481_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_482_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x8,0x0,0x0,0x0,0x30,0x9c,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x44,0x44,0x20,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_483_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+D_Reduction * d_reductions_484_mcrl2[] = {&d_reduction_77_mcrl2,&d_reduction_136_mcrl2};
+D_Reduction * d_reductions_485_mcrl2[] = {&d_reduction_77_mcrl2,&d_reduction_136_mcrl2};
+unsigned char d_goto_valid_486_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_487_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_488_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x63,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x4,0x1,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_489_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_489_mcrl2[] = {&d_reduction_75_mcrl2,&d_reduction_136_mcrl2,&d_reduction_224_mcrl2};
+D_RightEpsilonHint d_right_epsilon_hints_489_mcrl2[] = {{0, 519, &d_reduction_222_mcrl2}};
+D_Reduction * d_reductions_490_mcrl2[] = {&d_reduction_75_mcrl2,&d_reduction_136_mcrl2};
+unsigned char d_goto_valid_491_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_492_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_493_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_494_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_495_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_496_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_497_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_498_mcrl2[] = {&d_reduction_214_mcrl2,&d_reduction_215_mcrl2};
+D_Reduction * d_reductions_499_mcrl2[] = {&d_reduction_209_mcrl2};
+D_Reduction * d_reductions_500_mcrl2[] = {&d_reduction_211_mcrl2};
+D_Reduction * d_reductions_501_mcrl2[] = {&d_reduction_217_mcrl2};
+D_Reduction * d_reductions_502_mcrl2[] = {&d_reduction_219_mcrl2};
+D_Reduction * d_reductions_503_mcrl2[] = {&d_reduction_216_mcrl2};
+D_Reduction * d_reductions_504_mcrl2[] = {&d_reduction_212_mcrl2};
+D_Reduction * d_reductions_505_mcrl2[] = {&d_reduction_210_mcrl2};
+unsigned char d_goto_valid_506_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x30,0x9c,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0x60,0x0,0x0,0xc0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x44,0x44,0x20,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_507_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0x60,0x0,0x0,0xc0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_508_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x30,0x9c,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0x60,0x0,0x0,0xc0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x44,0x44,0x20,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_509_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x30,0x9c,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0x60,0x0,0x0,0xc0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x44,0x44,0x20,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_510_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x30,0x9c,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0x60,0x0,0x0,0xc0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x44,0x44,0x20,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_511_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x30,0x9c,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0x60,0x0,0x0,0xc0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x44,0x44,0x20,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_512_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x30,0x9c,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0x60,0x0,0x0,0xc0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x44,0x44,0x20,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_513_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x63,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x4,0x1,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_513_mcrl2[] = {&d_reduction_198_mcrl2};
+unsigned char d_goto_valid_514_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x63,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x4,0x1,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_514_mcrl2[] = {&d_reduction_198_mcrl2};
+unsigned char d_goto_valid_515_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x63,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x4,0x1,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x59,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_516_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x63,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x4,0x1,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_516_mcrl2[] = {&d_reduction_198_mcrl2};
+unsigned char d_goto_valid_517_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x63,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x4,0x1,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_517_mcrl2[] = {&d_reduction_198_mcrl2};
+unsigned char d_goto_valid_518_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x30,0x1,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+D_Reduction * d_reductions_518_mcrl2[] = {&d_reduction_221_mcrl2};
+D_Reduction * d_reductions_519_mcrl2[] = {&d_reduction_222_mcrl2};
+D_Reduction * d_reductions_520_mcrl2[] = {&d_reduction_223_mcrl2};
+unsigned char d_goto_valid_521_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_522_mcrl2[] = {
+0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xfc,0x25,0x9,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_523_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_524_mcrl2[] = {&d_reduction_227_mcrl2};
+D_Reduction * d_reductions_525_mcrl2[] = {&d_reduction_232_mcrl2};
+unsigned char d_goto_valid_526_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_526_mcrl2[] = {&d_reduction_230_mcrl2};
+unsigned char d_goto_valid_527_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_527_mcrl2[] = {&d_reduction_235_mcrl2};
+unsigned char d_goto_valid_528_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_529_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_530_mcrl2[] = {&d_reduction_240_mcrl2};
+D_Reduction * d_reductions_531_mcrl2[] = {&d_reduction_245_mcrl2};
+unsigned char d_goto_valid_532_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_532_mcrl2[] = {&d_reduction_243_mcrl2};
+unsigned char d_goto_valid_533_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x63,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x4,0x0,0x0,0x0,0x0,0x0,0x4,0x1,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_534_mcrl2[] = {&d_reduction_248_mcrl2};
+unsigned char d_goto_valid_535_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_535_mcrl2[] = {&d_reduction_256_mcrl2};
+D_RightEpsilonHint d_right_epsilon_hints_535_mcrl2[] = {{0, 754, &d_reduction_254_mcrl2}};
+D_Reduction * d_reductions_536_mcrl2[] = {&d_reduction_257_mcrl2};
+unsigned char d_goto_valid_537_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_537_mcrl2[] = {&d_reduction_267_mcrl2};
+D_Reduction * d_reductions_538_mcrl2[] = {&d_reduction_269_mcrl2};
+D_Reduction * d_reductions_539_mcrl2[] = {&d_reduction_266_mcrl2};
+unsigned char d_goto_valid_540_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_541_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_542_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_542_mcrl2[] = {&d_reduction_278_mcrl2};
+D_Reduction * d_reductions_543_mcrl2[] = {&d_reduction_282_mcrl2};
+D_Reduction * d_reductions_544_mcrl2[] = {&d_reduction_281_mcrl2};
+D_Reduction * d_reductions_545_mcrl2[] = {&d_reduction_280_mcrl2};
+unsigned char d_goto_valid_546_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_547_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_548_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_549_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_550_mcrl2[] = {&d_reduction_285_mcrl2};
+unsigned char d_goto_valid_551_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_552_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_552_mcrl2[] = {&d_reduction_289_mcrl2};
+D_Reduction * d_reductions_553_mcrl2[] = {&d_reduction_291_mcrl2};
+unsigned char d_goto_valid_554_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_555_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_556_mcrl2[] = {&d_reduction_295_mcrl2};
+D_Reduction * d_reductions_557_mcrl2[] = {&d_reduction_296_mcrl2};
+unsigned char d_goto_valid_558_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+D_Reduction * d_reductions_559_mcrl2[] = {&d_reduction_299_mcrl2};
+D_Reduction * d_reductions_560_mcrl2[] = {&d_reduction_300_mcrl2};
+unsigned char d_goto_valid_561_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_562_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_563_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_564_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_564_mcrl2[] = {&d_reduction_315_mcrl2};
+unsigned char d_goto_valid_565_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_566_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_567_mcrl2[] = {&d_reduction_318_mcrl2};
+D_Reduction * d_reductions_568_mcrl2[] = {&d_reduction_317_mcrl2};
+D_Reduction * d_reductions_569_mcrl2[] = {&d_reduction_316_mcrl2};
+unsigned char d_goto_valid_570_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x40,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_571_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x40,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_572_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x40,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_573_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+D_Reduction * d_reductions_574_mcrl2[] = {&d_reduction_309_mcrl2};
+D_Reduction * d_reductions_575_mcrl2[] = {&d_reduction_319_mcrl2};
+unsigned char d_goto_valid_576_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x78,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_577_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x78,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_577_mcrl2[] = {&d_reduction_333_mcrl2};
+unsigned char d_goto_valid_578_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_579_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_580_mcrl2[] = {&d_reduction_337_mcrl2};
+D_Reduction * d_reductions_581_mcrl2[] = {&d_reduction_336_mcrl2};
+D_Reduction * d_reductions_582_mcrl2[] = {&d_reduction_335_mcrl2};
+D_Reduction * d_reductions_583_mcrl2[] = {&d_reduction_334_mcrl2};
+unsigned char d_goto_valid_584_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_585_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0xc,0x0,0x0,0x0,0x0,0x8,0x4,0x0,0x0,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x40,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_586_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0xc,0x0,0x0,0x0,0x0,0x8,0x4,0x0,0x0,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x40,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_587_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0xc,0x0,0x0,0x0,0x0,0x8,0x4,0x0,0x0,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x40,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_588_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x78,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_588_mcrl2[] = {&d_reduction_338_mcrl2};
+unsigned char d_goto_valid_589_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x10,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_590_mcrl2[] = {&d_reduction_344_mcrl2};
+D_Reduction * d_reductions_591_mcrl2[] = {&d_reduction_342_mcrl2,&d_reduction_345_mcrl2};
+D_Reduction * d_reductions_592_mcrl2[] = {&d_reduction_342_mcrl2};
+unsigned char d_goto_valid_593_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0xc,0x0,0x0,0x0,0x0,0x8,0x84,0x0,0x0,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x40,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_594_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0xc,0x0,0x0,0x0,0x0,0x8,0x84,0x0,0x0,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x40,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_595_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_596_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x4,0x0,0x10,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_597_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_597_mcrl2[] = {&d_reduction_376_mcrl2};
+unsigned char d_goto_valid_598_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_599_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_600_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x80,0x10,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_601_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_602_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_603_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+D_Reduction * d_reductions_604_mcrl2[] = {&d_reduction_364_mcrl2};
+D_Reduction * d_reductions_605_mcrl2[] = {&d_reduction_383_mcrl2};
+unsigned char d_goto_valid_606_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+D_Reduction * d_reductions_607_mcrl2[] = {&d_reduction_364_mcrl2};
+D_Reduction * d_reductions_608_mcrl2[] = {&d_reduction_380_mcrl2};
+unsigned char d_goto_valid_609_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_609_mcrl2[] = {&d_reduction_350_mcrl2};
+D_RightEpsilonHint d_right_epsilon_hints_609_mcrl2[] = {{0, 795, &d_reduction_347_mcrl2},{0, 796, &d_reduction_348_mcrl2}};
+D_Reduction * d_reductions_610_mcrl2[] = {&d_reduction_352_mcrl2};
+D_Reduction * d_reductions_611_mcrl2[] = {&d_reduction_379_mcrl2};
+D_Reduction * d_reductions_612_mcrl2[] = {&d_reduction_378_mcrl2};
+D_Reduction * d_reductions_613_mcrl2[] = {&d_reduction_377_mcrl2};
+unsigned char d_goto_valid_614_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x2,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0xe0,0x0,0x0,0x40,0xa,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x4,0x0,0x0,0x0,0x0,0x40,0x1,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_615_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x2,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0xe0,0x0,0x0,0x40,0xa,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x4,0x0,0x0,0x0,0x0,0x40,0x1,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_616_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x2,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0xe0,0x0,0x0,0x40,0xa,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x4,0x0,0x0,0x0,0x0,0x40,0x1,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_617_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+D_Reduction * d_reductions_618_mcrl2[] = {&d_reduction_364_mcrl2};
+D_Reduction * d_reductions_619_mcrl2[] = {&d_reduction_386_mcrl2};
+unsigned char d_goto_valid_620_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_621_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_622_mcrl2[] = {&d_reduction_389_mcrl2};
+D_Reduction * d_reductions_623_mcrl2[] = {&d_reduction_390_mcrl2};
+unsigned char d_goto_valid_624_mcrl2[] = {
+0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xfc,0x25,0x9,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_625_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_625_mcrl2[] = {&d_reduction_394_mcrl2};
+D_Reduction * d_reductions_626_mcrl2[] = {&d_reduction_399_mcrl2};
+unsigned char d_goto_valid_627_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x87,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+D_Reduction * d_reductions_627_mcrl2[] = {&d_reduction_414_mcrl2};
+D_Reduction * d_reductions_628_mcrl2[] = {&d_reduction_415_mcrl2};
+unsigned char d_goto_valid_629_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_630_mcrl2[] = {
+0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_631_mcrl2[] = {&d_reduction_12_mcrl2};
+unsigned char d_goto_valid_632_mcrl2[] = {
+0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_633_mcrl2[] = {
+0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_634_mcrl2[] = {
+0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_635_mcrl2[] = {
+0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_636_mcrl2[] = {
+0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_636_mcrl2[] = {&d_reduction_12_mcrl2};
+unsigned char d_goto_valid_637_mcrl2[] = {
+0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_637_mcrl2[] = {&d_reduction_12_mcrl2};
+D_Reduction * d_reductions_638_mcrl2[] = {&d_reduction_20_mcrl2};
+unsigned char d_goto_valid_639_mcrl2[] = {
+0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_640_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_641_mcrl2[] = {&d_reduction_420_mcrl2};
+unsigned char d_goto_valid_642_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_643_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_644_mcrl2[] = {&d_reduction_24_mcrl2};
+D_Reduction * d_reductions_645_mcrl2[] = {&d_reduction_25_mcrl2};
+unsigned char d_goto_valid_646_mcrl2[] = {
+0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_647_mcrl2[] = {&d_reduction_32_mcrl2};
+unsigned char d_goto_valid_648_mcrl2[] = {
+0x0,0x0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_648_mcrl2[] = {&d_reduction_37_mcrl2};
+D_Reduction * d_reductions_649_mcrl2[] = {&d_reduction_40_mcrl2};
+unsigned char d_goto_valid_650_mcrl2[] = {
+0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_650_mcrl2[] = {&d_reduction_43_mcrl2};
+D_Reduction * d_reductions_651_mcrl2[] = {&d_reduction_47_mcrl2};
+D_Reduction * d_reductions_652_mcrl2[] = {&d_reduction_45_mcrl2};
+D_Reduction * d_reductions_653_mcrl2[] = {&d_reduction_51_mcrl2};
+D_Reduction * d_reductions_654_mcrl2[] = {&d_reduction_49_mcrl2};
+D_Reduction * d_reductions_655_mcrl2[] = {&d_reduction_53_mcrl2};
+D_Reduction * d_reductions_656_mcrl2[] = {&d_reduction_55_mcrl2};
+D_Reduction * d_reductions_657_mcrl2[] = {&d_reduction_57_mcrl2};
+D_Reduction * d_reductions_658_mcrl2[] = {&d_reduction_59_mcrl2};
+unsigned char d_goto_valid_659_mcrl2[] = {
+0x0,0x0,0x0,0x0,0xc0,0x41,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+D_Reduction * d_reductions_659_mcrl2[] = {&d_reduction_60_mcrl2,&d_reduction_67_mcrl2};
+D_Reduction * d_reductions_660_mcrl2[] = {&d_reduction_62_mcrl2};
+D_Reduction * d_reductions_661_mcrl2[] = {&d_reduction_86_mcrl2};
+D_Reduction * d_reductions_662_mcrl2[] = {&d_reduction_81_mcrl2};
+D_Reduction * d_reductions_663_mcrl2[] = {&d_reduction_81_mcrl2};
+unsigned char d_goto_valid_664_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+D_Reduction * d_reductions_665_mcrl2[] = {&d_reduction_81_mcrl2};
+D_Reduction * d_reductions_666_mcrl2[] = {&d_reduction_81_mcrl2};
+unsigned char d_goto_valid_667_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_668_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_669_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_670_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_671_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_672_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x2,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_673_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_674_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_674_mcrl2[] = {&d_reduction_95_mcrl2};
+unsigned char d_goto_valid_675_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_675_mcrl2[] = {&d_reduction_95_mcrl2};
+unsigned char d_goto_valid_676_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_676_mcrl2[] = {&d_reduction_95_mcrl2};
+unsigned char d_goto_valid_677_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_677_mcrl2[] = {&d_reduction_95_mcrl2};
+unsigned char d_goto_valid_678_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_678_mcrl2[] = {&d_reduction_95_mcrl2};
+unsigned char d_goto_valid_679_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_679_mcrl2[] = {&d_reduction_95_mcrl2};
+unsigned char d_goto_valid_680_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_680_mcrl2[] = {&d_reduction_95_mcrl2};
+unsigned char d_goto_valid_681_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_681_mcrl2[] = {&d_reduction_95_mcrl2};
+unsigned char d_goto_valid_682_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_682_mcrl2[] = {&d_reduction_95_mcrl2};
+unsigned char d_goto_valid_683_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_683_mcrl2[] = {&d_reduction_95_mcrl2};
+unsigned char d_goto_valid_684_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_684_mcrl2[] = {&d_reduction_95_mcrl2};
+unsigned char d_goto_valid_685_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_685_mcrl2[] = {&d_reduction_95_mcrl2};
+unsigned char d_goto_valid_686_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_686_mcrl2[] = {&d_reduction_95_mcrl2};
+unsigned char d_goto_valid_687_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_687_mcrl2[] = {&d_reduction_95_mcrl2};
+unsigned char d_goto_valid_688_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_688_mcrl2[] = {&d_reduction_95_mcrl2};
+unsigned char d_goto_valid_689_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_689_mcrl2[] = {&d_reduction_95_mcrl2};
+unsigned char d_goto_valid_690_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_690_mcrl2[] = {&d_reduction_95_mcrl2};
+unsigned char d_goto_valid_691_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_691_mcrl2[] = {&d_reduction_95_mcrl2};
+unsigned char d_goto_valid_692_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_692_mcrl2[] = {&d_reduction_95_mcrl2};
+unsigned char d_goto_valid_693_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_693_mcrl2[] = {&d_reduction_95_mcrl2};
+unsigned char d_goto_valid_694_mcrl2[] = {
+0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_694_mcrl2[] = {&d_reduction_69_mcrl2};
+unsigned char d_goto_valid_695_mcrl2[] = {
+0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_695_mcrl2[] = {&d_reduction_70_mcrl2};
+unsigned char d_goto_valid_696_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x90,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_697_mcrl2[] = {&d_reduction_72_mcrl2};
+D_Reduction * d_reductions_698_mcrl2[] = {&d_reduction_140_mcrl2};
+unsigned char d_goto_valid_699_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_700_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_700_mcrl2[] = {&d_reduction_145_mcrl2};
+unsigned char d_goto_valid_701_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_702_mcrl2[] = {&d_reduction_147_mcrl2};
+unsigned char d_goto_valid_703_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+D_Reduction * d_reductions_704_mcrl2[] = {&d_reduction_151_mcrl2};
+unsigned char d_goto_valid_705_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_705_mcrl2[] = {&d_reduction_154_mcrl2};
+unsigned char d_goto_valid_706_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+D_Reduction * d_reductions_707_mcrl2[] = {&d_reduction_156_mcrl2};
+D_Reduction * d_reductions_708_mcrl2[] = {&d_reduction_159_mcrl2};
+unsigned char d_goto_valid_709_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_710_mcrl2[] = {&d_reduction_161_mcrl2};
+unsigned char d_goto_valid_711_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_712_mcrl2[] = {&d_reduction_165_mcrl2};
+D_Reduction * d_reductions_713_mcrl2[] = {&d_reduction_168_mcrl2};
+unsigned char d_goto_valid_714_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_715_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_716_mcrl2[] = {&d_reduction_173_mcrl2};
+D_Reduction * d_reductions_717_mcrl2[] = {&d_reduction_176_mcrl2};
+D_Reduction * d_reductions_718_mcrl2[] = {&d_reduction_179_mcrl2};
+unsigned char d_goto_valid_719_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_720_mcrl2[] = {&d_reduction_181_mcrl2};
+D_Reduction * d_reductions_721_mcrl2[] = {&d_reduction_184_mcrl2};
+unsigned char d_goto_valid_722_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_723_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+D_Reduction * d_reductions_724_mcrl2[] = {&d_reduction_75_mcrl2,&d_reduction_136_mcrl2};
+D_Reduction * d_reductions_725_mcrl2[] = {&d_reduction_196_mcrl2};
+unsigned char d_goto_valid_726_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_727_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_728_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_729_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_730_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_731_mcrl2[] = {&d_reduction_218_mcrl2};
+unsigned char d_goto_valid_732_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_733_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x63,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x4,0x1,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_733_mcrl2[] = {&d_reduction_196_mcrl2};
+unsigned char d_goto_valid_734_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_734_mcrl2[] = {&d_reduction_196_mcrl2};
+unsigned char d_goto_valid_735_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x63,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x4,0x1,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_735_mcrl2[] = {&d_reduction_196_mcrl2};
+unsigned char d_goto_valid_736_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x63,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x4,0x1,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_736_mcrl2[] = {&d_reduction_196_mcrl2};
+unsigned char d_goto_valid_737_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x63,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x4,0x1,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_737_mcrl2[] = {&d_reduction_196_mcrl2};
+unsigned char d_goto_valid_738_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x63,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x4,0x1,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_738_mcrl2[] = {&d_reduction_196_mcrl2};
+unsigned char d_goto_valid_739_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x63,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x4,0x1,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_739_mcrl2[] = {&d_reduction_196_mcrl2};
+D_Reduction * d_reductions_740_mcrl2[] = {&d_reduction_213_mcrl2};
+D_Reduction * d_reductions_741_mcrl2[] = {&d_reduction_220_mcrl2};
+unsigned char d_goto_valid_742_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_743_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_744_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_744_mcrl2[] = {&d_reduction_75_mcrl2};
+D_Reduction * d_reductions_745_mcrl2[] = {&d_reduction_229_mcrl2};
+D_Reduction * d_reductions_746_mcrl2[] = {&d_reduction_226_mcrl2};
+D_Reduction * d_reductions_747_mcrl2[] = {&d_reduction_231_mcrl2};
+unsigned char d_goto_valid_748_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_749_mcrl2[] = {&d_reduction_236_mcrl2};
+unsigned char d_goto_valid_750_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_751_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x30,0x9c,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0x60,0x0,0x0,0xc0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x44,0x44,0x20,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+D_Reduction * d_reductions_752_mcrl2[] = {&d_reduction_244_mcrl2};
+D_Reduction * d_reductions_753_mcrl2[] = {&d_reduction_246_mcrl2};
+unsigned char d_goto_valid_754_mcrl2[] = {
+0x20,0x0,0x80,0x24,0x29,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x2,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x40,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x81,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_754_mcrl2[] = {&d_reduction_64_mcrl2,&d_reduction_254_mcrl2};
+D_Reduction * d_reductions_755_mcrl2[] = {&d_reduction_268_mcrl2};
+unsigned char d_goto_valid_756_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_757_mcrl2[] = {&d_reduction_275_mcrl2};
+unsigned char d_goto_valid_758_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_758_mcrl2[] = {&d_reduction_275_mcrl2};
+unsigned char d_goto_valid_759_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_759_mcrl2[] = {&d_reduction_275_mcrl2};
+unsigned char d_goto_valid_760_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_760_mcrl2[] = {&d_reduction_275_mcrl2};
+D_Reduction * d_reductions_761_mcrl2[] = {&d_reduction_283_mcrl2};
+unsigned char d_goto_valid_762_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_763_mcrl2[] = {&d_reduction_290_mcrl2};
+unsigned char d_goto_valid_764_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x40,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_765_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_766_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_767_mcrl2[] = {&d_reduction_303_mcrl2};
+unsigned char d_goto_valid_768_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_769_mcrl2[] = {&d_reduction_306_mcrl2};
+unsigned char d_goto_valid_770_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x40,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_771_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x40,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_772_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_772_mcrl2[] = {&d_reduction_312_mcrl2};
+unsigned char d_goto_valid_773_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_773_mcrl2[] = {&d_reduction_312_mcrl2};
+unsigned char d_goto_valid_774_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_774_mcrl2[] = {&d_reduction_312_mcrl2};
+unsigned char d_goto_valid_775_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_776_mcrl2[] = {&d_reduction_324_mcrl2};
+unsigned char d_goto_valid_777_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0xc,0x0,0x0,0x0,0x0,0x8,0x4,0x0,0x0,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x40,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_778_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0xc,0x0,0x0,0x0,0x0,0x8,0x4,0x0,0x0,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x40,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_779_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_779_mcrl2[] = {&d_reduction_329_mcrl2};
+unsigned char d_goto_valid_780_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x78,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_780_mcrl2[] = {&d_reduction_329_mcrl2};
+unsigned char d_goto_valid_781_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x78,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_781_mcrl2[] = {&d_reduction_329_mcrl2};
+unsigned char d_goto_valid_782_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x78,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_782_mcrl2[] = {&d_reduction_329_mcrl2};
+D_Reduction * d_reductions_783_mcrl2[] = {&d_reduction_339_mcrl2};
+unsigned char d_goto_valid_784_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x10,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_784_mcrl2[] = {&d_reduction_340_mcrl2};
+unsigned char d_goto_valid_785_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x10,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_785_mcrl2[] = {&d_reduction_340_mcrl2};
+D_Reduction * d_reductions_786_mcrl2[] = {&d_reduction_361_mcrl2};
+unsigned char d_goto_valid_787_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x2,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0xe0,0x0,0x0,0x40,0xa,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x4,0x0,0x0,0x0,0x0,0x40,0x1,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_788_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x2,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0xe0,0x0,0x0,0x40,0xa,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x4,0x0,0x0,0x0,0x0,0x40,0x1,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_789_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x2,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0xe0,0x0,0x0,0x40,0xa,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x4,0x0,0x0,0x0,0x0,0x40,0x1,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_790_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x2,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0xe0,0x0,0x0,0x40,0xa,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x4,0x0,0x0,0x0,0x0,0x40,0x1,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_791_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x2,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0xe0,0x0,0x0,0x40,0xa,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x4,0x0,0x0,0x0,0x0,0x40,0x1,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_792_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x2,0x0,0x0,0x80,0x0,0x1,0x0,0x0,0x0,0x0,0xe0,0x0,0x0,0x40,0xa,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x4,0x0,0x0,0x0,0x0,0x40,0x1,0x0,0x0,0x40,0x0};
+unsigned char d_goto_valid_793_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_793_mcrl2[] = {&d_reduction_385_mcrl2};
+unsigned char d_goto_valid_794_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_794_mcrl2[] = {&d_reduction_382_mcrl2};
+D_Reduction * d_reductions_795_mcrl2[] = {&d_reduction_347_mcrl2};
+unsigned char d_goto_valid_796_mcrl2[] = {
+0x20,0x0,0x80,0x4,0x29,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x40,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_796_mcrl2[] = {&d_reduction_64_mcrl2,&d_reduction_348_mcrl2};
+unsigned char d_goto_valid_797_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_797_mcrl2[] = {&d_reduction_371_mcrl2};
+unsigned char d_goto_valid_798_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_798_mcrl2[] = {&d_reduction_371_mcrl2};
+unsigned char d_goto_valid_799_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_799_mcrl2[] = {&d_reduction_371_mcrl2};
+unsigned char d_goto_valid_800_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_801_mcrl2[] = {&d_reduction_354_mcrl2};
+unsigned char d_goto_valid_802_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_803_mcrl2[] = {
+0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x26,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_804_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_805_mcrl2[] = {&d_reduction_395_mcrl2};
+unsigned char d_goto_valid_806_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x87,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+D_Reduction * d_reductions_806_mcrl2[] = {&d_reduction_407_mcrl2,&d_reduction_414_mcrl2};
+D_Reduction * d_reductions_807_mcrl2[] = {&d_reduction_409_mcrl2};
+unsigned char d_goto_valid_808_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x88,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x30,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_809_mcrl2[] = {&d_reduction_6_mcrl2};
+D_Reduction * d_reductions_810_mcrl2[] = {&d_reduction_6_mcrl2};
+D_Reduction * d_reductions_811_mcrl2[] = {&d_reduction_6_mcrl2};
+D_Reduction * d_reductions_812_mcrl2[] = {&d_reduction_6_mcrl2};
+D_Reduction * d_reductions_813_mcrl2[] = {&d_reduction_6_mcrl2};
+D_Reduction * d_reductions_814_mcrl2[] = {&d_reduction_23_mcrl2};
+D_Reduction * d_reductions_815_mcrl2[] = {&d_reduction_422_mcrl2};
+D_Reduction * d_reductions_816_mcrl2[] = {&d_reduction_30_mcrl2};
+D_Reduction * d_reductions_817_mcrl2[] = {&d_reduction_27_mcrl2};
+D_Reduction * d_reductions_818_mcrl2[] = {&d_reduction_34_mcrl2};
+D_Reduction * d_reductions_819_mcrl2[] = {&d_reduction_42_mcrl2};
+D_Reduction * d_reductions_820_mcrl2[] = {&d_reduction_61_mcrl2};
+unsigned char d_goto_valid_821_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x80,0x4,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_822_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_822_mcrl2[] = {&d_reduction_92_mcrl2};
+unsigned char d_goto_valid_823_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_823_mcrl2[] = {&d_reduction_92_mcrl2};
+unsigned char d_goto_valid_824_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_824_mcrl2[] = {&d_reduction_92_mcrl2};
+unsigned char d_goto_valid_825_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x10,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_826_mcrl2[] = {&d_reduction_88_mcrl2};
+unsigned char d_goto_valid_827_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+D_Reduction * d_reductions_828_mcrl2[] = {&d_reduction_115_mcrl2};
+D_Reduction * d_reductions_829_mcrl2[] = {&d_reduction_74_mcrl2};
+D_Reduction * d_reductions_830_mcrl2[] = {&d_reduction_141_mcrl2};
+D_Reduction * d_reductions_831_mcrl2[] = {&d_reduction_149_mcrl2};
+unsigned char d_goto_valid_832_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_832_mcrl2[] = {&d_reduction_153_mcrl2};
+D_Reduction * d_reductions_833_mcrl2[] = {&d_reduction_158_mcrl2};
+D_Reduction * d_reductions_834_mcrl2[] = {&d_reduction_163_mcrl2};
+D_Reduction * d_reductions_835_mcrl2[] = {&d_reduction_167_mcrl2};
+unsigned char d_goto_valid_836_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0};
+D_Reduction * d_reductions_837_mcrl2[] = {&d_reduction_175_mcrl2};
+D_Reduction * d_reductions_838_mcrl2[] = {&d_reduction_183_mcrl2};
+D_Reduction * d_reductions_839_mcrl2[] = {&d_reduction_86_mcrl2,&d_reduction_140_mcrl2};
+unsigned char d_goto_valid_840_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x30,0x9c,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0x60,0x0,0x0,0xc0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x44,0x44,0x20,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_841_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x30,0x9c,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0x60,0x0,0x0,0xc0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x44,0x44,0x20,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_842_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x30,0x9c,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0x60,0x0,0x0,0xc0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x44,0x44,0x20,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_843_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x30,0x9c,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0x60,0x0,0x0,0xc0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x44,0x44,0x20,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_844_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x30,0x9c,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0x60,0x0,0x0,0xc0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70,0x44,0x44,0x20,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+unsigned char d_goto_valid_845_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x80,0x1,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_846_mcrl2[] = {&d_reduction_225_mcrl2};
+D_Reduction * d_reductions_847_mcrl2[] = {&d_reduction_188_mcrl2};
+D_Reduction * d_reductions_848_mcrl2[] = {&d_reduction_238_mcrl2};
+D_Reduction * d_reductions_849_mcrl2[] = {&d_reduction_242_mcrl2};
+unsigned char d_goto_valid_850_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x63,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x4,0x0,0x0,0x0,0x0,0x0,0x4,0x1,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_851_mcrl2[] = {&d_reduction_255_mcrl2};
+unsigned char d_goto_valid_852_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_853_mcrl2[] = {&d_reduction_284_mcrl2};
+unsigned char d_goto_valid_854_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_855_mcrl2[] = {&d_reduction_298_mcrl2};
+D_Reduction * d_reductions_856_mcrl2[] = {&d_reduction_302_mcrl2};
+D_Reduction * d_reductions_857_mcrl2[] = {&d_reduction_304_mcrl2};
+unsigned char d_goto_valid_858_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_858_mcrl2[] = {&d_reduction_310_mcrl2};
+unsigned char d_goto_valid_859_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_859_mcrl2[] = {&d_reduction_310_mcrl2};
+D_Reduction * d_reductions_860_mcrl2[] = {&d_reduction_321_mcrl2};
+unsigned char d_goto_valid_861_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x78,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_861_mcrl2[] = {&d_reduction_327_mcrl2};
+unsigned char d_goto_valid_862_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x78,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_862_mcrl2[] = {&d_reduction_327_mcrl2};
+unsigned char d_goto_valid_863_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_863_mcrl2[] = {&d_reduction_374_mcrl2};
+unsigned char d_goto_valid_864_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_864_mcrl2[] = {&d_reduction_369_mcrl2};
+unsigned char d_goto_valid_865_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_865_mcrl2[] = {&d_reduction_369_mcrl2};
+unsigned char d_goto_valid_866_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_866_mcrl2[] = {&d_reduction_374_mcrl2};
+unsigned char d_goto_valid_867_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_867_mcrl2[] = {&d_reduction_367_mcrl2};
+unsigned char d_goto_valid_868_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_868_mcrl2[] = {&d_reduction_367_mcrl2};
+D_Reduction * d_reductions_869_mcrl2[] = {&d_reduction_349_mcrl2};
+D_Reduction * d_reductions_870_mcrl2[] = {&d_reduction_388_mcrl2};
+D_Reduction * d_reductions_871_mcrl2[] = {&d_reduction_392_mcrl2};
+unsigned char d_goto_valid_872_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x1,0x1,0x0,0x4,0x0,0x0,0xe0,0x2,0x0,0xc0,0x2a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x0};
+D_Reduction * d_reductions_873_mcrl2[] = {&d_reduction_397_mcrl2};
+D_Reduction * d_reductions_874_mcrl2[] = {&d_reduction_408_mcrl2};
+unsigned char d_goto_valid_875_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_876_mcrl2[] = {&d_reduction_84_mcrl2};
+D_Reduction * d_reductions_877_mcrl2[] = {&d_reduction_65_mcrl2};
+unsigned char d_goto_valid_878_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x80,0x1,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_879_mcrl2[] = {&d_reduction_171_mcrl2};
+unsigned char d_goto_valid_880_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x63,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x4,0x1,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_881_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x63,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x4,0x1,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_882_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x63,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x4,0x1,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_883_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x63,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x4,0x1,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_884_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,0x63,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x4,0x1,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x51,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+unsigned char d_goto_valid_885_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_886_mcrl2[] = {&d_reduction_239_mcrl2};
+D_Reduction * d_reductions_887_mcrl2[] = {&d_reduction_270_mcrl2};
+D_Reduction * d_reductions_888_mcrl2[] = {&d_reduction_292_mcrl2};
+unsigned char d_goto_valid_889_mcrl2[] = {
+0x0,0x0,0x0,0x0,0x0,0x80,0xff,0xff,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x80,0x84,0xff,0xdf,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+D_Reduction * d_reductions_889_mcrl2[] = {&d_reduction_393_mcrl2};
+D_Reduction * d_reductions_890_mcrl2[] = {&d_reduction_412_mcrl2};
+D_Reduction * d_reductions_891_mcrl2[] = {&d_reduction_87_mcrl2};
+D_Reduction * d_reductions_892_mcrl2[] = {&d_reduction_191_mcrl2};
+D_Reduction * d_reductions_893_mcrl2[] = {&d_reduction_191_mcrl2};
+D_Reduction * d_reductions_894_mcrl2[] = {&d_reduction_191_mcrl2};
+D_Reduction * d_reductions_895_mcrl2[] = {&d_reduction_191_mcrl2};
+D_Reduction * d_reductions_896_mcrl2[] = {&d_reduction_191_mcrl2};
+D_Reduction * d_reductions_897_mcrl2[] = {&d_reduction_208_mcrl2};
+unsigned short d_gotos_mcrl2[11135] = {
+94,101,114,104,118,106,108,109,110,100,107,146,112,109,110,113,
+148,150,151,120,162,122,173,96,124,125,164,165,126,180,127,174,
+185,176,186,211,177,179,182,183,191,216,188,189,213,218,97,218,
+222,98,235,225,236,219,220,227,221,253,262,251,276,319,271,329,
+246,247,327,273,355,248,267,359,252,361,278,362,363,364,372,374,
+330,354,331,332,116,378,328,356,358,106,376,377,380,381,365,140,
+141,142,270,330,382,268,269,143,370,371,374,392,393,395,457,373,
+383,152,384,385,150,394,458,459,464,272,344,274,465,466,469,471,
+470,254,472,116,475,476,479,480,212,223,492,214,493,494,116,495,
+159,496,212,528,212,182,477,563,464,166,478,187,181,368,369,530,
+531,520,521,187,168,181,175,163,175,499,368,369,610,163,625,520,
+521,555,540,167,526,602,368,369,527,147,149,149,626,116,116,628,
+115,169,642,116,650,560,561,188,481,328,562,352,482,111,102,541,
+652,103,105,111,105,184,95,190,172,81,82,83,84,85,86,87,
+178,88,524,525,89,608,609,90,641,654,91,117,272,95,648,92,
+81,82,83,84,85,86,87,99,88,119,121,89,123,123,90,657,
+529,91,274,659,95,559,92,81,82,83,84,85,86,87,519,88,
+144,145,89,214,181,90,116,254,91,128,144,145,522,92,149,168,
+217,116,663,128,160,161,664,345,105,343,665,129,353,153,115,375,
+212,116,275,666,667,129,102,532,550,103,457,533,170,171,261,154,
+187,215,144,145,150,409,130,131,132,224,133,128,226,144,145,245,
+130,131,132,245,133,266,128,249,250,277,155,156,318,129,123,134,
+135,668,136,669,137,551,138,523,129,134,135,93,136,670,137,639,
+138,249,250,157,158,249,250,93,130,131,132,93,133,93,139,357,
+254,557,558,130,131,132,464,133,464,228,93,202,366,367,259,260,
+223,134,135,464,136,709,137,630,138,366,367,229,134,135,230,136,
+93,137,93,138,125,366,367,231,93,127,93,649,203,204,607,93,
+93,603,205,206,207,93,261,208,708,93,209,93,713,350,351,615,
+616,617,93,93,556,328,389,390,144,145,93,318,93,93,93,93,
+714,128,150,391,93,386,254,575,576,647,387,388,285,286,552,255,
+93,645,646,129,93,93,176,619,620,473,93,623,624,474,149,703,
+93,116,150,410,93,553,554,269,93,93,93,93,212,93,130,131,
+132,717,133,605,606,718,618,622,232,233,234,721,256,257,705,574,
+287,228,237,93,93,698,722,134,135,279,136,711,137,727,138,210,
+161,150,411,229,238,258,230,239,192,93,240,93,125,125,715,231,
+241,127,127,732,612,613,614,93,139,733,154,93,102,93,93,103,
+728,93,139,259,542,218,280,281,93,747,121,93,139,294,220,93,
+719,752,730,538,539,155,156,93,93,368,369,150,497,594,595,282,
+93,252,283,712,284,755,707,93,218,93,139,520,521,175,157,158,
+294,220,729,753,93,139,295,99,150,498,320,757,149,296,762,116,
+765,768,117,360,119,242,150,566,123,731,763,254,321,771,243,322,
+263,233,234,115,255,125,116,244,323,295,127,772,149,778,750,116,
+298,264,716,265,702,299,720,93,346,312,212,779,193,194,195,368,
+369,789,196,288,228,175,197,93,313,790,198,314,315,312,199,316,
+704,256,257,710,792,200,229,793,809,230,604,149,223,212,116,125,
+201,644,231,326,127,817,297,591,519,827,258,164,674,317,829,172,
+289,290,150,567,697,819,300,831,396,592,837,277,93,324,593,93,
+139,317,571,572,573,112,109,110,643,291,300,178,292,93,293,99,
+99,190,816,289,290,149,249,250,116,756,117,117,119,119,806,121,
+123,123,818,301,302,303,252,835,93,841,383,749,291,653,842,292,
+843,293,149,93,333,116,844,301,302,303,150,579,304,325,845,305,
+149,306,379,116,172,535,334,93,217,335,307,836,259,543,184,336,
+304,805,337,305,127,306,93,139,366,367,347,348,349,464,307,796,
+797,144,145,847,848,150,580,397,465,95,128,217,81,82,83,84,
+85,86,87,850,88,856,93,89,99,857,90,748,129,91,163,861,
+249,250,92,117,854,119,871,93,838,123,150,599,568,569,570,872,
+150,600,166,891,254,277,898,130,131,132,839,133,149,255,632,116,
+386,144,145,407,93,0,655,338,0,266,128,0,399,215,366,367,
+134,135,99,136,224,137,93,138,277,547,548,549,129,117,0,119,
+308,309,93,123,105,764,269,0,277,0,256,257,111,93,585,586,
+587,588,175,0,308,309,93,130,131,132,214,133,277,116,0,0,
+849,93,0,258,149,832,0,116,115,0,402,116,93,0,0,403,
+134,135,0,136,310,137,311,138,0,339,340,341,342,408,343,0,
+0,0,461,93,93,93,0,181,310,404,311,656,170,405,0,149,
+144,145,116,187,93,215,150,391,95,128,880,81,82,83,84,85,
+86,87,99,88,0,462,89,0,93,90,0,129,91,117,830,119,
+412,92,0,123,149,249,250,116,0,93,149,144,145,116,874,93,
+615,616,617,352,128,212,130,131,132,93,133,0,144,145,93,330,
+0,0,581,582,583,128,129,544,545,546,331,803,93,0,115,134,
+135,116,136,0,137,0,138,129,0,0,93,330,0,547,548,549,
+0,130,131,132,398,133,0,0,163,0,275,0,0,585,586,587,
+588,0,130,131,132,0,133,0,93,139,134,135,0,136,0,137,
+93,138,368,369,368,369,160,161,406,145,0,134,135,0,136,153,
+137,128,138,0,876,93,144,145,212,584,368,369,0,460,0,128,
+0,154,0,129,0,612,613,614,0,160,161,93,400,758,0,215,
+149,129,153,116,0,0,93,0,93,139,0,0,155,156,130,131,
+132,463,133,401,154,249,250,0,149,144,145,116,130,131,132,0,
+133,0,128,0,0,157,158,134,135,0,136,93,137,0,138,155,
+156,0,0,93,129,134,135,0,136,93,137,0,138,658,0,0,
+0,581,582,583,93,150,394,0,157,158,0,544,545,546,93,130,
+131,132,93,133,437,438,439,440,441,442,443,444,445,446,447,448,
+449,450,451,452,453,454,455,456,134,135,0,136,0,137,93,138,
+150,751,547,548,549,350,351,93,139,93,93,0,571,572,573,93,
+0,93,437,438,439,440,441,442,443,444,445,446,447,448,449,450,
+451,452,453,454,455,456,144,145,584,0,259,759,150,766,93,128,
+285,564,93,139,93,160,161,0,507,508,509,510,93,0,153,511,
+512,129,513,93,139,0,93,0,770,571,572,573,368,369,0,0,
+154,366,367,366,367,285,565,0,93,810,0,0,130,131,132,0,
+133,0,93,0,287,0,0,0,0,366,367,155,156,279,0,93,
+0,0,254,368,369,134,135,0,136,0,137,255,138,0,0,149,
+0,0,116,0,157,158,0,0,0,287,615,616,617,93,139,93,
+139,0,279,368,369,413,568,569,570,320,280,281,0,93,139,93,
+544,545,546,0,0,0,414,0,256,257,149,321,0,116,322,0,
+93,139,0,282,125,0,283,323,284,127,93,0,0,368,369,280,
+281,258,0,413,415,0,0,0,594,595,0,0,500,0,594,595,
+93,139,93,568,569,570,149,0,282,116,0,283,416,284,0,417,
+631,368,369,0,418,419,420,421,422,423,424,425,426,427,428,429,
+430,431,415,432,433,434,435,0,436,784,0,0,501,368,369,612,
+613,614,502,368,369,0,368,369,0,0,416,0,324,417,503,0,
+0,0,418,419,420,421,422,423,424,425,426,427,428,429,430,431,
+0,432,433,434,435,0,436,437,438,439,440,441,442,443,444,445,
+446,447,448,449,450,451,452,453,454,455,456,366,367,0,815,277,
+0,467,591,0,259,760,594,595,591,820,109,110,611,93,139,259,
+761,0,504,0,592,791,505,0,506,593,592,735,93,139,0,593,
+0,0,366,367,277,0,0,0,0,437,438,439,440,441,442,443,
+444,445,446,447,448,449,450,451,452,453,454,455,456,0,585,586,
+587,588,366,367,615,616,617,99,615,616,617,93,254,0,0,0,
+0,0,117,333,119,255,0,254,123,93,0,0,811,0,0,0,
+255,0,0,460,0,334,788,0,335,93,0,787,366,367,336,0,
+93,337,0,127,777,0,95,0,202,81,82,83,84,85,86,87,
+591,88,256,257,89,0,0,90,0,0,91,0,0,256,257,92,
+366,367,592,0,93,0,0,593,413,489,204,258,812,0,0,205,
+206,207,813,0,208,814,258,209,0,0,202,0,366,367,0,160,
+161,0,366,367,0,366,367,0,153,612,613,614,0,612,613,614,
+93,0,581,582,583,0,338,415,0,0,154,514,204,547,548,549,
+111,205,206,207,0,0,208,259,853,209,413,202,0,0,0,416,
+0,0,417,0,215,155,156,418,419,420,421,422,423,424,425,426,
+427,428,429,430,431,468,432,433,434,435,0,436,515,204,157,158,
+0,0,205,206,207,0,0,208,0,415,209,0,490,491,547,548,
+549,368,369,0,0,483,571,572,573,584,627,342,0,343,0,254,
+0,416,0,0,417,0,0,484,255,418,419,420,421,422,423,424,
+425,426,427,428,429,430,431,0,432,433,434,435,0,436,210,161,
+0,99,485,486,132,0,133,192,571,572,573,0,117,0,119,615,
+616,617,123,0,0,256,257,0,202,154,0,487,488,0,136,0,
+137,0,138,585,586,587,588,571,572,573,0,544,545,546,258,210,
+161,0,0,93,155,156,0,0,192,516,204,547,548,549,93,205,
+206,207,0,0,208,0,0,209,202,802,154,218,0,157,158,0,
+0,0,0,294,220,0,615,616,617,193,194,195,0,93,0,196,
+568,569,570,197,0,155,156,198,0,517,204,199,544,545,546,205,
+206,207,200,0,208,0,0,209,615,616,617,0,295,201,157,158,
+0,0,0,577,612,613,614,585,586,587,588,193,194,195,594,595,
+0,196,568,569,570,197,93,139,0,198,0,0,0,199,215,0,
+0,0,0,0,200,0,0,581,582,583,0,0,210,161,0,201,
+212,568,569,570,0,192,0,93,0,288,0,0,193,194,195,0,
+366,367,196,0,873,0,197,154,0,0,198,612,613,614,199,585,
+586,587,588,594,595,200,0,0,0,544,545,546,210,161,0,0,
+201,0,155,156,0,192,289,290,202,0,0,0,0,612,613,614,
+615,616,617,93,139,0,0,154,0,0,0,157,158,0,584,291,
+0,0,292,237,293,777,93,202,591,518,204,581,582,583,0,205,
+206,207,155,156,208,238,0,209,239,0,592,240,0,0,125,593,
+0,241,0,127,0,93,139,0,534,204,0,157,158,0,205,206,
+207,0,0,208,0,0,209,0,0,193,194,195,0,0,217,196,
+218,0,0,197,571,572,573,198,294,220,0,199,0,591,547,548,
+549,0,200,581,582,583,93,139,0,0,0,0,0,201,0,592,
+0,0,584,0,593,612,613,614,0,193,194,195,0,0,0,196,
+0,295,0,197,0,0,242,198,578,0,0,199,210,161,0,243,
+0,536,200,0,0,192,0,0,537,0,0,277,0,201,571,572,
+573,0,0,889,571,572,573,154,0,0,0,210,161,0,0,0,
+0,0,0,0,192,212,0,218,0,0,584,0,0,0,288,294,
+220,888,155,156,0,0,154,585,586,587,588,0,0,0,218,0,
+0,0,585,586,587,588,294,220,0,0,0,157,158,0,568,569,
+570,155,156,93,139,0,0,93,295,0,0,289,290,0,0,589,
+585,586,587,588,590,585,586,587,588,312,157,158,544,545,546,295,
+0,99,0,0,291,0,298,292,0,293,0,597,117,0,119,596,
+121,0,123,93,139,0,0,0,0,193,194,195,212,0,0,196,
+0,312,0,197,0,297,0,198,568,569,570,199,0,317,568,569,
+570,0,200,212,0,0,300,598,193,194,195,0,297,201,196,0,
+0,0,197,217,0,0,198,0,0,0,199,581,582,583,0,0,
+0,200,289,290,0,317,581,582,583,0,0,0,201,312,300,615,
+616,617,0,301,302,303,0,0,0,289,290,291,633,0,292,0,
+293,0,0,621,581,582,583,0,0,581,582,583,304,0,0,305,
+0,306,291,0,0,292,218,293,0,0,307,301,302,303,294,220,
+277,317,0,0,615,616,617,0,0,0,300,615,616,617,215,615,
+616,617,584,0,304,224,226,305,0,306,217,0,0,584,615,616,
+617,0,307,93,139,0,0,295,0,0,0,0,0,0,298,0,
+0,217,0,601,0,634,0,301,302,303,0,584,0,0,0,0,
+584,0,93,139,612,613,614,0,0,0,0,0,93,0,0,0,
+304,635,0,305,0,306,0,0,0,0,0,212,0,0,307,0,
+0,0,0,0,297,0,0,277,636,0,0,0,0,0,0,0,
+308,309,0,0,0,0,0,0,277,612,613,614,0,0,277,637,
+612,613,614,0,612,613,614,0,0,0,0,0,0,0,0,0,
+0,289,290,612,613,614,638,0,308,309,0,0,0,0,0,0,
+277,0,0,0,310,0,311,0,0,0,291,0,0,292,640,293,
+0,0,95,93,0,81,82,83,84,85,86,87,0,88,0,0,
+89,0,0,90,93,0,91,0,0,651,93,92,310,0,311,0,
+0,0,0,0,308,309,0,0,0,0,0,0,277,660,0,661,
+141,142,0,0,0,0,0,143,0,217,0,0,93,437,438,439,
+440,441,442,443,444,445,446,447,448,449,450,451,452,453,454,455,
+456,0,0,0,0,0,0,0,310,0,311,95,0,0,81,82,
+83,84,85,86,87,0,88,0,0,89,0,0,90,0,0,91,
+0,0,0,0,92,0,0,95,93,0,81,82,83,84,85,86,
+87,0,88,0,0,89,277,0,90,0,0,91,0,0,95,0,
+92,81,82,83,84,85,86,87,0,88,0,0,89,0,0,90,
+0,0,91,0,0,95,0,92,81,82,83,84,85,86,87,0,
+88,0,0,89,0,0,90,0,0,91,0,0,95,0,92,81,
+82,83,84,85,86,87,0,88,0,0,89,0,0,90,0,0,
+91,0,93,0,95,92,0,81,82,83,84,85,86,87,0,88,
+144,145,89,0,0,90,0,0,91,128,0,0,0,92,413,95,
+0,0,81,82,83,84,85,86,87,0,88,129,0,89,695,629,
+90,0,0,91,0,0,0,0,92,0,0,0,0,0,0,0,
+0,0,0,0,0,0,130,131,132,0,133,696,0,415,0,0,
+0,0,0,0,0,0,0,0,0,93,0,0,0,0,0,134,
+135,0,136,0,137,416,138,0,417,0,0,0,0,418,419,420,
+421,422,423,424,425,426,427,428,429,430,431,0,432,433,434,435,
+0,436,437,438,439,440,441,442,443,444,445,446,447,448,449,450,
+451,452,453,454,455,456,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,93,0,0,437,438,439,440,441,442,443,444,445,446,447,
+448,449,450,451,452,453,454,455,456,0,0,0,0,0,93,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,93,0,0,437,438,439,440,441,442,443,444,
+445,446,447,448,449,450,451,452,453,454,455,456,93,0,0,0,
+0,0,467,0,95,0,0,81,82,83,84,85,86,87,0,88,
+0,0,89,93,0,90,0,0,91,0,0,0,0,92,0,0,
+0,95,0,0,81,82,83,84,85,86,87,93,88,0,0,89,
+0,0,90,413,662,91,0,93,139,0,92,0,0,0,97,0,
+0,746,0,0,0,0,93,0,0,0,437,438,439,440,441,442,
+443,444,445,446,447,448,449,450,451,452,453,454,455,456,0,0,
+0,0,415,0,0,0,413,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,416,0,0,417,0,0,
+0,0,418,419,420,421,422,423,424,425,426,427,428,429,430,431,
+0,432,433,434,435,415,436,0,0,413,0,507,508,509,510,0,
+0,0,511,512,804,513,0,0,0,0,0,0,0,416,0,0,
+417,0,0,0,468,418,419,420,421,422,423,424,425,426,427,428,
+429,430,431,0,432,433,434,435,415,436,437,438,439,440,441,442,
+443,444,445,446,447,448,449,450,451,452,453,454,455,456,0,0,
+416,0,0,417,0,0,0,0,418,419,420,421,422,423,424,425,
+426,427,428,429,430,431,0,432,433,434,435,413,436,437,438,439,
+440,441,442,443,444,445,446,447,448,449,450,451,452,453,454,455,
+456,0,0,0,95,0,726,81,82,83,84,85,86,87,0,88,
+0,0,89,0,0,90,0,0,91,0,415,93,0,92,0,500,
+0,0,0,0,0,0,673,0,0,0,0,0,0,0,0,0,
+0,0,416,0,0,417,0,166,93,0,418,419,420,421,422,423,
+424,425,426,427,428,429,430,431,0,432,433,434,435,0,436,501,
+0,672,0,0,0,502,0,0,0,675,0,0,0,0,0,0,
+0,503,0,676,0,0,0,0,0,0,95,413,0,81,82,83,
+84,85,86,87,0,88,0,0,89,0,0,90,0,0,91,0,
+0,0,0,92,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,677,0,0,0,0,415,0,0,0,413,0,
+0,678,0,0,0,504,0,0,0,505,0,506,0,0,0,0,
+0,0,416,671,0,417,0,0,0,0,418,419,420,421,422,423,
+424,425,426,427,428,429,430,431,679,432,433,434,435,415,436,144,
+145,0,0,680,0,0,0,0,128,0,0,0,0,0,0,0,
+144,145,0,0,0,416,0,0,417,128,129,0,0,418,419,420,
+421,422,423,424,425,426,427,428,429,430,431,129,432,433,434,435,
+0,436,144,145,0,130,131,132,0,133,0,128,144,145,0,0,
+0,0,681,0,0,128,130,131,132,0,133,0,0,129,134,135,
+0,136,0,137,0,138,0,129,0,0,0,93,0,0,0,134,
+135,0,136,0,137,0,138,0,130,131,132,0,133,682,144,145,
+0,0,130,131,132,0,133,128,0,0,144,145,0,0,0,0,
+0,134,135,128,136,0,137,0,138,129,0,134,135,0,136,0,
+137,0,138,0,0,129,0,0,0,0,0,0,0,0,0,0,
+0,144,145,0,130,131,132,0,133,0,128,683,144,145,0,0,
+130,131,132,0,133,128,0,0,0,0,0,0,129,134,135,0,
+136,93,137,0,138,0,0,129,0,134,135,0,136,0,137,0,
+138,0,0,684,0,0,0,130,131,132,0,133,0,0,0,0,
+0,0,130,131,132,0,133,0,0,0,0,144,145,0,0,237,
+134,135,0,136,128,137,0,138,0,0,0,134,135,0,136,0,
+137,238,138,685,239,0,129,240,0,0,125,0,0,241,0,127,
+0,686,0,0,0,0,144,145,0,0,0,0,0,0,0,128,
+0,130,131,132,0,133,93,139,0,0,0,0,0,0,0,0,
+0,129,0,0,0,687,0,93,139,0,134,135,0,136,0,137,
+0,138,0,0,0,0,0,0,0,0,0,0,130,131,132,0,
+133,0,0,0,144,145,0,0,0,93,139,0,0,128,0,0,
+0,0,242,93,139,134,135,0,136,0,137,243,138,0,0,129,
+0,688,0,0,852,0,0,0,0,0,0,0,144,145,0,0,
+0,0,0,0,0,128,0,0,0,0,130,131,132,0,133,0,
+0,0,689,0,0,93,139,129,0,0,0,0,0,0,0,0,
+0,93,139,134,135,0,136,0,137,0,138,0,144,145,0,0,
+0,0,130,131,132,128,133,0,0,690,144,145,0,0,0,0,
+0,0,0,128,0,0,0,129,93,139,0,134,135,0,136,0,
+137,0,138,93,139,129,0,0,0,0,0,0,0,99,144,145,
+0,0,130,131,132,0,133,128,117,0,119,691,121,0,123,0,
+130,131,132,0,133,0,692,0,0,129,0,134,135,0,136,0,
+137,0,138,0,0,0,0,0,0,134,135,0,136,0,137,0,
+138,0,93,139,130,131,132,693,133,0,144,145,0,0,0,0,
+0,0,0,128,0,0,0,0,694,0,0,0,0,134,135,0,
+136,0,137,0,138,129,0,0,0,0,0,144,145,93,139,0,
+0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,
+130,131,132,0,133,0,129,0,0,0,0,0,0,0,0,0,
+0,0,144,145,0,0,0,0,0,134,135,128,136,0,137,0,
+138,130,131,132,0,133,0,0,0,0,215,93,139,129,0,0,
+0,224,0,0,0,0,0,0,0,0,134,135,0,136,0,137,
+0,138,0,166,144,145,0,0,130,131,132,0,133,128,0,144,
+145,701,0,93,139,0,0,0,128,0,0,0,0,700,0,129,
+0,134,135,0,136,706,137,0,138,0,129,0,0,0,0,0,
+144,145,0,0,0,0,0,0,0,128,130,131,132,0,133,0,
+0,144,145,93,139,130,131,132,0,133,128,129,0,0,0,0,
+0,93,139,134,135,0,136,0,137,0,138,0,129,0,134,135,
+0,136,0,137,0,138,130,131,132,0,133,0,320,0,0,0,
+0,0,0,0,0,93,139,130,131,132,0,133,0,0,321,134,
+135,322,136,0,137,0,138,125,0,0,323,0,127,0,0,0,
+134,135,0,136,0,137,0,138,437,438,439,440,441,442,443,444,
+445,446,447,448,449,450,451,452,453,454,455,456,144,145,0,0,
+0,93,139,0,0,128,0,0,0,0,144,145,0,0,507,508,
+509,510,0,128,0,511,512,129,513,0,0,0,0,0,144,145,
+0,0,93,139,0,129,0,128,0,0,0,0,0,0,0,324,
+0,0,130,131,132,0,133,0,0,129,0,0,0,0,0,0,
+130,131,132,0,133,0,0,0,0,93,139,134,135,0,136,0,
+137,0,138,0,130,131,132,723,133,134,135,0,136,0,137,0,
+138,397,0,0,0,0,0,0,0,0,0,407,202,134,135,870,
+136,0,137,0,138,0,461,0,0,0,0,93,139,0,0,0,
+462,0,0,0,0,0,93,139,0,0,0,0,0,489,204,0,
+0,0,0,205,206,207,0,0,208,413,699,209,0,0,0,0,
+0,0,500,0,0,0,0,93,139,0,99,0,0,0,0,0,
+0,0,0,0,0,117,0,119,93,139,0,123,0,0,0,0,
+0,0,408,0,0,0,0,0,415,0,0,0,0,0,0,0,
+0,0,501,0,0,0,0,463,502,0,0,0,0,0,0,0,
+416,0,0,417,503,0,0,0,418,419,420,421,422,423,424,425,
+426,427,428,429,430,431,0,432,433,434,435,0,436,0,0,0,
+490,491,0,0,0,507,508,509,510,483,725,491,511,512,0,513,
+0,0,0,724,725,491,0,0,0,0,0,484,0,724,0,0,
+0,0,0,93,139,484,0,0,504,0,0,0,505,0,506,484,
+0,93,139,0,0,0,485,486,132,0,133,0,0,0,0,0,
+485,486,132,0,133,93,139,215,0,0,485,486,132,0,133,487,
+488,202,136,0,137,0,138,0,0,487,488,0,136,0,137,0,
+138,0,0,487,488,0,136,0,137,0,138,725,491,0,0,0,
+0,0,734,204,724,0,0,0,205,206,207,0,0,208,0,0,
+209,285,773,0,0,0,484,0,0,0,0,0,0,193,194,195,
+0,0,0,196,0,0,0,197,0,500,0,198,0,0,0,199,
+0,485,486,132,202,133,200,0,0,0,0,0,0,0,0,0,
+0,201,0,0,0,287,0,0,202,0,487,488,0,136,279,137,
+0,138,0,0,0,736,204,0,0,501,0,205,206,207,0,502,
+208,0,0,209,0,0,0,0,0,737,204,503,0,0,0,205,
+206,207,0,0,208,210,161,209,0,0,0,280,281,0,192,0,
+0,202,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+154,0,0,0,282,0,0,283,0,284,0,0,0,0,0,0,
+0,0,738,204,0,0,0,0,205,206,207,155,156,208,0,504,
+209,0,202,505,0,506,0,93,139,0,0,0,0,0,0,0,
+0,93,139,0,157,158,0,0,210,161,0,93,139,0,0,0,
+0,192,0,739,204,0,0,0,0,205,206,207,210,161,208,0,
+0,209,0,154,0,192,0,0,0,0,0,0,0,0,0,0,
+0,0,0,507,508,509,510,154,0,0,511,512,0,513,155,156,
+0,0,193,194,195,0,0,0,196,0,0,0,197,0,0,0,
+198,0,155,156,199,210,161,157,158,0,0,200,0,0,192,0,
+277,0,93,139,0,0,201,0,0,0,0,157,158,0,0,0,
+154,507,508,509,510,0,0,0,511,512,0,513,0,0,0,0,
+0,0,0,0,0,0,210,161,0,0,0,155,156,0,0,192,
+0,0,0,0,0,193,194,195,0,0,0,196,0,202,0,197,
+0,154,0,198,157,158,0,199,0,193,194,195,93,0,200,196,
+0,0,0,197,0,0,0,198,0,201,0,199,155,156,740,204,
+0,0,200,0,205,206,207,500,0,208,0,0,209,201,0,0,
+507,508,509,510,0,157,158,511,512,0,513,0,93,139,0,0,
+0,0,193,194,195,0,0,0,196,0,0,0,197,0,0,0,
+198,0,0,0,199,0,0,501,0,0,0,200,0,502,166,0,
+0,0,0,0,0,500,201,0,0,503,0,0,0,285,774,0,
+0,0,0,193,194,195,0,0,743,196,0,0,0,197,0,0,
+0,198,0,0,0,199,0,0,166,0,0,0,200,0,0,93,
+139,210,161,0,0,501,0,201,0,0,192,502,0,0,164,742,
+0,287,743,93,139,0,0,503,0,0,279,0,154,504,0,0,
+741,505,0,506,0,507,508,509,510,0,0,0,511,512,0,513,
+0,0,0,0,500,166,0,155,156,0,0,744,0,0,0,0,
+0,0,0,0,0,0,0,280,281,0,0,0,93,139,0,767,
+157,158,0,0,0,0,769,0,0,0,0,504,0,0,0,505,
+282,506,0,283,501,284,0,166,0,0,502,0,0,0,0,0,
+0,0,0,0,0,0,503,144,145,0,0,0,0,93,139,0,
+128,776,0,0,0,0,0,0,0,0,0,0,0,0,193,194,
+195,0,129,0,196,0,0,780,197,0,0,0,198,0,0,0,
+199,745,145,0,0,0,0,200,0,0,128,0,0,130,131,132,
+0,133,201,754,0,0,0,0,0,500,504,0,129,0,505,0,
+506,0,0,0,0,0,134,135,0,136,0,137,218,138,0,0,
+0,285,775,0,294,220,0,130,131,132,0,133,0,0,144,145,
+0,0,0,0,0,0,0,128,0,501,0,0,277,0,0,502,
+134,135,0,136,0,137,0,138,0,129,0,503,0,295,0,144,
+145,0,0,0,781,287,0,0,128,0,0,0,0,0,279,0,
+144,145,0,0,130,131,132,0,133,128,129,0,0,0,0,0,
+0,0,0,0,0,0,0,0,93,139,0,129,0,134,135,0,
+136,212,137,0,138,130,131,132,93,133,288,280,281,0,0,504,
+144,145,0,505,0,506,130,131,132,128,133,0,0,0,134,135,
+0,136,0,137,282,138,0,283,0,284,0,129,0,0,0,134,
+135,0,136,0,137,0,138,289,290,0,0,0,218,0,0,0,
+0,0,794,0,294,220,130,131,132,218,133,0,0,0,0,0,
+291,294,220,292,0,293,0,0,0,0,0,0,0,0,0,134,
+135,0,136,218,137,0,138,0,0,0,0,294,220,295,93,139,
+0,0,0,0,782,218,0,0,0,0,295,0,0,294,220,0,
+0,783,0,0,0,0,0,0,0,0,0,0,0,0,0,217,
+0,0,0,0,295,0,0,0,93,139,795,298,0,0,0,0,
+785,212,0,0,0,0,295,0,0,0,288,0,0,298,212,0,
+277,0,786,0,0,0,0,288,0,0,0,0,0,0,0,0,
+0,166,0,0,821,141,142,312,212,0,0,0,143,0,0,0,
+0,297,0,0,0,93,139,289,290,0,212,801,277,798,0,0,
+0,0,0,297,289,290,0,0,0,0,0,144,145,0,0,0,
+291,0,0,292,128,293,93,139,0,0,0,317,93,291,289,290,
+292,0,293,0,300,312,129,93,139,0,0,0,0,0,0,0,
+289,290,0,0,0,312,0,291,0,0,292,799,293,0,0,0,
+0,130,131,132,0,133,0,0,93,291,0,800,292,0,293,217,
+0,301,302,303,0,0,0,93,139,317,134,135,217,136,0,137,
+0,138,300,144,145,0,0,0,0,317,304,0,128,305,0,306,
+0,0,300,0,346,0,217,0,307,0,0,0,0,0,129,0,
+0,0,0,0,0,0,0,0,217,0,144,145,0,0,0,301,
+302,303,0,128,0,144,145,0,0,130,131,132,277,133,128,301,
+302,303,0,0,822,129,0,0,304,277,0,305,0,306,0,0,
+129,0,134,135,0,136,307,137,304,138,0,305,0,306,0,0,
+130,131,132,277,133,0,307,0,0,0,0,130,131,132,0,133,
+0,0,0,0,823,277,0,0,0,134,135,0,136,0,137,0,
+138,0,0,824,134,135,0,136,93,137,0,138,0,0,308,309,
+0,0,0,0,0,93,277,0,0,0,0,0,0,0,0,0,
+0,0,0,0,825,0,0,0,0,0,0,0,0,0,0,93,
+0,0,0,0,807,826,808,348,349,0,0,0,0,144,145,0,
+0,93,310,0,311,0,128,0,0,0,0,0,308,309,0,0,
+0,0,93,139,277,0,0,0,129,0,0,0,308,309,0,0,
+0,0,93,0,277,0,0,0,0,0,0,0,0,144,145,0,
+0,0,0,130,131,132,128,133,0,0,0,0,0,0,0,0,
+310,0,311,0,0,0,0,0,129,0,0,0,134,135,0,136,
+310,137,311,138,0,0,0,0,0,0,0,0,0,144,145,0,
+93,0,0,130,131,132,128,133,0,0,93,139,144,145,0,0,
+93,0,0,0,0,128,0,0,129,0,0,0,134,135,0,136,
+0,137,0,138,0,0,0,129,0,0,0,0,0,144,145,0,
+0,93,139,130,131,132,128,133,0,0,0,0,93,139,144,145,
+0,0,130,131,132,0,133,128,129,0,0,0,134,135,0,136,
+0,137,0,138,0,0,0,0,0,129,0,134,135,0,136,0,
+137,0,138,130,131,132,0,133,0,0,0,0,0,0,0,0,
+0,0,0,0,130,131,132,0,133,0,0,0,134,135,0,136,
+0,137,0,138,0,0,0,0,833,0,0,0,0,134,135,0,
+136,0,137,0,138,437,438,439,440,441,442,443,444,445,446,447,
+448,449,450,451,452,453,454,455,456,0,0,0,0,0,0,0,
+0,0,0,285,855,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,93,139,0,0,437,438,439,440,441,442,443,444,
+445,446,447,448,449,450,451,452,453,454,455,456,0,0,0,0,
+0,0,0,0,0,0,0,287,0,0,0,0,0,0,0,0,
+279,0,0,0,93,139,0,0,0,0,0,437,438,439,440,441,
+442,443,444,445,446,447,448,449,450,451,452,453,454,455,456,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,280,281,0,
+0,0,0,0,93,139,0,0,0,0,0,0,0,0,0,0,
+0,144,145,93,139,0,282,0,0,283,128,284,0,0,0,0,
+0,0,0,0,0,0,413,0,0,0,0,0,129,0,0,0,
+0,0,0,0,93,139,0,828,0,0,0,0,0,0,0,0,
+0,0,0,0,0,93,139,130,131,132,0,133,0,0,0,0,
+0,0,0,0,0,415,0,0,0,413,0,0,0,0,0,0,
+134,135,0,136,0,137,0,138,0,0,0,0,0,416,0,0,
+417,0,0,0,0,418,419,420,421,422,423,424,425,426,427,428,
+429,430,431,0,432,433,434,435,415,436,0,0,413,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+416,0,277,417,0,0,0,0,418,419,420,421,422,423,424,425,
+426,427,428,429,430,431,0,432,433,434,435,415,436,437,438,439,
+440,441,442,443,444,445,446,447,448,449,450,451,452,453,454,455,
+456,0,0,416,0,0,417,0,0,0,0,418,419,420,421,422,
+423,424,425,426,427,428,429,430,431,0,432,433,434,435,93,436,
+437,438,439,440,441,442,443,444,445,446,447,448,449,450,451,452,
+453,454,455,456,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,437,438,439,440,441,442,443,444,445,446,447,448,449,
+450,451,452,453,454,455,456,0,93,139,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,437,438,439,440,441,442,443,444,445,446,
+447,448,449,450,451,452,453,454,455,456,0,0,0,0,413,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,437,438,439,440,441,442,443,
+444,445,446,447,448,449,450,451,452,453,454,455,456,415,0,0,
+0,413,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,416,0,0,417,0,0,0,0,418,419,420,
+421,422,423,424,425,426,427,428,429,430,431,0,432,433,434,435,
+415,436,0,0,413,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,416,0,0,417,0,0,0,0,
+418,419,420,421,422,423,424,425,426,427,428,429,430,431,0,432,
+433,434,435,415,436,0,0,413,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,416,0,0,417,0,
+0,0,0,418,419,420,421,422,423,424,425,426,427,428,429,430,
+431,0,432,433,434,435,415,436,0,0,413,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,416,0,
+0,417,0,0,0,0,418,419,420,421,422,423,424,425,426,427,
+428,429,430,431,0,432,433,434,435,415,436,437,438,439,440,441,
+442,443,444,445,446,447,448,449,450,451,452,453,454,455,456,0,
+0,416,0,0,417,0,0,0,0,418,419,420,421,422,423,424,
+425,426,427,428,429,430,431,0,432,433,434,435,0,436,437,438,
+439,440,441,442,443,444,445,446,447,448,449,450,451,452,453,454,
+455,456,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,437,438,439,440,441,442,443,444,445,446,447,448,449,450,451,
+452,453,454,455,456,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,437,438,439,440,441,442,443,444,445,446,447,448,
+449,450,451,452,453,454,455,456,0,0,0,0,413,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,437,438,439,440,441,442,443,444,445,
+446,447,448,449,450,451,452,453,454,455,456,415,0,0,0,413,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,416,0,0,417,0,0,0,0,418,419,420,421,422,
+423,424,425,426,427,428,429,430,431,0,432,433,434,435,415,436,
+0,0,413,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,416,0,0,417,0,0,0,0,418,419,
+420,421,422,423,424,425,426,427,428,429,430,431,0,432,433,434,
+435,415,436,0,0,413,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,416,0,0,417,0,0,0,
+0,418,419,420,421,422,423,424,425,426,427,428,429,430,431,0,
+432,433,434,435,415,436,0,0,413,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,416,0,0,417,
+0,0,0,0,418,419,420,421,422,423,424,425,426,427,428,429,
+430,431,0,432,433,434,435,415,436,437,438,439,440,441,442,443,
+444,445,446,447,448,449,450,451,452,453,454,455,456,0,0,416,
+0,0,417,0,0,0,0,418,419,420,421,422,423,424,425,426,
+427,428,429,430,431,0,432,433,434,435,0,436,437,438,439,440,
+441,442,443,444,445,446,447,448,449,450,451,452,453,454,455,456,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,437,
+438,439,440,441,442,443,444,445,446,447,448,449,450,451,452,453,
+454,455,456,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,437,438,439,440,441,442,443,444,445,446,447,448,449,450,
+451,452,453,454,455,456,0,0,0,0,413,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,437,438,439,440,441,442,443,444,445,446,447,
+448,449,450,451,452,453,454,455,456,415,0,0,0,413,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,416,0,0,417,0,0,0,0,418,419,420,421,422,423,424,
+425,426,427,428,429,430,431,0,432,433,434,435,415,436,0,0,
+413,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,416,0,0,417,0,0,0,0,418,419,420,421,
+422,423,424,425,426,427,428,429,430,431,0,432,433,434,435,415,
+436,0,0,413,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,416,0,0,417,0,0,0,0,418,
+419,420,421,422,423,424,425,426,427,428,429,430,431,0,432,433,
+434,435,415,436,0,0,413,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,416,0,0,417,0,0,
+0,0,418,419,420,421,422,423,424,425,426,427,428,429,430,431,
+0,432,433,434,435,415,436,437,438,439,440,441,442,443,444,445,
+446,447,448,449,450,451,452,453,454,455,456,0,0,416,0,0,
+417,0,0,0,0,418,419,420,421,422,423,424,425,426,427,428,
+429,430,431,0,432,433,434,435,0,436,437,438,439,440,441,442,
+443,444,445,446,447,448,449,450,451,452,453,454,455,456,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,437,438,439,
+440,441,442,443,444,445,446,447,448,449,450,451,452,453,454,455,
+456,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+437,438,439,440,441,442,443,444,445,446,447,448,449,450,451,452,
+453,454,455,456,0,0,0,0,413,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,437,438,439,440,441,442,443,444,445,446,447,448,449,
+450,451,452,453,454,455,456,415,0,0,0,413,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,416,
+0,0,417,0,0,0,0,418,419,420,421,422,423,424,425,426,
+427,428,429,430,431,0,432,433,434,435,415,436,0,0,413,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,416,0,0,417,0,0,0,0,418,419,420,421,422,423,
+424,425,426,427,428,429,430,431,0,432,433,434,435,415,436,168,
+0,413,0,0,507,508,509,510,0,723,0,511,512,0,513,507,
+508,509,510,846,0,416,511,512,417,513,0,0,834,418,419,420,
+421,422,423,424,425,426,427,428,429,430,431,0,432,433,434,435,
+415,436,0,0,413,0,0,0,0,0,0,507,508,509,510,0,
+0,0,511,512,0,513,0,0,416,0,0,417,0,0,0,0,
+418,419,420,421,422,423,424,425,426,427,428,429,430,431,0,432,
+433,434,435,415,436,437,438,439,440,441,442,443,444,445,446,447,
+448,449,450,451,452,453,454,455,456,0,0,416,0,0,417,0,
+0,0,0,418,419,420,421,422,423,424,425,426,427,428,429,430,
+431,0,432,433,434,435,0,436,500,0,0,0,0,0,0,0,
+0,0,0,500,0,0,0,0,144,145,0,0,0,0,0,0,
+0,128,144,145,0,0,0,507,508,509,510,128,144,145,511,512,
+0,513,0,129,0,128,0,0,501,0,0,0,0,129,502,500,
+0,0,0,501,0,0,0,129,0,502,503,0,0,0,130,131,
+132,0,133,0,0,503,0,0,130,131,132,0,133,0,0,0,
+0,0,130,131,132,0,133,134,135,0,136,0,137,0,138,501,
+0,134,135,0,136,502,137,0,138,0,0,134,135,0,136,0,
+137,503,138,0,0,0,413,840,0,0,0,0,0,0,504,0,
+0,0,505,0,506,0,0,0,0,504,0,0,0,505,0,506,
+507,508,509,510,0,0,0,511,512,0,513,0,0,0,0,507,
+508,509,510,0,0,415,511,512,0,513,0,500,0,0,0,0,
+0,0,0,0,0,504,0,0,0,505,0,506,202,416,0,0,
+417,0,285,859,0,418,419,420,421,422,423,424,425,426,427,428,
+429,430,431,0,432,433,434,435,0,436,0,501,0,851,204,0,
+0,502,0,205,206,207,0,0,208,0,0,209,0,503,0,0,
+0,285,860,0,0,0,287,0,0,0,0,0,0,0,0,279,
+0,0,437,438,439,440,441,442,443,444,445,446,447,448,449,450,
+451,452,453,454,455,456,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,500,287,0,0,0,0,0,0,280,281,279,93,
+139,504,0,500,0,505,0,506,0,93,139,0,0,0,218,0,
+0,0,0,93,139,282,294,220,283,0,284,0,0,0,0,0,
+210,161,0,0,501,0,0,0,0,192,502,280,281,0,0,0,
+0,0,0,501,0,0,503,0,0,502,0,154,0,0,0,295,
+0,0,0,0,282,503,862,283,0,284,0,0,0,0,0,0,
+218,0,0,0,0,0,155,156,294,220,437,438,439,440,441,442,
+443,444,445,446,447,448,449,450,451,452,453,454,455,456,0,157,
+158,0,0,212,0,0,0,0,0,0,504,0,288,312,505,0,
+506,295,0,413,858,0,0,0,863,504,0,0,312,505,0,506,
+0,0,0,864,0,0,0,0,0,0,0,0,0,0,0,0,
+0,277,865,0,0,0,0,0,0,289,290,0,0,193,194,195,
+0,317,415,196,0,212,0,197,0,0,300,198,0,0,288,199,
+317,0,291,0,0,292,200,293,0,300,416,0,0,417,0,0,
+277,201,418,419,420,421,422,423,424,425,426,427,428,429,430,431,
+0,432,433,434,435,0,436,301,302,303,0,289,290,93,0,0,
+0,0,0,0,0,0,301,302,303,0,0,0,0,0,0,0,
+304,217,0,305,291,306,0,292,0,293,0,413,0,0,307,304,
+0,0,305,0,306,0,312,0,0,0,0,0,93,307,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,866,0,0,0,
+0,0,0,0,0,0,0,0,0,312,415,0,0,0,0,0,
+0,0,0,217,0,0,0,93,139,0,317,0,0,0,277,867,
+0,0,416,300,0,417,0,0,0,0,418,419,420,421,422,423,
+424,425,426,427,428,429,430,431,0,432,433,434,435,317,436,0,
+0,0,0,0,312,0,300,0,312,0,0,0,0,0,0,0,
+301,302,303,0,308,309,0,0,0,0,868,0,277,0,869,0,
+277,0,0,308,309,0,0,0,0,304,93,277,305,0,306,0,
+0,0,0,301,302,303,0,307,317,0,0,0,317,0,0,0,
+0,300,0,0,0,300,0,0,310,0,311,0,304,0,0,305,
+0,306,0,0,0,0,346,310,0,311,307,0,0,0,0,0,
+0,0,0,0,0,0,0,0,93,0,0,0,93,0,301,302,
+303,0,301,302,303,0,0,93,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,304,0,0,305,304,306,0,305,0,
+306,0,0,0,0,307,0,0,0,307,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,308,309,0,
+0,0,0,0,0,277,437,438,439,440,441,442,443,444,445,446,
+447,448,449,450,451,452,453,454,455,456,0,0,0,0,0,0,
+308,309,0,0,0,0,0,0,277,0,0,0,0,0,0,0,
+0,310,0,311,437,438,439,440,441,442,443,444,445,446,447,448,
+449,450,451,452,453,454,455,456,875,348,349,0,0,0,0,144,
+145,93,0,0,310,0,311,0,128,0,0,308,309,0,0,308,
+309,0,0,277,0,0,0,277,0,0,129,0,0,0,0,0,
+0,0,0,0,93,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,130,131,132,0,133,0,0,0,0,0,310,
+0,311,0,310,0,311,0,0,0,0,0,0,0,0,134,135,
+0,136,0,137,0,138,0,0,0,0,0,0,0,0,0,93,
+0,0,0,93,0,0,0,413,437,438,439,440,441,442,443,444,
+445,446,447,448,449,450,451,452,453,454,455,456,0,0,0,0,
+0,0,0,507,508,509,510,0,0,0,511,512,0,513,0,0,
+0,0,0,0,0,413,415,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,416,0,
+0,417,0,0,0,0,418,419,420,421,422,423,424,425,426,427,
+428,429,430,431,415,432,433,434,435,0,436,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,416,0,0,417,
+0,0,0,0,418,419,420,421,422,423,424,425,426,427,428,429,
+430,431,0,432,433,434,435,0,436,437,438,439,440,441,442,443,
+444,445,446,447,448,449,450,451,452,453,454,455,456,0,0,0,
+0,887,0,0,0,0,0,500,0,413,0,0,0,0,0,0,
+0,0,0,0,0,0,93,139,0,0,0,0,437,438,439,440,
+441,442,443,444,445,446,447,448,449,450,451,452,453,454,455,456,
+0,0,0,0,0,0,0,501,415,0,0,877,0,502,0,0,
+507,508,509,510,0,0,0,511,512,503,513,0,0,0,0,0,
+416,0,0,417,0,879,0,0,418,419,420,421,422,423,424,425,
+426,427,428,429,430,431,0,432,433,434,435,0,436,0,0,0,
+0,0,0,0,0,0,0,0,0,437,438,439,440,441,442,443,
+444,445,446,447,448,449,450,451,452,453,454,455,456,504,0,0,
+0,505,0,506,0,0,0,0,0,0,413,0,0,0,0,0,
+0,0,0,0,0,0,0,437,438,439,440,441,442,443,444,445,
+446,447,448,449,450,451,452,453,454,455,456,893,0,0,0,0,
+0,0,0,0,0,0,0,0,0,415,0,0,0,413,0,0,
+0,0,0,0,500,0,0,0,0,0,0,0,0,0,0,0,
+0,416,0,0,417,0,0,0,0,418,419,420,421,422,423,424,
+425,426,427,428,429,430,431,0,432,433,434,435,415,436,144,145,
+0,0,0,0,501,0,0,128,0,0,502,0,0,0,0,0,
+0,0,0,0,416,0,503,417,0,129,0,0,418,419,420,421,
+422,423,424,425,426,427,428,429,430,431,413,432,433,434,435,0,
+436,0,0,0,130,131,132,0,133,437,438,439,440,441,442,443,
+444,445,446,447,448,449,450,451,452,453,454,455,456,134,135,0,
+136,0,137,0,138,0,0,0,413,415,504,0,0,0,505,0,
+506,0,0,0,0,0,0,0,0,0,0,0,878,202,0,0,
+0,416,0,0,417,0,0,0,0,418,419,420,421,422,423,424,
+425,426,427,428,429,430,431,415,432,433,434,435,0,436,881,204,
+507,508,509,510,205,206,207,511,512,208,513,0,209,0,0,416,
+0,0,417,0,0,0,0,418,419,420,421,422,423,424,425,426,
+427,428,429,430,431,0,432,433,434,435,202,436,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,202,0,0,0,882,204,0,0,0,
+0,205,206,207,0,0,208,0,0,209,413,202,0,0,0,0,
+0,0,0,0,0,0,0,0,883,204,0,0,0,0,205,206,
+207,210,161,208,0,0,209,0,0,0,192,894,884,204,0,0,
+0,0,205,206,207,0,0,208,0,415,209,0,154,0,0,0,
+0,0,0,0,500,93,139,0,0,0,0,0,0,0,0,0,
+0,416,0,0,417,0,0,155,156,418,419,420,421,422,423,424,
+425,426,427,428,429,430,431,0,432,433,434,435,0,436,210,161,
+157,158,0,0,501,0,0,192,0,0,502,0,0,0,890,0,
+0,0,0,0,0,0,503,0,0,154,0,210,161,0,0,0,
+0,0,0,0,192,0,0,0,0,0,0,0,0,0,0,210,
+161,0,0,0,155,156,154,0,192,0,0,0,0,0,193,194,
+195,0,0,0,196,0,202,0,197,0,154,0,198,157,158,0,
+199,155,156,0,0,0,0,200,0,0,504,0,0,0,505,0,
+506,0,201,0,0,155,156,885,204,0,157,158,0,205,206,207,
+0,0,208,0,0,209,0,0,0,0,0,0,0,0,157,158,
+0,0,0,0,0,0,0,0,0,0,0,193,194,195,0,0,
+0,196,0,0,0,197,0,0,0,198,0,0,0,199,0,0,
+0,0,0,0,200,0,0,0,193,194,195,0,0,0,196,201,
+0,0,197,0,0,0,198,144,145,0,199,0,193,194,195,0,
+128,200,196,0,0,0,197,0,0,0,198,0,201,0,199,0,
+0,0,129,0,0,200,0,0,93,139,210,161,0,0,0,0,
+201,0,0,192,0,0,0,0,0,0,0,0,0,130,131,132,
+0,133,0,0,0,154,0,0,507,508,509,510,0,0,0,511,
+512,0,513,0,0,0,134,135,0,136,0,137,0,138,0,0,
+155,156,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,93,139,0,0,157,158,437,438,439,440,441,
+442,443,444,445,446,447,448,449,450,451,452,453,454,455,456,0,
+0,0,93,139,507,508,509,510,0,0,0,511,512,0,513,0,
+0,507,508,509,510,0,93,139,511,512,0,513,0,0,0,0,
+0,0,0,0,0,0,0,193,194,195,0,0,0,196,0,0,
+0,197,0,895,0,198,0,0,0,199,0,0,0,0,0,0,
+200,0,0,0,0,0,0,0,0,0,0,201,500,437,438,439,
+440,441,442,443,444,445,446,447,448,449,450,451,452,453,454,455,
+456,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,501,0,0,896,
+0,0,502,0,0,0,0,0,0,0,0,0,897,0,503,0,
+0,0,0,0,0,0,0,0,500,0,0,0,413,0,93,139,
+0,0,0,0,0,500,0,0,0,0,437,438,439,440,441,442,
+443,444,445,446,447,448,449,450,451,452,453,454,455,456,0,0,
+0,93,139,0,0,0,0,0,501,0,0,415,886,0,502,0,
+0,0,504,0,0,501,505,0,506,0,503,502,0,0,0,0,
+0,0,0,416,0,0,417,503,0,0,0,418,419,420,421,422,
+423,424,425,426,427,428,429,430,431,0,432,433,434,435,413,436,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,504,0,
+0,0,505,0,506,0,0,0,0,0,0,504,0,415,892,505,
+0,506,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,416,0,0,417,0,0,0,0,418,419,420,
+421,422,423,424,425,426,427,428,429,430,431,413,432,433,434,435,
+0,436,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,415,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,416,0,0,417,0,0,0,0,418,419,420,421,422,423,
+424,425,426,427,428,429,430,431,0,432,433,434,435,0,436};
+
+D_ErrorRecoveryHint d_error_recovery_hints_0_mcrl2[] = {{0, 1, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_4_mcrl2[] = {{0, 7, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_7_mcrl2[] = {{0, 18, ":"}};
+D_ErrorRecoveryHint d_error_recovery_hints_15_mcrl2[] = {
+{0, 38, ";"},
+{0, 40, "->"},
+{0, 46, "]"},
+{0, 46, "}"},
+{0, 46, ")"},
+{0, 46, "end"}};
+D_ErrorRecoveryHint d_error_recovery_hints_19_mcrl2[] = {
+{0, 46, "]"},
+{0, 46, "}"},
+{0, 46, ")"},
+{0, 46, "end"}};
+D_ErrorRecoveryHint d_error_recovery_hints_20_mcrl2[] = {{0, 67, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_26_mcrl2[] = {{0, 79, "}"}};
+D_ErrorRecoveryHint d_error_recovery_hints_29_mcrl2[] = {{0, 86, "}"}};
+D_ErrorRecoveryHint d_error_recovery_hints_32_mcrl2[] = {{0, 92, "}"}};
+D_ErrorRecoveryHint d_error_recovery_hints_35_mcrl2[] = {{0, 98, "}"}};
+D_ErrorRecoveryHint d_error_recovery_hints_36_mcrl2[] = {
+{0, 67, ")"},
+{0, 101, "."},
+{0, 106, "<>"},
+{0, 107, "->"}};
+D_ErrorRecoveryHint d_error_recovery_hints_38_mcrl2[] = {{0, 117, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_42_mcrl2[] = {{0, 126, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_44_mcrl2[] = {{0, 131, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_50_mcrl2[] = {{0, 142, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_52_mcrl2[] = {{0, 144, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_53_mcrl2[] = {{0, 148, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_56_mcrl2[] = {{0, 154, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_60_mcrl2[] = {{0, 162, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_61_mcrl2[] = {{0, 163, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_64_mcrl2[] = {
+{0, 163, ")"},
+{0, 175, "*"},
+{0, 175, "+"}};
+D_ErrorRecoveryHint d_error_recovery_hints_66_mcrl2[] = {{0, 183, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_74_mcrl2[] = {
+{0, 46, "]"},
+{0, 46, "}"},
+{0, 46, ")"},
+{0, 46, "end"},
+{0, 208, ";"},
+{0, 210, "->"}};
+D_ErrorRecoveryHint d_error_recovery_hints_85_mcrl2[] = {{1, 1, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_101_mcrl2[] = {{1, 7, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_104_mcrl2[] = {{0, 12, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_110_mcrl2[] = {{1, 18, ":"}};
+D_ErrorRecoveryHint d_error_recovery_hints_116_mcrl2[] = {{0, 25, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_118_mcrl2[] = {{0, 28, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_120_mcrl2[] = {{0, 31, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_122_mcrl2[] = {{0, 34, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_140_mcrl2[] = {
+{0, 46, "]"},
+{0, 46, "}"},
+{0, 46, ")"},
+{0, 46, "end"},
+{1, 38, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_142_mcrl2[] = {
+{1, 40, "->"},
+{1, 46, "]"},
+{1, 46, ")"},
+{1, 46, "end"}};
+D_ErrorRecoveryHint d_error_recovery_hints_151_mcrl2[] = {
+{1, 46, "]"},
+{1, 46, ")"},
+{1, 46, "end"}};
+D_ErrorRecoveryHint d_error_recovery_hints_158_mcrl2[] = {{1, 67, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_171_mcrl2[] = {{1, 79, "}"}};
+D_ErrorRecoveryHint d_error_recovery_hints_177_mcrl2[] = {{1, 86, "}"}};
+D_ErrorRecoveryHint d_error_recovery_hints_183_mcrl2[] = {{1, 92, "}"}};
+D_ErrorRecoveryHint d_error_recovery_hints_189_mcrl2[] = {{1, 98, "}"}};
+D_ErrorRecoveryHint d_error_recovery_hints_191_mcrl2[] = {
+{0, 46, "]"},
+{0, 46, "}"},
+{0, 46, ")"},
+{0, 46, "end"},
+{0, 101, "."},
+{0, 106, "<>"},
+{0, 107, "->"}};
+D_ErrorRecoveryHint d_error_recovery_hints_194_mcrl2[] = {{1, 100, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_199_mcrl2[] = {{1, 111, "."}};
+D_ErrorRecoveryHint d_error_recovery_hints_200_mcrl2[] = {{1, 101, "."}};
+D_ErrorRecoveryHint d_error_recovery_hints_201_mcrl2[] = {
+{1, 67, ")"},
+{1, 107, "->"}};
+D_ErrorRecoveryHint d_error_recovery_hints_209_mcrl2[] = {{0, 100, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_211_mcrl2[] = {{0, 116, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_213_mcrl2[] = {{1, 117, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_222_mcrl2[] = {
+{0, 128, ")"},
+{1, 126, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_225_mcrl2[] = {
+{0, 67, ")"},
+{0, 101, "."},
+{0, 106, "<>"},
+{0, 107, "->"},
+{1, 131, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_251_mcrl2[] = {{1, 142, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_260_mcrl2[] = {{1, 148, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_268_mcrl2[] = {{1, 154, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_271_mcrl2[] = {{0, 158, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_273_mcrl2[] = {{0, 161, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_274_mcrl2[] = {{1, 162, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_276_mcrl2[] = {{1, 163, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_286_mcrl2[] = {{0, 169, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_298_mcrl2[] = {
+{1, 175, "*"},
+{1, 175, "+"}};
+D_ErrorRecoveryHint d_error_recovery_hints_316_mcrl2[] = {{0, 194, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_317_mcrl2[] = {
+{0, 163, ")"},
+{1, 183, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_327_mcrl2[] = {{0, 197, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_345_mcrl2[] = {
+{1, 46, "]"},
+{1, 46, ")"},
+{1, 46, "end"},
+{1, 210, "->"}};
+D_ErrorRecoveryHint d_error_recovery_hints_347_mcrl2[] = {{1, 208, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_359_mcrl2[] = {{2, 1, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_371_mcrl2[] = {{2, 7, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_372_mcrl2[] = {
+{0, 1, ")"},
+{2, 7, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_374_mcrl2[] = {
+{0, 18, ":"},
+{1, 12, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_379_mcrl2[] = {{2, 18, ":"}};
+D_ErrorRecoveryHint d_error_recovery_hints_382_mcrl2[] = {{1, 25, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_385_mcrl2[] = {{1, 28, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_390_mcrl2[] = {{1, 31, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_393_mcrl2[] = {{1, 34, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_395_mcrl2[] = {
+{1, 46, ")"},
+{1, 46, "]"},
+{1, 46, "end"}};
+D_ErrorRecoveryHint d_error_recovery_hints_397_mcrl2[] = {{2, 46, "]"}};
+D_ErrorRecoveryHint d_error_recovery_hints_399_mcrl2[] = {{2, 46, "}"}};
+D_ErrorRecoveryHint d_error_recovery_hints_411_mcrl2[] = {
+{1, 46, "]"},
+{1, 46, ")"},
+{1, 46, "end"},
+{2, 38, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_413_mcrl2[] = {{2, 40, "->"}};
+D_ErrorRecoveryHint d_error_recovery_hints_435_mcrl2[] = {{2, 46, "end"}};
+D_ErrorRecoveryHint d_error_recovery_hints_469_mcrl2[] = {{2, 79, "}"}};
+D_ErrorRecoveryHint d_error_recovery_hints_473_mcrl2[] = {{2, 86, "}"}};
+D_ErrorRecoveryHint d_error_recovery_hints_477_mcrl2[] = {{2, 92, "}"}};
+D_ErrorRecoveryHint d_error_recovery_hints_481_mcrl2[] = {{2, 98, "}"}};
+D_ErrorRecoveryHint d_error_recovery_hints_488_mcrl2[] = {{2, 100, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_491_mcrl2[] = {
+{0, 79, "}"},
+{2, 100, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_492_mcrl2[] = {
+{0, 86, "}"},
+{2, 100, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_494_mcrl2[] = {
+{0, 98, "}"},
+{2, 100, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_495_mcrl2[] = {
+{0, 92, "}"},
+{2, 100, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_496_mcrl2[] = {{2, 111, "."}};
+D_ErrorRecoveryHint d_error_recovery_hints_497_mcrl2[] = {{2, 101, "."}};
+D_ErrorRecoveryHint d_error_recovery_hints_498_mcrl2[] = {{2, 107, "->"}};
+D_ErrorRecoveryHint d_error_recovery_hints_515_mcrl2[] = {{2, 106, "<>"}};
+D_ErrorRecoveryHint d_error_recovery_hints_523_mcrl2[] = {{2, 117, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_528_mcrl2[] = {{1, 128, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_529_mcrl2[] = {{2, 126, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_533_mcrl2[] = {{2, 131, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_540_mcrl2[] = {{2, 142, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_541_mcrl2[] = {{2, 144, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_549_mcrl2[] = {{2, 148, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_554_mcrl2[] = {{2, 154, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_555_mcrl2[] = {{1, 158, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_561_mcrl2[] = {{2, 162, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_563_mcrl2[] = {{2, 164, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_576_mcrl2[] = {{2, 170, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_589_mcrl2[] = {
+{1, 175, "*"},
+{1, 175, "+"},
+{2, 175, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_591_mcrl2[] = {{2, 175, "+"}};
+D_ErrorRecoveryHint d_error_recovery_hints_592_mcrl2[] = {{2, 175, "*"}};
+D_ErrorRecoveryHint d_error_recovery_hints_595_mcrl2[] = {{2, 185, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_620_mcrl2[] = {{2, 183, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_621_mcrl2[] = {{1, 197, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_628_mcrl2[] = {{2, 210, "->"}};
+D_ErrorRecoveryHint d_error_recovery_hints_629_mcrl2[] = {{2, 208, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_630_mcrl2[] = {{3, 1, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_639_mcrl2[] = {{3, 7, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_642_mcrl2[] = {{2, 12, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_651_mcrl2[] = {{2, 25, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_653_mcrl2[] = {{2, 28, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_656_mcrl2[] = {{2, 31, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_658_mcrl2[] = {{2, 34, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_661_mcrl2[] = {{3, 46, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_662_mcrl2[] = {{3, 46, "]"}};
+D_ErrorRecoveryHint d_error_recovery_hints_663_mcrl2[] = {{3, 46, "}"}};
+D_ErrorRecoveryHint d_error_recovery_hints_670_mcrl2[] = {
+{0, 46, "]"},
+{0, 46, "}"},
+{0, 46, ")"},
+{0, 46, "end"},
+{3, 38, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_673_mcrl2[] = {{3, 46, "end"}};
+D_ErrorRecoveryHint d_error_recovery_hints_698_mcrl2[] = {{3, 67, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_708_mcrl2[] = {{3, 79, "}"}};
+D_ErrorRecoveryHint d_error_recovery_hints_713_mcrl2[] = {{3, 86, "}"}};
+D_ErrorRecoveryHint d_error_recovery_hints_717_mcrl2[] = {{3, 92, "}"}};
+D_ErrorRecoveryHint d_error_recovery_hints_721_mcrl2[] = {{3, 98, "}"}};
+D_ErrorRecoveryHint d_error_recovery_hints_725_mcrl2[] = {{3, 100, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_731_mcrl2[] = {{3, 111, "."}};
+D_ErrorRecoveryHint d_error_recovery_hints_732_mcrl2[] = {
+{0, 46, "]"},
+{0, 46, "}"},
+{0, 46, ")"},
+{0, 46, "end"},
+{3, 101, "."}};
+D_ErrorRecoveryHint d_error_recovery_hints_740_mcrl2[] = {{3, 106, "<>"}};
+D_ErrorRecoveryHint d_error_recovery_hints_742_mcrl2[] = {{2, 116, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_746_mcrl2[] = {{3, 117, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_750_mcrl2[] = {{2, 128, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_751_mcrl2[] = {
+{0, 67, ")"},
+{0, 101, "."},
+{0, 106, "<>"},
+{0, 107, "->"},
+{3, 126, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_753_mcrl2[] = {{3, 131, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_756_mcrl2[] = {
+{0, 144, ")"},
+{3, 142, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_757_mcrl2[] = {{3, 144, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_761_mcrl2[] = {{3, 148, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_764_mcrl2[] = {
+{0, 163, ")"},
+{3, 154, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_765_mcrl2[] = {{2, 158, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_766_mcrl2[] = {{2, 161, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_767_mcrl2[] = {{3, 162, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_769_mcrl2[] = {{3, 164, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_775_mcrl2[] = {{2, 169, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_776_mcrl2[] = {{3, 170, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_783_mcrl2[] = {{3, 175, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_786_mcrl2[] = {{3, 185, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_800_mcrl2[] = {{2, 194, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_801_mcrl2[] = {{3, 183, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_802_mcrl2[] = {{2, 197, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_808_mcrl2[] = {{3, 208, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_809_mcrl2[] = {{4, 1, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_814_mcrl2[] = {{4, 7, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_816_mcrl2[] = {{3, 12, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_821_mcrl2[] = {
+{1, 46, "]"},
+{1, 46, ")"},
+{1, 46, "end"},
+{4, 46, "}"}};
+D_ErrorRecoveryHint d_error_recovery_hints_825_mcrl2[] = {
+{1, 46, "]"},
+{1, 46, ")"},
+{1, 46, "end"},
+{4, 38, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_826_mcrl2[] = {{4, 46, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_828_mcrl2[] = {{4, 46, "end"}};
+D_ErrorRecoveryHint d_error_recovery_hints_830_mcrl2[] = {{4, 67, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_845_mcrl2[] = {
+{1, 46, "]"},
+{1, 46, ")"},
+{1, 46, "end"},
+{4, 101, "."}};
+D_ErrorRecoveryHint d_error_recovery_hints_846_mcrl2[] = {{3, 116, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_847_mcrl2[] = {{4, 100, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_849_mcrl2[] = {{3, 128, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_850_mcrl2[] = {{4, 126, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_852_mcrl2[] = {{4, 142, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_854_mcrl2[] = {{4, 154, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_855_mcrl2[] = {{3, 158, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_856_mcrl2[] = {{3, 161, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_857_mcrl2[] = {{4, 163, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_860_mcrl2[] = {{3, 169, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_870_mcrl2[] = {{3, 194, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_871_mcrl2[] = {{3, 197, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_875_mcrl2[] = {{4, 208, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_876_mcrl2[] = {{5, 46, "}"}};
+D_ErrorRecoveryHint d_error_recovery_hints_877_mcrl2[] = {{5, 38, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_880_mcrl2[] = {{5, 100, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_885_mcrl2[] = {{5, 101, "."}};
+D_ErrorRecoveryHint d_error_recovery_hints_886_mcrl2[] = {{5, 126, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_887_mcrl2[] = {{5, 142, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_888_mcrl2[] = {{5, 154, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_890_mcrl2[] = {{5, 208, ";"}};
+D_ErrorRecoveryHint d_error_recovery_hints_891_mcrl2[] = {{6, 46, "]"}};
+D_ErrorRecoveryHint d_error_recovery_hints_892_mcrl2[] = {{6, 100, ")"}};
+D_ErrorRecoveryHint d_error_recovery_hints_897_mcrl2[] = {{6, 101, "."}};
+
+D_State d_states_mcrl2[] = {
+{d_goto_valid_0_mcrl2, 1, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_0_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_1_mcrl2, -22, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_0_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_2_mcrl2, -45, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_0_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_3_mcrl2, -4, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_4_mcrl2, 6, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_4_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_5_mcrl2, 5, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_6_mcrl2, 3, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_7_mcrl2, 10, {1, d_reductions_7_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_7_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_8_mcrl2, 4, {1, d_reductions_8_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_7_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_9_mcrl2, 20, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_10_mcrl2, 19, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_11_mcrl2, 7, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_12_mcrl2, 8, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_13_mcrl2, 8, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_14_mcrl2, 7, {1, d_reductions_14_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_15_mcrl2, -57, {1, d_reductions_15_mcrl2}, {0, NULL}, {6, d_error_recovery_hints_15_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_16_mcrl2, 30, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_17_mcrl2, 26, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_18_mcrl2, 25, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_19_mcrl2, -67, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_20_mcrl2, -77, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_20_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_21_mcrl2, 48, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_22_mcrl2, 42, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_23_mcrl2, -107, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_24_mcrl2, -118, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_25_mcrl2, -241, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_26_mcrl2, 57, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_26_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_27_mcrl2, 49, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_28_mcrl2, 47, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_29_mcrl2, 49, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_29_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_30_mcrl2, 59, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_31_mcrl2, 50, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_32_mcrl2, 60, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_32_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_33_mcrl2, 60, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_34_mcrl2, 52, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_35_mcrl2, 58, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_35_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_36_mcrl2, -328, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_36_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_37_mcrl2, 79, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_38_mcrl2, 73, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_38_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_39_mcrl2, 79, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_40_mcrl2, 69, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_41_mcrl2, 67, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_42_mcrl2, 78, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_42_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_43_mcrl2, 78, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_44_mcrl2, 76, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_44_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_45_mcrl2, -388, {1, d_reductions_45_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_46_mcrl2, 85, {1, d_reductions_46_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_47_mcrl2, -525, {1, d_reductions_47_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_48_mcrl2, 75, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_49_mcrl2, 71, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_50_mcrl2, 83, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_50_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_51_mcrl2, 86, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_52_mcrl2, -255, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_52_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_53_mcrl2, 90, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_53_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_54_mcrl2, -524, {2, d_reductions_54_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_55_mcrl2, 82, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_56_mcrl2, 53, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_56_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_57_mcrl2, 57, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_58_mcrl2, 94, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_59_mcrl2, 92, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_60_mcrl2, 102, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_60_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_61_mcrl2, 89, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_61_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_62_mcrl2, -313, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_61_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_63_mcrl2, -467, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_61_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_64_mcrl2, -502, {0, NULL}, {0, NULL}, {3, d_error_recovery_hints_64_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_65_mcrl2, -518, {1, d_reductions_65_mcrl2}, {1, d_right_epsilon_hints_65_mcrl2}, {1, d_error_recovery_hints_61_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_66_mcrl2, 122, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_66_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_67_mcrl2, -629, {1, d_reductions_67_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_68_mcrl2, -538, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_61_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_69_mcrl2, 129, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_70_mcrl2, 135, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_71_mcrl2, 116, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_72_mcrl2, -799, {2, d_reductions_72_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_73_mcrl2, -90, {1, d_reductions_73_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_74_mcrl2, -634, {1, d_reductions_74_mcrl2}, {0, NULL}, {6, d_error_recovery_hints_74_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_75_mcrl2, -89, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_76_mcrl2, 131, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_77_mcrl2, 147, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_78_mcrl2, 129, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_79_mcrl2, 129, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_80_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_81_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_82_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_83_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_84_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_85_mcrl2, 153, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_85_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_86_mcrl2, -642, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_0_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_87_mcrl2, 151, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_85_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_88_mcrl2, 149, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_85_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_89_mcrl2, 148, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_85_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_90_mcrl2, 147, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_85_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_91_mcrl2, -81, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_92_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_93_mcrl2, -155, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 1, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_94_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_95_mcrl2, -168, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 1, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_96_mcrl2, -180, {1, d_reductions_96_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_98_mcrl2, -98, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_4_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_101_mcrl2, 166, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_101_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_102_mcrl2, 134, {1, d_reductions_102_mcrl2}, {1, d_right_epsilon_hints_102_mcrl2}, {1, d_error_recovery_hints_101_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_104_mcrl2, -79, {1, d_reductions_104_mcrl2}, {1, d_right_epsilon_hints_104_mcrl2}, {1, d_error_recovery_hints_104_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_105_mcrl2, -71, {1, d_reductions_105_mcrl2}, {1, d_right_epsilon_hints_105_mcrl2}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_108_mcrl2, -817, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_0_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_109_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_110_mcrl2, 159, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_110_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_111_mcrl2, -73, {1, d_reductions_111_mcrl2}, {1, d_right_epsilon_hints_111_mcrl2}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_114_mcrl2, 151, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_115_mcrl2, 107, {1, d_reductions_115_mcrl2}, {1, d_right_epsilon_hints_115_mcrl2}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_116_mcrl2, -90, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_116_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_118_mcrl2, -447, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_118_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_120_mcrl2, -424, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_120_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_122_mcrl2, -74, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_122_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_124_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_126_mcrl2, 153, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_127_mcrl2, -698, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_128_mcrl2, -809, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, 133},
+{NULL, -2147483647, {1, d_reductions_129_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_130_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_131_mcrl2, -852, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_132_mcrl2, -945, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_133_mcrl2, -869, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_134_mcrl2, -959, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_135_mcrl2, -282, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_136_mcrl2, -456, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_137_mcrl2, -503, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_138_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_140_mcrl2, -1010, {0, NULL}, {0, NULL}, {5, d_error_recovery_hints_140_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_141_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_142_mcrl2, -1237, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_142_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_143_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_144_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_146_mcrl2, 141, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_148_mcrl2, 133, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_149_mcrl2, -75, {1, d_reductions_149_mcrl2}, {1, d_right_epsilon_hints_149_mcrl2}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_151_mcrl2, -1283, {0, NULL}, {0, NULL}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 1, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_152_mcrl2, -1135, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_153_mcrl2, -943, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_20_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_154_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_155_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_156_mcrl2, -978, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_20_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_157_mcrl2, -1150, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_20_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_158_mcrl2, 104, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_158_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 1, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_159_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_160_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_162_mcrl2, 121, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_163_mcrl2, -55, {1, d_reductions_163_mcrl2}, {1, d_right_epsilon_hints_163_mcrl2}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_165_mcrl2, -1560, {1, d_reductions_165_mcrl2}, {1, d_right_epsilon_hints_165_mcrl2}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_167_mcrl2, -1626, {0, NULL}, {0, NULL}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_169_mcrl2, -49, {1, d_reductions_169_mcrl2}, {1, d_right_epsilon_hints_169_mcrl2}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_171_mcrl2, 84, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_171_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_174_mcrl2, -46, {1, d_reductions_174_mcrl2}, {1, d_right_epsilon_hints_174_mcrl2}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_175_mcrl2, -46, {1, d_reductions_175_mcrl2}, {1, d_right_epsilon_hints_175_mcrl2}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_177_mcrl2, -406, {1, d_reductions_177_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_177_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_180_mcrl2, 118, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_181_mcrl2, -43, {1, d_reductions_181_mcrl2}, {1, d_right_epsilon_hints_181_mcrl2}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_183_mcrl2, -61, {1, d_reductions_183_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_183_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_186_mcrl2, 107, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_187_mcrl2, -39, {1, d_reductions_187_mcrl2}, {1, d_right_epsilon_hints_187_mcrl2}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_189_mcrl2, -105, {1, d_reductions_189_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_189_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_191_mcrl2, -1685, {0, NULL}, {0, NULL}, {7, d_error_recovery_hints_191_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_192_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_193_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_194_mcrl2, 86, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_194_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_195_mcrl2, 84, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_194_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_196_mcrl2, 83, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_194_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_197_mcrl2, 81, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_194_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_198_mcrl2, 79, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_194_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_199_mcrl2, -561, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_199_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_200_mcrl2, -590, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_200_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_201_mcrl2, 72, {0, NULL}, {0, NULL}, {2, d_error_recovery_hints_201_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_202_mcrl2, -1266, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 1, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_203_mcrl2, -1735, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_36_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, 204},
+{d_goto_valid_204_mcrl2, -1784, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_36_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_205_mcrl2, -1909, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_36_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_206_mcrl2, -1957, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_36_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_207_mcrl2, -2117, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_36_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_208_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_209_mcrl2, -46, {2, d_reductions_209_mcrl2}, {1, d_right_epsilon_hints_209_mcrl2}, {1, d_error_recovery_hints_209_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_211_mcrl2, -60, {1, d_reductions_211_mcrl2}, {1, d_right_epsilon_hints_211_mcrl2}, {1, d_error_recovery_hints_211_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_213_mcrl2, -108, {1, d_reductions_213_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_213_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_214_mcrl2, -63, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_38_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_216_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_217_mcrl2, -23, {1, d_reductions_217_mcrl2}, {1, d_right_epsilon_hints_217_mcrl2}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_219_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_222_mcrl2, -32, {1, d_reductions_222_mcrl2}, {0, NULL}, {2, d_error_recovery_hints_222_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_223_mcrl2, -185, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_42_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_225_mcrl2, -2148, {0, NULL}, {0, NULL}, {5, d_error_recovery_hints_225_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_227_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_228_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_229_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_230_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_232_mcrl2, -687, {2, d_reductions_232_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_233_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_235_mcrl2, -2206, {1, d_reductions_235_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_44_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_236_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_237_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_238_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_239_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_240_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_241_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_242_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_244_mcrl2, -454, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_50_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_246_mcrl2, -30, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_53_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_248_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_249_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_251_mcrl2, -64, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_251_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_253_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_254_mcrl2, -436, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_52_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_255_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_256_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_257_mcrl2, -685, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_52_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, 546},
+{NULL, -2147483647, {1, d_reductions_258_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_259_mcrl2, -792, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 1, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_260_mcrl2, -169, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_260_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_262_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_264_mcrl2, -328, {1, d_reductions_264_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_265_mcrl2, -348, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_56_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_268_mcrl2, -21, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_268_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_271_mcrl2, -228, {1, d_reductions_271_mcrl2}, {1, d_right_epsilon_hints_271_mcrl2}, {1, d_error_recovery_hints_271_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_273_mcrl2, -37, {1, d_reductions_273_mcrl2}, {1, d_right_epsilon_hints_273_mcrl2}, {1, d_error_recovery_hints_273_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_274_mcrl2, -43, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_274_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_276_mcrl2, 73, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_276_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_278_mcrl2, -1197, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_61_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_279_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_280_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_281_mcrl2, -1234, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_61_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, 570},
+{d_goto_valid_282_mcrl2, -604, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_283_mcrl2, -696, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_284_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_285_mcrl2, -589, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 1, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_286_mcrl2, -303, {1, d_reductions_286_mcrl2}, {1, d_right_epsilon_hints_286_mcrl2}, {1, d_error_recovery_hints_286_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_287_mcrl2, -1913, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_61_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_288_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_289_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_290_mcrl2, -2158, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_61_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, 585},
+{d_goto_valid_291_mcrl2, -768, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_292_mcrl2, -811, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_293_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_294_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_295_mcrl2, -787, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 1, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_296_mcrl2, -2261, {0, NULL}, {0, NULL}, {3, d_error_recovery_hints_64_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_297_mcrl2, -962, {1, d_reductions_297_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_298_mcrl2, -429, {0, NULL}, {0, NULL}, {2, d_error_recovery_hints_298_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 1, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_299_mcrl2, -2278, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_61_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_300_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_301_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_302_mcrl2, -2284, {0, NULL}, {0, NULL}, {3, d_error_recovery_hints_64_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_303_mcrl2, -2318, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_61_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, 614},
+{d_goto_valid_304_mcrl2, -848, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_305_mcrl2, -854, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_306_mcrl2, -2468, {0, NULL}, {0, NULL}, {3, d_error_recovery_hints_64_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_307_mcrl2, 14, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_308_mcrl2, -238, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_309_mcrl2, -324, {1, d_reductions_309_mcrl2}, {1, d_right_epsilon_hints_309_mcrl2}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_310_mcrl2, -40, {1, d_reductions_310_mcrl2}, {1, d_right_epsilon_hints_310_mcrl2}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_311_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_313_mcrl2, 11, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_66_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_314_mcrl2, -1460, {2, d_reductions_314_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_315_mcrl2, -261, {1, d_reductions_315_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_316_mcrl2, -294, {1, d_reductions_316_mcrl2}, {1, d_right_epsilon_hints_316_mcrl2}, {1, d_error_recovery_hints_316_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_317_mcrl2, -2378, {0, NULL}, {0, NULL}, {2, d_error_recovery_hints_317_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_319_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_320_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_321_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_322_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_323_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_325_mcrl2, -886, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 1, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_327_mcrl2, -295, {1, d_reductions_327_mcrl2}, {1, d_right_epsilon_hints_327_mcrl2}, {1, d_error_recovery_hints_327_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_329_mcrl2, 77, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_330_mcrl2, 12, {1, d_reductions_330_mcrl2}, {1, d_right_epsilon_hints_330_mcrl2}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_332_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_333_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_334_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {2, d_reductions_335_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_336_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_337_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_339_mcrl2, -1710, {3, d_reductions_339_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_340_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_341_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_342_mcrl2, 179, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_343_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_345_mcrl2, -2782, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_345_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_347_mcrl2, -293, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_347_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_348_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_349_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_350_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_351_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_356_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {0, NULL}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 1, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_358_mcrl2, -1535, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_0_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_359_mcrl2, -685, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_359_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_360_mcrl2, -2555, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_0_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_361_mcrl2, -2644, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_0_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_362_mcrl2, -2672, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_0_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_363_mcrl2, -2695, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_0_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_364_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_365_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_366_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_367_mcrl2, -2718, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_0_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_368_mcrl2, -2741, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_0_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_369_mcrl2, -360, {1, d_reductions_369_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_4_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_370_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_371_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_371_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_372_mcrl2, -2765, {0, NULL}, {0, NULL}, {2, d_error_recovery_hints_372_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_373_mcrl2, 20, {1, d_reductions_373_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_374_mcrl2, -741, {1, d_reductions_374_mcrl2}, {0, NULL}, {2, d_error_recovery_hints_374_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_375_mcrl2, -472, {1, d_reductions_375_mcrl2}, {1, d_right_epsilon_hints_375_mcrl2}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_376_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_377_mcrl2, -223, {1, d_reductions_377_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_378_mcrl2, -599, {1, d_reductions_378_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_379_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_379_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_380_mcrl2, -175, {1, d_reductions_380_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_381_mcrl2, -2792, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_0_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_382_mcrl2, 36, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_382_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_383_mcrl2, -772, {1, d_reductions_383_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_116_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_384_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_385_mcrl2, 11, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_385_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_386_mcrl2, -890, {1, d_reductions_386_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_118_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_387_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_388_mcrl2, -988, {1, d_reductions_388_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_120_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_389_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_390_mcrl2, -11, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_390_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_391_mcrl2, -1227, {1, d_reductions_391_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_122_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_392_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_393_mcrl2, -15, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_393_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_394_mcrl2, -2777, {1, d_reductions_394_mcrl2}, {0, NULL}, {6, d_error_recovery_hints_15_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_395_mcrl2, -3059, {0, NULL}, {0, NULL}, {3, d_error_recovery_hints_395_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_396_mcrl2, -3110, {1, d_reductions_396_mcrl2}, {0, NULL}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_397_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_397_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_398_mcrl2, -18, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_397_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_399_mcrl2, -20, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_399_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_400_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_399_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_401_mcrl2, -48, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_399_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_402_mcrl2, -3161, {1, d_reductions_402_mcrl2}, {1, d_right_epsilon_hints_402_mcrl2}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_403_mcrl2, -33, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_399_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_404_mcrl2, -34, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_399_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_405_mcrl2, -63, {1, d_reductions_405_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_406_mcrl2, -3259, {1, d_reductions_406_mcrl2}, {0, NULL}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_407_mcrl2, -3387, {1, d_reductions_407_mcrl2}, {0, NULL}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_408_mcrl2, -55, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_409_mcrl2, -57, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_410_mcrl2, -67, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_411_mcrl2, -3438, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_411_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_412_mcrl2, -3513, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_413_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_413_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_414_mcrl2, -3496, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_415_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_416_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_417_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_418_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_419_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_420_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_421_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_422_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_423_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_424_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_425_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_426_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_427_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_428_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_429_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_430_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_431_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_432_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_433_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_434_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_435_mcrl2, -663, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_435_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_436_mcrl2, -3547, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_437_mcrl2, -3557, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_438_mcrl2, -3607, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_439_mcrl2, -3619, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_440_mcrl2, -3658, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_441_mcrl2, -3669, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_442_mcrl2, -3732, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_443_mcrl2, -3775, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_444_mcrl2, -3837, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_445_mcrl2, -3877, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_446_mcrl2, -3925, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_447_mcrl2, -3939, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_448_mcrl2, -3975, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_449_mcrl2, -4035, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_450_mcrl2, -4068, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_451_mcrl2, -4107, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_452_mcrl2, -4157, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_453_mcrl2, -4168, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_454_mcrl2, -4201, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_455_mcrl2, -4218, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_456_mcrl2, -3021, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_0_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_457_mcrl2, -3050, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_0_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_458_mcrl2, -488, {1, d_reductions_458_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_459_mcrl2, -4473, {0, NULL}, {0, NULL}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_460_mcrl2, -166, {1, d_reductions_460_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_158_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_461_mcrl2, -168, {1, d_reductions_461_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_158_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_462_mcrl2, -179, {1, d_reductions_462_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_158_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_463_mcrl2, -4325, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_464_mcrl2, -4339, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_465_mcrl2, -424, {1, d_reductions_465_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_466_mcrl2, -452, {1, d_reductions_466_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_467_mcrl2, -4359, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_468_mcrl2, -362, {1, d_reductions_468_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_469_mcrl2, -131, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_469_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_470_mcrl2, -457, {1, d_reductions_470_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_471_mcrl2, -359, {1, d_reductions_471_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_472_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_473_mcrl2, -190, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_473_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_474_mcrl2, -478, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_475_mcrl2, -422, {1, d_reductions_475_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_476_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_477_mcrl2, -243, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_477_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_478_mcrl2, -377, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_479_mcrl2, -426, {1, d_reductions_479_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_480_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_481_mcrl2, -260, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_481_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_482_mcrl2, -4585, {0, NULL}, {0, NULL}, {7, d_error_recovery_hints_191_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_483_mcrl2, -4595, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {2, d_reductions_484_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {2, d_reductions_485_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_486_mcrl2, -4605, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_487_mcrl2, -4692, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_488_mcrl2, -3285, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_488_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_489_mcrl2, -504, {3, d_reductions_489_mcrl2}, {1, d_right_epsilon_hints_489_mcrl2}, {1, d_error_recovery_hints_209_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {2, d_reductions_490_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_491_mcrl2, -462, {0, NULL}, {0, NULL}, {2, d_error_recovery_hints_491_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_492_mcrl2, -490, {0, NULL}, {0, NULL}, {2, d_error_recovery_hints_492_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_493_mcrl2, -547, {0, NULL}, {0, NULL}, {2, d_error_recovery_hints_491_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_494_mcrl2, -496, {0, NULL}, {0, NULL}, {2, d_error_recovery_hints_494_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_495_mcrl2, -557, {0, NULL}, {0, NULL}, {2, d_error_recovery_hints_495_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_496_mcrl2, -265, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_496_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_497_mcrl2, -298, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_497_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {2, d_reductions_498_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_498_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_499_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_500_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_501_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_502_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_503_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_504_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_505_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_506_mcrl2, -4814, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_36_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_507_mcrl2, -1592, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_20_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_508_mcrl2, -4897, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_36_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_509_mcrl2, -4917, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_36_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_510_mcrl2, -4974, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_36_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_511_mcrl2, -5023, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_36_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_512_mcrl2, -5194, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_36_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_513_mcrl2, -4456, {1, d_reductions_513_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_514_mcrl2, -4703, {1, d_reductions_514_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_515_mcrl2, -5053, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_515_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_516_mcrl2, -5115, {1, d_reductions_516_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_517_mcrl2, -5210, {1, d_reductions_517_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_518_mcrl2, -5354, {1, d_reductions_518_mcrl2}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_519_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_520_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_521_mcrl2, -5312, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_522_mcrl2, -3293, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_0_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_523_mcrl2, -341, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_523_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_524_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_525_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_526_mcrl2, -758, {1, d_reductions_526_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_38_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_527_mcrl2, -545, {1, d_reductions_527_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_528_mcrl2, -1270, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_528_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_529_mcrl2, -348, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_529_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_530_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_531_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_532_mcrl2, -501, {1, d_reductions_532_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_42_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_533_mcrl2, -5343, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_533_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_534_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_535_mcrl2, -477, {1, d_reductions_535_mcrl2}, {1, d_right_epsilon_hints_535_mcrl2}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_536_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_537_mcrl2, -635, {1, d_reductions_537_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_50_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_538_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_539_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_540_mcrl2, -390, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_540_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_541_mcrl2, -972, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_541_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_542_mcrl2, -1169, {1, d_reductions_542_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_543_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_544_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_545_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_546_mcrl2, -1211, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_52_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_547_mcrl2, -1493, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_52_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_548_mcrl2, -1504, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_52_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_549_mcrl2, -394, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_549_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_550_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_551_mcrl2, -498, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_552_mcrl2, -795, {1, d_reductions_552_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_56_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_553_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_554_mcrl2, -395, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_554_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_555_mcrl2, -1314, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_555_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_556_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_557_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_558_mcrl2, -5415, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_559_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_560_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_561_mcrl2, -397, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_561_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_562_mcrl2, -5448, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_563_mcrl2, -1159, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_563_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_564_mcrl2, -1220, {1, d_reductions_564_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_565_mcrl2, -355, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_566_mcrl2, -369, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_567_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_568_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_569_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_570_mcrl2, -4766, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_61_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_571_mcrl2, -5210, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_61_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_572_mcrl2, -5454, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_61_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_573_mcrl2, -5465, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_574_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_575_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_576_mcrl2, -1523, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_576_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_577_mcrl2, -1816, {1, d_reductions_577_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_578_mcrl2, -371, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_579_mcrl2, -385, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_580_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_581_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_582_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_583_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_584_mcrl2, -5513, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_585_mcrl2, -5498, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_61_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_586_mcrl2, -5658, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_61_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_587_mcrl2, -5671, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_61_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_588_mcrl2, -1988, {1, d_reductions_588_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_576_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_589_mcrl2, -1336, {0, NULL}, {0, NULL}, {3, d_error_recovery_hints_589_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_590_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {2, d_reductions_591_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_591_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_592_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_592_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_593_mcrl2, -5697, {0, NULL}, {0, NULL}, {3, d_error_recovery_hints_64_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_594_mcrl2, -5715, {0, NULL}, {0, NULL}, {3, d_error_recovery_hints_64_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_595_mcrl2, -1514, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_595_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_596_mcrl2, -1462, {0, NULL}, {0, NULL}, {2, d_error_recovery_hints_298_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_597_mcrl2, -1264, {1, d_reductions_597_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_598_mcrl2, -391, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_599_mcrl2, -399, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_600_mcrl2, -1342, {0, NULL}, {0, NULL}, {2, d_error_recovery_hints_298_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_601_mcrl2, -410, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_602_mcrl2, -413, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_603_mcrl2, -5732, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_604_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_605_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_606_mcrl2, -5820, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_607_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_608_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_609_mcrl2, -668, {1, d_reductions_609_mcrl2}, {2, d_right_epsilon_hints_609_mcrl2}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_610_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_611_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_612_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_613_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_614_mcrl2, -5748, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_61_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_615_mcrl2, -5810, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_61_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_616_mcrl2, -5826, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_61_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_617_mcrl2, -5859, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_618_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_619_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_620_mcrl2, -1781, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_620_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_621_mcrl2, -900, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_621_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_622_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_623_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_624_mcrl2, -3395, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_0_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_625_mcrl2, -581, {1, d_reductions_625_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_626_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_627_mcrl2, -6006, {1, d_reductions_627_mcrl2}, {0, NULL}, {6, d_error_recovery_hints_74_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_628_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_628_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_629_mcrl2, -409, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_629_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_630_mcrl2, -1176, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_630_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_631_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_630_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_632_mcrl2, -1499, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_630_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_633_mcrl2, -1563, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_630_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_634_mcrl2, -1569, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_630_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_635_mcrl2, -1572, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_630_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_636_mcrl2, -1152, {1, d_reductions_636_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_637_mcrl2, -1154, {1, d_reductions_637_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_638_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_639_mcrl2, -1386, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_639_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_640_mcrl2, -555, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_641_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_642_mcrl2, -500, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_642_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_643_mcrl2, -571, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_644_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_645_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_646_mcrl2, -733, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_647_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_648_mcrl2, -1625, {1, d_reductions_648_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_7_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_649_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_650_mcrl2, -1425, {1, d_reductions_650_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_651_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_651_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_652_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_653_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_653_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_654_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_655_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_656_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_656_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_657_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_658_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_658_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_659_mcrl2, -5870, {2, d_reductions_659_mcrl2}, {0, NULL}, {6, d_error_recovery_hints_15_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_660_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_661_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_661_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_662_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_662_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_663_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_663_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_664_mcrl2, -6054, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_665_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_663_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_666_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_663_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_667_mcrl2, -6102, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_668_mcrl2, -6117, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_669_mcrl2, -6150, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_670_mcrl2, -6167, {0, NULL}, {0, NULL}, {5, d_error_recovery_hints_670_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_671_mcrl2, -504, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_661_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_672_mcrl2, -6422, {0, NULL}, {0, NULL}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_673_mcrl2, -410, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_673_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_674_mcrl2, -6473, {1, d_reductions_674_mcrl2}, {0, NULL}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_675_mcrl2, -6524, {1, d_reductions_675_mcrl2}, {0, NULL}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_676_mcrl2, -6750, {1, d_reductions_676_mcrl2}, {0, NULL}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_677_mcrl2, -6801, {1, d_reductions_677_mcrl2}, {0, NULL}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_678_mcrl2, -6852, {1, d_reductions_678_mcrl2}, {0, NULL}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_679_mcrl2, -6903, {1, d_reductions_679_mcrl2}, {0, NULL}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_680_mcrl2, -6954, {1, d_reductions_680_mcrl2}, {0, NULL}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_681_mcrl2, -7180, {1, d_reductions_681_mcrl2}, {0, NULL}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_682_mcrl2, -7231, {1, d_reductions_682_mcrl2}, {0, NULL}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_683_mcrl2, -7282, {1, d_reductions_683_mcrl2}, {0, NULL}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_684_mcrl2, -7333, {1, d_reductions_684_mcrl2}, {0, NULL}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_685_mcrl2, -7384, {1, d_reductions_685_mcrl2}, {0, NULL}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_686_mcrl2, -7610, {1, d_reductions_686_mcrl2}, {0, NULL}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_687_mcrl2, -7661, {1, d_reductions_687_mcrl2}, {0, NULL}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_688_mcrl2, -7712, {1, d_reductions_688_mcrl2}, {0, NULL}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_689_mcrl2, -7763, {1, d_reductions_689_mcrl2}, {0, NULL}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_690_mcrl2, -7814, {1, d_reductions_690_mcrl2}, {0, NULL}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_691_mcrl2, -8040, {1, d_reductions_691_mcrl2}, {0, NULL}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_692_mcrl2, -8091, {1, d_reductions_692_mcrl2}, {0, NULL}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_693_mcrl2, -8142, {1, d_reductions_693_mcrl2}, {0, NULL}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_694_mcrl2, -1457, {1, d_reductions_694_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_695_mcrl2, -1535, {1, d_reductions_695_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_696_mcrl2, -1012, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_697_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_698_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_698_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_699_mcrl2, -518, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_698_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_700_mcrl2, -8193, {1, d_reductions_700_mcrl2}, {0, NULL}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_701_mcrl2, -913, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_702_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_703_mcrl2, -6410, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_704_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_705_mcrl2, -8244, {1, d_reductions_705_mcrl2}, {0, NULL}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_706_mcrl2, -8369, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_707_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_708_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_708_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_709_mcrl2, -576, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_710_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_711_mcrl2, -747, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_712_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_713_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_713_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_714_mcrl2, -505, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_715_mcrl2, -800, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_716_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_717_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_717_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_718_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_719_mcrl2, -812, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_720_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_721_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_721_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_722_mcrl2, -8470, {0, NULL}, {0, NULL}, {3, d_error_recovery_hints_395_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_723_mcrl2, -8379, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {2, d_reductions_724_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_725_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_725_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_726_mcrl2, -541, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_725_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_727_mcrl2, -546, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_725_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_728_mcrl2, -548, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_725_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_729_mcrl2, -554, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_725_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_730_mcrl2, -562, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_725_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_731_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_731_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_732_mcrl2, -8389, {0, NULL}, {0, NULL}, {5, d_error_recovery_hints_732_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_733_mcrl2, -8318, {1, d_reductions_733_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_734_mcrl2, -621, {1, d_reductions_734_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_158_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_735_mcrl2, -8329, {1, d_reductions_735_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_736_mcrl2, -8373, {1, d_reductions_736_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_737_mcrl2, -8497, {1, d_reductions_737_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_738_mcrl2, -8618, {1, d_reductions_738_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_739_mcrl2, -8633, {1, d_reductions_739_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_740_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_740_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_741_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_742_mcrl2, -626, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_742_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_743_mcrl2, -627, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_725_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_744_mcrl2, -611, {1, d_reductions_744_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_745_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_746_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_746_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_747_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_748_mcrl2, -862, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_749_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_750_mcrl2, -642, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_750_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_751_mcrl2, -8697, {0, NULL}, {0, NULL}, {5, d_error_recovery_hints_751_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_752_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_753_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_753_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_754_mcrl2, -3946, {2, d_reductions_754_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_755_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_756_mcrl2, -1704, {0, NULL}, {0, NULL}, {2, d_error_recovery_hints_756_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_757_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_757_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_758_mcrl2, -1692, {1, d_reductions_758_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_759_mcrl2, -1757, {1, d_reductions_759_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_760_mcrl2, -1866, {1, d_reductions_760_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_761_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_761_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_762_mcrl2, -722, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_60_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_763_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_764_mcrl2, -6336, {0, NULL}, {0, NULL}, {2, d_error_recovery_hints_764_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_765_mcrl2, -644, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_765_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_766_mcrl2, -648, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_766_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_767_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_767_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_768_mcrl2, -8787, {0, NULL}, {0, NULL}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_769_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_769_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_770_mcrl2, -8607, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_61_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_771_mcrl2, -8654, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_61_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_772_mcrl2, -1745, {1, d_reductions_772_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_773_mcrl2, -1795, {1, d_reductions_773_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_774_mcrl2, -1826, {1, d_reductions_774_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_775_mcrl2, -654, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_775_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_776_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_776_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_777_mcrl2, -8780, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_61_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_778_mcrl2, -8846, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_61_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_779_mcrl2, -8923, {1, d_reductions_779_mcrl2}, {0, NULL}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_780_mcrl2, -1916, {1, d_reductions_780_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_781_mcrl2, -2220, {1, d_reductions_781_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_782_mcrl2, -2231, {1, d_reductions_782_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_783_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_783_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_784_mcrl2, -1918, {1, d_reductions_784_mcrl2}, {0, NULL}, {2, d_error_recovery_hints_298_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_785_mcrl2, -1987, {1, d_reductions_785_mcrl2}, {0, NULL}, {2, d_error_recovery_hints_298_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_786_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_786_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_787_mcrl2, -8842, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_61_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_788_mcrl2, -8857, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_61_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_789_mcrl2, -8995, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_61_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_790_mcrl2, -9030, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_61_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_791_mcrl2, -9089, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_61_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_792_mcrl2, -9093, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_61_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_793_mcrl2, -9383, {1, d_reductions_793_mcrl2}, {0, NULL}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_794_mcrl2, -9429, {1, d_reductions_794_mcrl2}, {0, NULL}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_795_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_796_mcrl2, -4471, {2, d_reductions_796_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_797_mcrl2, -1518, {1, d_reductions_797_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_798_mcrl2, -1852, {1, d_reductions_798_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_799_mcrl2, -1886, {1, d_reductions_799_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_800_mcrl2, -661, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_800_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_801_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_801_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_802_mcrl2, -670, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_802_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_803_mcrl2, -1903, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_804_mcrl2, -872, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_805_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_806_mcrl2, -9288, {2, d_reductions_806_mcrl2}, {0, NULL}, {6, d_error_recovery_hints_74_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_807_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_808_mcrl2, -961, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_808_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_809_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_809_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_810_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_809_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_811_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_809_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_812_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_809_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_813_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_809_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_814_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_814_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_815_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_816_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_816_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_817_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_818_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_819_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_820_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_821_mcrl2, -9561, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_821_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_822_mcrl2, -9706, {1, d_reductions_822_mcrl2}, {0, NULL}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_823_mcrl2, -9757, {1, d_reductions_823_mcrl2}, {0, NULL}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_824_mcrl2, -9850, {1, d_reductions_824_mcrl2}, {0, NULL}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_825_mcrl2, -9896, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_825_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_826_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_826_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_827_mcrl2, -9815, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_828_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_828_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_829_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_830_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_830_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_831_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_832_mcrl2, -10042, {1, d_reductions_832_mcrl2}, {0, NULL}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_833_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_834_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_835_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_836_mcrl2, -819, {0, NULL}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_837_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_838_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {2, d_reductions_839_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_661_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_840_mcrl2, -10074, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_36_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_841_mcrl2, -10151, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_36_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_842_mcrl2, -10180, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_36_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_843_mcrl2, -10200, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_36_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_844_mcrl2, -10371, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_36_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_845_mcrl2, -10620, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_845_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_846_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_846_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_847_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_847_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_848_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_849_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_849_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_850_mcrl2, -9533, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_850_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_851_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_852_mcrl2, -2141, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_852_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_853_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_854_mcrl2, -2111, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_854_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_855_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_855_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_856_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_856_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_857_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_857_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_858_mcrl2, -2185, {1, d_reductions_858_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_859_mcrl2, -2191, {1, d_reductions_859_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_860_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_860_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_861_mcrl2, -2261, {1, d_reductions_861_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_862_mcrl2, -2266, {1, d_reductions_862_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_863_mcrl2, -2006, {1, d_reductions_863_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_864_mcrl2, -2357, {1, d_reductions_864_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_865_mcrl2, -2410, {1, d_reductions_865_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_866_mcrl2, -2417, {1, d_reductions_866_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_867_mcrl2, -2421, {1, d_reductions_867_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_868_mcrl2, -2436, {1, d_reductions_868_mcrl2}, {0, NULL}, {0, NULL}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_869_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_870_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_870_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_871_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_871_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_872_mcrl2, -10336, {0, NULL}, {0, NULL}, {4, d_error_recovery_hints_19_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_873_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_874_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_875_mcrl2, -655, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_875_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_876_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_876_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_877_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_877_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_878_mcrl2, -10718, {0, NULL}, {0, NULL}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_879_mcrl2}, {0, NULL}, {0, NULL}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_880_mcrl2, -9738, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_880_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_881_mcrl2, -10074, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_880_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_882_mcrl2, -10514, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_880_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_883_mcrl2, -10590, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_880_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_884_mcrl2, -10603, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_880_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{d_goto_valid_885_mcrl2, -604, {0, NULL}, {0, NULL}, {1, d_error_recovery_hints_885_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_886_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_886_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_887_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_887_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_888_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_888_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{d_goto_valid_889_mcrl2, -10811, {1, d_reductions_889_mcrl2}, {0, NULL}, {3, d_error_recovery_hints_151_mcrl2}, 1, NULL, (void*)d_scanner_0_mcrl2, sizeof(unsigned char) , 0, D_SCAN_LONGEST, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_890_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_890_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_891_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_891_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_892_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_892_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_893_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_892_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_894_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_892_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_895_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_892_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_896_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_892_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1},
+{NULL, -2147483647, {1, d_reductions_897_mcrl2}, {0, NULL}, {1, d_error_recovery_hints_897_mcrl2}, 0, NULL, NULL, sizeof(unsigned char) , 0, D_SCAN_ALL, NULL, NULL, -1}
+};
+
+D_Symbol d_symbols_mcrl2[] = {
+{D_SYMBOL_EBNF, "0 Start", 7, -1},
+{D_SYMBOL_NTERM, "SortExpr", 8, 1},
+{D_SYMBOL_EBNF, "SortExpr__3", 11, -1},
+{D_SYMBOL_EBNF, "SortExpr__2", 11, -1},
+{D_SYMBOL_NTERM, "SortProduct", 11, 2},
+{D_SYMBOL_NTERM, "SortSpec", 8, 3},
+{D_SYMBOL_INTERNAL, "SortSpec__6", 11, -1},
+{D_SYMBOL_NTERM, "SortDecl", 8, 4},
+{D_SYMBOL_NTERM, "ConstrDecl", 10, 5},
+{D_SYMBOL_INTERNAL, "ConstrDecl__12", 14, -1},
+{D_SYMBOL_EBNF, "ConstrDecl__11", 14, -1},
+{D_SYMBOL_INTERNAL, "ConstrDecl__10", 14, -1},
+{D_SYMBOL_EBNF, "ConstrDecl__9", 13, -1},
+{D_SYMBOL_NTERM, "ConstrDeclList", 14, 6},
+{D_SYMBOL_INTERNAL, "ConstrDeclList__15", 18, -1},
+{D_SYMBOL_EBNF, "ConstrDeclList__14", 18, -1},
+{D_SYMBOL_NTERM, "ProjDecl", 8, 7},
+{D_SYMBOL_INTERNAL, "ProjDecl__18", 12, -1},
+{D_SYMBOL_EBNF, "ProjDecl__17", 12, -1},
+{D_SYMBOL_NTERM, "ProjDeclList", 12, 8},
+{D_SYMBOL_INTERNAL, "ProjDeclList__21", 16, -1},
+{D_SYMBOL_EBNF, "ProjDeclList__20", 16, -1},
+{D_SYMBOL_NTERM, "IdsDecl", 7, 9},
+{D_SYMBOL_NTERM, "ConsSpec", 8, 10},
+{D_SYMBOL_INTERNAL, "ConsSpec__25", 12, -1},
+{D_SYMBOL_EBNF, "ConsSpec__24", 12, -1},
+{D_SYMBOL_NTERM, "MapSpec", 7, 11},
+{D_SYMBOL_INTERNAL, "MapSpec__28", 11, -1},
+{D_SYMBOL_EBNF, "MapSpec__27", 11, -1},
+{D_SYMBOL_NTERM, "GlobVarSpec", 11, 12},
+{D_SYMBOL_INTERNAL, "GlobVarSpec__31", 15, -1},
+{D_SYMBOL_EBNF, "GlobVarSpec__30", 15, -1},
+{D_SYMBOL_NTERM, "VarSpec", 7, 13},
+{D_SYMBOL_INTERNAL, "VarSpec__34", 11, -1},
+{D_SYMBOL_EBNF, "VarSpec__33", 11, -1},
+{D_SYMBOL_NTERM, "EqnSpec", 7, 14},
+{D_SYMBOL_INTERNAL, "EqnSpec__37", 11, -1},
+{D_SYMBOL_INTERNAL, "EqnSpec__36", 11, -1},
+{D_SYMBOL_NTERM, "EqnDecl", 7, 15},
+{D_SYMBOL_INTERNAL, "EqnDecl__40", 11, -1},
+{D_SYMBOL_EBNF, "EqnDecl__39", 11, -1},
+{D_SYMBOL_NTERM, "VarDecl", 7, 16},
+{D_SYMBOL_NTERM, "VarsDecl", 8, 17},
+{D_SYMBOL_NTERM, "VarsDeclList", 12, 18},
+{D_SYMBOL_INTERNAL, "VarsDeclList__45", 16, -1},
+{D_SYMBOL_EBNF, "VarsDeclList__44", 16, -1},
+{D_SYMBOL_NTERM, "DataExpr", 8, 19},
+{D_SYMBOL_EBNF, "DataExpr__66", 12, -1},
+{D_SYMBOL_EBNF, "DataExpr__65", 12, -1},
+{D_SYMBOL_EBNF, "DataExpr__64", 12, -1},
+{D_SYMBOL_EBNF, "DataExpr__63", 12, -1},
+{D_SYMBOL_EBNF, "DataExpr__62", 12, -1},
+{D_SYMBOL_EBNF, "DataExpr__61", 12, -1},
+{D_SYMBOL_EBNF, "DataExpr__60", 12, -1},
+{D_SYMBOL_EBNF, "DataExpr__59", 12, -1},
+{D_SYMBOL_EBNF, "DataExpr__58", 12, -1},
+{D_SYMBOL_EBNF, "DataExpr__57", 12, -1},
+{D_SYMBOL_EBNF, "DataExpr__56", 12, -1},
+{D_SYMBOL_EBNF, "DataExpr__55", 12, -1},
+{D_SYMBOL_EBNF, "DataExpr__54", 12, -1},
+{D_SYMBOL_EBNF, "DataExpr__53", 12, -1},
+{D_SYMBOL_EBNF, "DataExpr__52", 12, -1},
+{D_SYMBOL_EBNF, "DataExpr__51", 12, -1},
+{D_SYMBOL_EBNF, "DataExpr__50", 12, -1},
+{D_SYMBOL_EBNF, "DataExpr__49", 12, -1},
+{D_SYMBOL_EBNF, "DataExpr__48", 12, -1},
+{D_SYMBOL_EBNF, "DataExpr__47", 12, -1},
+{D_SYMBOL_NTERM, "DataExprUnit", 12, 20},
+{D_SYMBOL_NTERM, "Assignment", 10, 21},
+{D_SYMBOL_NTERM, "AssignmentList", 14, 22},
+{D_SYMBOL_INTERNAL, "AssignmentList__71", 18, -1},
+{D_SYMBOL_EBNF, "AssignmentList__70", 18, -1},
+{D_SYMBOL_NTERM, "DataExprList", 12, 23},
+{D_SYMBOL_INTERNAL, "DataExprList__74", 16, -1},
+{D_SYMBOL_EBNF, "DataExprList__73", 16, -1},
+{D_SYMBOL_NTERM, "BagEnumElt", 10, 24},
+{D_SYMBOL_NTERM, "BagEnumEltList", 14, 25},
+{D_SYMBOL_INTERNAL, "BagEnumEltList__78", 18, -1},
+{D_SYMBOL_EBNF, "BagEnumEltList__77", 18, -1},
+{D_SYMBOL_NTERM, "ActIdSet", 8, 26},
+{D_SYMBOL_NTERM, "MultActId", 9, 27},
+{D_SYMBOL_INTERNAL, "MultActId__82", 13, -1},
+{D_SYMBOL_EBNF, "MultActId__81", 13, -1},
+{D_SYMBOL_NTERM, "MultActIdList", 13, 28},
+{D_SYMBOL_INTERNAL, "MultActIdList__85", 17, -1},
+{D_SYMBOL_EBNF, "MultActIdList__84", 17, -1},
+{D_SYMBOL_NTERM, "MultActIdSet", 12, 29},
+{D_SYMBOL_INTERNAL, "MultActIdSet__87", 16, -1},
+{D_SYMBOL_NTERM, "CommExpr", 8, 30},
+{D_SYMBOL_NTERM, "CommExprList", 12, 31},
+{D_SYMBOL_INTERNAL, "CommExprList__91", 16, -1},
+{D_SYMBOL_EBNF, "CommExprList__90", 16, -1},
+{D_SYMBOL_NTERM, "CommExprSet", 11, 32},
+{D_SYMBOL_INTERNAL, "CommExprSet__93", 15, -1},
+{D_SYMBOL_NTERM, "RenExpr", 7, 33},
+{D_SYMBOL_NTERM, "RenExprList", 11, 34},
+{D_SYMBOL_INTERNAL, "RenExprList__97", 15, -1},
+{D_SYMBOL_EBNF, "RenExprList__96", 15, -1},
+{D_SYMBOL_NTERM, "RenExprSet", 10, 35},
+{D_SYMBOL_INTERNAL, "RenExprSet__99", 14, -1},
+{D_SYMBOL_NTERM, "ProcExpr", 8, 36},
+{D_SYMBOL_EBNF, "ProcExpr__113", 13, -1},
+{D_SYMBOL_EBNF, "ProcExpr__112", 13, -1},
+{D_SYMBOL_EBNF, "ProcExpr__111", 13, -1},
+{D_SYMBOL_EBNF, "ProcExpr__110", 13, -1},
+{D_SYMBOL_EBNF, "ProcExpr__109", 13, -1},
+{D_SYMBOL_EBNF, "ProcExpr__107", 13, -1},
+{D_SYMBOL_EBNF, "ProcExpr__107__108", 18, -1},
+{D_SYMBOL_EBNF, "ProcExpr__106", 13, -1},
+{D_SYMBOL_EBNF, "ProcExpr__105", 13, -1},
+{D_SYMBOL_EBNF, "ProcExpr__104", 13, -1},
+{D_SYMBOL_EBNF, "ProcExpr__103", 13, -1},
+{D_SYMBOL_EBNF, "ProcExpr__102", 13, -1},
+{D_SYMBOL_INTERNAL, "ProcExpr__101", 13, -1},
+{D_SYMBOL_NTERM, "Action", 6, 37},
+{D_SYMBOL_INTERNAL, "Action__116", 11, -1},
+{D_SYMBOL_EBNF, "Action__115", 11, -1},
+{D_SYMBOL_NTERM, "ActDecl", 7, 38},
+{D_SYMBOL_INTERNAL, "ActDecl__119", 12, -1},
+{D_SYMBOL_EBNF, "ActDecl__118", 12, -1},
+{D_SYMBOL_NTERM, "ActSpec", 7, 39},
+{D_SYMBOL_INTERNAL, "ActSpec__121", 12, -1},
+{D_SYMBOL_NTERM, "MultAct", 7, 40},
+{D_SYMBOL_NTERM, "ActionList", 10, 41},
+{D_SYMBOL_INTERNAL, "ActionList__125", 15, -1},
+{D_SYMBOL_EBNF, "ActionList__124", 15, -1},
+{D_SYMBOL_NTERM, "ProcDecl", 8, 42},
+{D_SYMBOL_INTERNAL, "ProcDecl__128", 13, -1},
+{D_SYMBOL_EBNF, "ProcDecl__127", 13, -1},
+{D_SYMBOL_NTERM, "ProcSpec", 8, 43},
+{D_SYMBOL_INTERNAL, "ProcSpec__130", 13, -1},
+{D_SYMBOL_NTERM, "Init", 4, 44},
+{D_SYMBOL_NTERM, "DataSpec", 8, 45},
+{D_SYMBOL_INTERNAL, "DataSpec__134", 13, -1},
+{D_SYMBOL_EBNF, "DataSpec__133", 13, -1},
+{D_SYMBOL_NTERM, "mCRL2Spec", 9, 46},
+{D_SYMBOL_INTERNAL, "mCRL2Spec__137", 14, -1},
+{D_SYMBOL_INTERNAL, "mCRL2Spec__136", 14, -1},
+{D_SYMBOL_NTERM, "mCRL2SpecElt", 12, 47},
+{D_SYMBOL_NTERM, "BesSpec", 7, 48},
+{D_SYMBOL_NTERM, "BesEqnSpec", 10, 49},
+{D_SYMBOL_INTERNAL, "BesEqnSpec__141", 15, -1},
+{D_SYMBOL_NTERM, "BesEqnDecl", 10, 50},
+{D_SYMBOL_NTERM, "BesVar", 6, 51},
+{D_SYMBOL_NTERM, "BesExpr", 7, 52},
+{D_SYMBOL_EBNF, "BesExpr__147", 12, -1},
+{D_SYMBOL_EBNF, "BesExpr__146", 12, -1},
+{D_SYMBOL_EBNF, "BesExpr__145", 12, -1},
+{D_SYMBOL_NTERM, "BesInit", 7, 53},
+{D_SYMBOL_NTERM, "PbesSpec", 8, 54},
+{D_SYMBOL_INTERNAL, "PbesSpec__151", 13, -1},
+{D_SYMBOL_INTERNAL, "PbesSpec__150", 13, -1},
+{D_SYMBOL_NTERM, "PbesEqnSpec", 11, 55},
+{D_SYMBOL_INTERNAL, "PbesEqnSpec__153", 16, -1},
+{D_SYMBOL_NTERM, "PbesEqnDecl", 11, 56},
+{D_SYMBOL_NTERM, "FixedPointOperator", 18, 57},
+{D_SYMBOL_NTERM, "PropVarDecl", 11, 58},
+{D_SYMBOL_INTERNAL, "PropVarDecl__158", 16, -1},
+{D_SYMBOL_EBNF, "PropVarDecl__157", 16, -1},
+{D_SYMBOL_NTERM, "PropVarInst", 11, 59},
+{D_SYMBOL_INTERNAL, "PropVarInst__161", 16, -1},
+{D_SYMBOL_EBNF, "PropVarInst__160", 16, -1},
+{D_SYMBOL_NTERM, "PbesInit", 8, 60},
+{D_SYMBOL_NTERM, "DataValExpr", 11, 61},
+{D_SYMBOL_NTERM, "PbesExpr", 8, 62},
+{D_SYMBOL_EBNF, "PbesExpr__169", 13, -1},
+{D_SYMBOL_EBNF, "PbesExpr__168", 13, -1},
+{D_SYMBOL_EBNF, "PbesExpr__167", 13, -1},
+{D_SYMBOL_INTERNAL, "PbesExpr__166", 13, -1},
+{D_SYMBOL_EBNF, "PbesExpr__165", 13, -1},
+{D_SYMBOL_NTERM, "ActFrm", 6, 63},
+{D_SYMBOL_EBNF, "ActFrm__174", 11, -1},
+{D_SYMBOL_EBNF, "ActFrm__173", 11, -1},
+{D_SYMBOL_EBNF, "ActFrm__172", 11, -1},
+{D_SYMBOL_EBNF, "ActFrm__171", 11, -1},
+{D_SYMBOL_NTERM, "RegFrm", 6, 64},
+{D_SYMBOL_EBNF, "RegFrm__177", 11, -1},
+{D_SYMBOL_EBNF, "RegFrm__176", 11, -1},
+{D_SYMBOL_NTERM, "StateFrmSpec", 12, 65},
+{D_SYMBOL_EBNF, "StateFrmSpec__181", 17, -1},
+{D_SYMBOL_INTERNAL, "StateFrmSpec__181__182", 22, -1},
+{D_SYMBOL_EBNF, "StateFrmSpec__179", 17, -1},
+{D_SYMBOL_INTERNAL, "StateFrmSpec__179__180", 22, -1},
+{D_SYMBOL_NTERM, "FormSpec", 8, 66},
+{D_SYMBOL_NTERM, "StateFrmSpecElt", 15, 67},
+{D_SYMBOL_NTERM, "StateFrm", 8, 68},
+{D_SYMBOL_EBNF, "StateFrm__194", 13, -1},
+{D_SYMBOL_EBNF, "StateFrm__193", 13, -1},
+{D_SYMBOL_EBNF, "StateFrm__192", 13, -1},
+{D_SYMBOL_INTERNAL, "StateFrm__191", 13, -1},
+{D_SYMBOL_EBNF, "StateFrm__190", 13, -1},
+{D_SYMBOL_INTERNAL, "StateFrm__189", 13, -1},
+{D_SYMBOL_EBNF, "StateFrm__188", 13, -1},
+{D_SYMBOL_INTERNAL, "StateFrm__187", 13, -1},
+{D_SYMBOL_EBNF, "StateFrm__186", 13, -1},
+{D_SYMBOL_NTERM, "StateVarDecl", 12, 69},
+{D_SYMBOL_INTERNAL, "StateVarDecl__197", 17, -1},
+{D_SYMBOL_EBNF, "StateVarDecl__196", 17, -1},
+{D_SYMBOL_NTERM, "StateVarAssignment", 18, 70},
+{D_SYMBOL_NTERM, "StateVarAssignmentList", 22, 71},
+{D_SYMBOL_INTERNAL, "StateVarAssignmentList__201", 27, -1},
+{D_SYMBOL_EBNF, "StateVarAssignmentList__200", 27, -1},
+{D_SYMBOL_NTERM, "ActionRenameSpec", 16, 72},
+{D_SYMBOL_INTERNAL, "ActionRenameSpec__204", 21, -1},
+{D_SYMBOL_EBNF, "ActionRenameSpec__203", 21, -1},
+{D_SYMBOL_NTERM, "ActionRenameRuleSpec", 20, 73},
+{D_SYMBOL_INTERNAL, "ActionRenameRuleSpec__207", 25, -1},
+{D_SYMBOL_INTERNAL, "ActionRenameRuleSpec__206", 25, -1},
+{D_SYMBOL_NTERM, "ActionRenameRule", 16, 74},
+{D_SYMBOL_INTERNAL, "ActionRenameRule__210", 21, -1},
+{D_SYMBOL_EBNF, "ActionRenameRule__209", 21, -1},
+{D_SYMBOL_NTERM, "ActionRenameRuleRHS", 19, 75},
+{D_SYMBOL_NTERM, "IdList", 6, 76},
+{D_SYMBOL_INTERNAL, "IdList__214", 11, -1},
+{D_SYMBOL_EBNF, "IdList__213", 11, -1},
+{D_SYMBOL_NTERM, "Id", 2, 77},
+{D_SYMBOL_NTERM, "Number", 6, 78},
+{D_SYMBOL_NTERM, "whitespace", 10, 79},
+{D_SYMBOL_STRING, "Bool", 4, -1},
+{D_SYMBOL_STRING, "Pos", 3, -1},
+{D_SYMBOL_STRING, "Nat", 3, -1},
+{D_SYMBOL_STRING, "Int", 3, -1},
+{D_SYMBOL_STRING, "Real", 4, -1},
+{D_SYMBOL_STRING, "List", 4, -1},
+{D_SYMBOL_STRING, "(", 1, -1},
+{D_SYMBOL_STRING, ")", 1, -1},
+{D_SYMBOL_STRING, "Set", 3, -1},
+{D_SYMBOL_STRING, "(", 1, -1},
+{D_SYMBOL_STRING, ")", 1, -1},
+{D_SYMBOL_STRING, "Bag", 3, -1},
+{D_SYMBOL_STRING, "(", 1, -1},
+{D_SYMBOL_STRING, ")", 1, -1},
+{D_SYMBOL_STRING, "FSet", 4, -1},
+{D_SYMBOL_STRING, "(", 1, -1},
+{D_SYMBOL_STRING, ")", 1, -1},
+{D_SYMBOL_STRING, "FBag", 4, -1},
+{D_SYMBOL_STRING, "(", 1, -1},
+{D_SYMBOL_STRING, ")", 1, -1},
+{D_SYMBOL_STRING, "(", 1, -1},
+{D_SYMBOL_STRING, ")", 1, -1},
+{D_SYMBOL_STRING, "struct", 6, -1},
+{D_SYMBOL_STRING, "->", 2, -1},
+{D_SYMBOL_STRING, "#", 1, -1},
+{D_SYMBOL_STRING, "sort", 4, -1},
+{D_SYMBOL_STRING, ";", 1, -1},
+{D_SYMBOL_STRING, "=", 1, -1},
+{D_SYMBOL_STRING, ";", 1, -1},
+{D_SYMBOL_STRING, "(", 1, -1},
+{D_SYMBOL_STRING, ")", 1, -1},
+{D_SYMBOL_STRING, "?", 1, -1},
+{D_SYMBOL_STRING, "|", 1, -1},
+{D_SYMBOL_STRING, ":", 1, -1},
+{D_SYMBOL_STRING, ",", 1, -1},
+{D_SYMBOL_STRING, ":", 1, -1},
+{D_SYMBOL_STRING, "cons", 4, -1},
+{D_SYMBOL_STRING, ";", 1, -1},
+{D_SYMBOL_STRING, "map", 3, -1},
+{D_SYMBOL_STRING, ";", 1, -1},
+{D_SYMBOL_STRING, "glob", 4, -1},
+{D_SYMBOL_STRING, ";", 1, -1},
+{D_SYMBOL_STRING, "var", 3, -1},
+{D_SYMBOL_STRING, ";", 1, -1},
+{D_SYMBOL_STRING, "eqn", 3, -1},
+{D_SYMBOL_STRING, "->", 2, -1},
+{D_SYMBOL_STRING, "=", 1, -1},
+{D_SYMBOL_STRING, ";", 1, -1},
+{D_SYMBOL_STRING, ":", 1, -1},
+{D_SYMBOL_STRING, ":", 1, -1},
+{D_SYMBOL_STRING, ",", 1, -1},
+{D_SYMBOL_STRING, "true", 4, -1},
+{D_SYMBOL_STRING, "false", 5, -1},
+{D_SYMBOL_STRING, "[", 1, -1},
+{D_SYMBOL_STRING, "]", 1, -1},
+{D_SYMBOL_STRING, "{", 1, -1},
+{D_SYMBOL_STRING, "}", 1, -1},
+{D_SYMBOL_STRING, "{", 1, -1},
+{D_SYMBOL_STRING, ":", 1, -1},
+{D_SYMBOL_STRING, "}", 1, -1},
+{D_SYMBOL_STRING, "[", 1, -1},
+{D_SYMBOL_STRING, "]", 1, -1},
+{D_SYMBOL_STRING, "{", 1, -1},
+{D_SYMBOL_STRING, "}", 1, -1},
+{D_SYMBOL_STRING, "{", 1, -1},
+{D_SYMBOL_STRING, "|", 1, -1},
+{D_SYMBOL_STRING, "}", 1, -1},
+{D_SYMBOL_STRING, "{", 1, -1},
+{D_SYMBOL_STRING, "}", 1, -1},
+{D_SYMBOL_STRING, "(", 1, -1},
+{D_SYMBOL_STRING, ")", 1, -1},
+{D_SYMBOL_STRING, "[", 1, -1},
+{D_SYMBOL_STRING, "->", 2, -1},
+{D_SYMBOL_STRING, "]", 1, -1},
+{D_SYMBOL_STRING, "(", 1, -1},
+{D_SYMBOL_STRING, ")", 1, -1},
+{D_SYMBOL_STRING, "!", 1, -1},
+{D_SYMBOL_STRING, "-", 1, -1},
+{D_SYMBOL_STRING, "#", 1, -1},
+{D_SYMBOL_STRING, "forall", 6, -1},
+{D_SYMBOL_STRING, ".", 1, -1},
+{D_SYMBOL_STRING, "exists", 6, -1},
+{D_SYMBOL_STRING, ".", 1, -1},
+{D_SYMBOL_STRING, "lambda", 6, -1},
+{D_SYMBOL_STRING, ".", 1, -1},
+{D_SYMBOL_STRING, "=>", 2, -1},
+{D_SYMBOL_STRING, "||", 2, -1},
+{D_SYMBOL_STRING, "&&", 2, -1},
+{D_SYMBOL_STRING, "==", 2, -1},
+{D_SYMBOL_STRING, "!=", 2, -1},
+{D_SYMBOL_STRING, "<", 1, -1},
+{D_SYMBOL_STRING, "<=", 2, -1},
+{D_SYMBOL_STRING, ">=", 2, -1},
+{D_SYMBOL_STRING, ">", 1, -1},
+{D_SYMBOL_STRING, "in", 2, -1},
+{D_SYMBOL_STRING, "|>", 2, -1},
+{D_SYMBOL_STRING, "<|", 2, -1},
+{D_SYMBOL_STRING, "++", 2, -1},
+{D_SYMBOL_STRING, "+", 1, -1},
+{D_SYMBOL_STRING, "-", 1, -1},
+{D_SYMBOL_STRING, "/", 1, -1},
+{D_SYMBOL_STRING, "div", 3, -1},
+{D_SYMBOL_STRING, "mod", 3, -1},
+{D_SYMBOL_STRING, "*", 1, -1},
+{D_SYMBOL_STRING, ".", 1, -1},
+{D_SYMBOL_STRING, "whr", 3, -1},
+{D_SYMBOL_STRING, "end", 3, -1},
+{D_SYMBOL_STRING, "true", 4, -1},
+{D_SYMBOL_STRING, "false", 5, -1},
+{D_SYMBOL_STRING, "(", 1, -1},
+{D_SYMBOL_STRING, ")", 1, -1},
+{D_SYMBOL_STRING, "(", 1, -1},
+{D_SYMBOL_STRING, ")", 1, -1},
+{D_SYMBOL_STRING, "!", 1, -1},
+{D_SYMBOL_STRING, "-", 1, -1},
+{D_SYMBOL_STRING, "#", 1, -1},
+{D_SYMBOL_STRING, "=", 1, -1},
+{D_SYMBOL_STRING, ",", 1, -1},
+{D_SYMBOL_STRING, ",", 1, -1},
+{D_SYMBOL_STRING, ":", 1, -1},
+{D_SYMBOL_STRING, ",", 1, -1},
+{D_SYMBOL_STRING, "{", 1, -1},
+{D_SYMBOL_STRING, "}", 1, -1},
+{D_SYMBOL_STRING, "|", 1, -1},
+{D_SYMBOL_STRING, ",", 1, -1},
+{D_SYMBOL_STRING, "{", 1, -1},
+{D_SYMBOL_STRING, "}", 1, -1},
+{D_SYMBOL_STRING, "|", 1, -1},
+{D_SYMBOL_STRING, "->", 2, -1},
+{D_SYMBOL_STRING, ",", 1, -1},
+{D_SYMBOL_STRING, "{", 1, -1},
+{D_SYMBOL_STRING, "}", 1, -1},
+{D_SYMBOL_STRING, "->", 2, -1},
+{D_SYMBOL_STRING, ",", 1, -1},
+{D_SYMBOL_STRING, "{", 1, -1},
+{D_SYMBOL_STRING, "}", 1, -1},
+{D_SYMBOL_STRING, "(", 1, -1},
+{D_SYMBOL_STRING, ")", 1, -1},
+{D_SYMBOL_STRING, "delta", 5, -1},
+{D_SYMBOL_STRING, "tau", 3, -1},
+{D_SYMBOL_STRING, "block", 5, -1},
+{D_SYMBOL_STRING, "(", 1, -1},
+{D_SYMBOL_STRING, ",", 1, -1},
+{D_SYMBOL_STRING, ")", 1, -1},
+{D_SYMBOL_STRING, "allow", 5, -1},
+{D_SYMBOL_STRING, "(", 1, -1},
+{D_SYMBOL_STRING, ",", 1, -1},
+{D_SYMBOL_STRING, ")", 1, -1},
+{D_SYMBOL_STRING, "hide", 4, -1},
+{D_SYMBOL_STRING, "(", 1, -1},
+{D_SYMBOL_STRING, ",", 1, -1},
+{D_SYMBOL_STRING, ")", 1, -1},
+{D_SYMBOL_STRING, "rename", 6, -1},
+{D_SYMBOL_STRING, "(", 1, -1},
+{D_SYMBOL_STRING, ",", 1, -1},
+{D_SYMBOL_STRING, ")", 1, -1},
+{D_SYMBOL_STRING, "comm", 4, -1},
+{D_SYMBOL_STRING, "(", 1, -1},
+{D_SYMBOL_STRING, ",", 1, -1},
+{D_SYMBOL_STRING, ")", 1, -1},
+{D_SYMBOL_STRING, "(", 1, -1},
+{D_SYMBOL_STRING, ")", 1, -1},
+{D_SYMBOL_STRING, "+", 1, -1},
+{D_SYMBOL_STRING, "sum", 3, -1},
+{D_SYMBOL_STRING, ".", 1, -1},
+{D_SYMBOL_STRING, "||", 2, -1},
+{D_SYMBOL_STRING, "||_", 3, -1},
+{D_SYMBOL_STRING, "->", 2, -1},
+{D_SYMBOL_STRING, "->", 2, -1},
+{D_SYMBOL_STRING, "<>", 2, -1},
+{D_SYMBOL_STRING, "<<", 2, -1},
+{D_SYMBOL_STRING, ".", 1, -1},
+{D_SYMBOL_STRING, "@", 1, -1},
+{D_SYMBOL_STRING, "|", 1, -1},
+{D_SYMBOL_STRING, "dist", 4, -1},
+{D_SYMBOL_STRING, "[", 1, -1},
+{D_SYMBOL_STRING, "]", 1, -1},
+{D_SYMBOL_STRING, ".", 1, -1},
+{D_SYMBOL_STRING, "(", 1, -1},
+{D_SYMBOL_STRING, ")", 1, -1},
+{D_SYMBOL_STRING, ":", 1, -1},
+{D_SYMBOL_STRING, ";", 1, -1},
+{D_SYMBOL_STRING, "act", 3, -1},
+{D_SYMBOL_STRING, "tau", 3, -1},
+{D_SYMBOL_STRING, "|", 1, -1},
+{D_SYMBOL_STRING, "(", 1, -1},
+{D_SYMBOL_STRING, ")", 1, -1},
+{D_SYMBOL_STRING, "=", 1, -1},
+{D_SYMBOL_STRING, ";", 1, -1},
+{D_SYMBOL_STRING, "proc", 4, -1},
+{D_SYMBOL_STRING, "init", 4, -1},
+{D_SYMBOL_STRING, ";", 1, -1},
+{D_SYMBOL_STRING, "bes", 3, -1},
+{D_SYMBOL_STRING, "=", 1, -1},
+{D_SYMBOL_STRING, ";", 1, -1},
+{D_SYMBOL_STRING, "true", 4, -1},
+{D_SYMBOL_STRING, "false", 5, -1},
+{D_SYMBOL_STRING, "=>", 2, -1},
+{D_SYMBOL_STRING, "||", 2, -1},
+{D_SYMBOL_STRING, "&&", 2, -1},
+{D_SYMBOL_STRING, "!", 1, -1},
+{D_SYMBOL_STRING, "(", 1, -1},
+{D_SYMBOL_STRING, ")", 1, -1},
+{D_SYMBOL_STRING, "init", 4, -1},
+{D_SYMBOL_STRING, ";", 1, -1},
+{D_SYMBOL_STRING, "pbes", 4, -1},
+{D_SYMBOL_STRING, "=", 1, -1},
+{D_SYMBOL_STRING, ";", 1, -1},
+{D_SYMBOL_STRING, "mu", 2, -1},
+{D_SYMBOL_STRING, "nu", 2, -1},
+{D_SYMBOL_STRING, "(", 1, -1},
+{D_SYMBOL_STRING, ")", 1, -1},
+{D_SYMBOL_STRING, "(", 1, -1},
+{D_SYMBOL_STRING, ")", 1, -1},
+{D_SYMBOL_STRING, "init", 4, -1},
+{D_SYMBOL_STRING, ";", 1, -1},
+{D_SYMBOL_STRING, "val", 3, -1},
+{D_SYMBOL_STRING, "(", 1, -1},
+{D_SYMBOL_STRING, ")", 1, -1},
+{D_SYMBOL_STRING, "(", 1, -1},
+{D_SYMBOL_STRING, ")", 1, -1},
+{D_SYMBOL_STRING, "true", 4, -1},
+{D_SYMBOL_STRING, "false", 5, -1},
+{D_SYMBOL_STRING, "(", 1, -1},
+{D_SYMBOL_STRING, ")", 1, -1},
+{D_SYMBOL_STRING, "forall", 6, -1},
+{D_SYMBOL_STRING, ".", 1, -1},
+{D_SYMBOL_STRING, "exists", 6, -1},
+{D_SYMBOL_STRING, ".", 1, -1},
+{D_SYMBOL_STRING, "=>", 2, -1},
+{D_SYMBOL_STRING, "||", 2, -1},
+{D_SYMBOL_STRING, "&&", 2, -1},
+{D_SYMBOL_STRING, "!", 1, -1},
+{D_SYMBOL_STRING, "(", 1, -1},
+{D_SYMBOL_STRING, ")", 1, -1},
+{D_SYMBOL_STRING, "true", 4, -1},
+{D_SYMBOL_STRING, "false", 5, -1},
+{D_SYMBOL_STRING, "forall", 6, -1},
+{D_SYMBOL_STRING, ".", 1, -1},
+{D_SYMBOL_STRING, "exists", 6, -1},
+{D_SYMBOL_STRING, ".", 1, -1},
+{D_SYMBOL_STRING, "=>", 2, -1},
+{D_SYMBOL_STRING, "||", 2, -1},
+{D_SYMBOL_STRING, "&&", 2, -1},
+{D_SYMBOL_STRING, "@", 1, -1},
+{D_SYMBOL_STRING, "!", 1, -1},
+{D_SYMBOL_STRING, "(", 1, -1},
+{D_SYMBOL_STRING, ")", 1, -1},
+{D_SYMBOL_STRING, "+", 1, -1},
+{D_SYMBOL_STRING, ".", 1, -1},
+{D_SYMBOL_STRING, "*", 1, -1},
+{D_SYMBOL_STRING, "+", 1, -1},
+{D_SYMBOL_STRING, "form", 4, -1},
+{D_SYMBOL_STRING, ";", 1, -1},
+{D_SYMBOL_STRING, "(", 1, -1},
+{D_SYMBOL_STRING, ")", 1, -1},
+{D_SYMBOL_STRING, "true", 4, -1},
+{D_SYMBOL_STRING, "false", 5, -1},
+{D_SYMBOL_STRING, "(", 1, -1},
+{D_SYMBOL_STRING, ")", 1, -1},
+{D_SYMBOL_STRING, "delay", 5, -1},
+{D_SYMBOL_STRING, "@", 1, -1},
+{D_SYMBOL_STRING, "yaled", 5, -1},
+{D_SYMBOL_STRING, "@", 1, -1},
+{D_SYMBOL_STRING, "mu", 2, -1},
+{D_SYMBOL_STRING, ".", 1, -1},
+{D_SYMBOL_STRING, "nu", 2, -1},
+{D_SYMBOL_STRING, ".", 1, -1},
+{D_SYMBOL_STRING, "forall", 6, -1},
+{D_SYMBOL_STRING, ".", 1, -1},
+{D_SYMBOL_STRING, "exists", 6, -1},
+{D_SYMBOL_STRING, ".", 1, -1},
+{D_SYMBOL_STRING, "=>", 2, -1},
+{D_SYMBOL_STRING, "||", 2, -1},
+{D_SYMBOL_STRING, "&&", 2, -1},
+{D_SYMBOL_STRING, "[", 1, -1},
+{D_SYMBOL_STRING, "]", 1, -1},
+{D_SYMBOL_STRING, "<", 1, -1},
+{D_SYMBOL_STRING, ">", 1, -1},
+{D_SYMBOL_STRING, "!", 1, -1},
+{D_SYMBOL_STRING, "(", 1, -1},
+{D_SYMBOL_STRING, ")", 1, -1},
+{D_SYMBOL_STRING, ":", 1, -1},
+{D_SYMBOL_STRING, "=", 1, -1},
+{D_SYMBOL_STRING, ",", 1, -1},
+{D_SYMBOL_STRING, "rename", 6, -1},
+{D_SYMBOL_STRING, "->", 2, -1},
+{D_SYMBOL_STRING, "=>", 2, -1},
+{D_SYMBOL_STRING, ";", 1, -1},
+{D_SYMBOL_STRING, "tau", 3, -1},
+{D_SYMBOL_STRING, "delta", 5, -1},
+{D_SYMBOL_STRING, ",", 1, -1},
+{D_SYMBOL_REGEX, "[A-Za-z_][A-Za-z_0-9']*", 23, -1},
+{D_SYMBOL_REGEX, "0|([1-9][0-9]*)", 15, -1},
+{D_SYMBOL_REGEX, "([ \\t\\n\\r]|(%[^\\n\\r]*))*", 29, -1},
+};
+
+D_ParserTables parser_tables_mcrl2 = {
+898, d_states_mcrl2, d_gotos_mcrl2, 79, 513, d_symbols_mcrl2, NULL, 0, NULL, 0};
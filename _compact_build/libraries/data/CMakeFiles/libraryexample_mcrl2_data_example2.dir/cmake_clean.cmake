@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../stage/bin/libraryexample/libraryexample_mcrl2_data_example2"
+  "../../stage/bin/libraryexample/libraryexample_mcrl2_data_example2.pdb"
+  "CMakeFiles/libraryexample_mcrl2_data_example2.dir/example/example2.cpp.o"
+  "CMakeFiles/libraryexample_mcrl2_data_example2.dir/example/example2.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libraryexample_mcrl2_data_example2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../stage/bin/libraryexample/libraryexample_mcrl2_data_example4"
+  "../../stage/bin/libraryexample/libraryexample_mcrl2_data_example4.pdb"
+  "CMakeFiles/libraryexample_mcrl2_data_example4.dir/example/example4.cpp.o"
+  "CMakeFiles/libraryexample_mcrl2_data_example4.dir/example/example4.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libraryexample_mcrl2_data_example4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../stage/bin/libraryexample/libraryexample_mcrl2_data_parse_data"
+  "../../stage/bin/libraryexample/libraryexample_mcrl2_data_parse_data.pdb"
+  "CMakeFiles/libraryexample_mcrl2_data_parse_data.dir/example/parse_data.cpp.o"
+  "CMakeFiles/libraryexample_mcrl2_data_parse_data.dir/example/parse_data.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libraryexample_mcrl2_data_parse_data.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
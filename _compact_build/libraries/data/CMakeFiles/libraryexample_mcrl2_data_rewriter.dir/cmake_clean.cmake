@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../stage/bin/libraryexample/libraryexample_mcrl2_data_rewriter"
+  "../../stage/bin/libraryexample/libraryexample_mcrl2_data_rewriter.pdb"
+  "CMakeFiles/libraryexample_mcrl2_data_rewriter.dir/example/rewriter.cpp.o"
+  "CMakeFiles/libraryexample_mcrl2_data_rewriter.dir/example/rewriter.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libraryexample_mcrl2_data_rewriter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../stage/bin/librarytest/librarytest_mcrl2_data_ticket_1300"
+  "../../stage/bin/librarytest/librarytest_mcrl2_data_ticket_1300.pdb"
+  "CMakeFiles/librarytest_mcrl2_data_ticket_1300.dir/test/ticket_1300.cpp.o"
+  "CMakeFiles/librarytest_mcrl2_data_ticket_1300.dir/test/ticket_1300.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/librarytest_mcrl2_data_ticket_1300.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,31 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libraries/data/source/data.cpp" "libraries/data/CMakeFiles/mcrl2_data.dir/source/data.cpp.o" "gcc" "libraries/data/CMakeFiles/mcrl2_data.dir/source/data.cpp.o.d"
+  "/root/repo/libraries/data/source/data_io.cpp" "libraries/data/CMakeFiles/mcrl2_data.dir/source/data_io.cpp.o" "gcc" "libraries/data/CMakeFiles/mcrl2_data.dir/source/data_io.cpp.o.d"
+  "/root/repo/libraries/data/source/data_specification.cpp" "libraries/data/CMakeFiles/mcrl2_data.dir/source/data_specification.cpp.o" "gcc" "libraries/data/CMakeFiles/mcrl2_data.dir/source/data_specification.cpp.o.d"
+  "/root/repo/libraries/data/source/detail/prover/smt_lib_solver.cpp" "libraries/data/CMakeFiles/mcrl2_data.dir/source/detail/prover/smt_lib_solver.cpp.o" "gcc" "libraries/data/CMakeFiles/mcrl2_data.dir/source/detail/prover/smt_lib_solver.cpp.o.d"
+  "/root/repo/libraries/data/source/detail/rewrite/jitty.cpp" "libraries/data/CMakeFiles/mcrl2_data.dir/source/detail/rewrite/jitty.cpp.o" "gcc" "libraries/data/CMakeFiles/mcrl2_data.dir/source/detail/rewrite/jitty.cpp.o.d"
+  "/root/repo/libraries/data/source/detail/rewrite/jittyc.cpp" "libraries/data/CMakeFiles/mcrl2_data.dir/source/detail/rewrite/jittyc.cpp.o" "gcc" "libraries/data/CMakeFiles/mcrl2_data.dir/source/detail/rewrite/jittyc.cpp.o.d"
+  "/root/repo/libraries/data/source/detail/rewrite/rewrite.cpp" "libraries/data/CMakeFiles/mcrl2_data.dir/source/detail/rewrite/rewrite.cpp.o" "gcc" "libraries/data/CMakeFiles/mcrl2_data.dir/source/detail/rewrite/rewrite.cpp.o.d"
+  "/root/repo/libraries/data/source/detail/rewrite/strategy.cpp" "libraries/data/CMakeFiles/mcrl2_data.dir/source/detail/rewrite/strategy.cpp.o" "gcc" "libraries/data/CMakeFiles/mcrl2_data.dir/source/detail/rewrite/strategy.cpp.o.d"
+  "/root/repo/libraries/data/source/typecheck.cpp" "libraries/data/CMakeFiles/mcrl2_data.dir/source/typecheck.cpp.o" "gcc" "libraries/data/CMakeFiles/mcrl2_data.dir/source/typecheck.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_compact_build/libraries/core/CMakeFiles/mcrl2_core.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/libraries/atermpp/CMakeFiles/mcrl2_atermpp.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/libraries/utilities/CMakeFiles/mcrl2_utilities.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/3rd-party/dparser/CMakeFiles/dparser.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "../../stage/lib/libmcrl2_data.pdb"
+  "../../stage/lib/libmcrl2_data.so"
+  "CMakeFiles/mcrl2_data.dir/source/data.cpp.o"
+  "CMakeFiles/mcrl2_data.dir/source/data.cpp.o.d"
+  "CMakeFiles/mcrl2_data.dir/source/data_io.cpp.o"
+  "CMakeFiles/mcrl2_data.dir/source/data_io.cpp.o.d"
+  "CMakeFiles/mcrl2_data.dir/source/data_specification.cpp.o"
+  "CMakeFiles/mcrl2_data.dir/source/data_specification.cpp.o.d"
+  "CMakeFiles/mcrl2_data.dir/source/detail/prover/smt_lib_solver.cpp.o"
+  "CMakeFiles/mcrl2_data.dir/source/detail/prover/smt_lib_solver.cpp.o.d"
+  "CMakeFiles/mcrl2_data.dir/source/detail/rewrite/jitty.cpp.o"
+  "CMakeFiles/mcrl2_data.dir/source/detail/rewrite/jitty.cpp.o.d"
+  "CMakeFiles/mcrl2_data.dir/source/detail/rewrite/jittyc.cpp.o"
+  "CMakeFiles/mcrl2_data.dir/source/detail/rewrite/jittyc.cpp.o.d"
+  "CMakeFiles/mcrl2_data.dir/source/detail/rewrite/rewrite.cpp.o"
+  "CMakeFiles/mcrl2_data.dir/source/detail/rewrite/rewrite.cpp.o.d"
+  "CMakeFiles/mcrl2_data.dir/source/detail/rewrite/strategy.cpp.o"
+  "CMakeFiles/mcrl2_data.dir/source/detail/rewrite/strategy.cpp.o.d"
+  "CMakeFiles/mcrl2_data.dir/source/typecheck.cpp.o"
+  "CMakeFiles/mcrl2_data.dir/source/typecheck.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mcrl2_data.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
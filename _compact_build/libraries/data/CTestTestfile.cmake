@@ -0,0 +1,79 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libraries/data
+# Build directory: /root/repo/_compact_build/libraries/data
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(librarytest_mcrl2_data_bag_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_data_bag_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_data_bag_test")
+set_tests_properties(librarytest_mcrl2_data_bag_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/data/CMakeLists.txt;7;add_mcrl2_library;/root/repo/libraries/data/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_data_bool_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_data_bool_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_data_bool_test")
+set_tests_properties(librarytest_mcrl2_data_bool_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/data/CMakeLists.txt;7;add_mcrl2_library;/root/repo/libraries/data/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_data_builder_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_data_builder_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_data_builder_test")
+set_tests_properties(librarytest_mcrl2_data_builder_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/data/CMakeLists.txt;7;add_mcrl2_library;/root/repo/libraries/data/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_data_compatibility_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_data_compatibility_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_data_compatibility_test")
+set_tests_properties(librarytest_mcrl2_data_compatibility_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/data/CMakeLists.txt;7;add_mcrl2_library;/root/repo/libraries/data/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_data_data_equation_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_data_data_equation_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_data_data_equation_test")
+set_tests_properties(librarytest_mcrl2_data_data_equation_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/data/CMakeLists.txt;7;add_mcrl2_library;/root/repo/libraries/data/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_data_data_expression_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_data_data_expression_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_data_data_expression_test")
+set_tests_properties(librarytest_mcrl2_data_data_expression_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/data/CMakeLists.txt;7;add_mcrl2_library;/root/repo/libraries/data/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_data_data_specification_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_data_data_specification_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_data_data_specification_test")
+set_tests_properties(librarytest_mcrl2_data_data_specification_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/data/CMakeLists.txt;7;add_mcrl2_library;/root/repo/libraries/data/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_data_enumerator_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_data_enumerator_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_data_enumerator_test")
+set_tests_properties(librarytest_mcrl2_data_enumerator_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/data/CMakeLists.txt;7;add_mcrl2_library;/root/repo/libraries/data/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_data_find_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_data_find_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_data_find_test")
+set_tests_properties(librarytest_mcrl2_data_find_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/data/CMakeLists.txt;7;add_mcrl2_library;/root/repo/libraries/data/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_data_identifier_generator_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_data_identifier_generator_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_data_identifier_generator_test")
+set_tests_properties(librarytest_mcrl2_data_identifier_generator_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/data/CMakeLists.txt;7;add_mcrl2_library;/root/repo/libraries/data/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_data_index_traits_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_data_index_traits_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_data_index_traits_test")
+set_tests_properties(librarytest_mcrl2_data_index_traits_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/data/CMakeLists.txt;7;add_mcrl2_library;/root/repo/libraries/data/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_data_int_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_data_int_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_data_int_test")
+set_tests_properties(librarytest_mcrl2_data_int_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/data/CMakeLists.txt;7;add_mcrl2_library;/root/repo/libraries/data/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_data_linear_inequalities_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_data_linear_inequalities_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_data_linear_inequalities_test")
+set_tests_properties(librarytest_mcrl2_data_linear_inequalities_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/data/CMakeLists.txt;7;add_mcrl2_library;/root/repo/libraries/data/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_data_list_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_data_list_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_data_list_test")
+set_tests_properties(librarytest_mcrl2_data_list_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/data/CMakeLists.txt;7;add_mcrl2_library;/root/repo/libraries/data/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_data_normalize_sorts_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_data_normalize_sorts_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_data_normalize_sorts_test")
+set_tests_properties(librarytest_mcrl2_data_normalize_sorts_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/data/CMakeLists.txt;7;add_mcrl2_library;/root/repo/libraries/data/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_data_parser_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_data_parser_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_data_parser_test")
+set_tests_properties(librarytest_mcrl2_data_parser_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/data/CMakeLists.txt;7;add_mcrl2_library;/root/repo/libraries/data/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_data_print_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_data_print_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_data_print_test")
+set_tests_properties(librarytest_mcrl2_data_print_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/data/CMakeLists.txt;7;add_mcrl2_library;/root/repo/libraries/data/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_data_quantifier_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_data_quantifier_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_data_quantifier_test")
+set_tests_properties(librarytest_mcrl2_data_quantifier_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/data/CMakeLists.txt;7;add_mcrl2_library;/root/repo/libraries/data/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_data_replace_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_data_replace_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_data_replace_test")
+set_tests_properties(librarytest_mcrl2_data_replace_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/data/CMakeLists.txt;7;add_mcrl2_library;/root/repo/libraries/data/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_data_representative_generator_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_data_representative_generator_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_data_representative_generator_test")
+set_tests_properties(librarytest_mcrl2_data_representative_generator_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/data/CMakeLists.txt;7;add_mcrl2_library;/root/repo/libraries/data/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_data_rewriter_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_data_rewriter_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_data_rewriter_test")
+set_tests_properties(librarytest_mcrl2_data_rewriter_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/data/CMakeLists.txt;7;add_mcrl2_library;/root/repo/libraries/data/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_data_rewriting_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_data_rewriting_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_data_rewriting_test")
+set_tests_properties(librarytest_mcrl2_data_rewriting_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/data/CMakeLists.txt;7;add_mcrl2_library;/root/repo/libraries/data/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_data_set_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_data_set_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_data_set_test")
+set_tests_properties(librarytest_mcrl2_data_set_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/data/CMakeLists.txt;7;add_mcrl2_library;/root/repo/libraries/data/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_data_sort_expression_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_data_sort_expression_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_data_sort_expression_test")
+set_tests_properties(librarytest_mcrl2_data_sort_expression_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/data/CMakeLists.txt;7;add_mcrl2_library;/root/repo/libraries/data/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_data_substitution_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_data_substitution_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_data_substitution_test")
+set_tests_properties(librarytest_mcrl2_data_substitution_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/data/CMakeLists.txt;7;add_mcrl2_library;/root/repo/libraries/data/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_data_template_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_data_template_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_data_template_test")
+set_tests_properties(librarytest_mcrl2_data_template_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/data/CMakeLists.txt;7;add_mcrl2_library;/root/repo/libraries/data/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_data_ticket_1300 "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_data_ticket_1300" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_data_ticket_1300")
+set_tests_properties(librarytest_mcrl2_data_ticket_1300 PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/data/CMakeLists.txt;7;add_mcrl2_library;/root/repo/libraries/data/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_data_type_check_tree_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_data_type_check_tree_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_data_type_check_tree_test")
+set_tests_properties(librarytest_mcrl2_data_type_check_tree_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/data/CMakeLists.txt;7;add_mcrl2_library;/root/repo/libraries/data/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_data_typecheck_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_data_typecheck_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_data_typecheck_test")
+set_tests_properties(librarytest_mcrl2_data_typecheck_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/data/CMakeLists.txt;7;add_mcrl2_library;/root/repo/libraries/data/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_data_utility_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_data_utility_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_data_utility_test")
+set_tests_properties(librarytest_mcrl2_data_utility_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/data/CMakeLists.txt;7;add_mcrl2_library;/root/repo/libraries/data/CMakeLists.txt;0;")
+add_test(libraryexample_mcrl2_data_example1 "/usr/bin/cmake" "--build" "/root/repo/_compact_build" "--target" "libraryexample_mcrl2_data_example1")
+set_tests_properties(libraryexample_mcrl2_data_example1 PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "libraryexample" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;42;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/data/CMakeLists.txt;7;add_mcrl2_library;/root/repo/libraries/data/CMakeLists.txt;0;")
+add_test(libraryexample_mcrl2_data_example2 "/usr/bin/cmake" "--build" "/root/repo/_compact_build" "--target" "libraryexample_mcrl2_data_example2")
+set_tests_properties(libraryexample_mcrl2_data_example2 PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "libraryexample" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;42;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/data/CMakeLists.txt;7;add_mcrl2_library;/root/repo/libraries/data/CMakeLists.txt;0;")
+add_test(libraryexample_mcrl2_data_example3 "/usr/bin/cmake" "--build" "/root/repo/_compact_build" "--target" "libraryexample_mcrl2_data_example3")
+set_tests_properties(libraryexample_mcrl2_data_example3 PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "libraryexample" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;42;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/data/CMakeLists.txt;7;add_mcrl2_library;/root/repo/libraries/data/CMakeLists.txt;0;")
+add_test(libraryexample_mcrl2_data_example4 "/usr/bin/cmake" "--build" "/root/repo/_compact_build" "--target" "libraryexample_mcrl2_data_example4")
+set_tests_properties(libraryexample_mcrl2_data_example4 PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "libraryexample" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;42;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/data/CMakeLists.txt;7;add_mcrl2_library;/root/repo/libraries/data/CMakeLists.txt;0;")
+add_test(libraryexample_mcrl2_data_parse_data "/usr/bin/cmake" "--build" "/root/repo/_compact_build" "--target" "libraryexample_mcrl2_data_parse_data")
+set_tests_properties(libraryexample_mcrl2_data_parse_data PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "libraryexample" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;42;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/data/CMakeLists.txt;7;add_mcrl2_library;/root/repo/libraries/data/CMakeLists.txt;0;")
+add_test(libraryexample_mcrl2_data_rewriter "/usr/bin/cmake" "--build" "/root/repo/_compact_build" "--target" "libraryexample_mcrl2_data_rewriter")
+set_tests_properties(libraryexample_mcrl2_data_rewriter PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "libraryexample" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;42;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/data/CMakeLists.txt;7;add_mcrl2_library;/root/repo/libraries/data/CMakeLists.txt;0;")
+subdirs("example")
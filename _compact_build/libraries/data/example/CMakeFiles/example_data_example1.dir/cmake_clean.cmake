@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/example_data_example1"
+  "../../../stage/bin/example_data_example1.pdb"
+  "CMakeFiles/example_data_example1.dir/example1.cpp.o"
+  "CMakeFiles/example_data_example1.dir/example1.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_data_example1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
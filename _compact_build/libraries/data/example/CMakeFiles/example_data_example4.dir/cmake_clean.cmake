@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/example_data_example4"
+  "../../../stage/bin/example_data_example4.pdb"
+  "CMakeFiles/example_data_example4.dir/example4.cpp.o"
+  "CMakeFiles/example_data_example4.dir/example4.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_data_example4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
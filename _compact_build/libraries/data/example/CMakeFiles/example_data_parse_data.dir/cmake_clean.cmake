@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/example_data_parse_data"
+  "../../../stage/bin/example_data_parse_data.pdb"
+  "CMakeFiles/example_data_parse_data.dir/parse_data.cpp.o"
+  "CMakeFiles/example_data_parse_data.dir/parse_data.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_data_parse_data.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
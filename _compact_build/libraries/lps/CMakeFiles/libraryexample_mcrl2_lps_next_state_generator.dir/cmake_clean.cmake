@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../stage/bin/libraryexample/libraryexample_mcrl2_lps_next_state_generator"
+  "../../stage/bin/libraryexample/libraryexample_mcrl2_lps_next_state_generator.pdb"
+  "CMakeFiles/libraryexample_mcrl2_lps_next_state_generator.dir/example/next_state_generator.cpp.o"
+  "CMakeFiles/libraryexample_mcrl2_lps_next_state_generator.dir/example/next_state_generator.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libraryexample_mcrl2_lps_next_state_generator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../stage/bin/libraryexample/libraryexample_mcrl2_lps_parelm_test"
+  "../../stage/bin/libraryexample/libraryexample_mcrl2_lps_parelm_test.pdb"
+  "CMakeFiles/libraryexample_mcrl2_lps_parelm_test.dir/example/parelm_test.cpp.o"
+  "CMakeFiles/libraryexample_mcrl2_lps_parelm_test.dir/example/parelm_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libraryexample_mcrl2_lps_parelm_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
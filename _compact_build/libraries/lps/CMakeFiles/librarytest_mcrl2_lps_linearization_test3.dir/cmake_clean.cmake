@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../stage/bin/librarytest/librarytest_mcrl2_lps_linearization_test3"
+  "../../stage/bin/librarytest/librarytest_mcrl2_lps_linearization_test3.pdb"
+  "CMakeFiles/librarytest_mcrl2_lps_linearization_test3.dir/test/linearization_test3.cpp.o"
+  "CMakeFiles/librarytest_mcrl2_lps_linearization_test3.dir/test/linearization_test3.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/librarytest_mcrl2_lps_linearization_test3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
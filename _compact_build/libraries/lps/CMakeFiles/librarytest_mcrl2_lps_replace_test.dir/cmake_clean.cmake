@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../stage/bin/librarytest/librarytest_mcrl2_lps_replace_test"
+  "../../stage/bin/librarytest/librarytest_mcrl2_lps_replace_test.pdb"
+  "CMakeFiles/librarytest_mcrl2_lps_replace_test.dir/test/replace_test.cpp.o"
+  "CMakeFiles/librarytest_mcrl2_lps_replace_test.dir/test/replace_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/librarytest_mcrl2_lps_replace_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,34 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libraries/lps/source/linearise.cpp" "libraries/lps/CMakeFiles/mcrl2_lps.dir/source/linearise.cpp.o" "gcc" "libraries/lps/CMakeFiles/mcrl2_lps.dir/source/linearise.cpp.o.d"
+  "/root/repo/libraries/lps/source/lps.cpp" "libraries/lps/CMakeFiles/mcrl2_lps.dir/source/lps.cpp.o" "gcc" "libraries/lps/CMakeFiles/mcrl2_lps.dir/source/lps.cpp.o.d"
+  "/root/repo/libraries/lps/source/lps_io.cpp" "libraries/lps/CMakeFiles/mcrl2_lps.dir/source/lps_io.cpp.o" "gcc" "libraries/lps/CMakeFiles/mcrl2_lps.dir/source/lps_io.cpp.o.d"
+  "/root/repo/libraries/lps/source/lpsparunfoldlib.cpp" "libraries/lps/CMakeFiles/mcrl2_lps.dir/source/lpsparunfoldlib.cpp.o" "gcc" "libraries/lps/CMakeFiles/mcrl2_lps.dir/source/lpsparunfoldlib.cpp.o.d"
+  "/root/repo/libraries/lps/source/next_state_generator.cpp" "libraries/lps/CMakeFiles/mcrl2_lps.dir/source/next_state_generator.cpp.o" "gcc" "libraries/lps/CMakeFiles/mcrl2_lps.dir/source/next_state_generator.cpp.o.d"
+  "/root/repo/libraries/lps/source/symbolic_lts_io.cpp" "libraries/lps/CMakeFiles/mcrl2_lps.dir/source/symbolic_lts_io.cpp.o" "gcc" "libraries/lps/CMakeFiles/mcrl2_lps.dir/source/symbolic_lts_io.cpp.o.d"
+  "/root/repo/libraries/lps/source/tools.cpp" "libraries/lps/CMakeFiles/mcrl2_lps.dir/source/tools.cpp.o" "gcc" "libraries/lps/CMakeFiles/mcrl2_lps.dir/source/tools.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_compact_build/libraries/process/CMakeFiles/mcrl2_process.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/libraries/smt/CMakeFiles/mcrl2_smt.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/libraries/symbolic/CMakeFiles/mcrl2_symbolic.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/libraries/data/CMakeFiles/mcrl2_data.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/libraries/core/CMakeFiles/mcrl2_core.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/libraries/atermpp/CMakeFiles/mcrl2_atermpp.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/3rd-party/dparser/CMakeFiles/dparser.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/libraries/utilities/CMakeFiles/mcrl2_utilities.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/3rd-party/sylvan/src/CMakeFiles/sylvan.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
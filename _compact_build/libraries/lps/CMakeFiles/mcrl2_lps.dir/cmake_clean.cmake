@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "../../stage/lib/libmcrl2_lps.pdb"
+  "../../stage/lib/libmcrl2_lps.so"
+  "CMakeFiles/mcrl2_lps.dir/source/linearise.cpp.o"
+  "CMakeFiles/mcrl2_lps.dir/source/linearise.cpp.o.d"
+  "CMakeFiles/mcrl2_lps.dir/source/lps.cpp.o"
+  "CMakeFiles/mcrl2_lps.dir/source/lps.cpp.o.d"
+  "CMakeFiles/mcrl2_lps.dir/source/lps_io.cpp.o"
+  "CMakeFiles/mcrl2_lps.dir/source/lps_io.cpp.o.d"
+  "CMakeFiles/mcrl2_lps.dir/source/lpsparunfoldlib.cpp.o"
+  "CMakeFiles/mcrl2_lps.dir/source/lpsparunfoldlib.cpp.o.d"
+  "CMakeFiles/mcrl2_lps.dir/source/next_state_generator.cpp.o"
+  "CMakeFiles/mcrl2_lps.dir/source/next_state_generator.cpp.o.d"
+  "CMakeFiles/mcrl2_lps.dir/source/symbolic_lts_io.cpp.o"
+  "CMakeFiles/mcrl2_lps.dir/source/symbolic_lts_io.cpp.o.d"
+  "CMakeFiles/mcrl2_lps.dir/source/tools.cpp.o"
+  "CMakeFiles/mcrl2_lps.dir/source/tools.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mcrl2_lps.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
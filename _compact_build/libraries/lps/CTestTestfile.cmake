@@ -0,0 +1,79 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libraries/lps
+# Build directory: /root/repo/_compact_build/libraries/lps
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(librarytest_mcrl2_lps_action_rename_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_lps_action_rename_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_lps_action_rename_test")
+set_tests_properties(librarytest_mcrl2_lps_action_rename_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/lps/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/lps/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_lps_binary_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_lps_binary_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_lps_binary_test")
+set_tests_properties(librarytest_mcrl2_lps_binary_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/lps/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/lps/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_lps_confcheck_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_lps_confcheck_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_lps_confcheck_test")
+set_tests_properties(librarytest_mcrl2_lps_confcheck_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/lps/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/lps/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_lps_constelm_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_lps_constelm_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_lps_constelm_test")
+set_tests_properties(librarytest_mcrl2_lps_constelm_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/lps/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/lps/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_lps_data_specification_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_lps_data_specification_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_lps_data_specification_test")
+set_tests_properties(librarytest_mcrl2_lps_data_specification_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/lps/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/lps/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_lps_external_state_map_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_lps_external_state_map_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_lps_external_state_map_test")
+set_tests_properties(librarytest_mcrl2_lps_external_state_map_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/lps/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/lps/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_lps_find_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_lps_find_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_lps_find_test")
+set_tests_properties(librarytest_mcrl2_lps_find_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/lps/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/lps/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_lps_invelm_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_lps_invelm_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_lps_invelm_test")
+set_tests_properties(librarytest_mcrl2_lps_invelm_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/lps/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/lps/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_lps_linear_process_conversion_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_lps_linear_process_conversion_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_lps_linear_process_conversion_test")
+set_tests_properties(librarytest_mcrl2_lps_linear_process_conversion_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/lps/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/lps/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_lps_linearization_stochastic_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_lps_linearization_stochastic_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_lps_linearization_stochastic_test")
+set_tests_properties(librarytest_mcrl2_lps_linearization_stochastic_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/lps/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/lps/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_lps_linearization_test1 "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_lps_linearization_test1" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_lps_linearization_test1")
+set_tests_properties(librarytest_mcrl2_lps_linearization_test1 PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/lps/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/lps/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_lps_linearization_test2 "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_lps_linearization_test2" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_lps_linearization_test2")
+set_tests_properties(librarytest_mcrl2_lps_linearization_test2 PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/lps/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/lps/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_lps_linearization_test3 "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_lps_linearization_test3" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_lps_linearization_test3")
+set_tests_properties(librarytest_mcrl2_lps_linearization_test3 PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/lps/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/lps/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_lps_lps_algorithm_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_lps_lps_algorithm_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_lps_lps_algorithm_test")
+set_tests_properties(librarytest_mcrl2_lps_lps_algorithm_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/lps/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/lps/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_lps_lpsparunfold_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_lps_lpsparunfold_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_lps_lpsparunfold_test")
+set_tests_properties(librarytest_mcrl2_lps_lpsparunfold_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/lps/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/lps/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_lps_ltsmin_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_lps_ltsmin_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_lps_ltsmin_test")
+set_tests_properties(librarytest_mcrl2_lps_ltsmin_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/lps/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/lps/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_lps_multi_action_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_lps_multi_action_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_lps_multi_action_test")
+set_tests_properties(librarytest_mcrl2_lps_multi_action_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/lps/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/lps/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_lps_next_state_generator_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_lps_next_state_generator_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_lps_next_state_generator_test")
+set_tests_properties(librarytest_mcrl2_lps_next_state_generator_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/lps/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/lps/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_lps_parelm_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_lps_parelm_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_lps_parelm_test")
+set_tests_properties(librarytest_mcrl2_lps_parelm_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/lps/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/lps/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_lps_print_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_lps_print_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_lps_print_test")
+set_tests_properties(librarytest_mcrl2_lps_print_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/lps/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/lps/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_lps_remove_parameters_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_lps_remove_parameters_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_lps_remove_parameters_test")
+set_tests_properties(librarytest_mcrl2_lps_remove_parameters_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/lps/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/lps/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_lps_rename_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_lps_rename_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_lps_rename_test")
+set_tests_properties(librarytest_mcrl2_lps_rename_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/lps/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/lps/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_lps_replace_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_lps_replace_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_lps_replace_test")
+set_tests_properties(librarytest_mcrl2_lps_replace_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/lps/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/lps/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_lps_resolve_name_clash_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_lps_resolve_name_clash_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_lps_resolve_name_clash_test")
+set_tests_properties(librarytest_mcrl2_lps_resolve_name_clash_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/lps/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/lps/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_lps_rewriter_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_lps_rewriter_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_lps_rewriter_test")
+set_tests_properties(librarytest_mcrl2_lps_rewriter_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/lps/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/lps/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_lps_short_vector_explorer_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_lps_short_vector_explorer_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_lps_short_vector_explorer_test")
+set_tests_properties(librarytest_mcrl2_lps_short_vector_explorer_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/lps/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/lps/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_lps_specification_property_map_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_lps_specification_property_map_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_lps_specification_property_map_test")
+set_tests_properties(librarytest_mcrl2_lps_specification_property_map_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/lps/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/lps/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_lps_specification_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_lps_specification_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_lps_specification_test")
+set_tests_properties(librarytest_mcrl2_lps_specification_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/lps/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/lps/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_lps_stochastic_specification_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_lps_stochastic_specification_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_lps_stochastic_specification_test")
+set_tests_properties(librarytest_mcrl2_lps_stochastic_specification_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/lps/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/lps/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_lps_sumelm_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_lps_sumelm_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_lps_sumelm_test")
+set_tests_properties(librarytest_mcrl2_lps_sumelm_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/lps/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/lps/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_lps_suminst_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_lps_suminst_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_lps_suminst_test")
+set_tests_properties(librarytest_mcrl2_lps_suminst_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/lps/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/lps/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_lps_symbolic_reachability_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_lps_symbolic_reachability_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_lps_symbolic_reachability_test")
+set_tests_properties(librarytest_mcrl2_lps_symbolic_reachability_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/lps/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/lps/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_lps_timed_linearization_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_lps_timed_linearization_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_lps_timed_linearization_test")
+set_tests_properties(librarytest_mcrl2_lps_timed_linearization_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/lps/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/lps/CMakeLists.txt;0;")
+add_test(librarytest_mcrl2_lps_untime_test "/usr/bin/ctest" "--build-and-test" "/root/repo" "/root/repo/_compact_build" "--build-noclean" "--build-nocmake" "--build-generator" "Unix Makefiles" "--build-target" "librarytest_mcrl2_lps_untime_test" "--build-makeprogram" "/usr/bin/gmake" "--test-command" "/root/repo/_compact_build/stage/bin/librarytest/librarytest_mcrl2_lps_untime_test")
+set_tests_properties(librarytest_mcrl2_lps_untime_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "librarytest" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;30;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/lps/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/lps/CMakeLists.txt;0;")
+add_test(libraryexample_mcrl2_lps_next_state_generator "/usr/bin/cmake" "--build" "/root/repo/_compact_build" "--target" "libraryexample_mcrl2_lps_next_state_generator")
+set_tests_properties(libraryexample_mcrl2_lps_next_state_generator PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "libraryexample" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;42;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/lps/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/lps/CMakeLists.txt;0;")
+add_test(libraryexample_mcrl2_lps_parelm_test "/usr/bin/cmake" "--build" "/root/repo/_compact_build" "--target" "libraryexample_mcrl2_lps_parelm_test")
+set_tests_properties(libraryexample_mcrl2_lps_parelm_test PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "libraryexample" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;42;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/lps/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/lps/CMakeLists.txt;0;")
+subdirs("example")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/example_lps_next_state_generator"
+  "../../../stage/bin/example_lps_next_state_generator.pdb"
+  "CMakeFiles/example_lps_next_state_generator.dir/next_state_generator.cpp.o"
+  "CMakeFiles/example_lps_next_state_generator.dir/next_state_generator.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_lps_next_state_generator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
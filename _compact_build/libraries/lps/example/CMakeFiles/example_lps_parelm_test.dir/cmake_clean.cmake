@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/example_lps_parelm_test"
+  "../../../stage/bin/example_lps_parelm_test.pdb"
+  "CMakeFiles/example_lps_parelm_test.dir/parelm_test.cpp.o"
+  "CMakeFiles/example_lps_parelm_test.dir/parelm_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_lps_parelm_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../stage/bin/librarytest/librarytest_mcrl2_lts_compare"
+  "../../stage/bin/librarytest/librarytest_mcrl2_lts_compare.pdb"
+  "CMakeFiles/librarytest_mcrl2_lts_compare.dir/test/compare.cpp.o"
+  "CMakeFiles/librarytest_mcrl2_lts_compare.dir/test/compare.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/librarytest_mcrl2_lts_compare.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../stage/bin/librarytest/librarytest_mcrl2_lts_read_mcrl2"
+  "../../stage/bin/librarytest/librarytest_mcrl2_lts_read_mcrl2.pdb"
+  "CMakeFiles/librarytest_mcrl2_lts_read_mcrl2.dir/test/read_mcrl2.cpp.o"
+  "CMakeFiles/librarytest_mcrl2_lts_read_mcrl2.dir/test/read_mcrl2.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/librarytest_mcrl2_lts_read_mcrl2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
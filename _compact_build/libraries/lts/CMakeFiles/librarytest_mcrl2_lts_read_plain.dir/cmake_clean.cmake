@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../stage/bin/librarytest/librarytest_mcrl2_lts_read_plain"
+  "../../stage/bin/librarytest/librarytest_mcrl2_lts_read_plain.pdb"
+  "CMakeFiles/librarytest_mcrl2_lts_read_plain.dir/test/read_plain.cpp.o"
+  "CMakeFiles/librarytest_mcrl2_lts_read_plain.dir/test/read_plain.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/librarytest_mcrl2_lts_read_plain.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
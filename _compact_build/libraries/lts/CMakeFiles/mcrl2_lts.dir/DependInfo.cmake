@@ -0,0 +1,40 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libraries/lts/source/check_complexity.cpp" "libraries/lts/CMakeFiles/mcrl2_lts.dir/source/check_complexity.cpp.o" "gcc" "libraries/lts/CMakeFiles/mcrl2_lts.dir/source/check_complexity.cpp.o.d"
+  "/root/repo/libraries/lts/source/exploration.cpp" "libraries/lts/CMakeFiles/mcrl2_lts.dir/source/exploration.cpp.o" "gcc" "libraries/lts/CMakeFiles/mcrl2_lts.dir/source/exploration.cpp.o.d"
+  "/root/repo/libraries/lts/source/liblts.cpp" "libraries/lts/CMakeFiles/mcrl2_lts.dir/source/liblts.cpp.o" "gcc" "libraries/lts/CMakeFiles/mcrl2_lts.dir/source/liblts.cpp.o.d"
+  "/root/repo/libraries/lts/source/liblts_aut.cpp" "libraries/lts/CMakeFiles/mcrl2_lts.dir/source/liblts_aut.cpp.o" "gcc" "libraries/lts/CMakeFiles/mcrl2_lts.dir/source/liblts_aut.cpp.o.d"
+  "/root/repo/libraries/lts/source/liblts_bisim_gjkw.cpp" "libraries/lts/CMakeFiles/mcrl2_lts.dir/source/liblts_bisim_gjkw.cpp.o" "gcc" "libraries/lts/CMakeFiles/mcrl2_lts.dir/source/liblts_bisim_gjkw.cpp.o.d"
+  "/root/repo/libraries/lts/source/liblts_dot.cpp" "libraries/lts/CMakeFiles/mcrl2_lts.dir/source/liblts_dot.cpp.o" "gcc" "libraries/lts/CMakeFiles/mcrl2_lts.dir/source/liblts_dot.cpp.o.d"
+  "/root/repo/libraries/lts/source/liblts_fsm.cpp" "libraries/lts/CMakeFiles/mcrl2_lts.dir/source/liblts_fsm.cpp.o" "gcc" "libraries/lts/CMakeFiles/mcrl2_lts.dir/source/liblts_fsm.cpp.o.d"
+  "/root/repo/libraries/lts/source/liblts_lts.cpp" "libraries/lts/CMakeFiles/mcrl2_lts.dir/source/liblts_lts.cpp.o" "gcc" "libraries/lts/CMakeFiles/mcrl2_lts.dir/source/liblts_lts.cpp.o.d"
+  "/root/repo/libraries/lts/source/sim_hashtable.cpp" "libraries/lts/CMakeFiles/mcrl2_lts.dir/source/sim_hashtable.cpp.o" "gcc" "libraries/lts/CMakeFiles/mcrl2_lts.dir/source/sim_hashtable.cpp.o.d"
+  "/root/repo/libraries/lts/source/simulation.cpp" "libraries/lts/CMakeFiles/mcrl2_lts.dir/source/simulation.cpp.o" "gcc" "libraries/lts/CMakeFiles/mcrl2_lts.dir/source/simulation.cpp.o.d"
+  "/root/repo/libraries/lts/source/tree_set.cpp" "libraries/lts/CMakeFiles/mcrl2_lts.dir/source/tree_set.cpp.o" "gcc" "libraries/lts/CMakeFiles/mcrl2_lts.dir/source/tree_set.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_compact_build/libraries/modal_formula/CMakeFiles/mcrl2_modal_formula.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/libraries/lps/CMakeFiles/mcrl2_lps.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/libraries/smt/CMakeFiles/mcrl2_smt.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/libraries/symbolic/CMakeFiles/mcrl2_symbolic.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/3rd-party/sylvan/src/CMakeFiles/sylvan.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/libraries/process/CMakeFiles/mcrl2_process.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/libraries/data/CMakeFiles/mcrl2_data.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/libraries/core/CMakeFiles/mcrl2_core.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/libraries/atermpp/CMakeFiles/mcrl2_atermpp.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/libraries/utilities/CMakeFiles/mcrl2_utilities.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/3rd-party/dparser/CMakeFiles/dparser.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
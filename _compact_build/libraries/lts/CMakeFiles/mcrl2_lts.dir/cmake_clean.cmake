@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "../../stage/lib/libmcrl2_lts.pdb"
+  "../../stage/lib/libmcrl2_lts.so"
+  "CMakeFiles/mcrl2_lts.dir/source/check_complexity.cpp.o"
+  "CMakeFiles/mcrl2_lts.dir/source/check_complexity.cpp.o.d"
+  "CMakeFiles/mcrl2_lts.dir/source/exploration.cpp.o"
+  "CMakeFiles/mcrl2_lts.dir/source/exploration.cpp.o.d"
+  "CMakeFiles/mcrl2_lts.dir/source/liblts.cpp.o"
+  "CMakeFiles/mcrl2_lts.dir/source/liblts.cpp.o.d"
+  "CMakeFiles/mcrl2_lts.dir/source/liblts_aut.cpp.o"
+  "CMakeFiles/mcrl2_lts.dir/source/liblts_aut.cpp.o.d"
+  "CMakeFiles/mcrl2_lts.dir/source/liblts_bisim_gjkw.cpp.o"
+  "CMakeFiles/mcrl2_lts.dir/source/liblts_bisim_gjkw.cpp.o.d"
+  "CMakeFiles/mcrl2_lts.dir/source/liblts_dot.cpp.o"
+  "CMakeFiles/mcrl2_lts.dir/source/liblts_dot.cpp.o.d"
+  "CMakeFiles/mcrl2_lts.dir/source/liblts_fsm.cpp.o"
+  "CMakeFiles/mcrl2_lts.dir/source/liblts_fsm.cpp.o.d"
+  "CMakeFiles/mcrl2_lts.dir/source/liblts_lts.cpp.o"
+  "CMakeFiles/mcrl2_lts.dir/source/liblts_lts.cpp.o.d"
+  "CMakeFiles/mcrl2_lts.dir/source/sim_hashtable.cpp.o"
+  "CMakeFiles/mcrl2_lts.dir/source/sim_hashtable.cpp.o.d"
+  "CMakeFiles/mcrl2_lts.dir/source/simulation.cpp.o"
+  "CMakeFiles/mcrl2_lts.dir/source/simulation.cpp.o.d"
+  "CMakeFiles/mcrl2_lts.dir/source/tree_set.cpp.o"
+  "CMakeFiles/mcrl2_lts.dir/source/tree_set.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mcrl2_lts.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
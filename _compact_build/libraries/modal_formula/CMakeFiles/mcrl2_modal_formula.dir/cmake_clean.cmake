@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../stage/lib/libmcrl2_modal_formula.pdb"
+  "../../stage/lib/libmcrl2_modal_formula.so"
+  "CMakeFiles/mcrl2_modal_formula.dir/source/modal_formula.cpp.o"
+  "CMakeFiles/mcrl2_modal_formula.dir/source/modal_formula.cpp.o.d"
+  "CMakeFiles/mcrl2_modal_formula.dir/source/regfrmtrans.cpp.o"
+  "CMakeFiles/mcrl2_modal_formula.dir/source/regfrmtrans.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mcrl2_modal_formula.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../stage/bin/librarytest/librarytest_mcrl2_pbes_pbes_test"
+  "../../stage/bin/librarytest/librarytest_mcrl2_pbes_pbes_test.pdb"
+  "CMakeFiles/librarytest_mcrl2_pbes_pbes_test.dir/test/pbes_test.cpp.o"
+  "CMakeFiles/librarytest_mcrl2_pbes_pbes_test.dir/test/pbes_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/librarytest_mcrl2_pbes_pbes_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,36 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libraries/pbes/source/algorithms.cpp" "libraries/pbes/CMakeFiles/mcrl2_pbes.dir/source/algorithms.cpp.o" "gcc" "libraries/pbes/CMakeFiles/mcrl2_pbes.dir/source/algorithms.cpp.o.d"
+  "/root/repo/libraries/pbes/source/io.cpp" "libraries/pbes/CMakeFiles/mcrl2_pbes.dir/source/io.cpp.o" "gcc" "libraries/pbes/CMakeFiles/mcrl2_pbes.dir/source/io.cpp.o.d"
+  "/root/repo/libraries/pbes/source/pbes.cpp" "libraries/pbes/CMakeFiles/mcrl2_pbes.dir/source/pbes.cpp.o" "gcc" "libraries/pbes/CMakeFiles/mcrl2_pbes.dir/source/pbes.cpp.o.d"
+  "/root/repo/libraries/pbes/source/pbes_explorer.cpp" "libraries/pbes/CMakeFiles/mcrl2_pbes.dir/source/pbes_explorer.cpp.o" "gcc" "libraries/pbes/CMakeFiles/mcrl2_pbes.dir/source/pbes_explorer.cpp.o.d"
+  "/root/repo/libraries/pbes/source/tools.cpp" "libraries/pbes/CMakeFiles/mcrl2_pbes.dir/source/tools.cpp.o" "gcc" "libraries/pbes/CMakeFiles/mcrl2_pbes.dir/source/tools.cpp.o.d"
+  "/root/repo/libraries/pbes/source/tools2.cpp" "libraries/pbes/CMakeFiles/mcrl2_pbes.dir/source/tools2.cpp.o" "gcc" "libraries/pbes/CMakeFiles/mcrl2_pbes.dir/source/tools2.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_compact_build/libraries/lts/CMakeFiles/mcrl2_lts.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/libraries/modal_formula/CMakeFiles/mcrl2_modal_formula.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/libraries/lps/CMakeFiles/mcrl2_lps.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/libraries/symbolic/CMakeFiles/mcrl2_symbolic.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/3rd-party/sylvan/src/CMakeFiles/sylvan.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/libraries/smt/CMakeFiles/mcrl2_smt.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/libraries/process/CMakeFiles/mcrl2_process.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/libraries/data/CMakeFiles/mcrl2_data.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/libraries/core/CMakeFiles/mcrl2_core.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/libraries/atermpp/CMakeFiles/mcrl2_atermpp.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/3rd-party/dparser/CMakeFiles/dparser.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/libraries/utilities/CMakeFiles/mcrl2_utilities.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "../../stage/lib/libmcrl2_pbes.pdb"
+  "../../stage/lib/libmcrl2_pbes.so"
+  "CMakeFiles/mcrl2_pbes.dir/source/algorithms.cpp.o"
+  "CMakeFiles/mcrl2_pbes.dir/source/algorithms.cpp.o.d"
+  "CMakeFiles/mcrl2_pbes.dir/source/io.cpp.o"
+  "CMakeFiles/mcrl2_pbes.dir/source/io.cpp.o.d"
+  "CMakeFiles/mcrl2_pbes.dir/source/pbes.cpp.o"
+  "CMakeFiles/mcrl2_pbes.dir/source/pbes.cpp.o.d"
+  "CMakeFiles/mcrl2_pbes.dir/source/pbes_explorer.cpp.o"
+  "CMakeFiles/mcrl2_pbes.dir/source/pbes_explorer.cpp.o.d"
+  "CMakeFiles/mcrl2_pbes.dir/source/tools.cpp.o"
+  "CMakeFiles/mcrl2_pbes.dir/source/tools.cpp.o.d"
+  "CMakeFiles/mcrl2_pbes.dir/source/tools2.cpp.o"
+  "CMakeFiles/mcrl2_pbes.dir/source/tools2.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mcrl2_pbes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../stage/bin/libraryexample/libraryexample_mcrl2_pg_pg_solving"
+  "../../stage/bin/libraryexample/libraryexample_mcrl2_pg_pg_solving.pdb"
+  "CMakeFiles/libraryexample_mcrl2_pg_pg_solving.dir/example/pg_solving.cpp.o"
+  "CMakeFiles/libraryexample_mcrl2_pg_pg_solving.dir/example/pg_solving.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libraryexample_mcrl2_pg_pg_solving.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,50 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libraries/pg/source/Abortable.cpp" "libraries/pg/CMakeFiles/mcrl2_pg.dir/source/Abortable.cpp.o" "gcc" "libraries/pg/CMakeFiles/mcrl2_pg.dir/source/Abortable.cpp.o.d"
+  "/root/repo/libraries/pg/source/ComponentSolver.cpp" "libraries/pg/CMakeFiles/mcrl2_pg.dir/source/ComponentSolver.cpp.o" "gcc" "libraries/pg/CMakeFiles/mcrl2_pg.dir/source/ComponentSolver.cpp.o.d"
+  "/root/repo/libraries/pg/source/DecycleSolver.cpp" "libraries/pg/CMakeFiles/mcrl2_pg.dir/source/DecycleSolver.cpp.o" "gcc" "libraries/pg/CMakeFiles/mcrl2_pg.dir/source/DecycleSolver.cpp.o.d"
+  "/root/repo/libraries/pg/source/DeloopSolver.cpp" "libraries/pg/CMakeFiles/mcrl2_pg.dir/source/DeloopSolver.cpp.o" "gcc" "libraries/pg/CMakeFiles/mcrl2_pg.dir/source/DeloopSolver.cpp.o.d"
+  "/root/repo/libraries/pg/source/FocusListLiftingStrategy.cpp" "libraries/pg/CMakeFiles/mcrl2_pg.dir/source/FocusListLiftingStrategy.cpp.o" "gcc" "libraries/pg/CMakeFiles/mcrl2_pg.dir/source/FocusListLiftingStrategy.cpp.o.d"
+  "/root/repo/libraries/pg/source/Graph.cpp" "libraries/pg/CMakeFiles/mcrl2_pg.dir/source/Graph.cpp.o" "gcc" "libraries/pg/CMakeFiles/mcrl2_pg.dir/source/Graph.cpp.o.d"
+  "/root/repo/libraries/pg/source/LiftingStrategy.cpp" "libraries/pg/CMakeFiles/mcrl2_pg.dir/source/LiftingStrategy.cpp.o" "gcc" "libraries/pg/CMakeFiles/mcrl2_pg.dir/source/LiftingStrategy.cpp.o.d"
+  "/root/repo/libraries/pg/source/LinearLiftingStrategy.cpp" "libraries/pg/CMakeFiles/mcrl2_pg.dir/source/LinearLiftingStrategy.cpp.o" "gcc" "libraries/pg/CMakeFiles/mcrl2_pg.dir/source/LinearLiftingStrategy.cpp.o.d"
+  "/root/repo/libraries/pg/source/MaxMeasureLiftingStrategy.cpp" "libraries/pg/CMakeFiles/mcrl2_pg.dir/source/MaxMeasureLiftingStrategy.cpp.o" "gcc" "libraries/pg/CMakeFiles/mcrl2_pg.dir/source/MaxMeasureLiftingStrategy.cpp.o.d"
+  "/root/repo/libraries/pg/source/OldMaxMeasureLiftingStrategy.cpp" "libraries/pg/CMakeFiles/mcrl2_pg.dir/source/OldMaxMeasureLiftingStrategy.cpp.o" "gcc" "libraries/pg/CMakeFiles/mcrl2_pg.dir/source/OldMaxMeasureLiftingStrategy.cpp.o.d"
+  "/root/repo/libraries/pg/source/ParityGame.cpp" "libraries/pg/CMakeFiles/mcrl2_pg.dir/source/ParityGame.cpp.o" "gcc" "libraries/pg/CMakeFiles/mcrl2_pg.dir/source/ParityGame.cpp.o.d"
+  "/root/repo/libraries/pg/source/ParityGameSolver.cpp" "libraries/pg/CMakeFiles/mcrl2_pg.dir/source/ParityGameSolver.cpp.o" "gcc" "libraries/pg/CMakeFiles/mcrl2_pg.dir/source/ParityGameSolver.cpp.o.d"
+  "/root/repo/libraries/pg/source/ParityGame_IO.cpp" "libraries/pg/CMakeFiles/mcrl2_pg.dir/source/ParityGame_IO.cpp.o" "gcc" "libraries/pg/CMakeFiles/mcrl2_pg.dir/source/ParityGame_IO.cpp.o.d"
+  "/root/repo/libraries/pg/source/ParityGame_verify.cpp" "libraries/pg/CMakeFiles/mcrl2_pg.dir/source/ParityGame_verify.cpp.o" "gcc" "libraries/pg/CMakeFiles/mcrl2_pg.dir/source/ParityGame_verify.cpp.o.d"
+  "/root/repo/libraries/pg/source/PredecessorLiftingStrategy.cpp" "libraries/pg/CMakeFiles/mcrl2_pg.dir/source/PredecessorLiftingStrategy.cpp.o" "gcc" "libraries/pg/CMakeFiles/mcrl2_pg.dir/source/PredecessorLiftingStrategy.cpp.o.d"
+  "/root/repo/libraries/pg/source/PriorityPromotionSolver.cpp" "libraries/pg/CMakeFiles/mcrl2_pg.dir/source/PriorityPromotionSolver.cpp.o" "gcc" "libraries/pg/CMakeFiles/mcrl2_pg.dir/source/PriorityPromotionSolver.cpp.o.d"
+  "/root/repo/libraries/pg/source/RecursiveSolver.cpp" "libraries/pg/CMakeFiles/mcrl2_pg.dir/source/RecursiveSolver.cpp.o" "gcc" "libraries/pg/CMakeFiles/mcrl2_pg.dir/source/RecursiveSolver.cpp.o.d"
+  "/root/repo/libraries/pg/source/SmallProgressMeasures.cpp" "libraries/pg/CMakeFiles/mcrl2_pg.dir/source/SmallProgressMeasures.cpp.o" "gcc" "libraries/pg/CMakeFiles/mcrl2_pg.dir/source/SmallProgressMeasures.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_compact_build/libraries/bes/CMakeFiles/mcrl2_bes.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/libraries/pbes/CMakeFiles/mcrl2_pbes.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/libraries/lts/CMakeFiles/mcrl2_lts.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/libraries/modal_formula/CMakeFiles/mcrl2_modal_formula.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/libraries/lps/CMakeFiles/mcrl2_lps.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/libraries/smt/CMakeFiles/mcrl2_smt.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/libraries/process/CMakeFiles/mcrl2_process.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/libraries/symbolic/CMakeFiles/mcrl2_symbolic.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/libraries/data/CMakeFiles/mcrl2_data.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/libraries/core/CMakeFiles/mcrl2_core.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/libraries/atermpp/CMakeFiles/mcrl2_atermpp.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/libraries/utilities/CMakeFiles/mcrl2_utilities.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/3rd-party/sylvan/src/CMakeFiles/sylvan.dir/DependInfo.cmake"
+  "/root/repo/_compact_build/3rd-party/dparser/CMakeFiles/dparser.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
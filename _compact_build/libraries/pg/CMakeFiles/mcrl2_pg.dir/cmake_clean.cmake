@@ -0,0 +1,45 @@
+file(REMOVE_RECURSE
+  "../../stage/lib/libmcrl2_pg.pdb"
+  "../../stage/lib/libmcrl2_pg.so"
+  "CMakeFiles/mcrl2_pg.dir/source/Abortable.cpp.o"
+  "CMakeFiles/mcrl2_pg.dir/source/Abortable.cpp.o.d"
+  "CMakeFiles/mcrl2_pg.dir/source/ComponentSolver.cpp.o"
+  "CMakeFiles/mcrl2_pg.dir/source/ComponentSolver.cpp.o.d"
+  "CMakeFiles/mcrl2_pg.dir/source/DecycleSolver.cpp.o"
+  "CMakeFiles/mcrl2_pg.dir/source/DecycleSolver.cpp.o.d"
+  "CMakeFiles/mcrl2_pg.dir/source/DeloopSolver.cpp.o"
+  "CMakeFiles/mcrl2_pg.dir/source/DeloopSolver.cpp.o.d"
+  "CMakeFiles/mcrl2_pg.dir/source/FocusListLiftingStrategy.cpp.o"
+  "CMakeFiles/mcrl2_pg.dir/source/FocusListLiftingStrategy.cpp.o.d"
+  "CMakeFiles/mcrl2_pg.dir/source/Graph.cpp.o"
+  "CMakeFiles/mcrl2_pg.dir/source/Graph.cpp.o.d"
+  "CMakeFiles/mcrl2_pg.dir/source/LiftingStrategy.cpp.o"
+  "CMakeFiles/mcrl2_pg.dir/source/LiftingStrategy.cpp.o.d"
+  "CMakeFiles/mcrl2_pg.dir/source/LinearLiftingStrategy.cpp.o"
+  "CMakeFiles/mcrl2_pg.dir/source/LinearLiftingStrategy.cpp.o.d"
+  "CMakeFiles/mcrl2_pg.dir/source/MaxMeasureLiftingStrategy.cpp.o"
+  "CMakeFiles/mcrl2_pg.dir/source/MaxMeasureLiftingStrategy.cpp.o.d"
+  "CMakeFiles/mcrl2_pg.dir/source/OldMaxMeasureLiftingStrategy.cpp.o"
+  "CMakeFiles/mcrl2_pg.dir/source/OldMaxMeasureLiftingStrategy.cpp.o.d"
+  "CMakeFiles/mcrl2_pg.dir/source/ParityGame.cpp.o"
+  "CMakeFiles/mcrl2_pg.dir/source/ParityGame.cpp.o.d"
+  "CMakeFiles/mcrl2_pg.dir/source/ParityGameSolver.cpp.o"
+  "CMakeFiles/mcrl2_pg.dir/source/ParityGameSolver.cpp.o.d"
+  "CMakeFiles/mcrl2_pg.dir/source/ParityGame_IO.cpp.o"
+  "CMakeFiles/mcrl2_pg.dir/source/ParityGame_IO.cpp.o.d"
+  "CMakeFiles/mcrl2_pg.dir/source/ParityGame_verify.cpp.o"
+  "CMakeFiles/mcrl2_pg.dir/source/ParityGame_verify.cpp.o.d"
+  "CMakeFiles/mcrl2_pg.dir/source/PredecessorLiftingStrategy.cpp.o"
+  "CMakeFiles/mcrl2_pg.dir/source/PredecessorLiftingStrategy.cpp.o.d"
+  "CMakeFiles/mcrl2_pg.dir/source/PriorityPromotionSolver.cpp.o"
+  "CMakeFiles/mcrl2_pg.dir/source/PriorityPromotionSolver.cpp.o.d"
+  "CMakeFiles/mcrl2_pg.dir/source/RecursiveSolver.cpp.o"
+  "CMakeFiles/mcrl2_pg.dir/source/RecursiveSolver.cpp.o.d"
+  "CMakeFiles/mcrl2_pg.dir/source/SmallProgressMeasures.cpp.o"
+  "CMakeFiles/mcrl2_pg.dir/source/SmallProgressMeasures.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mcrl2_pg.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/example_pg_solve_pg"
+  "../../../stage/bin/example_pg_solve_pg.pdb"
+  "CMakeFiles/example_pg_solve_pg.dir/pg_solving.cpp.o"
+  "CMakeFiles/example_pg_solve_pg.dir/pg_solving.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_pg_solve_pg.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
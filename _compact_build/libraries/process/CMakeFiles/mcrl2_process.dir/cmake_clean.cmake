@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../stage/lib/libmcrl2_process.pdb"
+  "../../stage/lib/libmcrl2_process.so"
+  "CMakeFiles/mcrl2_process.dir/source/process.cpp.o"
+  "CMakeFiles/mcrl2_process.dir/source/process.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mcrl2_process.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
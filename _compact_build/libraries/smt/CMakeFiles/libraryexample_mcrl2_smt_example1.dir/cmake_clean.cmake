@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../stage/bin/libraryexample/libraryexample_mcrl2_smt_example1"
+  "../../stage/bin/libraryexample/libraryexample_mcrl2_smt_example1.pdb"
+  "CMakeFiles/libraryexample_mcrl2_smt_example1.dir/example/example1.cpp.o"
+  "CMakeFiles/libraryexample_mcrl2_smt_example1.dir/example/example1.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libraryexample_mcrl2_smt_example1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
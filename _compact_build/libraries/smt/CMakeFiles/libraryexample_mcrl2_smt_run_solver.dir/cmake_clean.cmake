@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../stage/bin/libraryexample/libraryexample_mcrl2_smt_run_solver"
+  "../../stage/bin/libraryexample/libraryexample_mcrl2_smt_run_solver.pdb"
+  "CMakeFiles/libraryexample_mcrl2_smt_run_solver.dir/example/run_solver.cpp.o"
+  "CMakeFiles/libraryexample_mcrl2_smt_run_solver.dir/example/run_solver.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libraryexample_mcrl2_smt_run_solver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
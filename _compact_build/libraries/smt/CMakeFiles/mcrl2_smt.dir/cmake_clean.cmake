@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../stage/lib/libmcrl2_smt.pdb"
+  "../../stage/lib/libmcrl2_smt.so"
+  "CMakeFiles/mcrl2_smt.dir/source/child_process.cpp.o"
+  "CMakeFiles/mcrl2_smt.dir/source/child_process.cpp.o.d"
+  "CMakeFiles/mcrl2_smt.dir/source/solver.cpp.o"
+  "CMakeFiles/mcrl2_smt.dir/source/solver.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mcrl2_smt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libraries/smt
+# Build directory: /root/repo/_compact_build/libraries/smt
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(libraryexample_mcrl2_smt_example1 "/usr/bin/cmake" "--build" "/root/repo/_compact_build" "--target" "libraryexample_mcrl2_smt_example1")
+set_tests_properties(libraryexample_mcrl2_smt_example1 PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "libraryexample" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;42;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/smt/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/smt/CMakeLists.txt;0;")
+add_test(libraryexample_mcrl2_smt_run_solver "/usr/bin/cmake" "--build" "/root/repo/_compact_build" "--target" "libraryexample_mcrl2_smt_run_solver")
+set_tests_properties(libraryexample_mcrl2_smt_run_solver PROPERTIES  ENVIRONMENT "MCRL2_COMPILEREWRITER=/root/repo/_compact_build/stage/bin/mcrl2compilerewriter" LABELS "libraryexample" _BACKTRACE_TRIPLES "/root/repo/build/cmake/AddMCRL2Binary.cmake;42;add_test;/root/repo/build/cmake/AddMCRL2Binary.cmake;239;_add_library_tests;/root/repo/build/cmake/AddMCRL2Binary.cmake;284;_add_mcrl2_binary;/root/repo/libraries/smt/CMakeLists.txt;1;add_mcrl2_library;/root/repo/libraries/smt/CMakeLists.txt;0;")
+subdirs("example")
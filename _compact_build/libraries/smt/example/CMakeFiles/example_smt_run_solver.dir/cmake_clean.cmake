@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/example_smt_run_solver"
+  "../../../stage/bin/example_smt_run_solver.pdb"
+  "CMakeFiles/example_smt_run_solver.dir/run_solver.cpp.o"
+  "CMakeFiles/example_smt_run_solver.dir/run_solver.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_smt_run_solver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
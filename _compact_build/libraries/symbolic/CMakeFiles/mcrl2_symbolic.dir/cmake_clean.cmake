@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../stage/lib/libmcrl2_symbolic.pdb"
+  "../../stage/lib/libmcrl2_symbolic.so"
+  "CMakeFiles/mcrl2_symbolic.dir/source/ldd_stream.cpp.o"
+  "CMakeFiles/mcrl2_symbolic.dir/source/ldd_stream.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mcrl2_symbolic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
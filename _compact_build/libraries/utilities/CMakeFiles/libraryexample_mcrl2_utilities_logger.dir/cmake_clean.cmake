@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../stage/bin/libraryexample/libraryexample_mcrl2_utilities_logger"
+  "../../stage/bin/libraryexample/libraryexample_mcrl2_utilities_logger.pdb"
+  "CMakeFiles/libraryexample_mcrl2_utilities_logger.dir/example/logger.cpp.o"
+  "CMakeFiles/libraryexample_mcrl2_utilities_logger.dir/example/logger.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libraryexample_mcrl2_utilities_logger.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
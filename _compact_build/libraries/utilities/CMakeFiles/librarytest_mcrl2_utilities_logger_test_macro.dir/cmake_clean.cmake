@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../stage/bin/librarytest/librarytest_mcrl2_utilities_logger_test_macro"
+  "../../stage/bin/librarytest/librarytest_mcrl2_utilities_logger_test_macro.pdb"
+  "CMakeFiles/librarytest_mcrl2_utilities_logger_test_macro.dir/test/logger_test_macro.cpp.o"
+  "CMakeFiles/librarytest_mcrl2_utilities_logger_test_macro.dir/test/logger_test_macro.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/librarytest_mcrl2_utilities_logger_test_macro.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
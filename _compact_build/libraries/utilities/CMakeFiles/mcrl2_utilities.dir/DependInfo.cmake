@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libraries/utilities/source/bitstream.cpp" "libraries/utilities/CMakeFiles/mcrl2_utilities.dir/source/bitstream.cpp.o" "gcc" "libraries/utilities/CMakeFiles/mcrl2_utilities.dir/source/bitstream.cpp.o.d"
+  "/root/repo/libraries/utilities/source/cache_metric.cpp" "libraries/utilities/CMakeFiles/mcrl2_utilities.dir/source/cache_metric.cpp.o" "gcc" "libraries/utilities/CMakeFiles/mcrl2_utilities.dir/source/cache_metric.cpp.o.d"
+  "/root/repo/libraries/utilities/source/command_line_interface.cpp" "libraries/utilities/CMakeFiles/mcrl2_utilities.dir/source/command_line_interface.cpp.o" "gcc" "libraries/utilities/CMakeFiles/mcrl2_utilities.dir/source/command_line_interface.cpp.o.d"
+  "/root/repo/libraries/utilities/source/logger.cpp" "libraries/utilities/CMakeFiles/mcrl2_utilities.dir/source/logger.cpp.o" "gcc" "libraries/utilities/CMakeFiles/mcrl2_utilities.dir/source/logger.cpp.o.d"
+  "/root/repo/libraries/utilities/source/text_utility.cpp" "libraries/utilities/CMakeFiles/mcrl2_utilities.dir/source/text_utility.cpp.o" "gcc" "libraries/utilities/CMakeFiles/mcrl2_utilities.dir/source/text_utility.cpp.o.d"
+  "/root/repo/libraries/utilities/source/toolset_version.cpp" "libraries/utilities/CMakeFiles/mcrl2_utilities.dir/source/toolset_version.cpp.o" "gcc" "libraries/utilities/CMakeFiles/mcrl2_utilities.dir/source/toolset_version.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
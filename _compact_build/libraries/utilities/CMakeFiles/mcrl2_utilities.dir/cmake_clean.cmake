@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "../../stage/lib/libmcrl2_utilities.pdb"
+  "../../stage/lib/libmcrl2_utilities.so"
+  "CMakeFiles/mcrl2_utilities.dir/source/bitstream.cpp.o"
+  "CMakeFiles/mcrl2_utilities.dir/source/bitstream.cpp.o.d"
+  "CMakeFiles/mcrl2_utilities.dir/source/cache_metric.cpp.o"
+  "CMakeFiles/mcrl2_utilities.dir/source/cache_metric.cpp.o.d"
+  "CMakeFiles/mcrl2_utilities.dir/source/command_line_interface.cpp.o"
+  "CMakeFiles/mcrl2_utilities.dir/source/command_line_interface.cpp.o.d"
+  "CMakeFiles/mcrl2_utilities.dir/source/logger.cpp.o"
+  "CMakeFiles/mcrl2_utilities.dir/source/logger.cpp.o.d"
+  "CMakeFiles/mcrl2_utilities.dir/source/text_utility.cpp.o"
+  "CMakeFiles/mcrl2_utilities.dir/source/text_utility.cpp.o.d"
+  "CMakeFiles/mcrl2_utilities.dir/source/toolset_version.cpp.o"
+  "CMakeFiles/mcrl2_utilities.dir/source/toolset_version.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mcrl2_utilities.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
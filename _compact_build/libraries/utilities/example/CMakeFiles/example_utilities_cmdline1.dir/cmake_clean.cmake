@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/example_utilities_cmdline1"
+  "../../../stage/bin/example_utilities_cmdline1.pdb"
+  "CMakeFiles/example_utilities_cmdline1.dir/cmdline1.cpp.o"
+  "CMakeFiles/example_utilities_cmdline1.dir/cmdline1.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_utilities_cmdline1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/example_utilities_logger"
+  "../../../stage/bin/example_utilities_logger.pdb"
+  "CMakeFiles/example_utilities_logger.dir/logger.cpp.o"
+  "CMakeFiles/example_utilities_logger.dir/logger.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_utilities_logger.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
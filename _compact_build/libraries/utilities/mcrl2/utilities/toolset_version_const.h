@@ -0,0 +1,17 @@
+#ifndef MCRL2_UTILITIES_TOOLSET_VERSION_CONST_H
+#define MCRL2_UTILITIES_TOOLSET_VERSION_CONST_H
+#include <string>
+
+namespace mcrl2
+{
+namespace utilities
+{
+
+#define ___MCRL2_UTILITIES_BUILD_TYPE_x(s) #s
+#define ___MCRL2_UTILITIES_BUILD_TYPE(s) ___MCRL2_UTILITIES_BUILD_TYPE_x(s)
+#define __MCRL2_UTILITIES_BUILD_TYPE ___MCRL2_UTILITIES_BUILD_TYPE(MCRL2_BUILD_TYPE)
+const std::string MCRL2_VERSION = "202206.1.c96aa6849aM (" __MCRL2_UTILITIES_BUILD_TYPE ")";
+
+}
+}
+#endif // MCRL2_UTILITIES_TOOLSET_VERSION_CONST_H
@@ -0,0 +1,802 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests
+# Build directory: /root/repo/_compact_build/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(tooltest_mcrl22lps_a_abp_mcrl2 "/root/repo/_compact_build/stage/bin/mcrl22lps" "-a" "abp.mcrl2")
+set_tests_properties(tooltest_mcrl22lps_a_abp_mcrl2 PROPERTIES  LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;108;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;515;gen_mcrl22lps_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_mcrl22lps_b_abp_mcrl2 "/root/repo/_compact_build/stage/bin/mcrl22lps" "-b" "abp.mcrl2")
+set_tests_properties(tooltest_mcrl22lps_b_abp_mcrl2 PROPERTIES  LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;108;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;515;gen_mcrl22lps_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_mcrl22lps_c_abp_mcrl2 "/root/repo/_compact_build/stage/bin/mcrl22lps" "-c" "abp.mcrl2")
+set_tests_properties(tooltest_mcrl22lps_c_abp_mcrl2 PROPERTIES  LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;108;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;515;gen_mcrl22lps_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_mcrl22lps_e_abp_mcrl2 "/root/repo/_compact_build/stage/bin/mcrl22lps" "-e" "abp.mcrl2")
+set_tests_properties(tooltest_mcrl22lps_e_abp_mcrl2 PROPERTIES  LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;108;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;515;gen_mcrl22lps_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_mcrl22lps_f_abp_mcrl2 "/root/repo/_compact_build/stage/bin/mcrl22lps" "-f" "abp.mcrl2")
+set_tests_properties(tooltest_mcrl22lps_f_abp_mcrl2 PROPERTIES  LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;108;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;515;gen_mcrl22lps_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_mcrl22lps_g_abp_mcrl2 "/root/repo/_compact_build/stage/bin/mcrl22lps" "-g" "abp.mcrl2")
+set_tests_properties(tooltest_mcrl22lps_g_abp_mcrl2 PROPERTIES  LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;108;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;515;gen_mcrl22lps_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_mcrl22lps_lregular_abp_mcrl2 "/root/repo/_compact_build/stage/bin/mcrl22lps" "-lregular" "abp.mcrl2")
+set_tests_properties(tooltest_mcrl22lps_lregular_abp_mcrl2 PROPERTIES  LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;108;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;515;gen_mcrl22lps_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_mcrl22lps_lregular2_abp_mcrl2 "/root/repo/_compact_build/stage/bin/mcrl22lps" "-lregular2" "abp.mcrl2")
+set_tests_properties(tooltest_mcrl22lps_lregular2_abp_mcrl2 PROPERTIES  LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;108;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;515;gen_mcrl22lps_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_mcrl22lps_lstack_abp_mcrl2 "/root/repo/_compact_build/stage/bin/mcrl22lps" "-lstack" "abp.mcrl2")
+set_tests_properties(tooltest_mcrl22lps_lstack_abp_mcrl2 PROPERTIES  LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;108;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;515;gen_mcrl22lps_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_mcrl22lps_m_abp_mcrl2 "/root/repo/_compact_build/stage/bin/mcrl22lps" "-m" "abp.mcrl2")
+set_tests_properties(tooltest_mcrl22lps_m_abp_mcrl2 PROPERTIES  LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;108;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;515;gen_mcrl22lps_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_mcrl22lps_n_abp_mcrl2 "/root/repo/_compact_build/stage/bin/mcrl22lps" "-n" "abp.mcrl2")
+set_tests_properties(tooltest_mcrl22lps_n_abp_mcrl2 PROPERTIES  LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;108;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;515;gen_mcrl22lps_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_mcrl22lps_no-constelm_abp_mcrl2 "/root/repo/_compact_build/stage/bin/mcrl22lps" "--no-constelm" "abp.mcrl2")
+set_tests_properties(tooltest_mcrl22lps_no-constelm_abp_mcrl2 PROPERTIES  LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;108;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;515;gen_mcrl22lps_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_mcrl22lps_o_abp_mcrl2 "/root/repo/_compact_build/stage/bin/mcrl22lps" "-o" "abp.mcrl2")
+set_tests_properties(tooltest_mcrl22lps_o_abp_mcrl2 PROPERTIES  LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;108;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;515;gen_mcrl22lps_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_mcrl22lps_rjitty_abp_mcrl2 "/root/repo/_compact_build/stage/bin/mcrl22lps" "-rjitty" "abp.mcrl2")
+set_tests_properties(tooltest_mcrl22lps_rjitty_abp_mcrl2 PROPERTIES  LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;108;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;515;gen_mcrl22lps_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_mcrl22lps_rjittyp_abp_mcrl2 "/root/repo/_compact_build/stage/bin/mcrl22lps" "-rjittyp" "abp.mcrl2")
+set_tests_properties(tooltest_mcrl22lps_rjittyp_abp_mcrl2 PROPERTIES  LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;108;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;515;gen_mcrl22lps_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_mcrl22lps_rjittyc_abp_mcrl2 "/root/repo/_compact_build/stage/bin/mcrl22lps" "-rjittyc" "abp.mcrl2")
+set_tests_properties(tooltest_mcrl22lps_rjittyc_abp_mcrl2 PROPERTIES  LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;108;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;515;gen_mcrl22lps_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_mcrl22lps_timings_abp_mcrl2 "/root/repo/_compact_build/stage/bin/mcrl22lps" "--timings" "abp.mcrl2")
+set_tests_properties(tooltest_mcrl22lps_timings_abp_mcrl2 PROPERTIES  LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;108;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;515;gen_mcrl22lps_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_mcrl22lps_w_abp_mcrl2 "/root/repo/_compact_build/stage/bin/mcrl22lps" "-w" "abp.mcrl2")
+set_tests_properties(tooltest_mcrl22lps_w_abp_mcrl2 PROPERTIES  LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;108;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;515;gen_mcrl22lps_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_mcrl22lps_z_abp_mcrl2 "/root/repo/_compact_build/stage/bin/mcrl22lps" "-z" "abp.mcrl2")
+set_tests_properties(tooltest_mcrl22lps_z_abp_mcrl2 PROPERTIES  LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;108;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;515;gen_mcrl22lps_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_mcrl22lps_D_abp_mcrl2_abp_lps "/root/repo/_compact_build/stage/bin/mcrl22lps" "-D" "abp.mcrl2" "abp.lps")
+set_tests_properties(tooltest_mcrl22lps_D_abp_mcrl2_abp_lps PROPERTIES  LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;110;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;515;gen_mcrl22lps_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsinfo_abp_lps "/root/repo/_compact_build/stage/bin/lpsinfo" "abp.lps")
+set_tests_properties(tooltest_lpsinfo_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;115;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;516;gen_lpsinfo_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpspp_fdefault_abp_lps_abp_lps_txt "/root/repo/_compact_build/stage/bin/lpspp" "-fdefault" "abp.lps" "abp.lps.txt")
+set_tests_properties(tooltest_lpspp_fdefault_abp_lps_abp_lps_txt PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;120;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;517;gen_lpspp_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpspp_finternal_abp_lps "/root/repo/_compact_build/stage/bin/lpspp" "-finternal" "abp.lps")
+set_tests_properties(tooltest_lpspp_finternal_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;121;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;517;gen_lpspp_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lps2lts_ctau_abp_lps "/root/repo/_compact_build/stage/bin/lps2lts" "-ctau" "abp.lps")
+set_tests_properties(tooltest_lps2lts_ctau_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;137;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;518;gen_lps2lts_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lps2lts_D_abp_lps "/root/repo/_compact_build/stage/bin/lps2lts" "-D" "abp.lps")
+set_tests_properties(tooltest_lps2lts_D_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;137;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;518;gen_lps2lts_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lps2lts_error-trace_abp_lps "/root/repo/_compact_build/stage/bin/lps2lts" "--error-trace" "abp.lps")
+set_tests_properties(tooltest_lps2lts_error-trace_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;137;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;518;gen_lps2lts_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lps2lts_rjitty_abp_lps "/root/repo/_compact_build/stage/bin/lps2lts" "-rjitty" "abp.lps")
+set_tests_properties(tooltest_lps2lts_rjitty_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;137;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;518;gen_lps2lts_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lps2lts_rjittyp_abp_lps "/root/repo/_compact_build/stage/bin/lps2lts" "-rjittyp" "abp.lps")
+set_tests_properties(tooltest_lps2lts_rjittyp_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;137;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;518;gen_lps2lts_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lps2lts_rjittyc_abp_lps "/root/repo/_compact_build/stage/bin/lps2lts" "-rjittyc" "abp.lps")
+set_tests_properties(tooltest_lps2lts_rjittyc_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;137;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;518;gen_lps2lts_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lps2lts_sd_abp_lps "/root/repo/_compact_build/stage/bin/lps2lts" "-sd" "abp.lps")
+set_tests_properties(tooltest_lps2lts_sd_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;137;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;518;gen_lps2lts_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lps2lts_sb_abp_lps "/root/repo/_compact_build/stage/bin/lps2lts" "-sb" "abp.lps")
+set_tests_properties(tooltest_lps2lts_sb_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;137;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;518;gen_lps2lts_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lps2lts_sh_todo-max=100_abp_lps "/root/repo/_compact_build/stage/bin/lps2lts" "-sh" "--todo-max=100" "abp.lps")
+set_tests_properties(tooltest_lps2lts_sh_todo-max=100_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;137;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;518;gen_lps2lts_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lps2lts_verbose_suppress_abp_lps "/root/repo/_compact_build/stage/bin/lps2lts" "--verbose" "--suppress" "abp.lps")
+set_tests_properties(tooltest_lps2lts_verbose_suppress_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;137;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;518;gen_lps2lts_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lps2lts_u_abp_lps "/root/repo/_compact_build/stage/bin/lps2lts" "-u" "abp.lps")
+set_tests_properties(tooltest_lps2lts_u_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;137;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;518;gen_lps2lts_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lps2lts_ar1,s4_abp_lps "/root/repo/_compact_build/stage/bin/lps2lts" "-ar1,s4" "abp.lps")
+set_tests_properties(tooltest_lps2lts_ar1,s4_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;137;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;518;gen_lps2lts_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lps2lts_cr1,s4_abp_lps "/root/repo/_compact_build/stage/bin/lps2lts" "-cr1,s4" "abp.lps")
+set_tests_properties(tooltest_lps2lts_cr1,s4_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;137;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;518;gen_lps2lts_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lps2lts_abp_lps_abp_lts "/root/repo/_compact_build/stage/bin/lps2lts" "abp.lps" "abp.lts")
+set_tests_properties(tooltest_lps2lts_abp_lps_abp_lts PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;140;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;518;gen_lps2lts_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lps2lts_abp_lps_abp_aut "/root/repo/_compact_build/stage/bin/lps2lts" "abp.lps" "abp.aut")
+set_tests_properties(tooltest_lps2lts_abp_lps_abp_aut PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;140;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;518;gen_lps2lts_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lps2lts_abp_lps_abp_fsm "/root/repo/_compact_build/stage/bin/lps2lts" "abp.lps" "abp.fsm")
+set_tests_properties(tooltest_lps2lts_abp_lps_abp_fsm PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;140;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;518;gen_lps2lts_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lps2lts_abp_lps_abp_dot "/root/repo/_compact_build/stage/bin/lps2lts" "abp.lps" "abp.dot")
+set_tests_properties(tooltest_lps2lts_abp_lps_abp_dot PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;140;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;518;gen_lps2lts_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsconstelm_c_abp_lps "/root/repo/_compact_build/stage/bin/lpsconstelm" "-c" "abp.lps")
+set_tests_properties(tooltest_lpsconstelm_c_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;148;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;519;gen_lpsconstelm_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsconstelm_f_abp_lps "/root/repo/_compact_build/stage/bin/lpsconstelm" "-f" "abp.lps")
+set_tests_properties(tooltest_lpsconstelm_f_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;148;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;519;gen_lpsconstelm_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsconstelm_s_abp_lps "/root/repo/_compact_build/stage/bin/lpsconstelm" "-s" "abp.lps")
+set_tests_properties(tooltest_lpsconstelm_s_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;148;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;519;gen_lpsconstelm_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsconstelm_t_abp_lps "/root/repo/_compact_build/stage/bin/lpsconstelm" "-t" "abp.lps")
+set_tests_properties(tooltest_lpsconstelm_t_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;148;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;519;gen_lpsconstelm_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsconstelm_rjitty_abp_lps "/root/repo/_compact_build/stage/bin/lpsconstelm" "-rjitty" "abp.lps")
+set_tests_properties(tooltest_lpsconstelm_rjitty_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;148;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;519;gen_lpsconstelm_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsconstelm_rjittyp_abp_lps "/root/repo/_compact_build/stage/bin/lpsconstelm" "-rjittyp" "abp.lps")
+set_tests_properties(tooltest_lpsconstelm_rjittyp_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;148;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;519;gen_lpsconstelm_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsconstelm_rjittyc_abp_lps "/root/repo/_compact_build/stage/bin/lpsconstelm" "-rjittyc" "abp.lps")
+set_tests_properties(tooltest_lpsconstelm_rjittyc_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;148;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;519;gen_lpsconstelm_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsrewr_rjitty_abp_lps "/root/repo/_compact_build/stage/bin/lpsrewr" "-rjitty" "abp.lps")
+set_tests_properties(tooltest_lpsrewr_rjitty_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;156;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;520;gen_lpsrewr_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsrewr_rjittyp_abp_lps "/root/repo/_compact_build/stage/bin/lpsrewr" "-rjittyp" "abp.lps")
+set_tests_properties(tooltest_lpsrewr_rjittyp_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;156;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;520;gen_lpsrewr_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsrewr_rjittyc_abp_lps "/root/repo/_compact_build/stage/bin/lpsrewr" "-rjittyc" "abp.lps")
+set_tests_properties(tooltest_lpsrewr_rjittyc_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;156;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;520;gen_lpsrewr_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsparelm_abp_lps "/root/repo/_compact_build/stage/bin/lpsparelm" "abp.lps")
+set_tests_properties(tooltest_lpsparelm_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;162;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;521;gen_lpsparelm_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpssumelm_abp_lps "/root/repo/_compact_build/stage/bin/lpssumelm" "abp.lps")
+set_tests_properties(tooltest_lpssumelm_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;167;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;522;gen_lpssumelm_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpssumelm_c_abp_lps "/root/repo/_compact_build/stage/bin/lpssumelm" "-c" "abp.lps")
+set_tests_properties(tooltest_lpssumelm_c_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;168;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;522;gen_lpssumelm_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsactionrename_fabp_rename_spec_txt_m_abp_lps "/root/repo/_compact_build/stage/bin/lpsactionrename" "-fabp_rename_spec.txt" "-m" "abp.lps")
+set_tests_properties(tooltest_lpsactionrename_fabp_rename_spec_txt_m_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;175;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;524;gen_lpsactionrename_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsactionrename_fabp_rename_spec_txt_o_abp_lps "/root/repo/_compact_build/stage/bin/lpsactionrename" "-fabp_rename_spec.txt" "-o" "abp.lps")
+set_tests_properties(tooltest_lpsactionrename_fabp_rename_spec_txt_o_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;175;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;524;gen_lpsactionrename_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsactionrename_fabp_rename_spec_txt_t_abp_lps "/root/repo/_compact_build/stage/bin/lpsactionrename" "-fabp_rename_spec.txt" "-t" "abp.lps")
+set_tests_properties(tooltest_lpsactionrename_fabp_rename_spec_txt_t_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;175;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;524;gen_lpsactionrename_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsactionrename_fabp_rename_spec_txt_rjitty_abp_lps "/root/repo/_compact_build/stage/bin/lpsactionrename" "-fabp_rename_spec.txt" "-rjitty" "abp.lps")
+set_tests_properties(tooltest_lpsactionrename_fabp_rename_spec_txt_rjitty_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;175;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;524;gen_lpsactionrename_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsactionrename_fabp_rename_spec_txt_rjittyp_abp_lps "/root/repo/_compact_build/stage/bin/lpsactionrename" "-fabp_rename_spec.txt" "-rjittyp" "abp.lps")
+set_tests_properties(tooltest_lpsactionrename_fabp_rename_spec_txt_rjittyp_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;175;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;524;gen_lpsactionrename_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsactionrename_fabp_rename_spec_txt_rjittyc_abp_lps "/root/repo/_compact_build/stage/bin/lpsactionrename" "-fabp_rename_spec.txt" "-rjittyc" "abp.lps")
+set_tests_properties(tooltest_lpsactionrename_fabp_rename_spec_txt_rjittyc_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;175;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;524;gen_lpsactionrename_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsuntime_abp_lps "/root/repo/_compact_build/stage/bin/lpsuntime" "abp.lps")
+set_tests_properties(tooltest_lpsuntime_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;181;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;526;gen_lpsuntime_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsuntime_i_abp_lps "/root/repo/_compact_build/stage/bin/lpsuntime" "-i" "abp.lps")
+set_tests_properties(tooltest_lpsuntime_i_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;182;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;526;gen_lpsuntime_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsuntime_e_abp_lps "/root/repo/_compact_build/stage/bin/lpsuntime" "-e" "abp.lps")
+set_tests_properties(tooltest_lpsuntime_e_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;183;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;526;gen_lpsuntime_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsinvelm_itrue_txt_c_abp_lps "/root/repo/_compact_build/stage/bin/lpsinvelm" "-itrue.txt" "-c" "abp.lps")
+set_tests_properties(tooltest_lpsinvelm_itrue_txt_c_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;193;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;527;gen_lpsinvelm_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsinvelm_itrue_txt_e_abp_lps "/root/repo/_compact_build/stage/bin/lpsinvelm" "-itrue.txt" "-e" "abp.lps")
+set_tests_properties(tooltest_lpsinvelm_itrue_txt_e_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;193;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;527;gen_lpsinvelm_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsinvelm_itrue_txt_l_abp_lps "/root/repo/_compact_build/stage/bin/lpsinvelm" "-itrue.txt" "-l" "abp.lps")
+set_tests_properties(tooltest_lpsinvelm_itrue_txt_l_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;193;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;527;gen_lpsinvelm_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsinvelm_itrue_txt_n_abp_lps "/root/repo/_compact_build/stage/bin/lpsinvelm" "-itrue.txt" "-n" "abp.lps")
+set_tests_properties(tooltest_lpsinvelm_itrue_txt_n_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;193;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;527;gen_lpsinvelm_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsinvelm_itrue_txt_pinvelm_test_abp_lps "/root/repo/_compact_build/stage/bin/lpsinvelm" "-itrue.txt" "-pinvelm_test" "abp.lps")
+set_tests_properties(tooltest_lpsinvelm_itrue_txt_pinvelm_test_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;193;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;527;gen_lpsinvelm_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsinvelm_itrue_txt_rjitty_abp_lps "/root/repo/_compact_build/stage/bin/lpsinvelm" "-itrue.txt" "-rjitty" "abp.lps")
+set_tests_properties(tooltest_lpsinvelm_itrue_txt_rjitty_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;193;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;527;gen_lpsinvelm_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsinvelm_itrue_txt_t10_abp_lps "/root/repo/_compact_build/stage/bin/lpsinvelm" "-itrue.txt" "-t10" "abp.lps")
+set_tests_properties(tooltest_lpsinvelm_itrue_txt_t10_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;193;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;527;gen_lpsinvelm_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsinvelm_itrue_txt_rjittyc_abp_lps "/root/repo/_compact_build/stage/bin/lpsinvelm" "-itrue.txt" "-rjittyc" "abp.lps")
+set_tests_properties(tooltest_lpsinvelm_itrue_txt_rjittyc_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;193;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;527;gen_lpsinvelm_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsinvelm_ifalse_txt_n_e_abp_lps "/root/repo/_compact_build/stage/bin/lpsinvelm" "-ifalse.txt" "-n" "-e" "abp.lps")
+set_tests_properties(tooltest_lpsinvelm_ifalse_txt_n_e_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;195;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;527;gen_lpsinvelm_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsconfcheck_a_abp_lps "/root/repo/_compact_build/stage/bin/lpsconfcheck" "-a" "abp.lps")
+set_tests_properties(tooltest_lpsconfcheck_a_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;207;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;528;gen_lpsconfcheck_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsconfcheck_c_abp_lps "/root/repo/_compact_build/stage/bin/lpsconfcheck" "-c" "abp.lps")
+set_tests_properties(tooltest_lpsconfcheck_c_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;207;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;528;gen_lpsconfcheck_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsconfcheck_g_abp_lps "/root/repo/_compact_build/stage/bin/lpsconfcheck" "-g" "abp.lps")
+set_tests_properties(tooltest_lpsconfcheck_g_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;207;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;528;gen_lpsconfcheck_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsconfcheck_itrue_txt_abp_lps "/root/repo/_compact_build/stage/bin/lpsconfcheck" "-itrue.txt" "abp.lps")
+set_tests_properties(tooltest_lpsconfcheck_itrue_txt_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;207;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;528;gen_lpsconfcheck_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsconfcheck_ifalse_txt_abp_lps "/root/repo/_compact_build/stage/bin/lpsconfcheck" "-ifalse.txt" "abp.lps")
+set_tests_properties(tooltest_lpsconfcheck_ifalse_txt_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;207;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;528;gen_lpsconfcheck_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsconfcheck_pabp_lpsconfcheck_dot_itrue_txt_abp_lps "/root/repo/_compact_build/stage/bin/lpsconfcheck" "-pabp.lpsconfcheck.dot" "-itrue.txt" "abp.lps")
+set_tests_properties(tooltest_lpsconfcheck_pabp_lpsconfcheck_dot_itrue_txt_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;207;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;528;gen_lpsconfcheck_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsconfcheck_m_abp_lps "/root/repo/_compact_build/stage/bin/lpsconfcheck" "-m" "abp.lps")
+set_tests_properties(tooltest_lpsconfcheck_m_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;207;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;528;gen_lpsconfcheck_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsconfcheck_n_abp_lps "/root/repo/_compact_build/stage/bin/lpsconfcheck" "-n" "abp.lps")
+set_tests_properties(tooltest_lpsconfcheck_n_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;207;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;528;gen_lpsconfcheck_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsconfcheck_o_abp_lps "/root/repo/_compact_build/stage/bin/lpsconfcheck" "-o" "abp.lps")
+set_tests_properties(tooltest_lpsconfcheck_o_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;207;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;528;gen_lpsconfcheck_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsconfcheck_rjitty_abp_lps "/root/repo/_compact_build/stage/bin/lpsconfcheck" "-rjitty" "abp.lps")
+set_tests_properties(tooltest_lpsconfcheck_rjitty_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;207;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;528;gen_lpsconfcheck_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsconfcheck_rjittyc_abp_lps "/root/repo/_compact_build/stage/bin/lpsconfcheck" "-rjittyc" "abp.lps")
+set_tests_properties(tooltest_lpsconfcheck_rjittyc_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;207;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;528;gen_lpsconfcheck_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsconfcheck_s10_itrue_txt_abp_lps "/root/repo/_compact_build/stage/bin/lpsconfcheck" "-s10" "-itrue.txt" "abp.lps")
+set_tests_properties(tooltest_lpsconfcheck_s10_itrue_txt_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;207;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;528;gen_lpsconfcheck_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsconfcheck_t10_itrue_txt_abp_lps "/root/repo/_compact_build/stage/bin/lpsconfcheck" "-t10" "-itrue.txt" "abp.lps")
+set_tests_properties(tooltest_lpsconfcheck_t10_itrue_txt_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;207;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;528;gen_lpsconfcheck_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsbinary_rjitty_abp_lps "/root/repo/_compact_build/stage/bin/lpsbinary" "-rjitty" "abp.lps")
+set_tests_properties(tooltest_lpsbinary_rjitty_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;215;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;529;gen_lpsbinary_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsbinary_rjittyp_abp_lps "/root/repo/_compact_build/stage/bin/lpsbinary" "-rjittyp" "abp.lps")
+set_tests_properties(tooltest_lpsbinary_rjittyp_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;215;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;529;gen_lpsbinary_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsbinary_rjittyc_abp_lps "/root/repo/_compact_build/stage/bin/lpsbinary" "-rjittyc" "abp.lps")
+set_tests_properties(tooltest_lpsbinary_rjittyc_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;215;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;529;gen_lpsbinary_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsparunfold_sNat_l_abp_lps "/root/repo/_compact_build/stage/bin/lpsparunfold" "-sNat" "-l" "abp.lps")
+set_tests_properties(tooltest_lpsparunfold_sNat_l_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;223;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;530;gen_lpsparunfold_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsparunfold_sNat_n10_abp_lps "/root/repo/_compact_build/stage/bin/lpsparunfold" "-sNat" "-n10" "abp.lps")
+set_tests_properties(tooltest_lpsparunfold_sNat_n10_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;223;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;530;gen_lpsparunfold_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsparunfold_sNat_rjitty_abp_lps "/root/repo/_compact_build/stage/bin/lpsparunfold" "-sNat" "-rjitty" "abp.lps")
+set_tests_properties(tooltest_lpsparunfold_sNat_rjitty_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;223;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;530;gen_lpsparunfold_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsparunfold_sNat_rjittyp_abp_lps "/root/repo/_compact_build/stage/bin/lpsparunfold" "-sNat" "-rjittyp" "abp.lps")
+set_tests_properties(tooltest_lpsparunfold_sNat_rjittyp_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;223;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;530;gen_lpsparunfold_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsparunfold_sNat_rjittyc_abp_lps "/root/repo/_compact_build/stage/bin/lpsparunfold" "-sNat" "-rjittyc" "abp.lps")
+set_tests_properties(tooltest_lpsparunfold_sNat_rjittyc_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;223;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;530;gen_lpsparunfold_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsparunfold_i0_abp_lps "/root/repo/_compact_build/stage/bin/lpsparunfold" "-i0" "abp.lps")
+set_tests_properties(tooltest_lpsparunfold_i0_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;225;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;530;gen_lpsparunfold_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpssuminst_f_rjitty_abp_lps "/root/repo/_compact_build/stage/bin/lpssuminst" "-f" "-rjitty" "abp.lps")
+set_tests_properties(tooltest_lpssuminst_f_rjitty_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;232;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;531;gen_lpssuminst_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpssuminst_f_rjittyp_abp_lps "/root/repo/_compact_build/stage/bin/lpssuminst" "-f" "-rjittyp" "abp.lps")
+set_tests_properties(tooltest_lpssuminst_f_rjittyp_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;232;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;531;gen_lpssuminst_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpssuminst_f_rjittyc_abp_lps "/root/repo/_compact_build/stage/bin/lpssuminst" "-f" "-rjittyc" "abp.lps")
+set_tests_properties(tooltest_lpssuminst_f_rjittyc_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;232;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;531;gen_lpssuminst_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpssuminst_f_t_abp_lps "/root/repo/_compact_build/stage/bin/lpssuminst" "-f" "-t" "abp.lps")
+set_tests_properties(tooltest_lpssuminst_f_t_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;232;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;531;gen_lpssuminst_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_ltsinfo_abp_lts "/root/repo/_compact_build/stage/bin/ltsinfo" "abp.lts")
+set_tests_properties(tooltest_ltsinfo_abp_lts PROPERTIES  DEPENDS "tooltest_lps2lts_abp_lps_abp_lts" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;238;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;533;gen_ltsinfo_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_ltsinfo_abp_aut "/root/repo/_compact_build/stage/bin/ltsinfo" "abp.aut")
+set_tests_properties(tooltest_ltsinfo_abp_aut PROPERTIES  DEPENDS "tooltest_lps2lts_abp_lps_abp_aut" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;238;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;533;gen_ltsinfo_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_ltsinfo_abp_fsm "/root/repo/_compact_build/stage/bin/ltsinfo" "abp.fsm")
+set_tests_properties(tooltest_ltsinfo_abp_fsm PROPERTIES  DEPENDS "tooltest_lps2lts_abp_lps_abp_fsm" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;238;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;533;gen_ltsinfo_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_ltscompare_c_ebranching-bisim_abp_lts_abp_lts "/root/repo/_compact_build/stage/bin/ltscompare" "-c" "-ebranching-bisim" "abp.lts" "abp.lts")
+set_tests_properties(tooltest_ltscompare_c_ebranching-bisim_abp_lts_abp_lts PROPERTIES  DEPENDS "tooltest_lps2lts_abp_lps_abp_lts;tooltest_lps2lts_abp_lps_abp_lts" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;266;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;535;gen_ltscompare_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_ltscompare_c_edpbranching-bisim_abp_lts_abp_lts "/root/repo/_compact_build/stage/bin/ltscompare" "-c" "-edpbranching-bisim" "abp.lts" "abp.lts")
+set_tests_properties(tooltest_ltscompare_c_edpbranching-bisim_abp_lts_abp_lts PROPERTIES  DEPENDS "tooltest_lps2lts_abp_lps_abp_lts;tooltest_lps2lts_abp_lps_abp_lts" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;266;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;535;gen_ltscompare_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_ltscompare_c_esim_abp_lts_abp_lts "/root/repo/_compact_build/stage/bin/ltscompare" "-c" "-esim" "abp.lts" "abp.lts")
+set_tests_properties(tooltest_ltscompare_c_esim_abp_lts_abp_lts PROPERTIES  DEPENDS "tooltest_lps2lts_abp_lps_abp_lts;tooltest_lps2lts_abp_lps_abp_lts" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;266;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;535;gen_ltscompare_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_ltscompare_c_etrace_abp_lts_abp_lts "/root/repo/_compact_build/stage/bin/ltscompare" "-c" "-etrace" "abp.lts" "abp.lts")
+set_tests_properties(tooltest_ltscompare_c_etrace_abp_lts_abp_lts PROPERTIES  DEPENDS "tooltest_lps2lts_abp_lps_abp_lts;tooltest_lps2lts_abp_lps_abp_lts" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;266;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;535;gen_ltscompare_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_ltscompare_c_eweak-trace_abp_lts_abp_lts "/root/repo/_compact_build/stage/bin/ltscompare" "-c" "-eweak-trace" "abp.lts" "abp.lts")
+set_tests_properties(tooltest_ltscompare_c_eweak-trace_abp_lts_abp_lts PROPERTIES  DEPENDS "tooltest_lps2lts_abp_lps_abp_lts;tooltest_lps2lts_abp_lps_abp_lts" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;266;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;535;gen_ltscompare_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_ltscompare_psim_abp_lts_abp_lts "/root/repo/_compact_build/stage/bin/ltscompare" "-psim" "abp.lts" "abp.lts")
+set_tests_properties(tooltest_ltscompare_psim_abp_lts_abp_lts PROPERTIES  DEPENDS "tooltest_lps2lts_abp_lps_abp_lts;tooltest_lps2lts_abp_lps_abp_lts" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;266;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;535;gen_ltscompare_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_ltscompare_pweak-trace_abp_lts_abp_lts "/root/repo/_compact_build/stage/bin/ltscompare" "-pweak-trace" "abp.lts" "abp.lts")
+set_tests_properties(tooltest_ltscompare_pweak-trace_abp_lts_abp_lts PROPERTIES  DEPENDS "tooltest_lps2lts_abp_lps_abp_lts;tooltest_lps2lts_abp_lps_abp_lts" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;266;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;535;gen_ltscompare_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_ltscompare_ebisim_tau=r1,s4_abp_lts_abp_lts "/root/repo/_compact_build/stage/bin/ltscompare" "-ebisim" "--tau=r1,s4" "abp.lts" "abp.lts")
+set_tests_properties(tooltest_ltscompare_ebisim_tau=r1,s4_abp_lts_abp_lts PROPERTIES  DEPENDS "tooltest_lps2lts_abp_lps_abp_lts;tooltest_lps2lts_abp_lps_abp_lts" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;266;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;535;gen_ltscompare_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsbisim2pbes_bstrong-bisim_abp_lps_abp_lps "/root/repo/_compact_build/stage/bin/lpsbisim2pbes" "-bstrong-bisim" "abp.lps" "abp.lps")
+set_tests_properties(tooltest_lpsbisim2pbes_bstrong-bisim_abp_lps_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps;tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;394;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;536;gen_lpsbisim2pbes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsbisim2pbes_bweak-bisim_abp_lps_abp_lps "/root/repo/_compact_build/stage/bin/lpsbisim2pbes" "-bweak-bisim" "abp.lps" "abp.lps")
+set_tests_properties(tooltest_lpsbisim2pbes_bweak-bisim_abp_lps_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps;tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;395;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;536;gen_lpsbisim2pbes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsbisim2pbes_bbranching-bisim_abp_lps_abp_lps "/root/repo/_compact_build/stage/bin/lpsbisim2pbes" "-bbranching-bisim" "abp.lps" "abp.lps")
+set_tests_properties(tooltest_lpsbisim2pbes_bbranching-bisim_abp_lps_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps;tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;396;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;536;gen_lpsbisim2pbes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsbisim2pbes_bbranching-sim_abp_lps_abp_lps "/root/repo/_compact_build/stage/bin/lpsbisim2pbes" "-bbranching-sim" "abp.lps" "abp.lps")
+set_tests_properties(tooltest_lpsbisim2pbes_bbranching-sim_abp_lps_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps;tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;397;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;536;gen_lpsbisim2pbes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lpsbisim2pbes_bstrong-bisim_n_abp_lps_abp_lps "/root/repo/_compact_build/stage/bin/lpsbisim2pbes" "-bstrong-bisim" "-n" "abp.lps" "abp.lps")
+set_tests_properties(tooltest_lpsbisim2pbes_bstrong-bisim_n_abp_lps_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps;tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;398;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;536;gen_lpsbisim2pbes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_txt2lps_abp_lps_txt "/root/repo/_compact_build/stage/bin/txt2lps" "abp.lps.txt")
+set_tests_properties(tooltest_txt2lps_abp_lps_txt PROPERTIES  DEPENDS "tooltest_lpspp_fdefault_abp_lps_abp_lps_txt" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;327;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;538;gen_txt2lps_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/lps2pbes" "-f" "nodeadlock.mcf" "abp.lps" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;272;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;546;gen_lps2pbes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lps2pbes_tf_nodeadlock_mcf_abp_lps "/root/repo/_compact_build/stage/bin/lps2pbes" "-tf" "nodeadlock.mcf" "abp.lps")
+set_tests_properties(tooltest_lps2pbes_tf_nodeadlock_mcf_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;273;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;546;gen_lps2pbes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lts2pbes_f_nodeadlock_mcf_m_abp_mcrl2_abp_lts "/root/repo/_compact_build/stage/bin/lts2pbes" "-f" "nodeadlock.mcf" "-m" "abp.mcrl2" "abp.lts")
+set_tests_properties(tooltest_lts2pbes_f_nodeadlock_mcf_m_abp_mcrl2_abp_lts PROPERTIES  DEPENDS "tooltest_lps2lts_abp_lps_abp_lts" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;278;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;547;gen_lts2pbes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesinfo_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbesinfo" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbesinfo_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;283;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;548;gen_pbesinfo_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesinfo_f_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbesinfo" "-f" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbesinfo_f_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;284;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;548;gen_pbesinfo_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbespp_finternal_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbespp" "-finternal" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbespp_finternal_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;289;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;549;gen_pbespp_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbespp_fdefault_abp_nodeadlock_pbes_abp_nodeadlock_pbes_txt "/root/repo/_compact_build/stage/bin/pbespp" "-fdefault" "abp.nodeadlock.pbes" "abp.nodeadlock.pbes.txt")
+set_tests_properties(tooltest_pbespp_fdefault_abp_nodeadlock_pbes_abp_nodeadlock_pbes_txt PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;290;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;549;gen_pbespp_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesconstelm_c_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbesconstelm" "-c" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbesconstelm_c_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;298;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;550;gen_pbesconstelm_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesconstelm_e_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbesconstelm" "-e" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbesconstelm_e_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;298;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;550;gen_pbesconstelm_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesconstelm_psimplify_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbesconstelm" "-psimplify" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbesconstelm_psimplify_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;298;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;550;gen_pbesconstelm_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesconstelm_pquantifier-all_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbesconstelm" "-pquantifier-all" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbesconstelm_pquantifier-all_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;298;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;550;gen_pbesconstelm_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesconstelm_pquantifier-finite_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbesconstelm" "-pquantifier-finite" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbesconstelm_pquantifier-finite_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;298;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;550;gen_pbesconstelm_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesconstelm_ppfnf_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbesconstelm" "-ppfnf" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbesconstelm_ppfnf_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;298;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;550;gen_pbesconstelm_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesconstelm_rjitty_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbesconstelm" "-rjitty" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbesconstelm_rjitty_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;298;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;550;gen_pbesconstelm_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesconstelm_rjittyp_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbesconstelm" "-rjittyp" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbesconstelm_rjittyp_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;298;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;550;gen_pbesconstelm_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesconstelm_rjittyc_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbesconstelm" "-rjittyc" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbesconstelm_rjittyc_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;298;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;550;gen_pbesconstelm_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesparelm_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbesparelm" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbesparelm_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;304;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;551;gen_pbesparelm_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesrewr_psimplify_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbesrewr" "-psimplify" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbesrewr_psimplify_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;312;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;552;gen_pbesrewr_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesrewr_pquantifier-all_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbesrewr" "-pquantifier-all" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbesrewr_pquantifier-all_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;312;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;552;gen_pbesrewr_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesrewr_pquantifier-finite_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbesrewr" "-pquantifier-finite" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbesrewr_pquantifier-finite_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;312;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;552;gen_pbesrewr_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesrewr_ppfnf_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbesrewr" "-ppfnf" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbesrewr_ppfnf_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;312;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;552;gen_pbesrewr_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesrewr_rjitty_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbesrewr" "-rjitty" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbesrewr_rjitty_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;312;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;552;gen_pbesrewr_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesrewr_rjittyp_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbesrewr" "-rjittyp" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbesrewr_rjittyp_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;312;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;552;gen_pbesrewr_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesrewr_rjittyc_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbesrewr" "-rjittyc" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbesrewr_rjittyc_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;312;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;552;gen_pbesrewr_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bool_c_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbes2bool" "-c" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbes2bool_c_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;321;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;553;gen_pbes2bool_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bool_rjitty_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbes2bool" "-rjitty" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbes2bool_rjitty_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;321;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;553;gen_pbes2bool_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bool_rjittyp_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbes2bool" "-rjittyp" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbes2bool_rjittyp_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;321;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;553;gen_pbes2bool_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bool_rjittyc_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbes2bool" "-rjittyc" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbes2bool_rjittyc_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;321;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;553;gen_pbes2bool_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bool_s0_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbes2bool" "-s0" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbes2bool_s0_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;321;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;553;gen_pbes2bool_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bool_s1_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbes2bool" "-s1" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbes2bool_s1_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;321;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;553;gen_pbes2bool_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bool_s2_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbes2bool" "-s2" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbes2bool_s2_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;321;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;553;gen_pbes2bool_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bool_s3_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbes2bool" "-s3" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbes2bool_s3_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;321;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;553;gen_pbes2bool_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bool_s4_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbes2bool" "-s4" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbes2bool_s4_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;321;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;553;gen_pbes2bool_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bool_u_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbes2bool" "-u" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbes2bool_u_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;321;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;553;gen_pbes2bool_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bool_zbreadth-first_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbes2bool" "-zbreadth-first" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbes2bool_zbreadth-first_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;321;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;553;gen_pbes2bool_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bool_zdepth-first_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbes2bool" "-zdepth-first" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbes2bool_zdepth-first_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;321;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;553;gen_pbes2bool_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bes_abp_nodeadlock_pbes_abp_nodeadlock_bes "/root/repo/_compact_build/stage/bin/pbes2bes" "abp.nodeadlock.pbes" "abp.nodeadlock.bes")
+set_tests_properties(tooltest_pbes2bes_abp_nodeadlock_pbes_abp_nodeadlock_bes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;339;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;554;gen_pbes2bes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bes_opbes_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbes2bes" "-opbes" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbes2bes_opbes_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;341;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;554;gen_pbes2bes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bes_otext_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbes2bes" "-otext" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbes2bes_otext_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;341;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;554;gen_pbes2bes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bes_obes_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbes2bes" "-obes" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbes2bes_obes_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;341;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;554;gen_pbes2bes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bes_opgsolver_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbes2bes" "-opgsolver" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbes2bes_opgsolver_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;341;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;554;gen_pbes2bes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bes_rjitty_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbes2bes" "-rjitty" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbes2bes_rjitty_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;341;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;554;gen_pbes2bes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bes_rjittyp_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbes2bes" "-rjittyp" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbes2bes_rjittyp_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;341;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;554;gen_pbes2bes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bes_rjittyc_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbes2bes" "-rjittyc" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbes2bes_rjittyc_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;341;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;554;gen_pbes2bes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bes_s0_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbes2bes" "-s0" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbes2bes_s0_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;341;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;554;gen_pbes2bes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bes_s1_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbes2bes" "-s1" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbes2bes_s1_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;341;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;554;gen_pbes2bes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bes_s2_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbes2bes" "-s2" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbes2bes_s2_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;341;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;554;gen_pbes2bes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bes_s3_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbes2bes" "-s3" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbes2bes_s3_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;341;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;554;gen_pbes2bes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bes_u_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbes2bes" "-u" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbes2bes_u_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;341;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;554;gen_pbes2bes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bes_zb_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbes2bes" "-zb" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbes2bes_zb_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;341;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;554;gen_pbes2bes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bes_zd_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbes2bes" "-zd" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbes2bes_zd_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;341;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;554;gen_pbes2bes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bes_erase=none_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbes2bes" "--erase=none" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbes2bes_erase=none_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;341;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;554;gen_pbes2bes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bes_erase=some_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbes2bes" "--erase=some" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbes2bes_erase=some_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;341;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;554;gen_pbes2bes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bes_erase=all_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbes2bes" "--erase=all" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbes2bes_erase=all_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;341;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;554;gen_pbes2bes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_bespp_fdefault_abp_nodeadlock_bes_abp_nodeadlock_bes_txt "/root/repo/_compact_build/stage/bin/bespp" "-fdefault" "abp.nodeadlock.bes" "abp.nodeadlock.bes.txt")
+set_tests_properties(tooltest_bespp_fdefault_abp_nodeadlock_bes_abp_nodeadlock_bes_txt PROPERTIES  DEPENDS "tooltest_pbes2bes_abp_nodeadlock_pbes_abp_nodeadlock_bes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;353;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;555;gen_bespp_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_besinfo_abp_nodeadlock_bes "/root/repo/_compact_build/stage/bin/besinfo" "abp.nodeadlock.bes")
+set_tests_properties(tooltest_besinfo_abp_nodeadlock_bes PROPERTIES  DEPENDS "tooltest_pbes2bes_abp_nodeadlock_pbes_abp_nodeadlock_bes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;347;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;557;gen_besinfo_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_besinfo_f_abp_nodeadlock_bes "/root/repo/_compact_build/stage/bin/besinfo" "-f" "abp.nodeadlock.bes")
+set_tests_properties(tooltest_besinfo_f_abp_nodeadlock_bes PROPERTIES  DEPENDS "tooltest_pbes2bes_abp_nodeadlock_pbes_abp_nodeadlock_bes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;348;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;557;gen_besinfo_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_bessolve_sgauss_abp_nodeadlock_bes "/root/repo/_compact_build/stage/bin/bessolve" "-sgauss" "abp.nodeadlock.bes")
+set_tests_properties(tooltest_bessolve_sgauss_abp_nodeadlock_bes PROPERTIES  DEPENDS "tooltest_pbes2bes_abp_nodeadlock_pbes_abp_nodeadlock_bes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;358;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;558;gen_bessolve_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_bessolve_sspm_abp_nodeadlock_bes "/root/repo/_compact_build/stage/bin/bessolve" "-sspm" "abp.nodeadlock.bes")
+set_tests_properties(tooltest_bessolve_sspm_abp_nodeadlock_bes PROPERTIES  DEPENDS "tooltest_pbes2bes_abp_nodeadlock_pbes_abp_nodeadlock_bes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;359;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;558;gen_bessolve_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesinst_opbes_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbesinst" "-opbes" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbesinst_opbes_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;372;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;559;gen_pbesinst_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesinst_obes_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbesinst" "-obes" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbesinst_obes_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;372;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;559;gen_pbesinst_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesinst_otext_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbesinst" "-otext" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbesinst_otext_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;372;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;559;gen_pbesinst_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesinst_opgsolver_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbesinst" "-opgsolver" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbesinst_opgsolver_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;372;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;559;gen_pbesinst_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesinst_slazy_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbesinst" "-slazy" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbesinst_slazy_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;372;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;559;gen_pbesinst_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesinst_sfinite_f"___:Bool_"_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbesinst" "-sfinite" "-f\"*(*:Bool)\"" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbesinst_sfinite_f"___:Bool_"_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;372;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;559;gen_pbesinst_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesinst_rjitty_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbesinst" "-rjitty" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbesinst_rjitty_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;372;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;559;gen_pbesinst_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesinst_rjittyp_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbesinst" "-rjittyp" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbesinst_rjittyp_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;372;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;559;gen_pbesinst_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesinst_rjittyc_abp_nodeadlock_pbes "/root/repo/_compact_build/stage/bin/pbesinst" "-rjittyc" "abp.nodeadlock.pbes")
+set_tests_properties(tooltest_pbesinst_rjittyc_abp_nodeadlock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nodeadlock_mcf_abp_lps_abp_nodeadlock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;372;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;559;gen_pbesinst_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_txt2pbes_abp_nodeadlock_pbes_txt "/root/repo/_compact_build/stage/bin/txt2pbes" "abp.nodeadlock.pbes.txt")
+set_tests_properties(tooltest_txt2pbes_abp_nodeadlock_pbes_txt PROPERTIES  DEPENDS "tooltest_pbespp_fdefault_abp_nodeadlock_pbes_abp_nodeadlock_pbes_txt" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;332;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;561;gen_txt2pbes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_txt2bes_abp_nodeadlock_bes_txt "/root/repo/_compact_build/stage/bin/txt2bes" "abp.nodeadlock.bes.txt")
+set_tests_properties(tooltest_txt2bes_abp_nodeadlock_bes_txt PROPERTIES  DEPENDS "tooltest_bespp_fdefault_abp_nodeadlock_bes_abp_nodeadlock_bes_txt" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;403;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;562;gen_txt2bes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/lps2pbes" "-f" "nolivelock.mcf" "abp.lps" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;272;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;546;gen_lps2pbes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lps2pbes_tf_nolivelock_mcf_abp_lps "/root/repo/_compact_build/stage/bin/lps2pbes" "-tf" "nolivelock.mcf" "abp.lps")
+set_tests_properties(tooltest_lps2pbes_tf_nolivelock_mcf_abp_lps PROPERTIES  DEPENDS "tooltest_mcrl22lps_D_abp_mcrl2_abp_lps" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;273;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;546;gen_lps2pbes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_lts2pbes_f_nolivelock_mcf_m_abp_mcrl2_abp_lts "/root/repo/_compact_build/stage/bin/lts2pbes" "-f" "nolivelock.mcf" "-m" "abp.mcrl2" "abp.lts")
+set_tests_properties(tooltest_lts2pbes_f_nolivelock_mcf_m_abp_mcrl2_abp_lts PROPERTIES  DEPENDS "tooltest_lps2lts_abp_lps_abp_lts" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;278;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;547;gen_lts2pbes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesinfo_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbesinfo" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbesinfo_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;283;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;548;gen_pbesinfo_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesinfo_f_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbesinfo" "-f" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbesinfo_f_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;284;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;548;gen_pbesinfo_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbespp_finternal_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbespp" "-finternal" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbespp_finternal_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;289;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;549;gen_pbespp_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbespp_fdefault_abp_nolivelock_pbes_abp_nolivelock_pbes_txt "/root/repo/_compact_build/stage/bin/pbespp" "-fdefault" "abp.nolivelock.pbes" "abp.nolivelock.pbes.txt")
+set_tests_properties(tooltest_pbespp_fdefault_abp_nolivelock_pbes_abp_nolivelock_pbes_txt PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;290;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;549;gen_pbespp_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesconstelm_c_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbesconstelm" "-c" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbesconstelm_c_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;298;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;550;gen_pbesconstelm_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesconstelm_e_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbesconstelm" "-e" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbesconstelm_e_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;298;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;550;gen_pbesconstelm_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesconstelm_psimplify_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbesconstelm" "-psimplify" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbesconstelm_psimplify_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;298;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;550;gen_pbesconstelm_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesconstelm_pquantifier-all_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbesconstelm" "-pquantifier-all" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbesconstelm_pquantifier-all_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;298;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;550;gen_pbesconstelm_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesconstelm_pquantifier-finite_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbesconstelm" "-pquantifier-finite" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbesconstelm_pquantifier-finite_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;298;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;550;gen_pbesconstelm_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesconstelm_ppfnf_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbesconstelm" "-ppfnf" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbesconstelm_ppfnf_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;298;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;550;gen_pbesconstelm_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesconstelm_rjitty_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbesconstelm" "-rjitty" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbesconstelm_rjitty_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;298;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;550;gen_pbesconstelm_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesconstelm_rjittyp_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbesconstelm" "-rjittyp" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbesconstelm_rjittyp_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;298;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;550;gen_pbesconstelm_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesconstelm_rjittyc_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbesconstelm" "-rjittyc" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbesconstelm_rjittyc_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;298;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;550;gen_pbesconstelm_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesparelm_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbesparelm" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbesparelm_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;304;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;551;gen_pbesparelm_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesrewr_psimplify_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbesrewr" "-psimplify" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbesrewr_psimplify_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;312;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;552;gen_pbesrewr_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesrewr_pquantifier-all_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbesrewr" "-pquantifier-all" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbesrewr_pquantifier-all_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;312;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;552;gen_pbesrewr_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesrewr_pquantifier-finite_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbesrewr" "-pquantifier-finite" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbesrewr_pquantifier-finite_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;312;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;552;gen_pbesrewr_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesrewr_ppfnf_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbesrewr" "-ppfnf" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbesrewr_ppfnf_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;312;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;552;gen_pbesrewr_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesrewr_rjitty_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbesrewr" "-rjitty" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbesrewr_rjitty_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;312;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;552;gen_pbesrewr_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesrewr_rjittyp_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbesrewr" "-rjittyp" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbesrewr_rjittyp_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;312;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;552;gen_pbesrewr_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesrewr_rjittyc_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbesrewr" "-rjittyc" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbesrewr_rjittyc_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;312;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;552;gen_pbesrewr_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bool_c_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbes2bool" "-c" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbes2bool_c_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;321;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;553;gen_pbes2bool_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bool_rjitty_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbes2bool" "-rjitty" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbes2bool_rjitty_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;321;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;553;gen_pbes2bool_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bool_rjittyp_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbes2bool" "-rjittyp" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbes2bool_rjittyp_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;321;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;553;gen_pbes2bool_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bool_rjittyc_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbes2bool" "-rjittyc" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbes2bool_rjittyc_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;321;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;553;gen_pbes2bool_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bool_s0_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbes2bool" "-s0" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbes2bool_s0_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;321;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;553;gen_pbes2bool_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bool_s1_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbes2bool" "-s1" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbes2bool_s1_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;321;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;553;gen_pbes2bool_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bool_s2_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbes2bool" "-s2" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbes2bool_s2_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;321;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;553;gen_pbes2bool_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bool_s3_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbes2bool" "-s3" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbes2bool_s3_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;321;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;553;gen_pbes2bool_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bool_s4_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbes2bool" "-s4" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbes2bool_s4_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;321;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;553;gen_pbes2bool_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bool_u_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbes2bool" "-u" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbes2bool_u_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;321;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;553;gen_pbes2bool_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bool_zbreadth-first_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbes2bool" "-zbreadth-first" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbes2bool_zbreadth-first_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;321;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;553;gen_pbes2bool_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bool_zdepth-first_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbes2bool" "-zdepth-first" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbes2bool_zdepth-first_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;321;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;553;gen_pbes2bool_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bes_abp_nolivelock_pbes_abp_nolivelock_bes "/root/repo/_compact_build/stage/bin/pbes2bes" "abp.nolivelock.pbes" "abp.nolivelock.bes")
+set_tests_properties(tooltest_pbes2bes_abp_nolivelock_pbes_abp_nolivelock_bes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;339;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;554;gen_pbes2bes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bes_opbes_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbes2bes" "-opbes" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbes2bes_opbes_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;341;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;554;gen_pbes2bes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bes_otext_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbes2bes" "-otext" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbes2bes_otext_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;341;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;554;gen_pbes2bes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bes_obes_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbes2bes" "-obes" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbes2bes_obes_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;341;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;554;gen_pbes2bes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bes_opgsolver_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbes2bes" "-opgsolver" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbes2bes_opgsolver_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;341;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;554;gen_pbes2bes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bes_rjitty_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbes2bes" "-rjitty" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbes2bes_rjitty_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;341;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;554;gen_pbes2bes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bes_rjittyp_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbes2bes" "-rjittyp" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbes2bes_rjittyp_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;341;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;554;gen_pbes2bes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bes_rjittyc_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbes2bes" "-rjittyc" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbes2bes_rjittyc_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;341;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;554;gen_pbes2bes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bes_s0_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbes2bes" "-s0" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbes2bes_s0_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;341;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;554;gen_pbes2bes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bes_s1_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbes2bes" "-s1" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbes2bes_s1_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;341;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;554;gen_pbes2bes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bes_s2_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbes2bes" "-s2" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbes2bes_s2_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;341;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;554;gen_pbes2bes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bes_s3_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbes2bes" "-s3" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbes2bes_s3_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;341;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;554;gen_pbes2bes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bes_u_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbes2bes" "-u" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbes2bes_u_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;341;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;554;gen_pbes2bes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bes_zb_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbes2bes" "-zb" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbes2bes_zb_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;341;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;554;gen_pbes2bes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bes_zd_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbes2bes" "-zd" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbes2bes_zd_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;341;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;554;gen_pbes2bes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bes_erase=none_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbes2bes" "--erase=none" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbes2bes_erase=none_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;341;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;554;gen_pbes2bes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bes_erase=some_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbes2bes" "--erase=some" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbes2bes_erase=some_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;341;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;554;gen_pbes2bes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbes2bes_erase=all_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbes2bes" "--erase=all" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbes2bes_erase=all_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;341;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;554;gen_pbes2bes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_bespp_fdefault_abp_nolivelock_bes_abp_nolivelock_bes_txt "/root/repo/_compact_build/stage/bin/bespp" "-fdefault" "abp.nolivelock.bes" "abp.nolivelock.bes.txt")
+set_tests_properties(tooltest_bespp_fdefault_abp_nolivelock_bes_abp_nolivelock_bes_txt PROPERTIES  DEPENDS "tooltest_pbes2bes_abp_nolivelock_pbes_abp_nolivelock_bes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;353;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;555;gen_bespp_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_besinfo_abp_nolivelock_bes "/root/repo/_compact_build/stage/bin/besinfo" "abp.nolivelock.bes")
+set_tests_properties(tooltest_besinfo_abp_nolivelock_bes PROPERTIES  DEPENDS "tooltest_pbes2bes_abp_nolivelock_pbes_abp_nolivelock_bes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;347;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;557;gen_besinfo_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_besinfo_f_abp_nolivelock_bes "/root/repo/_compact_build/stage/bin/besinfo" "-f" "abp.nolivelock.bes")
+set_tests_properties(tooltest_besinfo_f_abp_nolivelock_bes PROPERTIES  DEPENDS "tooltest_pbes2bes_abp_nolivelock_pbes_abp_nolivelock_bes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;348;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;557;gen_besinfo_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_bessolve_sgauss_abp_nolivelock_bes "/root/repo/_compact_build/stage/bin/bessolve" "-sgauss" "abp.nolivelock.bes")
+set_tests_properties(tooltest_bessolve_sgauss_abp_nolivelock_bes PROPERTIES  DEPENDS "tooltest_pbes2bes_abp_nolivelock_pbes_abp_nolivelock_bes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;358;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;558;gen_bessolve_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_bessolve_sspm_abp_nolivelock_bes "/root/repo/_compact_build/stage/bin/bessolve" "-sspm" "abp.nolivelock.bes")
+set_tests_properties(tooltest_bessolve_sspm_abp_nolivelock_bes PROPERTIES  DEPENDS "tooltest_pbes2bes_abp_nolivelock_pbes_abp_nolivelock_bes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;359;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;558;gen_bessolve_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesinst_opbes_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbesinst" "-opbes" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbesinst_opbes_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;372;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;559;gen_pbesinst_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesinst_obes_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbesinst" "-obes" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbesinst_obes_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;372;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;559;gen_pbesinst_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesinst_otext_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbesinst" "-otext" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbesinst_otext_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;372;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;559;gen_pbesinst_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesinst_opgsolver_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbesinst" "-opgsolver" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbesinst_opgsolver_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;372;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;559;gen_pbesinst_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesinst_slazy_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbesinst" "-slazy" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbesinst_slazy_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;372;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;559;gen_pbesinst_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesinst_sfinite_f"___:Bool_"_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbesinst" "-sfinite" "-f\"*(*:Bool)\"" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbesinst_sfinite_f"___:Bool_"_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;372;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;559;gen_pbesinst_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesinst_rjitty_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbesinst" "-rjitty" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbesinst_rjitty_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;372;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;559;gen_pbesinst_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesinst_rjittyp_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbesinst" "-rjittyp" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbesinst_rjittyp_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;372;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;559;gen_pbesinst_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_pbesinst_rjittyc_abp_nolivelock_pbes "/root/repo/_compact_build/stage/bin/pbesinst" "-rjittyc" "abp.nolivelock.pbes")
+set_tests_properties(tooltest_pbesinst_rjittyc_abp_nolivelock_pbes PROPERTIES  DEPENDS "tooltest_lps2pbes_f_nolivelock_mcf_abp_lps_abp_nolivelock_pbes" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;372;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;559;gen_pbesinst_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_txt2pbes_abp_nolivelock_pbes_txt "/root/repo/_compact_build/stage/bin/txt2pbes" "abp.nolivelock.pbes.txt")
+set_tests_properties(tooltest_txt2pbes_abp_nolivelock_pbes_txt PROPERTIES  DEPENDS "tooltest_pbespp_fdefault_abp_nolivelock_pbes_abp_nolivelock_pbes_txt" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;332;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;561;gen_txt2pbes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(tooltest_txt2bes_abp_nolivelock_bes_txt "/root/repo/_compact_build/stage/bin/txt2bes" "abp.nolivelock.bes.txt")
+set_tests_properties(tooltest_txt2bes_abp_nolivelock_bes_txt PROPERTIES  DEPENDS "tooltest_bespp_fdefault_abp_nolivelock_bes_abp_nolivelock_bes_txt" LABELS "tooltest" WORKING_DIRECTORY "/root/repo/_compact_build/mcrl2-testoutput" _BACKTRACE_TRIPLES "/root/repo/build/cmake/GenerateToolTests.cmake;61;add_test;/root/repo/build/cmake/GenerateToolTests.cmake;403;add_tool_test;/root/repo/build/cmake/GenerateToolTests.cmake;562;gen_txt2bes_release_tests;/root/repo/tests/CMakeLists.txt;4;generate_tool_tests;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_alphabet-reduce "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "alphabet-reduce")
+set_tests_properties(random_alphabet-reduce PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_bessolve "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "bessolve")
+set_tests_properties(random_bessolve PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_bisimulation-bisim "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "bisimulation-bisim")
+set_tests_properties(random_bisimulation-bisim PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_bisimulation-bisim-gjkw "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "bisimulation-bisim-gjkw")
+set_tests_properties(random_bisimulation-bisim-gjkw PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_bisimulation-bisim-gv "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "bisimulation-bisim-gv")
+set_tests_properties(random_bisimulation-bisim-gv PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_bisimulation-branching-bisim "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "bisimulation-branching-bisim")
+set_tests_properties(random_bisimulation-branching-bisim PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_bisimulation-branching-bisim-gjkw "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "bisimulation-branching-bisim-gjkw")
+set_tests_properties(random_bisimulation-branching-bisim-gjkw PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_bisimulation-branching-bisim-gv "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "bisimulation-branching-bisim-gv")
+set_tests_properties(random_bisimulation-branching-bisim-gv PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_bisimulation-weak-bisim "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "bisimulation-weak-bisim")
+set_tests_properties(random_bisimulation-weak-bisim PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_lps-quantifier-one-point "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "lps-quantifier-one-point")
+set_tests_properties(random_lps-quantifier-one-point PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_lps2lts-algorithms "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "lps2lts-algorithms")
+set_tests_properties(random_lps2lts-algorithms PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_lps2pbes "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "lps2pbes")
+set_tests_properties(random_lps2pbes PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_lpsbinary "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "lpsbinary")
+set_tests_properties(random_lpsbinary PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_lpsconfcheck-commutative "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "lpsconfcheck-commutative")
+set_tests_properties(random_lpsconfcheck-commutative PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_lpsconfcheck-commutative-disjoint "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "lpsconfcheck-commutative-disjoint")
+set_tests_properties(random_lpsconfcheck-commutative-disjoint PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_lpsconfcheck-disjoint "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "lpsconfcheck-disjoint")
+set_tests_properties(random_lpsconfcheck-disjoint PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_lpsconfcheck-triangular "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "lpsconfcheck-triangular")
+set_tests_properties(random_lpsconfcheck-triangular PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_lpsconfcheck-trivial "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "lpsconfcheck-trivial")
+set_tests_properties(random_lpsconfcheck-trivial PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_lpsconstelm "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "lpsconstelm")
+set_tests_properties(random_lpsconstelm PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_lpsparelm "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "lpsparelm")
+set_tests_properties(random_lpsparelm PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_lpsstategraph "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "lpsstategraph")
+set_tests_properties(random_lpsstategraph PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_lpssumelm "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "lpssumelm")
+set_tests_properties(random_lpssumelm PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_lpssuminst "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "lpssuminst")
+set_tests_properties(random_lpssuminst PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_lts2pbes "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "lts2pbes")
+set_tests_properties(random_lts2pbes PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_ltscompare-bisim "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ltscompare-bisim")
+set_tests_properties(random_ltscompare-bisim PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_ltscompare-bisim-gjkw "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ltscompare-bisim-gjkw")
+set_tests_properties(random_ltscompare-bisim-gjkw PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_ltscompare-bisim-gv "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ltscompare-bisim-gv")
+set_tests_properties(random_ltscompare-bisim-gv PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_ltscompare-branching-bisim "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ltscompare-branching-bisim")
+set_tests_properties(random_ltscompare-branching-bisim PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_ltscompare-branching-bisim-gjkw "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ltscompare-branching-bisim-gjkw")
+set_tests_properties(random_ltscompare-branching-bisim-gjkw PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_ltscompare-branching-bisim-gv "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ltscompare-branching-bisim-gv")
+set_tests_properties(random_ltscompare-branching-bisim-gv PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_ltscompare-dpbranching-bisim "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ltscompare-dpbranching-bisim")
+set_tests_properties(random_ltscompare-dpbranching-bisim PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_ltscompare-dpbranching-bisim-gjkw "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ltscompare-dpbranching-bisim-gjkw")
+set_tests_properties(random_ltscompare-dpbranching-bisim-gjkw PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_ltscompare-dpbranching-bisim-gv "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ltscompare-dpbranching-bisim-gv")
+set_tests_properties(random_ltscompare-dpbranching-bisim-gv PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_ltscompare-dpweak-bisim "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ltscompare-dpweak-bisim")
+set_tests_properties(random_ltscompare-dpweak-bisim PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_ltscompare-ready-sim "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ltscompare-ready-sim")
+set_tests_properties(random_ltscompare-ready-sim PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_ltscompare-sim "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ltscompare-sim")
+set_tests_properties(random_ltscompare-sim PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_ltscompare-trace "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ltscompare-trace")
+set_tests_properties(random_ltscompare-trace PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_ltscompare-weak-bisim "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ltscompare-weak-bisim")
+set_tests_properties(random_ltscompare-weak-bisim PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_ltscompare-weak-trace "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ltscompare-weak-trace")
+set_tests_properties(random_ltscompare-weak-trace PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_ltsconvertsymbolic "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ltsconvertsymbolic")
+set_tests_properties(random_ltsconvertsymbolic PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_pbes-srf "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbes-srf")
+set_tests_properties(random_pbes-srf PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_pbes-unify-parameters "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbes-unify-parameters")
+set_tests_properties(random_pbes-unify-parameters PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_pbesconstelm "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbesconstelm")
+set_tests_properties(random_pbesconstelm PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_pbesinst-alternative_lazy "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbesinst-alternative_lazy")
+set_tests_properties(random_pbesinst-alternative_lazy PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_pbesinst-finite "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbesinst-finite")
+set_tests_properties(random_pbesinst-finite PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_pbesinst-lazy "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbesinst-lazy")
+set_tests_properties(random_pbesinst-lazy PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_pbesparelm "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbesparelm")
+set_tests_properties(random_pbesparelm PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_pbespareqelm "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbespareqelm")
+set_tests_properties(random_pbespareqelm PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_pbespgsolve "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbespgsolve")
+set_tests_properties(random_pbespgsolve PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_pbespor2 "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbespor2")
+set_tests_properties(random_pbespor2 PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_pbesrewr-data-rewriter "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbesrewr-data-rewriter")
+set_tests_properties(random_pbesrewr-data-rewriter PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_pbesrewr-pfnf "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbesrewr-pfnf")
+set_tests_properties(random_pbesrewr-pfnf PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_pbesrewr-quantifier-all "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbesrewr-quantifier-all")
+set_tests_properties(random_pbesrewr-quantifier-all PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_pbesrewr-quantifier-finite "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbesrewr-quantifier-finite")
+set_tests_properties(random_pbesrewr-quantifier-finite PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_pbesrewr-quantifier-inside "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbesrewr-quantifier-inside")
+set_tests_properties(random_pbesrewr-quantifier-inside PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_pbesrewr-quantifier-one-point "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbesrewr-quantifier-one-point")
+set_tests_properties(random_pbesrewr-quantifier-one-point PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_pbesrewr-simplify "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbesrewr-simplify")
+set_tests_properties(random_pbesrewr-simplify PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_pbesrewr-simplify-data-rewriter "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbesrewr-simplify-data-rewriter")
+set_tests_properties(random_pbesrewr-simplify-data-rewriter PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_pbesrewr-simplify-quantifiers-data-rewriter "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbesrewr-simplify-quantifiers-data-rewriter")
+set_tests_properties(random_pbesrewr-simplify-quantifiers-data-rewriter PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_pbesrewr-simplify-quantifiers-rewriter "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbesrewr-simplify-quantifiers-rewriter")
+set_tests_properties(random_pbesrewr-simplify-quantifiers-rewriter PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_pbesrewr-simplify-rewriter "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbesrewr-simplify-rewriter")
+set_tests_properties(random_pbesrewr-simplify-rewriter PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_pbessolve "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbessolve")
+set_tests_properties(random_pbessolve PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_pbessolve-counter-example-optimization-0 "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbessolve-counter-example-optimization-0")
+set_tests_properties(random_pbessolve-counter-example-optimization-0 PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_pbessolve-counter-example-optimization-1 "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbessolve-counter-example-optimization-1")
+set_tests_properties(random_pbessolve-counter-example-optimization-1 PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_pbessolve-counter-example-optimization-2 "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbessolve-counter-example-optimization-2")
+set_tests_properties(random_pbessolve-counter-example-optimization-2 PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_pbessolve-counter-example-optimization-3 "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbessolve-counter-example-optimization-3")
+set_tests_properties(random_pbessolve-counter-example-optimization-3 PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_pbessolve-counter-example-optimization-4 "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbessolve-counter-example-optimization-4")
+set_tests_properties(random_pbessolve-counter-example-optimization-4 PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_pbessolve-counter-example-optimization-5 "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbessolve-counter-example-optimization-5")
+set_tests_properties(random_pbessolve-counter-example-optimization-5 PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_pbessolve-counter-example-optimization-6 "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbessolve-counter-example-optimization-6")
+set_tests_properties(random_pbessolve-counter-example-optimization-6 PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_pbessolve-counter-example-optimization-7 "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbessolve-counter-example-optimization-7")
+set_tests_properties(random_pbessolve-counter-example-optimization-7 PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_pbessolve-depth-first "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbessolve-depth-first")
+set_tests_properties(random_pbessolve-depth-first PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_pbessolvesymbolic "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbessolvesymbolic")
+set_tests_properties(random_pbessolvesymbolic PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_pbessolvesymbolic-partial "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbessolvesymbolic-partial")
+set_tests_properties(random_pbessolvesymbolic-partial PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(random_pbesstategraph "/root/.pyenv/shims/python3" "/root/repo/tests/random/random_testing.py" "-r 100" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbesstategraph")
+set_tests_properties(random_pbesstategraph PROPERTIES  LABELS "random" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_alphabet-reduce-01 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "alphabet-reduce-01")
+set_tests_properties(regression_alphabet-reduce-01 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_alphabet-reduce-02 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "alphabet-reduce-02")
+set_tests_properties(regression_alphabet-reduce-02 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_alphabet-reduce-03 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "alphabet-reduce-03")
+set_tests_properties(regression_alphabet-reduce-03 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_alphabet-reduce-04 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "alphabet-reduce-04")
+set_tests_properties(regression_alphabet-reduce-04 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_alphabet-reduce-05 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "alphabet-reduce-05")
+set_tests_properties(regression_alphabet-reduce-05 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_alphabet-reduce-06 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "alphabet-reduce-06")
+set_tests_properties(regression_alphabet-reduce-06 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_alphabet-reduce-07 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "alphabet-reduce-07")
+set_tests_properties(regression_alphabet-reduce-07 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_alphabet-reduce-08 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "alphabet-reduce-08")
+set_tests_properties(regression_alphabet-reduce-08 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_alphabet-reduce-09 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "alphabet-reduce-09")
+set_tests_properties(regression_alphabet-reduce-09 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_alphabet-reduce-10 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "alphabet-reduce-10")
+set_tests_properties(regression_alphabet-reduce-10 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_alphabet-reduce-11 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "alphabet-reduce-11")
+set_tests_properties(regression_alphabet-reduce-11 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_alphabet-reduce-12 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "alphabet-reduce-12")
+set_tests_properties(regression_alphabet-reduce-12 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_alphabet-reduce-13 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "alphabet-reduce-13")
+set_tests_properties(regression_alphabet-reduce-13 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_alphabet-reduce-14 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "alphabet-reduce-14")
+set_tests_properties(regression_alphabet-reduce-14 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_alphabet-reduce-15 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "alphabet-reduce-15")
+set_tests_properties(regression_alphabet-reduce-15 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_alphabet-reduce-16 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "alphabet-reduce-16")
+set_tests_properties(regression_alphabet-reduce-16 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_alphabet-reduce-17 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "alphabet-reduce-17")
+set_tests_properties(regression_alphabet-reduce-17 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_alphabet-reduce-18 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "alphabet-reduce-18")
+set_tests_properties(regression_alphabet-reduce-18 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_lpsconfcheck1 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "lpsconfcheck1")
+set_tests_properties(regression_lpsconfcheck1 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_onepoint1 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "onepoint1")
+set_tests_properties(regression_onepoint1 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_pbessolve "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbessolve")
+set_tests_properties(regression_pbessolve PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_pbessolve-01 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbessolve-01")
+set_tests_properties(regression_pbessolve-01 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_pbessolve-02 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbessolve-02")
+set_tests_properties(regression_pbessolve-02 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_pbessolve-03 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbessolve-03")
+set_tests_properties(regression_pbessolve-03 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_pbessolve-04 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbessolve-04")
+set_tests_properties(regression_pbessolve-04 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_pbessolve-05 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbessolve-05")
+set_tests_properties(regression_pbessolve-05 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_pbessolve-06 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbessolve-06")
+set_tests_properties(regression_pbessolve-06 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_pbessolve-07 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbessolve-07")
+set_tests_properties(regression_pbessolve-07 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_pbessolve-08 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbessolve-08")
+set_tests_properties(regression_pbessolve-08 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_pbessolve-09 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbessolve-09")
+set_tests_properties(regression_pbessolve-09 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_pbessolve-10 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbessolve-10")
+set_tests_properties(regression_pbessolve-10 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_pbessolve-11 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbessolve-11")
+set_tests_properties(regression_pbessolve-11 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_pbessolve-12 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbessolve-12")
+set_tests_properties(regression_pbessolve-12 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_pbessolve-13 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbessolve-13")
+set_tests_properties(regression_pbessolve-13 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_pbessolve-14 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbessolve-14")
+set_tests_properties(regression_pbessolve-14 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_pbessolve-15 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbessolve-15")
+set_tests_properties(regression_pbessolve-15 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_pbessolve-16 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbessolve-16")
+set_tests_properties(regression_pbessolve-16 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_pbessolve-17 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbessolve-17")
+set_tests_properties(regression_pbessolve-17 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_pbessolve-18 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbessolve-18")
+set_tests_properties(regression_pbessolve-18 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_pbessolve-19 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "pbessolve-19")
+set_tests_properties(regression_pbessolve-19 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_ticket-1090 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ticket-1090")
+set_tests_properties(regression_ticket-1090 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_ticket-1114a "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ticket-1114a")
+set_tests_properties(regression_ticket-1114a PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_ticket-1114b "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ticket-1114b")
+set_tests_properties(regression_ticket-1114b PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_ticket-1143 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ticket-1143")
+set_tests_properties(regression_ticket-1143 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_ticket-1144 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ticket-1144")
+set_tests_properties(regression_ticket-1144 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_ticket-1167 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ticket-1167")
+set_tests_properties(regression_ticket-1167 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_ticket-1206 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ticket-1206")
+set_tests_properties(regression_ticket-1206 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_ticket-1218 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ticket-1218")
+set_tests_properties(regression_ticket-1218 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_ticket-1234 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ticket-1234")
+set_tests_properties(regression_ticket-1234 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_ticket-1241 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ticket-1241")
+set_tests_properties(regression_ticket-1241 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_ticket-1249 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ticket-1249")
+set_tests_properties(regression_ticket-1249 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_ticket-1297 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ticket-1297")
+set_tests_properties(regression_ticket-1297 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_ticket-1301 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ticket-1301")
+set_tests_properties(regression_ticket-1301 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_ticket-1311 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ticket-1311")
+set_tests_properties(regression_ticket-1311 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_ticket-1315 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ticket-1315")
+set_tests_properties(regression_ticket-1315 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_ticket-1316 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ticket-1316")
+set_tests_properties(regression_ticket-1316 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_ticket-1317 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ticket-1317")
+set_tests_properties(regression_ticket-1317 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_ticket-1318 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ticket-1318")
+set_tests_properties(regression_ticket-1318 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_ticket-1319 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ticket-1319")
+set_tests_properties(regression_ticket-1319 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_ticket-1320 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ticket-1320")
+set_tests_properties(regression_ticket-1320 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_ticket-1321 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ticket-1321")
+set_tests_properties(regression_ticket-1321 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_ticket-1322 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ticket-1322")
+set_tests_properties(regression_ticket-1322 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_ticket-1345 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ticket-1345")
+set_tests_properties(regression_ticket-1345 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_ticket-1413 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ticket-1413")
+set_tests_properties(regression_ticket-1413 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_ticket-1483 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ticket-1483")
+set_tests_properties(regression_ticket-1483 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_ticket-1519 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ticket-1519")
+set_tests_properties(regression_ticket-1519 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_ticket-283 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ticket-283")
+set_tests_properties(regression_ticket-283 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_ticket-325 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ticket-325")
+set_tests_properties(regression_ticket-325 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_ticket-904 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ticket-904")
+set_tests_properties(regression_ticket-904 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(regression_ticket-952 "/root/.pyenv/shims/python3" "/root/repo/tests/regression/regression_testing.py" "--toolpath" "/root/repo/_compact_build/stage/bin" "--pattern" "ticket-952")
+set_tests_properties(regression_ticket-952 PROPERTIES  LABELS "regression" WORKING_DIRECTORY "/root/repo/_compact_build/tests/workspace" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;65;add_test;/root/repo/tests/CMakeLists.txt;0;")
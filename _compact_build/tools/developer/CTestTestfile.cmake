@@ -0,0 +1,18 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tools/developer
+# Build directory: /root/repo/_compact_build/tools/developer
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("confcheck")
+subdirs("lps2ltsdeprecated")
+subdirs("lpstransform")
+subdirs("mcrl2rewrite")
+subdirs("mcrl2transform")
+subdirs("mcrl2typecheck")
+subdirs("pbes2bdd")
+subdirs("pbestransform")
+subdirs("reduce_pbes")
+subdirs("reduce_process")
+subdirs("ltsconvertsymbolic")
+subdirs("pbesbddsolve")
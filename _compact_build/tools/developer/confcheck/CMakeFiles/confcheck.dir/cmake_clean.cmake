@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/confcheck"
+  "../../../stage/bin/confcheck.pdb"
+  "CMakeFiles/confcheck.dir/confcheck.cpp.o"
+  "CMakeFiles/confcheck.dir/confcheck.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/confcheck.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
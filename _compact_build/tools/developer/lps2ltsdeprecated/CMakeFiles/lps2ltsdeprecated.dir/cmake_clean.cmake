@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/lps2ltsdeprecated"
+  "../../../stage/bin/lps2ltsdeprecated.pdb"
+  "CMakeFiles/lps2ltsdeprecated.dir/lps2ltsdeprecated.cpp.o"
+  "CMakeFiles/lps2ltsdeprecated.dir/lps2ltsdeprecated.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lps2ltsdeprecated.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
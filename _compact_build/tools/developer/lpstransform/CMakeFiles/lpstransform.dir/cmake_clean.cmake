@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/lpstransform"
+  "../../../stage/bin/lpstransform.pdb"
+  "CMakeFiles/lpstransform.dir/lpstransform.cpp.o"
+  "CMakeFiles/lpstransform.dir/lpstransform.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lpstransform.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
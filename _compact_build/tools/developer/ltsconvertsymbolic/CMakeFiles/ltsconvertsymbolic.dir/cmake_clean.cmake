@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/ltsconvertsymbolic"
+  "../../../stage/bin/ltsconvertsymbolic.pdb"
+  "CMakeFiles/ltsconvertsymbolic.dir/ltsconvertsymbolic.cpp.o"
+  "CMakeFiles/ltsconvertsymbolic.dir/ltsconvertsymbolic.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ltsconvertsymbolic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/mcrl2rewrite"
+  "../../../stage/bin/mcrl2rewrite.pdb"
+  "CMakeFiles/mcrl2rewrite.dir/mcrl2rewrite.cpp.o"
+  "CMakeFiles/mcrl2rewrite.dir/mcrl2rewrite.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mcrl2rewrite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/mcrl2transform"
+  "../../../stage/bin/mcrl2transform.pdb"
+  "CMakeFiles/mcrl2transform.dir/mcrl2transform.cpp.o"
+  "CMakeFiles/mcrl2transform.dir/mcrl2transform.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mcrl2transform.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
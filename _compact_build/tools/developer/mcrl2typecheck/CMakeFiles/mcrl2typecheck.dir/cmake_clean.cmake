@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/mcrl2typecheck"
+  "../../../stage/bin/mcrl2typecheck.pdb"
+  "CMakeFiles/mcrl2typecheck.dir/mcrl2typecheck.cpp.o"
+  "CMakeFiles/mcrl2typecheck.dir/mcrl2typecheck.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mcrl2typecheck.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
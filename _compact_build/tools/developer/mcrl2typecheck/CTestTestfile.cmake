@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tools/developer/mcrl2typecheck
+# Build directory: /root/repo/_compact_build/tools/developer/mcrl2typecheck
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/pbes2bdd"
+  "../../../stage/bin/pbes2bdd.pdb"
+  "CMakeFiles/pbes2bdd.dir/pbes2bdd.cpp.o"
+  "CMakeFiles/pbes2bdd.dir/pbes2bdd.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pbes2bdd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
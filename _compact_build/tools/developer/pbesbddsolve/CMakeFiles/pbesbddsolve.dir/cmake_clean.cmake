@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/pbesbddsolve"
+  "../../../stage/bin/pbesbddsolve.pdb"
+  "CMakeFiles/pbesbddsolve.dir/pbesbddsolve.cpp.o"
+  "CMakeFiles/pbesbddsolve.dir/pbesbddsolve.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pbesbddsolve.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/pbestransform"
+  "../../../stage/bin/pbestransform.pdb"
+  "CMakeFiles/pbestransform.dir/pbestransform.cpp.o"
+  "CMakeFiles/pbestransform.dir/pbestransform.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pbestransform.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/reduce_pbes"
+  "../../../stage/bin/reduce_pbes.pdb"
+  "CMakeFiles/reduce_pbes.dir/reduce_pbes.cpp.o"
+  "CMakeFiles/reduce_pbes.dir/reduce_pbes.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/reduce_pbes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
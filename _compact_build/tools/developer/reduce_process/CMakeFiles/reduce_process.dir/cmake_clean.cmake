@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/reduce_process"
+  "../../../stage/bin/reduce_process.pdb"
+  "CMakeFiles/reduce_process.dir/reduce_process.cpp.o"
+  "CMakeFiles/reduce_process.dir/reduce_process.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/reduce_process.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,60 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tools/release
+# Build directory: /root/repo/_compact_build/tools/release
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("besinfo")
+subdirs("bespp")
+subdirs("diagraphica")
+subdirs("lps2lts")
+subdirs("lps2pbes")
+subdirs("lpsactionrename")
+subdirs("lpsbinary")
+subdirs("lpsconfcheck")
+subdirs("lpsconstelm")
+subdirs("lpsinfo")
+subdirs("lpsinvelm")
+subdirs("lpsparelm")
+subdirs("lpsparunfold")
+subdirs("lpspp")
+subdirs("lpsrewr")
+subdirs("lpssim")
+subdirs("lpsstategraph")
+subdirs("lpssumelm")
+subdirs("lpssuminst")
+subdirs("lpsuntime")
+subdirs("lpsxsim")
+subdirs("lts2lps")
+subdirs("lts2pbes")
+subdirs("ltscompare")
+subdirs("ltsconvert")
+subdirs("ltsgraph")
+subdirs("ltsinfo")
+subdirs("ltspbisim")
+subdirs("ltspcompare")
+subdirs("ltsview")
+subdirs("mcrl2-gui")
+subdirs("mcrl22lps")
+subdirs("mcrl2i")
+subdirs("mcrl2ide")
+subdirs("mcrl2xi")
+subdirs("pbes2bes")
+subdirs("pbes2bool")
+subdirs("pbesconstelm")
+subdirs("pbesinfo")
+subdirs("pbesparelm")
+subdirs("pbespgsolve")
+subdirs("pbespp")
+subdirs("pbesrewr")
+subdirs("pbessolve")
+subdirs("pbesstategraph")
+subdirs("tracepp")
+subdirs("txt2lps")
+subdirs("txt2pbes")
+subdirs("bessolve")
+subdirs("txt2bes")
+subdirs("pbesinst")
+subdirs("lpsbisim2pbes")
+subdirs("lpsreach")
+subdirs("pbessolvesymbolic")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/besinfo"
+  "../../../stage/bin/besinfo.pdb"
+  "CMakeFiles/besinfo.dir/besinfo.cpp.o"
+  "CMakeFiles/besinfo.dir/besinfo.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/besinfo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
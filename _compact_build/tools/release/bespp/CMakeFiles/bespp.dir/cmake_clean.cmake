@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/bespp"
+  "../../../stage/bin/bespp.pdb"
+  "CMakeFiles/bespp.dir/bespp.cpp.o"
+  "CMakeFiles/bespp.dir/bespp.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bespp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
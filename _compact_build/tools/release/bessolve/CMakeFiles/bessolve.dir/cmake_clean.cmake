@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/bessolve"
+  "../../../stage/bin/bessolve.pdb"
+  "CMakeFiles/bessolve.dir/bessolve.cpp.o"
+  "CMakeFiles/bessolve.dir/bessolve.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bessolve.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,103 @@
+# Install script for directory: /root/repo/tools/release
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Release")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for each subdirectory.
+  include("/root/repo/_compact_build/tools/release/besinfo/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/bespp/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/diagraphica/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/lps2lts/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/lps2pbes/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/lpsactionrename/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/lpsbinary/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/lpsconfcheck/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/lpsconstelm/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/lpsinfo/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/lpsinvelm/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/lpsparelm/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/lpsparunfold/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/lpspp/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/lpsrewr/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/lpssim/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/lpsstategraph/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/lpssumelm/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/lpssuminst/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/lpsuntime/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/lpsxsim/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/lts2lps/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/lts2pbes/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/ltscompare/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/ltsconvert/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/ltsgraph/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/ltsinfo/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/ltspbisim/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/ltspcompare/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/ltsview/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/mcrl2-gui/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/mcrl22lps/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/mcrl2i/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/mcrl2ide/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/mcrl2xi/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/pbes2bes/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/pbes2bool/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/pbesconstelm/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/pbesinfo/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/pbesparelm/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/pbespgsolve/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/pbespp/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/pbesrewr/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/pbessolve/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/pbesstategraph/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/tracepp/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/txt2lps/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/txt2pbes/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/bessolve/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/txt2bes/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/pbesinst/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/lpsbisim2pbes/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/lpsreach/cmake_install.cmake")
+  include("/root/repo/_compact_build/tools/release/pbessolvesymbolic/cmake_install.cmake")
+
+endif()
+
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/lps2lts"
+  "../../../stage/bin/lps2lts.pdb"
+  "CMakeFiles/lps2lts.dir/lps2lts.cpp.o"
+  "CMakeFiles/lps2lts.dir/lps2lts.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lps2lts.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
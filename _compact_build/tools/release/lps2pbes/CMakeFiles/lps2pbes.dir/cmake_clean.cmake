@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/lps2pbes"
+  "../../../stage/bin/lps2pbes.pdb"
+  "CMakeFiles/lps2pbes.dir/lps2pbes.cpp.o"
+  "CMakeFiles/lps2pbes.dir/lps2pbes.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lps2pbes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
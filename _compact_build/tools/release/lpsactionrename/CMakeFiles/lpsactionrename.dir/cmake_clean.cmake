@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/lpsactionrename"
+  "../../../stage/bin/lpsactionrename.pdb"
+  "CMakeFiles/lpsactionrename.dir/lpsactionrename.cpp.o"
+  "CMakeFiles/lpsactionrename.dir/lpsactionrename.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lpsactionrename.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/lpsbinary"
+  "../../../stage/bin/lpsbinary.pdb"
+  "CMakeFiles/lpsbinary.dir/lpsbinary.cpp.o"
+  "CMakeFiles/lpsbinary.dir/lpsbinary.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lpsbinary.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/lpsbisim2pbes"
+  "../../../stage/bin/lpsbisim2pbes.pdb"
+  "CMakeFiles/lpsbisim2pbes.dir/lpsbisim2pbes.cpp.o"
+  "CMakeFiles/lpsbisim2pbes.dir/lpsbisim2pbes.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lpsbisim2pbes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/lpsconfcheck"
+  "../../../stage/bin/lpsconfcheck.pdb"
+  "CMakeFiles/lpsconfcheck.dir/lpsconfcheck.cpp.o"
+  "CMakeFiles/lpsconfcheck.dir/lpsconfcheck.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lpsconfcheck.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/lpsconstelm"
+  "../../../stage/bin/lpsconstelm.pdb"
+  "CMakeFiles/lpsconstelm.dir/lpsconstelm.cpp.o"
+  "CMakeFiles/lpsconstelm.dir/lpsconstelm.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lpsconstelm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/lpsinfo"
+  "../../../stage/bin/lpsinfo.pdb"
+  "CMakeFiles/lpsinfo.dir/lpsinfo.cpp.o"
+  "CMakeFiles/lpsinfo.dir/lpsinfo.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lpsinfo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/lpsinvelm"
+  "../../../stage/bin/lpsinvelm.pdb"
+  "CMakeFiles/lpsinvelm.dir/lpsinvelm.cpp.o"
+  "CMakeFiles/lpsinvelm.dir/lpsinvelm.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lpsinvelm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
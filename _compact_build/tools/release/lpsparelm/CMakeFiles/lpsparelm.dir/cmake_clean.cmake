@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/lpsparelm"
+  "../../../stage/bin/lpsparelm.pdb"
+  "CMakeFiles/lpsparelm.dir/lpsparelm.cpp.o"
+  "CMakeFiles/lpsparelm.dir/lpsparelm.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lpsparelm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
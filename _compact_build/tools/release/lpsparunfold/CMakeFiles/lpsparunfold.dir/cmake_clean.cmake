@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/lpsparunfold"
+  "../../../stage/bin/lpsparunfold.pdb"
+  "CMakeFiles/lpsparunfold.dir/lpsparunfold.cpp.o"
+  "CMakeFiles/lpsparunfold.dir/lpsparunfold.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lpsparunfold.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
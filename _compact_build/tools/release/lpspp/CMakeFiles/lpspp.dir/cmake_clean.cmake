@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/lpspp"
+  "../../../stage/bin/lpspp.pdb"
+  "CMakeFiles/lpspp.dir/lpspp.cpp.o"
+  "CMakeFiles/lpspp.dir/lpspp.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lpspp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
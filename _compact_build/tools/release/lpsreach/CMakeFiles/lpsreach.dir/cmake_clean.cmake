@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/lpsreach"
+  "../../../stage/bin/lpsreach.pdb"
+  "CMakeFiles/lpsreach.dir/lpsreach.cpp.o"
+  "CMakeFiles/lpsreach.dir/lpsreach.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lpsreach.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/lpsrewr"
+  "../../../stage/bin/lpsrewr.pdb"
+  "CMakeFiles/lpsrewr.dir/lpsrewr.cpp.o"
+  "CMakeFiles/lpsrewr.dir/lpsrewr.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lpsrewr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
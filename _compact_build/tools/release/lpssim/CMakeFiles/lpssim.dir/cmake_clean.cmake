@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/lpssim"
+  "../../../stage/bin/lpssim.pdb"
+  "CMakeFiles/lpssim.dir/lpssim.cpp.o"
+  "CMakeFiles/lpssim.dir/lpssim.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lpssim.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
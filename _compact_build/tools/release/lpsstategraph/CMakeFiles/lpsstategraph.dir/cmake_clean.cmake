@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/lpsstategraph"
+  "../../../stage/bin/lpsstategraph.pdb"
+  "CMakeFiles/lpsstategraph.dir/lpsstategraph.cpp.o"
+  "CMakeFiles/lpsstategraph.dir/lpsstategraph.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lpsstategraph.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
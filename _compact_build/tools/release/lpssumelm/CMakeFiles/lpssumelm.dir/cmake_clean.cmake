@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/lpssumelm"
+  "../../../stage/bin/lpssumelm.pdb"
+  "CMakeFiles/lpssumelm.dir/lpssumelm.cpp.o"
+  "CMakeFiles/lpssumelm.dir/lpssumelm.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lpssumelm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/lpssuminst"
+  "../../../stage/bin/lpssuminst.pdb"
+  "CMakeFiles/lpssuminst.dir/lpssuminst.cpp.o"
+  "CMakeFiles/lpssuminst.dir/lpssuminst.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lpssuminst.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/lpsuntime"
+  "../../../stage/bin/lpsuntime.pdb"
+  "CMakeFiles/lpsuntime.dir/lpsuntime.cpp.o"
+  "CMakeFiles/lpsuntime.dir/lpsuntime.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lpsuntime.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
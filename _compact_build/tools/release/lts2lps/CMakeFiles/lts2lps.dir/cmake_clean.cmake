@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/lts2lps"
+  "../../../stage/bin/lts2lps.pdb"
+  "CMakeFiles/lts2lps.dir/lts2lps.cpp.o"
+  "CMakeFiles/lts2lps.dir/lts2lps.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lts2lps.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
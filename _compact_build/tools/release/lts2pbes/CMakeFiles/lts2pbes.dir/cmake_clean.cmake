@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/lts2pbes"
+  "../../../stage/bin/lts2pbes.pdb"
+  "CMakeFiles/lts2pbes.dir/lts2pbes.cpp.o"
+  "CMakeFiles/lts2pbes.dir/lts2pbes.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lts2pbes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/ltscompare"
+  "../../../stage/bin/ltscompare.pdb"
+  "CMakeFiles/ltscompare.dir/ltscompare.cpp.o"
+  "CMakeFiles/ltscompare.dir/ltscompare.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ltscompare.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
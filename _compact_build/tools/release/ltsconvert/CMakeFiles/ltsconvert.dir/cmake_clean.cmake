@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/ltsconvert"
+  "../../../stage/bin/ltsconvert.pdb"
+  "CMakeFiles/ltsconvert.dir/ltsconvert.cpp.o"
+  "CMakeFiles/ltsconvert.dir/ltsconvert.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ltsconvert.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/ltsinfo"
+  "../../../stage/bin/ltsinfo.pdb"
+  "CMakeFiles/ltsinfo.dir/ltsinfo.cpp.o"
+  "CMakeFiles/ltsinfo.dir/ltsinfo.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ltsinfo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/ltspbisim"
+  "../../../stage/bin/ltspbisim.pdb"
+  "CMakeFiles/ltspbisim.dir/ltspbisim.cpp.o"
+  "CMakeFiles/ltspbisim.dir/ltspbisim.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ltspbisim.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
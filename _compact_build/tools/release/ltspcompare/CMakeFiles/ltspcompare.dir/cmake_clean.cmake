@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/ltspcompare"
+  "../../../stage/bin/ltspcompare.pdb"
+  "CMakeFiles/ltspcompare.dir/ltspcompare.cpp.o"
+  "CMakeFiles/ltspcompare.dir/ltspcompare.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ltspcompare.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
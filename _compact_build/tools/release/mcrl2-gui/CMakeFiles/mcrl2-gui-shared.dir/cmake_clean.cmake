@@ -0,0 +1,5 @@
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/mcrl2-gui-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/mcrl22lps"
+  "../../../stage/bin/mcrl22lps.pdb"
+  "CMakeFiles/mcrl22lps.dir/mcrl22lps.cpp.o"
+  "CMakeFiles/mcrl22lps.dir/mcrl22lps.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mcrl22lps.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
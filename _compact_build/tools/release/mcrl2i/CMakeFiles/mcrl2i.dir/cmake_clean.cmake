@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/mcrl2i"
+  "../../../stage/bin/mcrl2i.pdb"
+  "CMakeFiles/mcrl2i.dir/mcrl2i.cpp.o"
+  "CMakeFiles/mcrl2i.dir/mcrl2i.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mcrl2i.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
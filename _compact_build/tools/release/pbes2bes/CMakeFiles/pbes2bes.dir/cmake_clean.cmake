@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/pbes2bes"
+  "../../../stage/bin/pbes2bes.pdb"
+  "CMakeFiles/pbes2bes.dir/pbes2bes.cpp.o"
+  "CMakeFiles/pbes2bes.dir/pbes2bes.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pbes2bes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
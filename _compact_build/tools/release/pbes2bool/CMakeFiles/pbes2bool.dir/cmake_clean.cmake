@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/pbes2bool"
+  "../../../stage/bin/pbes2bool.pdb"
+  "CMakeFiles/pbes2bool.dir/pbes2bool.cpp.o"
+  "CMakeFiles/pbes2bool.dir/pbes2bool.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pbes2bool.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
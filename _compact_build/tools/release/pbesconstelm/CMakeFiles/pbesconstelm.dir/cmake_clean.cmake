@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/pbesconstelm"
+  "../../../stage/bin/pbesconstelm.pdb"
+  "CMakeFiles/pbesconstelm.dir/pbesconstelm.cpp.o"
+  "CMakeFiles/pbesconstelm.dir/pbesconstelm.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pbesconstelm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
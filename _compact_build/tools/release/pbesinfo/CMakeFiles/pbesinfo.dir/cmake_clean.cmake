@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/pbesinfo"
+  "../../../stage/bin/pbesinfo.pdb"
+  "CMakeFiles/pbesinfo.dir/pbesinfo.cpp.o"
+  "CMakeFiles/pbesinfo.dir/pbesinfo.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pbesinfo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
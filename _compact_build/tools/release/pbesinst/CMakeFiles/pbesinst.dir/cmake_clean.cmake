@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/pbesinst"
+  "../../../stage/bin/pbesinst.pdb"
+  "CMakeFiles/pbesinst.dir/pbesinst.cpp.o"
+  "CMakeFiles/pbesinst.dir/pbesinst.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pbesinst.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/pbesparelm"
+  "../../../stage/bin/pbesparelm.pdb"
+  "CMakeFiles/pbesparelm.dir/pbesparelm.cpp.o"
+  "CMakeFiles/pbesparelm.dir/pbesparelm.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pbesparelm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
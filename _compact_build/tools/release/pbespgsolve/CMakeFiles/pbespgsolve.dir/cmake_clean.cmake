@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/pbespgsolve"
+  "../../../stage/bin/pbespgsolve.pdb"
+  "CMakeFiles/pbespgsolve.dir/pbespgsolve.cpp.o"
+  "CMakeFiles/pbespgsolve.dir/pbespgsolve.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pbespgsolve.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
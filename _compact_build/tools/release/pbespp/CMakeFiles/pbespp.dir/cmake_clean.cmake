@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/pbespp"
+  "../../../stage/bin/pbespp.pdb"
+  "CMakeFiles/pbespp.dir/pbespp.cpp.o"
+  "CMakeFiles/pbespp.dir/pbespp.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pbespp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/pbesrewr"
+  "../../../stage/bin/pbesrewr.pdb"
+  "CMakeFiles/pbesrewr.dir/pbesrewr.cpp.o"
+  "CMakeFiles/pbesrewr.dir/pbesrewr.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pbesrewr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
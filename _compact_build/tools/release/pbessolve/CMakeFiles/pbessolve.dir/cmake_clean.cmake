@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/pbessolve"
+  "../../../stage/bin/pbessolve.pdb"
+  "CMakeFiles/pbessolve.dir/pbessolve.cpp.o"
+  "CMakeFiles/pbessolve.dir/pbessolve.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pbessolve.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
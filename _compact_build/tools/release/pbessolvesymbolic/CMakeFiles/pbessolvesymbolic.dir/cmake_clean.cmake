@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/pbessolvesymbolic"
+  "../../../stage/bin/pbessolvesymbolic.pdb"
+  "CMakeFiles/pbessolvesymbolic.dir/pbessolvesymbolic.cpp.o"
+  "CMakeFiles/pbessolvesymbolic.dir/pbessolvesymbolic.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pbessolvesymbolic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
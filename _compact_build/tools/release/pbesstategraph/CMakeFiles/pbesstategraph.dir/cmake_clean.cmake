@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/pbesstategraph"
+  "../../../stage/bin/pbesstategraph.pdb"
+  "CMakeFiles/pbesstategraph.dir/pbesstategraph.cpp.o"
+  "CMakeFiles/pbesstategraph.dir/pbesstategraph.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pbesstategraph.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
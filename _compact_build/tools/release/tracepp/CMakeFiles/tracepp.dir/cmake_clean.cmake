@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/tracepp"
+  "../../../stage/bin/tracepp.pdb"
+  "CMakeFiles/tracepp.dir/tracepp.cpp.o"
+  "CMakeFiles/tracepp.dir/tracepp.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tracepp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/txt2bes"
+  "../../../stage/bin/txt2bes.pdb"
+  "CMakeFiles/txt2bes.dir/txt2bes.cpp.o"
+  "CMakeFiles/txt2bes.dir/txt2bes.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/txt2bes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/txt2lps"
+  "../../../stage/bin/txt2lps.pdb"
+  "CMakeFiles/txt2lps.dir/txt2lps.cpp.o"
+  "CMakeFiles/txt2lps.dir/txt2lps.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/txt2lps.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
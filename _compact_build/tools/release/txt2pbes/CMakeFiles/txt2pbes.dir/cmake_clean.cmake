@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../stage/bin/txt2pbes"
+  "../../../stage/bin/txt2pbes.pdb"
+  "CMakeFiles/txt2pbes.dir/txt2pbes.cpp.o"
+  "CMakeFiles/txt2pbes.dir/txt2pbes.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/txt2pbes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -48,6 +48,10 @@ if(MCRL2_ENABLE_MULTITHREADING)
   add_definitions(-DMCRL2_THREAD_SAFE)
 endif()
 
+if(MCRL2_ENABLE_COMPACT_TERMS)
+  add_definitions(-DMCRL2_ATERMPP_COMPACT_TERMS)
+endif()
+
 # Enable C++17 for all targets.
 set(CMAKE_CXX_STANDARD 17)
 set(CMAKE_CXX_STANDARD_REQUIRED true)
@@ -0,0 +1,53 @@
+// Author(s): Maurice Laveaux
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include "benchmark_shared.h"
+
+#include "mcrl2/utilities/block_allocator.h"
+
+using namespace atermpp;
+
+int main(int argc, char* argv[])
+{
+  std::size_t number_of_threads = 1;
+
+  // Accept one argument for the number of threads.
+  if (argc > 1)
+  {
+    number_of_threads = static_cast<std::size_t>(std::stoi(argv[1]));
+  }
+
+  // The thread-safe allocator of the size of a term with two arguments.
+  mcrl2::utilities::block_allocator<std::array<std::size_t, 3>, 1024, true> allocator;
+
+  std::size_t rounds = 10000;
+  std::size_t size = 1000;
+
+  // Define a function that repeatedly allocates a number of elements and frees them again.
+  auto allocate_function = [&](int) -> void
+    {
+      std::vector<std::array<std::size_t, 3>*> elements(size);
+      for (std::size_t i = 0; i < rounds; ++i)
+      {
+        for (auto& element : elements)
+        {
+          element = allocator.allocate(1);
+        }
+
+        for (auto& element : elements)
+        {
+          allocator.deallocate(element, 1);
+        }
+      }
+    };
+
+  benchmark_threads(number_of_threads, allocate_function);
+
+  return 0;
+}
@@ -31,7 +31,7 @@ class unprotected_aterm
   friend detail::_aterm* detail::address(const unprotected_aterm& t);
 
 protected:
-  const detail::_aterm* m_term;
+  detail::_aterm_pointer m_term;
 
 public:
 
@@ -363,7 +363,7 @@ namespace detail
   /// \returns A pointer to the underlying aterm.
   inline _aterm* address(const unprotected_aterm& t)
   {
-    return const_cast<_aterm*>(t.m_term);
+    return const_cast<_aterm*>(static_cast<const _aterm*>(t.m_term));
   }
 }
 
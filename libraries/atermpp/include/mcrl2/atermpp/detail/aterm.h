@@ -86,14 +86,16 @@ private:
   function_symbol m_function_symbol;
 };
 
-inline _aterm* address(const unprotected_aterm& t);
-
-#ifdef MCRL2_ATERMPP_REFERENCE_COUNTED
-const std::size_t offset = 2;
+/// \brief The reference to a term that is stored in an unprotected_aterm. When MCRL2_ATERMPP_COMPACT_TERMS
+///        is defined this is a 32-bit offset in the term arena instead of a pointer.
+#ifdef MCRL2_ATERMPP_COMPACT_TERMS
+using _aterm_pointer = compact_pointer<const _aterm>;
 #else
-const std::size_t offset = 2;
+using _aterm_pointer = const _aterm*;
 #endif
 
+inline _aterm* address(const unprotected_aterm& t);
+
 inline void debug_print(std::ostream& out, const _aterm* t, const std::size_t d)
 {
   if (d==0) { out << "..."; return; }
@@ -105,7 +107,8 @@ inline void debug_print(std::ostream& out, const _aterm* t, const std::size_t d)
   for(std::size_t i=0; i< t->function().arity() ; ++i)
   {
     out << separator;
-    debug_print(out, *((reinterpret_cast<_aterm *const*>(t))+offset+i),d-1);
+    // The arguments are stored directly after the header of the term.
+    debug_print(out, reinterpret_cast<const _aterm_pointer*>(reinterpret_cast<const char*>(t) + sizeof(_aterm))[i], d-1);
     separator = ",";
   }
   if (t->function().arity()>0)
@@ -184,7 +184,11 @@ public:
   constexpr bool has_free_slots() const noexcept { return false; }
 
 private:
+#ifdef MCRL2_ATERMPP_COMPACT_TERMS
+  term_arena_allocator<char> m_packed_allocator;
+#else
   std::allocator<char> m_packed_allocator;
+#endif
 };
 
 static_assert(sizeof(_term_appl) == sizeof(_aterm) + sizeof(aterm), "Sanity check: aterm_appl size");
@@ -47,6 +47,11 @@ constexpr static bool EnableVariableRegistrationMetrics = false;
 ///          Outcomment to enable the protection set approach to protect aterms. 
 // #define MCRL2_ATERMPP_REFERENCE_COUNTED
 
+/// \brief Refer to terms and function symbols by 32-bit offsets in the term arena instead of pointers.
+/// \details This macro is defined by the CMake option MCRL2_ENABLE_COMPACT_TERMS, as the compiling rewriter
+///          must use the same representation. See term_arena.h.
+// #define MCRL2_ATERMPP_COMPACT_TERMS
+
 } // namespace detail
 } // namespace atermpp
 
@@ -36,7 +36,8 @@ private:
   std::size_t m_value;
 };
 
-static_assert(sizeof(_aterm_int) == sizeof(_aterm) + sizeof(std::size_t), "Sanity check: _aterm_int size");
+// A compact header is padded up to the alignment of the value.
+static_assert(sizeof(_aterm_int) == std::max(sizeof(_aterm), alignof(std::size_t)) + sizeof(std::size_t), "Sanity check: _aterm_int size");
 
 } // namespace detail 
 
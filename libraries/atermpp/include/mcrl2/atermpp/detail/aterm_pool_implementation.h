@@ -412,22 +412,22 @@ void aterm_pool::resize_if_needed(thread_aterm_pool_interface* thread)
   auto timestamp = std::chrono::system_clock::now();
   std::size_t old_capacity = capacity();
 
-  // Attempt to resize all storages.
+  // Attempt to resize all storages. Each storage resizes at most one of its shards.
   m_function_symbol_pool.resize_if_needed();
 
-  m_int_storage.resize_if_needed();
-  std::get<0>(m_appl_storage).resize_if_needed();
-  std::get<1>(m_appl_storage).resize_if_needed();
-  std::get<2>(m_appl_storage).resize_if_needed();
-  std::get<3>(m_appl_storage).resize_if_needed();
-  std::get<4>(m_appl_storage).resize_if_needed();
-  std::get<5>(m_appl_storage).resize_if_needed();
-  std::get<6>(m_appl_storage).resize_if_needed();
-  std::get<7>(m_appl_storage).resize_if_needed();
-  m_appl_dynamic_storage.resize_if_needed();
-
-  // Attempt to resize ever so often.
-  m_count_until_resize = 10000;
+  bool pending = m_int_storage.resize_if_needed();
+  pending = std::get<0>(m_appl_storage).resize_if_needed() || pending;
+  pending = std::get<1>(m_appl_storage).resize_if_needed() || pending;
+  pending = std::get<2>(m_appl_storage).resize_if_needed() || pending;
+  pending = std::get<3>(m_appl_storage).resize_if_needed() || pending;
+  pending = std::get<4>(m_appl_storage).resize_if_needed() || pending;
+  pending = std::get<5>(m_appl_storage).resize_if_needed() || pending;
+  pending = std::get<6>(m_appl_storage).resize_if_needed() || pending;
+  pending = std::get<7>(m_appl_storage).resize_if_needed() || pending;
+  pending = m_appl_dynamic_storage.resize_if_needed() || pending;
+
+  // Attempt to resize ever so often, and sooner when shards are still waiting to be resized.
+  m_count_until_resize = pending ? 1000 : 10000;
 
   if (EnableGarbageCollectionMetrics && old_capacity != capacity())
   {
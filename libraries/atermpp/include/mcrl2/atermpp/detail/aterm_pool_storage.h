@@ -14,6 +14,7 @@
 #include "mcrl2/utilities/cache_metric.h"
 #include "mcrl2/utilities/unordered_set.h"
 
+#include <array>
 #include <stack>
 #include <utility>
 
@@ -28,9 +29,37 @@ class aterm_pool;
 /// \brief Marks a term and recursively all arguments that are not reachable.
 inline void mark_term(const _aterm& root, std::stack<std::reference_wrapper<_aterm>>& todo);
 
+/// \brief The hash function of the terms within a shard. The ShardBits bits of the hash starting at bit
+///        ShardOffset determine the shard, and the remaining bits the bucket within the shard.
+template<typename Hash, std::size_t ShardOffset, std::size_t ShardBits>
+struct aterm_shard_hasher : public Hash
+{
+  using is_transparent = void;
+
+  /// \returns The index of the shard of a term with the given hash.
+  static std::size_t shard(std::size_t hash) noexcept
+  {
+    return (hash >> ShardOffset) & ((std::size_t(1) << ShardBits) - 1);
+  }
+
+  /// \returns The given hash without the bits that determine the shard.
+  static std::size_t within_shard(std::size_t hash) noexcept
+  {
+    return (hash & ((std::size_t(1) << ShardOffset) - 1)) | ((hash >> (ShardOffset + ShardBits)) << ShardOffset);
+  }
+
+  template<typename ...Args>
+  std::size_t operator()(const Args&... args) const noexcept
+  {
+    return within_shard(Hash::operator()(args...));
+  }
+};
+
 /// \brief This class provides for all types of term storage. It also
 ///       provides garbage collection via its mark and sweep functions.
-/// \details Internally a hash set is used to ensure that the created terms are unique.
+/// \details Internally a hash set is used to ensure that the created terms are unique. This set is split into
+///          a number of shards on the hash of the terms, which are resized independently. This way a resize only
+///          rehashes a single shard while the other threads are halted, instead of all terms of this storage.
 template<typename Element,
          typename Hash = aterm_hasher<>,
          typename Equals = aterm_equals<>,
@@ -38,13 +67,29 @@ template<typename Element,
 class aterm_pool_storage : private mcrl2::utilities::noncopyable
 {
 public:
+  /// \brief The terms are stored in 2^ShardBits shards. The shard is not determined by the lowest bits of
+  ///        the hash, such that terms that are created one after the other, which often have consecutive
+  ///        hashes, end up in consecutive buckets of the same shard.
+  static constexpr std::size_t ShardOffset = 10;
+  static constexpr std::size_t ShardBits = 4;
+  static constexpr std::size_t NumberOfShards = 1 << ShardBits;
+
+  /// \brief The allocator for terms with a fixed number of arguments. Compact terms must reside in the term arena.
+#ifdef MCRL2_ATERMPP_COMPACT_TERMS
+  using term_allocator = term_arena_allocator<Element>;
+#else
+  using term_allocator = typename std::conditional<EnableBlockAllocator,
+                                                   mcrl2::utilities::block_allocator<Element, 1024, GlobalThreadSafe>,
+                                                   std::allocator<Element>>::type;
+#endif
+
   using unordered_set = mcrl2::utilities::unordered_set<
     Element,
-    Hash,
+    aterm_shard_hasher<Hash, ShardOffset, ShardBits>,
     Equals,
     typename std::conditional<N == DynamicNumberOfArguments,
       atermpp::detail::_aterm_appl_allocator<>,
-      typename std::conditional<EnableBlockAllocator, mcrl2::utilities::block_allocator<Element, 1024, GlobalThreadSafe>, std::allocator<Element>>::type
+      term_allocator
       >::type,
     GlobalThreadSafe,
     false>;
@@ -60,7 +105,7 @@ public:
   void add_deletion_hook(function_symbol sym, term_callback callback);
 
   /// \returns The total number of terms that can be stored without resizing.
-  std::size_t capacity() const noexcept { return m_term_set.capacity(); }
+  std::size_t capacity() const noexcept;
 
   /// \brief Creates a integral term with the given value.
   bool create_int(aterm& term, std::size_t value);
@@ -155,16 +200,17 @@ public:
   ///        mark() was called first.
   void sweep();
 
-  /// \brief Resizes the hash table if necessary.
-  void resize_if_needed();
+  /// \brief Resizes the shard with the highest load factor, if it exceeds the maximum load factor.
+  /// \returns True iff another shard must be resized as well.
+  bool resize_if_needed();
 
   /// \returns The number of terms stored in this storage.
-  std::size_t size() const { return m_term_set.size(); }
+  std::size_t size() const;
 
   /// \brief A fake copy constructor to fix the issues with GCC 4 and 5.
   aterm_pool_storage(const aterm_pool_storage& other) :
     m_pool(other.m_pool),
-    m_term_set(std::move(other.m_term_set))
+    m_term_sets(std::move(other.m_term_sets))
   {}
 
   /// \brief Check that all arguments of a term application are marked properly.
@@ -180,8 +226,14 @@ private:
   /// \threadsafe
   void call_deletion_hook(unprotected_aterm term);
 
-  /// \brief Removes an element from the unordered set and deallocates it.
-  iterator destroy(iterator it);
+  /// \brief Removes an element from the given shard and deallocates it.
+  iterator destroy(unordered_set& term_set, iterator it);
+
+  /// \returns The shard that stores the terms with the given hash.
+  unordered_set& shard(std::size_t hash)
+  {
+    return m_term_sets[unordered_set::hasher::shard(hash)];
+  }
 
   /// \brief Inserts a term constructed by the given arguments, checks for existing term.
   template<typename ...Args>
@@ -198,8 +250,11 @@ private:
   /// The pool that this storage belongs to.
   aterm_pool& m_pool;
 
-  /// This is the set of term pointers to keep the terms unique.
-  unordered_set m_term_set;
+  /// The hash function that determines the shard of a term.
+  Hash m_hash;
+
+  /// These are the shards of the set of term pointers to keep the terms unique.
+  std::array<unordered_set, NumberOfShards> m_term_sets;
 
   /// This array stores creation, resp deletion, hooks for function symbols.
   // std::vector<callback_pair> m_creation_hooks; Not needed anymore. 
@@ -123,9 +123,13 @@ void mark_term(const _aterm& root, std::stack<std::reference_wrapper<_aterm>>& t
 
 ATERM_POOL_STORAGE_TEMPLATES
 ATERM_POOL_STORAGE::aterm_pool_storage(aterm_pool& pool) :
-  m_pool(pool),
-  m_term_set(1 << 14)
-{}
+  m_pool(pool)
+{
+  for (unordered_set& term_set : m_term_sets)
+  {
+    term_set.rehash((1 << 14) / NumberOfShards);
+  }
+}
 
 ATERM_POOL_STORAGE_TEMPLATES
 void ATERM_POOL_STORAGE::add_deletion_hook(function_symbol sym, term_callback callback)
@@ -138,6 +142,28 @@ void ATERM_POOL_STORAGE::add_deletion_hook(function_symbol sym, term_callback ca
   m_deletion_hooks.emplace_back(sym, callback);
 }
 
+ATERM_POOL_STORAGE_TEMPLATES
+std::size_t ATERM_POOL_STORAGE::capacity() const noexcept
+{
+  std::size_t result = 0;
+  for (const unordered_set& term_set : m_term_sets)
+  {
+    result += term_set.capacity();
+  }
+  return result;
+}
+
+ATERM_POOL_STORAGE_TEMPLATES
+std::size_t ATERM_POOL_STORAGE::size() const
+{
+  std::size_t result = 0;
+  for (const unordered_set& term_set : m_term_sets)
+  {
+    result += term_set.size();
+  }
+  return result;
+}
+
 ATERM_POOL_STORAGE_TEMPLATES
 bool ATERM_POOL_STORAGE::create_int(aterm& term, std::size_t value)
 {
@@ -340,8 +366,11 @@ void ATERM_POOL_STORAGE::print_performance_stats(const char* identifier) const
 {
   if (EnableHashtableMetrics)
   {
-    mCRL2log(mcrl2::log::info, "Performance") << "g_term_pool(" << identifier << ") hashtable:\n";
-    print_performance_statistics(m_term_set);
+    for (std::size_t i = 0; i < NumberOfShards; ++i)
+    {
+      mCRL2log(mcrl2::log::info, "Performance") << "g_term_pool(" << identifier << ") hashtable shard " << i << ":\n";
+      print_performance_statistics(m_term_sets[i]);
+    }
   }
 
   if (EnableGarbageCollectionMetrics && m_erasedBlocks > 0)
@@ -360,27 +389,29 @@ void ATERM_POOL_STORAGE::print_performance_stats(const char* identifier) const
 ATERM_POOL_STORAGE_TEMPLATES
 void ATERM_POOL_STORAGE::mark()
 {
-  for (const Element& term : m_term_set)
+  for (const unordered_set& term_set : m_term_sets)
   {
-    if (term.is_marked())
+    for (const Element& term : term_set)
     {
-      mark_term(term, todo);
-    }
+      if (term.is_marked())
+      {
+        mark_term(term, todo);
+      }
 
-    for (const auto& [symbol, callback] : m_deletion_hooks)
-    {
-      if (symbol == term.function())
+      for (const auto& [symbol, callback] : m_deletion_hooks)
       {
-        // For terms on which deletion hooks are called, ensure that all arguments are marked.
-        const _term_appl& ta = static_cast<_term_appl&>(const_cast<Element&>(term));
-        for (std::size_t i = 0; i < ta.function().arity(); ++i)
+        if (symbol == term.function())
         {
-          _aterm& argument = *detail::address(ta.arg(i));
-          mark_term(argument);
+          // For terms on which deletion hooks are called, ensure that all arguments are marked.
+          const _term_appl& ta = static_cast<_term_appl&>(const_cast<Element&>(term));
+          for (std::size_t i = 0; i < ta.function().arity(); ++i)
+          {
+            _aterm& argument = *detail::address(ta.arg(i));
+            mark_term(argument);
+          }
         }
       }
     }
-
   }
 }
 #endif
@@ -388,35 +419,59 @@ void ATERM_POOL_STORAGE::mark()
 ATERM_POOL_STORAGE_TEMPLATES
 void ATERM_POOL_STORAGE::sweep()
 {
-  // Iterate over all terms and removes the ones that are marked.
-  for (auto it = m_term_set.begin(); it != m_term_set.end(); )
-  {
-    const Element& term = *it;
+  m_erasedBlocks = 0;
 
-    if (!term.is_marked())
+  // Sweep the shards one by one, and remove the terms that are not marked.
+  for (unordered_set& term_set : m_term_sets)
+  {
+    for (auto it = term_set.begin(); it != term_set.end(); )
     {
-      // For constants, i.e., arity zero and integer terms we do not mark, but use their reachability directly. 
-      it = destroy(it);
+      const Element& term = *it;
+
+      if (!term.is_marked())
+      {
+        // For constants, i.e., arity zero and integer terms we do not mark, but use their reachability directly. 
+        it = destroy(term_set, it);
+      }
+      else
+      {
+        // Reset terms that have been marked.
+        term.unmark();
+        ++it;
+      }
     }
-    else
+
+    if constexpr (EnableBlockAllocator)
     {
-      // Reset terms that have been marked.
-      term.unmark();
-      ++it;
+      // Clean up unnecessary blocks.
+      m_erasedBlocks += term_set.get_allocator().consolidate();
     }
   }
-
-  if constexpr (EnableBlockAllocator)
-  {
-    // Clean up unnecessary blocks.
-    m_erasedBlocks = m_term_set.get_allocator().consolidate();
-  }
 }
 
 ATERM_POOL_STORAGE_TEMPLATES
-void ATERM_POOL_STORAGE::resize_if_needed()
+bool ATERM_POOL_STORAGE::resize_if_needed()
 {
-  m_term_set.rehash_if_needed();
+  // Only the fullest shard is rehashed, such that the other threads are halted for a short time only.
+  unordered_set* fullest = nullptr;
+  std::size_t number_of_full_shards = 0;
+  for (unordered_set& term_set : m_term_sets)
+  {
+    if (term_set.load_factor() >= term_set.max_load_factor())
+    {
+      ++number_of_full_shards;
+      if (fullest == nullptr || term_set.load_factor() > fullest->load_factor())
+      {
+        fullest = &term_set;
+      }
+    }
+  }
+
+  if (fullest != nullptr)
+  {
+    fullest->rehash_if_needed();
+  }
+  return number_of_full_shards > 1;
 }
 
 /// PRIVATE FUNCTIONS
@@ -439,15 +494,18 @@ ATERM_POOL_STORAGE_TEMPLATES
 bool ATERM_POOL_STORAGE::verify_mark()
 {
   // Check for consistency that if a term is marked then its arguments are as well.
-  for (const Element& term : m_term_set)
+  for (const unordered_set& term_set : m_term_sets)
   {
-    if (term.is_marked() && term.function().arity() > 0)
+    for (const Element& term : term_set)
     {
-       const _term_appl& ta = static_cast<_term_appl&>(const_cast<Element&>(term));
-       for (std::size_t i = 0; i < ta.function().arity(); ++i)
-       {
-         assert(detail::address(ta.arg(i))->is_marked());
-       }
+      if (term.is_marked() && term.function().arity() > 0)
+      {
+         const _term_appl& ta = static_cast<_term_appl&>(const_cast<Element&>(term));
+         for (std::size_t i = 0; i < ta.function().arity(); ++i)
+         {
+           assert(detail::address(ta.arg(i))->is_marked());
+         }
+      }
     }
   }
   return true;
@@ -457,10 +515,13 @@ ATERM_POOL_STORAGE_TEMPLATES
 bool ATERM_POOL_STORAGE::verify_sweep()
 {
   // Check that no argument was removed from a reachable term.
-  for (const Element& term : m_term_set)
+  for (const unordered_set& term_set : m_term_sets)
   {
-    (void)term;
-    assert(verify_term(term));
+    for (const Element& term : term_set)
+    {
+      (void)term;
+      assert(verify_term(term));
+    }
   }
   return true;
 }
@@ -468,7 +529,7 @@ bool ATERM_POOL_STORAGE::verify_sweep()
 /// Private definitions
 
 ATERM_POOL_STORAGE_TEMPLATES
-typename ATERM_POOL_STORAGE::iterator ATERM_POOL_STORAGE::destroy(iterator it)
+typename ATERM_POOL_STORAGE::iterator ATERM_POOL_STORAGE::destroy(unordered_set& term_set, iterator it)
 {
   // Store the term temporarily to be able to deallocate it after removing it from the set.
   const Element& term = *it;
@@ -477,14 +538,16 @@ typename ATERM_POOL_STORAGE::iterator ATERM_POOL_STORAGE::destroy(iterator it)
   call_deletion_hook(&term);
 
   // Remove them from the hash table, will also destroy terms with fixed arity.
-  return m_term_set.erase(it);
+  return term_set.erase(it);
 }
 
 ATERM_POOL_STORAGE_TEMPLATES
 template<typename ...Args>
 bool ATERM_POOL_STORAGE::emplace(aterm& term, Args&&... args)
 {
-  auto [it, added] = m_term_set.emplace(std::forward<Args>(args)...);
+  // Some bits of the hash determine the shard, and the remaining bits the bucket within that shard.
+  const std::size_t hash = m_hash(args...);
+  auto [it, added] = shard(hash).emplace_hashed(unordered_set::hasher::within_shard(hash), std::forward<Args>(args)...);
 
   // Assign the inserted term.
 #ifdef MCRL2_ATERMPP_REFERENCE_COUNTED
@@ -17,7 +17,7 @@
 
 #include "mcrl2/utilities/noncopyable.h"
 #include "mcrl2/utilities/shared_reference.h"
-#include "mcrl2/atermpp/detail/aterm_configuration.h"
+#include "mcrl2/atermpp/detail/term_arena.h"
 
 
 namespace atermpp
@@ -30,7 +30,11 @@ class _function_symbol : public mcrl2::utilities::shared_reference_counted<_func
 {
 public:
   /// \brief A shared reference for this object.
+#ifdef MCRL2_ATERMPP_COMPACT_TERMS
+  using ref = mcrl2::utilities::shared_reference<const _function_symbol, compact_tagged_pointer<const _function_symbol>>;
+#else
   using ref = mcrl2::utilities::shared_reference<const _function_symbol>;
+#endif
 
   _function_symbol(const std::string& name, std::size_t arity) :
      m_arity(arity),
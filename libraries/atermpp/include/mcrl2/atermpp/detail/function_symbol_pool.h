@@ -71,7 +71,11 @@ private:
     _function_symbol,
     function_symbol_hasher,
     function_symbol_equals,
+#ifdef MCRL2_ATERMPP_COMPACT_TERMS
+    term_arena_allocator<_function_symbol>,
+#else
     mcrl2::utilities::block_allocator<_function_symbol, 1024, GlobalThreadSafe>,
+#endif
     GlobalThreadSafe,
     false>;
 
@@ -0,0 +1,238 @@
+// Author(s): Maurice Laveaux.
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef MCRL2_ATERMPP_DETAIL_TERM_ARENA_H
+#define MCRL2_ATERMPP_DETAIL_TERM_ARENA_H
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "mcrl2/atermpp/detail/aterm_configuration.h"
+
+#ifdef MCRL2_ATERMPP_COMPACT_TERMS
+
+namespace atermpp
+{
+namespace detail
+{
+
+/// \brief The start of the term arena, which is nullptr until the first allocation.
+extern char* g_term_arena_base;
+
+/// \brief A single reserved range of virtual memory in which all terms and function symbols are stored,
+///        such that they can be referred to by a 32-bit offset instead of a pointer.
+/// \details Memory is only committed by the operating system when it is used. Freed blocks are kept in a
+///          free list per size and are reused by allocations of the same size.
+class term_arena
+{
+public:
+  /// \brief All blocks are aligned to, and their sizes are a multiple of, this number of bytes.
+  static constexpr std::size_t Alignment = 8;
+
+  /// \brief Offsets count units of this number of bytes, which leaves the lowest bit of the offset of
+  ///        an aligned block free for a tag. As such 2^32 offsets cover an arena of 16GB.
+  static constexpr std::size_t Unit = 4;
+
+  /// \returns A block of at least size bytes.
+  /// \details Throws std::bad_alloc when the arena is exhausted.
+  /// \threadsafe
+  static void* allocate(std::size_t size);
+
+  /// \brief Returns a block obtained by allocate(size) to the arena.
+  /// \threadsafe
+  static void deallocate(void* block, std::size_t size) noexcept;
+
+  /// \returns The number of bytes of the arena that have been handed out, including the freed blocks.
+  static std::size_t size() noexcept;
+
+  /// \returns The offset of p in the arena, where nullptr has offset zero.
+  static std::uint32_t offset(const void* p) noexcept
+  {
+    if (p == nullptr)
+    {
+      return 0;
+    }
+
+    const std::size_t bytes = static_cast<std::size_t>(static_cast<const char*>(p) - g_term_arena_base);
+    assert(bytes % Unit == 0 && bytes / Unit <= std::numeric_limits<std::uint32_t>::max());
+    return static_cast<std::uint32_t>(bytes / Unit);
+  }
+
+  /// \returns The address at the given offset in the arena.
+  static char* address(std::uint32_t offset) noexcept
+  {
+    return offset == 0 ? nullptr : g_term_arena_base + static_cast<std::size_t>(offset) * Unit;
+  }
+};
+
+/// \brief A pointer to an object in the term arena, which is stored as a 32-bit offset.
+template<typename T>
+class compact_pointer
+{
+public:
+  compact_pointer() noexcept = default;
+
+  compact_pointer(std::nullptr_t) noexcept
+  {}
+
+  compact_pointer(T* p) noexcept
+    : m_offset(term_arena::offset(p))
+  {}
+
+  T* get() const noexcept
+  {
+    return reinterpret_cast<T*>(term_arena::address(m_offset));
+  }
+
+  operator T*() const noexcept
+  {
+    return get();
+  }
+
+  T* operator->() const noexcept
+  {
+    return get();
+  }
+
+  T& operator*() const noexcept
+  {
+    return *get();
+  }
+
+  // The offsets are ordered in the same way as the addresses.
+  bool operator==(const compact_pointer& other) const noexcept { return m_offset == other.m_offset; }
+  bool operator!=(const compact_pointer& other) const noexcept { return m_offset != other.m_offset; }
+  bool operator<(const compact_pointer& other) const noexcept { return m_offset < other.m_offset; }
+  bool operator<=(const compact_pointer& other) const noexcept { return m_offset <= other.m_offset; }
+  bool operator>(const compact_pointer& other) const noexcept { return m_offset > other.m_offset; }
+  bool operator>=(const compact_pointer& other) const noexcept { return m_offset >= other.m_offset; }
+
+  bool operator==(std::nullptr_t) const noexcept { return m_offset == 0; }
+  bool operator!=(std::nullptr_t) const noexcept { return m_offset != 0; }
+
+private:
+  std::uint32_t m_offset = 0;
+};
+
+/// \brief The equivalent of utilities::tagged_pointer for objects in the term arena, which is stored as
+///        a 32-bit offset of which the least significant bit is the tag.
+template<typename T>
+class compact_tagged_pointer
+{
+public:
+  compact_tagged_pointer() noexcept = default;
+
+  explicit compact_tagged_pointer(T* p) noexcept
+    : m_offset(term_arena::offset(p))
+  {}
+
+  /// \returns True iff this pointer has been tagged,
+  bool tagged() const noexcept
+  {
+    return m_offset & 1;
+  }
+
+  /// \brief Apply a tag to the pointer that can be checked with tagged().
+  void tag() const noexcept
+  {
+    m_offset |= 1;
+  }
+
+  /// \brief Remove the tag.
+  void untag() const noexcept
+  {
+    m_offset &= ~static_cast<std::uint32_t>(1);
+  }
+
+  bool defined() const noexcept
+  {
+    return untagged_offset() != 0;
+  }
+
+  void operator=(std::nullptr_t) noexcept
+  {
+    m_offset = 1;
+  }
+
+  bool operator==(std::nullptr_t) const noexcept { return !defined(); }
+  bool operator!=(std::nullptr_t) const noexcept { return defined(); }
+
+  bool operator==(const compact_tagged_pointer& other) const noexcept { return untagged_offset() == other.untagged_offset(); }
+  bool operator!=(const compact_tagged_pointer& other) const noexcept { return untagged_offset() != other.untagged_offset(); }
+  bool operator<(const compact_tagged_pointer& other) const noexcept { return untagged_offset() < other.untagged_offset(); }
+  bool operator<=(const compact_tagged_pointer& other) const noexcept { return untagged_offset() <= other.untagged_offset(); }
+  bool operator>(const compact_tagged_pointer& other) const noexcept { return untagged_offset() > other.untagged_offset(); }
+  bool operator>=(const compact_tagged_pointer& other) const noexcept { return untagged_offset() >= other.untagged_offset(); }
+
+  T& operator*() const noexcept
+  {
+    return *get();
+  }
+
+  T* operator->() const noexcept
+  {
+    return get();
+  }
+
+  T* get() const noexcept
+  {
+    return reinterpret_cast<T*>(term_arena::address(untagged_offset()));
+  }
+
+private:
+  std::uint32_t untagged_offset() const noexcept
+  {
+    return m_offset & ~static_cast<std::uint32_t>(1);
+  }
+
+  mutable std::uint32_t m_offset = 0;
+};
+
+/// \brief An allocator that obtains its memory from the term arena.
+template<typename T>
+class term_arena_allocator
+{
+public:
+  using value_type = T;
+  using size_type = std::size_t;
+
+  term_arena_allocator() noexcept = default;
+
+  template<typename U>
+  term_arena_allocator(const term_arena_allocator<U>&) noexcept
+  {}
+
+  T* allocate(size_type n, const void* = nullptr)
+  {
+    return static_cast<T*>(term_arena::allocate(n * sizeof(T)));
+  }
+
+  void deallocate(T* p, size_type n) noexcept
+  {
+    term_arena::deallocate(p, n * sizeof(T));
+  }
+
+  // This member function is to ensure parity with the block_allocator, freed blocks are never released.
+  constexpr std::size_t consolidate() const noexcept { return 0; }
+
+  template<typename U>
+  bool operator==(const term_arena_allocator<U>&) const noexcept { return true; }
+
+  template<typename U>
+  bool operator!=(const term_arena_allocator<U>&) const noexcept { return false; }
+};
+
+} // namespace detail
+} // namespace atermpp
+
+#endif // MCRL2_ATERMPP_COMPACT_TERMS
+
+#endif // MCRL2_ATERMPP_DETAIL_TERM_ARENA_H
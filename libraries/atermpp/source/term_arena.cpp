@@ -0,0 +1,159 @@
+// Author(s): Maurice Laveaux
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include "mcrl2/atermpp/detail/term_arena.h"
+
+#ifdef MCRL2_ATERMPP_COMPACT_TERMS
+
+#include <algorithm>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#ifndef MAP_NORESERVE
+#define MAP_NORESERVE 0
+#endif
+#endif
+
+using namespace atermpp::detail;
+
+char* atermpp::detail::g_term_arena_base = nullptr;
+
+namespace
+{
+
+struct term_arena_state
+{
+  /// \brief The number of bytes of address space that has been reserved.
+  std::size_t reserved = 0;
+
+  /// \brief The number of bytes that have been committed, only used on Windows.
+  std::size_t committed = 0;
+
+  /// \brief The first byte that has never been handed out. Offset zero represents nullptr.
+  std::size_t top = term_arena::Alignment;
+
+  /// \brief The first free block of i * Alignment bytes is free_lists[i], such a block starts
+  ///        with a pointer to the next free block of the same size.
+  std::vector<void*> free_lists;
+
+  std::mutex mutex;
+};
+
+/// \brief The state is never destroyed, because terms can be freed during the destruction of static objects.
+term_arena_state& arena_state()
+{
+  static term_arena_state& state = *new term_arena_state();
+  return state;
+}
+
+/// \brief Reserves the largest range of address space, up to the range covered by 32-bit offsets, that is available.
+void reserve(term_arena_state& state)
+{
+  for (std::size_t size = (std::size_t(1) << 32) * term_arena::Unit; size >= (std::size_t(1) << 28); size /= 2)
+  {
+#ifdef _WIN32
+    void* base = VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_NOACCESS);
+#else
+    void* base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (base == MAP_FAILED)
+    {
+      base = nullptr;
+    }
+#endif
+    if (base != nullptr)
+    {
+      g_term_arena_base = static_cast<char*>(base);
+      state.reserved = size;
+      return;
+    }
+  }
+
+  throw std::bad_alloc();
+}
+
+/// \brief Makes sure that the first top bytes of the arena can be written.
+void commit([[maybe_unused]] term_arena_state& state, [[maybe_unused]] std::size_t top)
+{
+#ifdef _WIN32
+  if (top > state.committed)
+  {
+    // Commit in steps of 64MB to limit the number of system calls.
+    const std::size_t step = std::size_t(1) << 26;
+    const std::size_t committed = std::min(state.reserved, (top + step - 1) / step * step);
+    if (VirtualAlloc(g_term_arena_base + state.committed, committed - state.committed, MEM_COMMIT, PAGE_READWRITE) == nullptr)
+    {
+      throw std::bad_alloc();
+    }
+    state.committed = committed;
+  }
+#endif
+}
+
+} // namespace
+
+void* term_arena::allocate(std::size_t size)
+{
+  term_arena_state& state = arena_state();
+  size = (size + Alignment - 1) / Alignment * Alignment;
+  const std::size_t index = size / Alignment;
+
+  std::unique_lock<std::mutex> lock(state.mutex, std::defer_lock);
+  if constexpr (GlobalThreadSafe) { lock.lock(); }
+
+  if (g_term_arena_base == nullptr)
+  {
+    reserve(state);
+  }
+
+  if (index < state.free_lists.size() && state.free_lists[index] != nullptr)
+  {
+    void* block = state.free_lists[index];
+    state.free_lists[index] = *static_cast<void**>(block);
+    return block;
+  }
+
+  if (size > state.reserved - state.top)
+  {
+    throw std::bad_alloc();
+  }
+
+  commit(state, state.top + size);
+  void* block = g_term_arena_base + state.top;
+  state.top += size;
+  return block;
+}
+
+void term_arena::deallocate(void* block, std::size_t size) noexcept
+{
+  term_arena_state& state = arena_state();
+  const std::size_t index = (size + Alignment - 1) / Alignment;
+
+  std::unique_lock<std::mutex> lock(state.mutex, std::defer_lock);
+  if constexpr (GlobalThreadSafe) { lock.lock(); }
+
+  if (index >= state.free_lists.size())
+  {
+    state.free_lists.resize(index + 1, nullptr);
+  }
+  *static_cast<void**>(block) = state.free_lists[index];
+  state.free_lists[index] = block;
+}
+
+std::size_t term_arena::size() noexcept
+{
+  return arena_state().top;
+}
+
+#endif // MCRL2_ATERMPP_COMPACT_TERMS
@@ -29,6 +29,21 @@ BOOST_AUTO_TEST_CASE(test_aterm)
   BOOST_CHECK(e==atermpp::aterm());
 }
 
+#ifdef MCRL2_ATERMPP_COMPACT_TERMS
+BOOST_AUTO_TEST_CASE(test_compact_terms)
+{
+  static_assert(sizeof(aterm) == sizeof(std::uint32_t), "Terms are referred to by 32-bit offsets");
+  static_assert(sizeof(function_symbol) == sizeof(std::uint32_t), "Function symbols are referred to by 32-bit offsets");
+
+  function_symbol f("f", 2);
+  aterm_appl t(f, aterm_int(1), aterm_appl(f, aterm_int(2), aterm_int(3)));
+  BOOST_CHECK(t == aterm_appl(f, aterm_int(1), aterm_appl(f, aterm_int(2), aterm_int(3))));
+  BOOST_CHECK(down_cast<aterm_int>(down_cast<aterm_appl>(t[1])[1]).value() == 3);
+  BOOST_CHECK(t.function() == f && t.function().name() == "f");
+  BOOST_CHECK(detail::term_arena::address(detail::term_arena::offset(detail::address(t))) == reinterpret_cast<char*>(detail::address(t)));
+}
+#endif
+
 BOOST_AUTO_TEST_CASE(test_aterm_string)
 {
   const aterm_string& empty = empty_string();
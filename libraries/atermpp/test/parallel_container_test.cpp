@@ -11,6 +11,7 @@
 #include <boost/test/included/unit_test.hpp>
 
 #include "mcrl2/utilities/configuration.h"
+#include "mcrl2/atermpp/aterm_appl.h"
 #include "mcrl2/atermpp/aterm_int.h"
 #include "mcrl2/atermpp/standard_containers/vector.h"
 #include "mcrl2/atermpp/detail/global_aterm_pool.h"
@@ -56,3 +57,53 @@ BOOST_AUTO_TEST_CASE(parallel_vector)
 #endif
 }
 
+
+BOOST_AUTO_TEST_CASE(parallel_term_creation)
+{
+#ifdef MCRL2_THREAD_SAFE
+  // Several threads create the same terms in a different order, such that the shards of the term pool
+  // are resized while terms are created. The terms must nevertheless be maximally shared.
+  constexpr std::size_t number_of_threads = 4;
+  constexpr std::size_t number_of_terms = 1 << 17;
+  std::vector<atermpp::vector<atermpp::aterm>*> terms(number_of_threads, nullptr);
+  std::atomic<std::size_t> created(0);
+  std::atomic<std::size_t> compared(0);
+  std::atomic<bool> shared(true);
+
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < number_of_threads; ++t)
+  {
+    threads.emplace_back([&, t]()
+    {
+      atermpp::function_symbol f("f", 2);
+      atermpp::vector<atermpp::aterm> local(number_of_terms);
+      for (std::size_t j = 0; j < number_of_terms; ++j)
+      {
+        std::size_t i = (j * (2 * t + 1)) % number_of_terms;
+        local[i] = atermpp::aterm_appl(f, atermpp::aterm_int(i), atermpp::aterm_int(i + t % 2));
+      }
+      terms[t] = &local;
+      ++created;
+      while (created < number_of_threads) {}
+
+      // Compare with the terms that another thread created with the same arguments, in another order.
+      const atermpp::vector<atermpp::aterm>& other = *terms[(t + 2) % number_of_threads];
+      for (std::size_t i = 0; i < number_of_terms; ++i)
+      {
+        if (local[i] != other[i])
+        {
+          shared = false;
+        }
+      }
+      ++compared;
+      while (compared < number_of_threads) {}
+    });
+  }
+
+  for (std::thread& thread : threads)
+  {
+    thread.join();
+  }
+  BOOST_CHECK(shared);
+#endif
+}
@@ -502,11 +502,13 @@ class BDD_Prover: protected rewriter
                       << "  Full: " << f_full << "," << std::endl;
     }
 
-    BDD_Prover(const rewriter& r, int time_limit = 0, bool apply_induction = false)
+    BDD_Prover(const rewriter& r, int time_limit = 0, bool apply_induction = false,
+               bool path_eliminator = false, smt_solver_type solver_type = solver_type_cvc)
     : rewriter(r),
       f_time_limit(time_limit),
       f_apply_induction(apply_induction),
-      f_bdd_simplifier(new BDD_Simplifier())
+      f_bdd_simplifier(path_eliminator ? std::shared_ptr<BDD_Simplifier>(new BDD_Path_Eliminator(solver_type)) :
+                                         std::shared_ptr<BDD_Simplifier>(new BDD_Simplifier()))
     {
       rewriter::thread_initialise();
     }
@@ -633,6 +635,12 @@ class BDD_Prover: protected rewriter
       return BDD_Prover(rewriter::clone());
     }
 
+    /// \brief Returns a copy of the rewriter of this prover, to be used in another thread.
+    rewriter clone_rewriter()
+    {
+      return rewriter::clone();
+    }
+
     void thread_initialise()
     {
       rewriter::thread_initialise();
@@ -15,9 +15,17 @@
 #ifndef MCRL2_LPS_CONFLUENCE_CHECKER_H
 #define MCRL2_LPS_CONFLUENCE_CHECKER_H
 
+#include "mcrl2/atermpp/aterm_io_binary.h"
+#include "mcrl2/data/detail/io.h"
 #include "mcrl2/lps/disjointness_checker.h"
 #include "mcrl2/lps/invariant_checker.h"
+#include <atomic>
+#include <condition_variable>
+#include <fstream>
 #include <iomanip>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 
 
 /** \brief A class that takes a linear process specification and checks all tau-summands of that LPS for confluence.
@@ -120,6 +128,13 @@
     was set to true, the confluent tau-summands will not be marked, only the results of the confluence checking will be
     displayed.
 
+    If the parameter a_number_of_threads is larger than one, the confluence conditions of a tau-summand are proven by
+    that many threads, each with its own prover and its own copy of the rewriter. The results are still reported in
+    the order of the summands. Confluence conditions that are identical to a condition that was proven before are not
+    proven again. If a file name is passed as parameter a_results_file_name, the proven conditions are stored in this
+    file after each tau-summand, and the results already stored in it are reused. This allows an interrupted check to
+    be resumed.
+
     If there already is an action named ctau present in the LPS passed as parameter a_lps, an error will be reported. */
 
 
@@ -154,6 +169,12 @@ inline process::action make_ctau_action()
   return process::action(ctau_action);
 }
 
+/// \brief The marker at the start of a file with confluence results.
+inline atermpp::aterm_appl confluence_results_marker()
+{
+  return atermpp::aterm_appl(atermpp::function_symbol("confluence_results", 0));
+}
+
 template <typename Specification>
 class Confluence_Checker
 {
@@ -162,6 +183,35 @@ class Confluence_Checker
   typedef std::vector<action_summand_type> action_summand_vector_type;
 
   private:
+    /// \brief The confluence of a tau-summand with another summand.
+    struct summand_pair
+    {
+      /// \brief The number of the other summand.
+      std::size_t summand_number = 0;
+
+      /// \brief The symbol that is printed for this pair, or 0 if the condition must be proven.
+      char result = 0;
+
+      /// \brief The confluence condition.
+      data::data_expression condition;
+
+      /// \brief Flag indicating whether the condition has been proven.
+      bool proven = false;
+
+      /// \brief Flag indicating whether the condition is a tautology.
+      bool is_tautology = false;
+
+      /// \brief The BDD of the condition, if it is not a tautology.
+      data::data_expression bdd;
+
+      /// \brief A counter example of the condition, if it is not a tautology.
+      data::data_expression counter_example;
+
+      /// \brief Exceptions thrown while proving the condition or computing a counter example.
+      std::exception_ptr exception;
+      std::exception_ptr counter_example_exception;
+    };
+
     /// \brief Class that can check if two summands are disjoint.
     Disjointness_Checker f_disjointness_checker;
 
@@ -200,6 +250,19 @@ class Confluence_Checker
     /// \brief summand is encountered that is not confluent with the tau summand at hand.
     bool f_generate_invariants;
 
+    /// \brief The settings of the prover, which are needed to create the provers of the worker threads.
+    int f_time_limit;
+    bool f_path_eliminator;
+    data::detail::smt_solver_type f_solver_type;
+    bool f_apply_induction;
+
+    /// \brief The number of threads that prove confluence conditions.
+    std::size_t f_number_of_threads;
+
+    /// \brief The name of the file in which proven confluence conditions are stored. If the file
+    /// \brief exists, the results in it are reused.
+    std::string f_results_file_name;
+
     /// \brief The number of summands of the current LPS.
     std::size_t f_number_of_summands;
 
@@ -209,20 +272,63 @@ class Confluence_Checker
     /// \brief Identifier generator to allow variables to be uniquely renamed.
     data::set_identifier_generator f_set_identifier_generator;
 
+    /// \brief The fresh names of renamed summation variables. A variable is always given the same fresh
+    /// \brief name, such that identical pairs of summands lead to identical confluence conditions.
+    std::map<core::identifier_string, core::identifier_string> f_renamed_identifiers;
+
+    /// \brief Maps confluence conditions to a flag indicating whether they are a tautology.
+    std::unordered_map<data::data_expression, bool> f_proof_cache;
+
+    /// \brief The number of confluence conditions that were found in f_proof_cache.
+    std::size_t f_cache_hits = 0;
+
+    /// \brief Flag indicating whether f_proof_cache has changed since it was last written to f_results_file_name.
+    bool f_cache_changed = false;
+
+    /// \brief The worker threads, which share the pairs in f_pairs with the main thread.
+    std::vector<std::thread> f_workers;
+    std::mutex f_workers_mutex;
+    std::condition_variable f_workers_condition;
+    std::size_t f_generation = 0;
+    std::size_t f_busy_workers = 0;
+    bool f_stop_workers = false;
+    std::vector<summand_pair>* f_pairs = nullptr;
+    std::atomic<std::size_t> f_next_pair{0};
+    std::atomic<std::size_t> f_first_failure{0};
+
     /// \brief Writes a dot file of the BDD created when checking the confluence of summands a_summand_number_1 and a_summand_number_2.
-    void save_dot_file(std::size_t a_summand_number_1, std::size_t a_summand_number_2);
+    void save_dot_file(const data::data_expression& a_bdd, std::size_t a_summand_number_1, std::size_t a_summand_number_2);
 
     /// \brief Outputs a path in the BDD corresponding to the condition at hand that leads to a node labelled false.
-    void print_counter_example();
+    void print_counter_example(const summand_pair& a_pair);
 
-    /// \brief Checks the confluence of summand a_summand_1 and a_summand_2
-    bool check_summands(
-      const data::data_expression& a_invariant,
-      const action_summand_type a_summand_1,
-      const std::size_t a_summand_number_1,
-      const action_summand_type a_summand_2,
-      const std::size_t a_summand_number_2,
-      const char a_condition_type);
+    /// \brief Reports that the tau-summand at hand is not confluent with summand a_summand_number.
+    void print_not_confluent(std::size_t a_summand_number);
+
+    /// \brief Proves the conditions of the pairs in f_pairs using the given prover, until all pairs have
+    /// \brief been handled, or a pair before the next one is known not to be confluent.
+    void prove_pairs(data::detail::BDD_Prover& a_prover);
+
+    /// \brief Proves the conditions of all pairs that have no result, using all threads.
+    void prove_pairs(std::vector<summand_pair>& a_pairs);
+
+    /// \brief The function executed by a worker thread.
+    void run_worker(const data::rewriter& a_rewriter);
+
+    /// \brief Starts the worker threads, which each get their own prover and rewriter.
+    void start_workers();
+
+    /// \brief Stops the worker threads.
+    void stop_workers();
+
+    /// \brief Reads the confluence results stored in f_results_file_name, if this file exists.
+    void read_results();
+
+    /// \brief Writes the confluence results to f_results_file_name.
+    void write_results();
+
+    /// \brief Reports the confluence of the tau-summand a_summand_number with the summand in a_pair.
+    bool check_summands(summand_pair& a_pair, const std::size_t a_summand_number);
 
     /// \brief Checks and updates the confluence of summand a_summand concerning all other tau-summands.
     void check_confluence_and_mark_summand(
@@ -255,9 +361,17 @@ class Confluence_Checker
       std::string a_conditions = "c",
       bool a_counter_example = false,
       bool a_generate_invariants = false,
-      std::string const& a_dot_file_name = std::string()
+      std::string const& a_dot_file_name = std::string(),
+      std::size_t a_number_of_threads = 1,
+      std::string const& a_results_file_name = std::string()
     );
 
+    /// \brief Destructor that stops the worker threads.
+    ~Confluence_Checker()
+    {
+      stop_workers();
+    }
+
     /// \brief Check the confluence of the LPS Confluence_Checker::f_lps.
     /// precondition: the argument passed as parameter a_invariant is an expression of sort Bool in internal mCRL2 format
     /// precondition: the argument passed as parameter a_summand_number corresponds with a summand of the LPS for which
@@ -265,6 +379,7 @@ class Confluence_Checker
     void check_confluence_and_mark(const data::data_expression& a_invariant, const std::size_t a_summand_number);
 };
 
+
 // Auxiliary functions ----------------------------------------------------------------------------
 
 static
@@ -571,28 +686,252 @@ bool has_ctau_action(const Specification& a_lps)
 // Class Confluence_Checker - Functions declared private ----------------------------------------
 
 template <typename Specification>
-void Confluence_Checker<Specification>::save_dot_file(std::size_t a_summand_number_1, std::size_t a_summand_number_2)
+void Confluence_Checker<Specification>::save_dot_file(const data::data_expression& a_bdd, std::size_t a_summand_number_1, std::size_t a_summand_number_2)
 {
   if (!f_dot_file_name.empty())
   {
-    f_bdd2dot.output_bdd(f_bdd_prover.get_bdd(), f_dot_file_name + "-" + std::to_string(a_summand_number_1) + "-" + std::to_string(a_summand_number_2) + ".dot");
+    f_bdd2dot.output_bdd(a_bdd, f_dot_file_name + "-" + std::to_string(a_summand_number_1) + "-" + std::to_string(a_summand_number_2) + ".dot");
   }
 }
 
 // --------------------------------------------------------------------------------------------
 
 template <typename Specification>
-void Confluence_Checker<Specification>::print_counter_example()
+void Confluence_Checker<Specification>::print_counter_example(const summand_pair& a_pair)
 {
   if (f_counter_example)
   {
-    const data::data_expression v_counter_example(f_bdd_prover.get_counter_example());
-    mCRL2log(log::info) << "  Counter example: " << v_counter_example << "\n";
+    if (a_pair.counter_example_exception)
+    {
+      std::rethrow_exception(a_pair.counter_example_exception);
+    }
+    mCRL2log(log::info) << "  Counter example: " << a_pair.counter_example << "\n";
+  }
+}
+
+// --------------------------------------------------------------------------------------------
+
+template <typename Specification>
+void Confluence_Checker<Specification>::print_not_confluent(std::size_t a_summand_number)
+{
+  if (f_check_all)
+  {
+    mCRL2log(log::info) << "-";
+  }
+  else
+  {
+    mCRL2log(log::info) << "Not confluent with summand " << a_summand_number << ".";
+  }
+}
+
+// --------------------------------------------------------------------------------------------
+
+template <typename Specification>
+void Confluence_Checker<Specification>::prove_pairs(data::detail::BDD_Prover& a_prover)
+{
+  std::vector<summand_pair>& v_pairs = *f_pairs;
+  for (std::size_t k = f_next_pair++; k < v_pairs.size() && k < f_first_failure; k = f_next_pair++)
+  {
+    summand_pair& v_pair = v_pairs[k];
+    if (v_pair.result != 0)
+    {
+      continue;
+    }
+
+    try
+    {
+      a_prover.set_formula(v_pair.condition);
+      v_pair.is_tautology = a_prover.is_tautology() == data::detail::answer_yes;
+      if (!v_pair.is_tautology)
+      {
+        v_pair.bdd = a_prover.get_bdd();
+        if (f_counter_example)
+        {
+          try
+          {
+            v_pair.counter_example = a_prover.get_counter_example();
+          }
+          catch (...)
+          {
+            v_pair.counter_example_exception = std::current_exception();
+          }
+        }
+      }
+    }
+    catch (...)
+    {
+      v_pair.exception = std::current_exception();
+    }
+    v_pair.proven = true;
+
+    // Without invariants, the pairs after a pair that is not confluent need not be investigated.
+    if ((!v_pair.is_tautology || v_pair.exception) && !f_generate_invariants && !f_check_all)
+    {
+      std::size_t v_first_failure = f_first_failure;
+      while (k < v_first_failure && !f_first_failure.compare_exchange_weak(v_first_failure, k))
+      {}
+    }
   }
 }
 
 // --------------------------------------------------------------------------------------------
 
+template <typename Specification>
+void Confluence_Checker<Specification>::prove_pairs(std::vector<summand_pair>& a_pairs)
+{
+  f_pairs = &a_pairs;
+  f_next_pair = 0;
+  f_first_failure = a_pairs.size();
+
+  if (f_workers.empty())
+  {
+    prove_pairs(f_bdd_prover);
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> v_lock(f_workers_mutex);
+    ++f_generation;
+    f_busy_workers = f_workers.size();
+  }
+  f_workers_condition.notify_all();
+
+  prove_pairs(f_bdd_prover);
+
+  std::unique_lock<std::mutex> v_lock(f_workers_mutex);
+  f_workers_condition.wait(v_lock, [this]() { return f_busy_workers == 0; });
+}
+
+// --------------------------------------------------------------------------------------------
+
+template <typename Specification>
+void Confluence_Checker<Specification>::run_worker(const data::rewriter& a_rewriter)
+{
+  // The prover is created in this thread, as it initialises its rewriter for the thread in which it is created.
+  data::detail::BDD_Prover v_prover(a_rewriter, f_time_limit, f_apply_induction, f_path_eliminator, f_solver_type);
+  std::size_t v_generation = 0;
+  while (true)
+  {
+    {
+      std::unique_lock<std::mutex> v_lock(f_workers_mutex);
+      f_workers_condition.wait(v_lock, [&]() { return f_stop_workers || f_generation != v_generation; });
+      if (f_stop_workers)
+      {
+        return;
+      }
+      v_generation = f_generation;
+    }
+
+    prove_pairs(v_prover);
+
+    {
+      std::lock_guard<std::mutex> v_lock(f_workers_mutex);
+      --f_busy_workers;
+    }
+    f_workers_condition.notify_all();
+  }
+}
+
+// --------------------------------------------------------------------------------------------
+
+template <typename Specification>
+void Confluence_Checker<Specification>::start_workers()
+{
+  f_generation = 0;
+  for (std::size_t i = 1; i < f_number_of_threads; ++i)
+  {
+    // It is essential that the rewriter is cloned, as one rewriter cannot be used in parallel.
+    const data::rewriter v_rewriter = f_bdd_prover.clone_rewriter();
+    f_workers.emplace_back([this, v_rewriter]() { run_worker(v_rewriter); });
+  }
+}
+
+// --------------------------------------------------------------------------------------------
+
+template <typename Specification>
+void Confluence_Checker<Specification>::stop_workers()
+{
+  {
+    std::lock_guard<std::mutex> v_lock(f_workers_mutex);
+    f_stop_workers = true;
+  }
+  f_workers_condition.notify_all();
+  for (std::thread& v_worker: f_workers)
+  {
+    v_worker.join();
+  }
+  f_workers.clear();
+  f_stop_workers = false;
+}
+
+// --------------------------------------------------------------------------------------------
+
+template <typename Specification>
+void Confluence_Checker<Specification>::read_results()
+{
+  std::ifstream v_stream(f_results_file_name, std::ios::binary);
+  if (f_results_file_name.empty() || !v_stream.is_open())
+  {
+    return;
+  }
+
+  atermpp::binary_aterm_istream v_aterm_stream(v_stream);
+  v_aterm_stream >> data::detail::add_index_impl;
+
+  atermpp::aterm v_marker;
+  v_aterm_stream >> v_marker;
+  if (v_marker != confluence_results_marker())
+  {
+    throw mcrl2::runtime_error("The file " + f_results_file_name + " does not contain confluence results.");
+  }
+
+  data::data_expression_list v_tautologies;
+  data::data_expression_list v_non_tautologies;
+  v_aterm_stream >> v_tautologies;
+  v_aterm_stream >> v_non_tautologies;
+  for (const data::data_expression& v_condition: v_tautologies)
+  {
+    f_proof_cache[v_condition] = true;
+  }
+  for (const data::data_expression& v_condition: v_non_tautologies)
+  {
+    f_proof_cache[v_condition] = false;
+  }
+  mCRL2log(log::verbose) << "Read " << f_proof_cache.size() << " confluence results from " << f_results_file_name << "." << std::endl;
+}
+
+// --------------------------------------------------------------------------------------------
+
+template <typename Specification>
+void Confluence_Checker<Specification>::write_results()
+{
+  if (f_results_file_name.empty() || !f_cache_changed)
+  {
+    return;
+  }
+
+  data::data_expression_list v_tautologies;
+  data::data_expression_list v_non_tautologies;
+  for (const auto& [v_condition, v_is_tautology]: f_proof_cache)
+  {
+    (v_is_tautology ? v_tautologies : v_non_tautologies).push_front(v_condition);
+  }
+
+  std::ofstream v_stream(f_results_file_name, std::ios::binary);
+  if (!v_stream.is_open())
+  {
+    throw mcrl2::runtime_error("Cannot write confluence results to " + f_results_file_name + ".");
+  }
+  atermpp::binary_aterm_ostream v_aterm_stream(v_stream);
+  v_aterm_stream << data::detail::remove_index_impl;
+  v_aterm_stream << confluence_results_marker();
+  v_aterm_stream << v_tautologies;
+  v_aterm_stream << v_non_tautologies;
+  f_cache_changed = false;
+}
+
+// --------------------------------------------------------------------------------------------
+
 template <typename Specification>
 void Confluence_Checker<Specification>::uniquely_rename_summutation_variables(
   action_summand_type& summand)
@@ -611,7 +950,12 @@ void Confluence_Checker<Specification>::uniquely_rename_summutation_variables(
 
   for (const data::variable& summation_variable : summation_variables)
   {
-    core::identifier_string new_name = f_set_identifier_generator(summation_variable.name());
+    auto i = f_renamed_identifiers.find(summation_variable.name());
+    if (i == f_renamed_identifiers.end())
+    {
+      i = f_renamed_identifiers.insert({summation_variable.name(), f_set_identifier_generator(summation_variable.name())}).first;
+    }
+    const core::identifier_string& new_name = i->second;
     // mCRL2log(log::verbose) << "Renamed " << i->name() << " to " << new_name << std::endl;
 
     data::variable renamed_variable = data::variable(new_name, summation_variable.sort());
@@ -664,81 +1008,58 @@ void Confluence_Checker<Specification>::uniquely_rename_summutation_variables(
 
 template <typename Specification>
 bool Confluence_Checker<Specification>::check_summands(
-  const data::data_expression& a_invariant,
-  const action_summand_type a_summand_1,
-  const std::size_t a_summand_number_1,
-  const action_summand_type a_summand_2,
-  const std::size_t a_summand_number_2,
-  const char a_condition_type)
+  summand_pair& a_pair,
+  const std::size_t a_summand_number)
 {
-  assert(a_summand_1.is_tau());
-
-  const data::variable_list v_variables = f_lps.process().process_parameters();
-  bool v_is_confluent = true;
-
-  if ((a_condition_type == 'c' || a_condition_type == 'd') && f_disjointness_checker.disjoint(a_summand_number_1, a_summand_number_2))
-  {
-    mCRL2log(log::info) << ":";
-  }
-  else
+  switch (a_pair.result)
   {
-    action_summand_type tagged = a_summand_2;
-
-    if (!f_no_sums)
+    case '.':
+    case ':':
+    case '+':
     {
-      uniquely_rename_summutation_variables(tagged);
+      mCRL2log(log::info) << a_pair.result;
+      return true;
     }
-
-    const data::data_expression v_condition = get_confluence_condition(a_invariant, a_summand_1, tagged, v_variables, a_condition_type);
-    f_bdd_prover.set_formula(v_condition);
-    if (f_bdd_prover.is_tautology() == data::detail::answer_yes)
+    case '-':
     {
-      mCRL2log(log::info) << "+";
+      print_not_confluent(a_pair.summand_number);
+      return false;
     }
-    else
+    default:
+      break;
+  }
+
+  assert(a_pair.proven);
+  if (a_pair.exception)
+  {
+    std::rethrow_exception(a_pair.exception);
+  }
+  f_proof_cache[a_pair.condition] = a_pair.is_tautology;
+  f_cache_changed = true;
+
+  if (a_pair.is_tautology)
+  {
+    mCRL2log(log::info) << "+";
+    return true;
+  }
+
+  if (f_generate_invariants)
+  {
+    const data::data_expression& v_new_invariant = a_pair.bdd;
+    mCRL2log(log::verbose) << "\nChecking invariant: " << data::pp(v_new_invariant) << "\n";
+    if (f_invariant_checker.check_invariant(v_new_invariant))
     {
-      if (f_generate_invariants)
-      {
-        const data::data_expression v_new_invariant(f_bdd_prover.get_bdd());
-        mCRL2log(log::verbose) << "\nChecking invariant: " << data::pp(v_new_invariant) << "\n";
-        if (f_invariant_checker.check_invariant(v_new_invariant))
-        {
-          mCRL2log(log::verbose) << "Invariant holds" << std::endl;
-          mCRL2log(log::info) << "i";
-        }
-        else
-        {
-          mCRL2log(log::verbose) << "Invariant doesn't hold" << std::endl;
-          v_is_confluent = false;
-          if (f_check_all)
-          {
-            mCRL2log(log::info) << "-";
-          }
-          else
-          {
-            mCRL2log(log::info) << "Not confluent with summand " << a_summand_number_2 << ".";
-          }
-          print_counter_example();
-          save_dot_file(a_summand_number_1, a_summand_number_2);
-        }
-      }
-      else
-      {
-        v_is_confluent = false;
-        if (f_check_all)
-        {
-          mCRL2log(log::info) << "-";
-        }
-        else
-        {
-          mCRL2log(log::info) << "Not confluent with summand " << a_summand_number_2 << ".";
-        }
-        print_counter_example();
-        save_dot_file(a_summand_number_1, a_summand_number_2);
-      }
+      mCRL2log(log::verbose) << "Invariant holds" << std::endl;
+      mCRL2log(log::info) << "i";
+      return true;
     }
+    mCRL2log(log::verbose) << "Invariant doesn't hold" << std::endl;
   }
-  return v_is_confluent;
+
+  print_not_confluent(a_pair.summand_number);
+  print_counter_example(a_pair);
+  save_dot_file(a_pair.bdd, a_summand_number, a_pair.summand_number);
+  return false;
 }
 
 // --------------------------------------------------------------------------------------------
@@ -754,7 +1075,7 @@ void Confluence_Checker<Specification>::check_confluence_and_mark_summand(
   typedef typename Specification::process_type::action_summand_type action_summand_type;
   assert(a_summand.is_tau());
   std::vector<action_summand_type>& v_summands = f_lps.process().action_summands();
-  std::size_t v_summand_number = 1;
+  const data::variable_list v_variables = f_lps.process().process_parameters();
   bool v_is_confluent = true;
 
   // Add here that the sum variables of a_summand must be empty otherwise
@@ -772,41 +1093,67 @@ void Confluence_Checker<Specification>::check_confluence_and_mark_summand(
     }
   }
 
-  for (typename std::vector<action_summand_type>::const_iterator i=v_summands.begin(); i!=v_summands.end() && (v_is_confluent || f_check_all); ++i)
+  // First determine the pairs whose confluence is known without using the prover, and the
+  // confluence conditions of the other pairs. Unless all summands must be checked, this stops
+  // at the first summand that is known not to be confluent.
+  std::vector<summand_pair> v_pairs;
+  if (v_is_confluent || f_check_all)
   {
-    const action_summand_type v_summand = *i;
-
-    if (v_summand_number < a_summand_number)
+    std::size_t v_summand_number = 1;
+    for (const action_summand_type& v_summand: v_summands)
     {
+      summand_pair v_pair;
+      v_pair.summand_number = v_summand_number;
+
       // Check the cache
-      if (f_intermediate[v_summand_number] > a_summand_number)
+      if (v_summand_number < a_summand_number && f_intermediate[v_summand_number] > a_summand_number)
+      {
+        v_pair.result = '.';
+      }
+      else if (v_summand_number < a_summand_number && f_intermediate[v_summand_number] == a_summand_number)
       {
-        mCRL2log(log::info) << ".";
+        v_pair.result = '-';
+      }
+      else if ((a_condition_type == 'c' || a_condition_type == 'd') && f_disjointness_checker.disjoint(a_summand_number, v_summand_number))
+      {
+        v_pair.result = ':';
       }
       else
       {
-        if (f_intermediate[v_summand_number] == a_summand_number)
+        action_summand_type tagged = v_summand;
+        if (!f_no_sums)
         {
-          if (f_check_all)
-          {
-            mCRL2log(log::info) << "-";
-          }
-          else
-          {
-            mCRL2log(log::info) << "Not confluent with summand " << v_summand_number << ".";
-          }
-          v_is_confluent = false;
+          uniquely_rename_summutation_variables(tagged);
         }
-        else
+        v_pair.condition = get_confluence_condition(a_invariant, a_summand, tagged, v_variables, a_condition_type);
+
+        // A condition that is not a tautology must be proven again if its BDD is needed.
+        const auto i = f_proof_cache.find(v_pair.condition);
+        if (i != f_proof_cache.end() && (i->second || (!f_generate_invariants && !f_counter_example && f_dot_file_name.empty())))
         {
-          v_is_confluent &= check_summands(a_invariant, a_summand, a_summand_number, v_summand, v_summand_number, a_condition_type);
+          v_pair.result = i->second ? '+' : '-';
+          ++f_cache_hits;
         }
       }
+      v_pairs.push_back(v_pair);
+      if (v_pair.result == '-' && !f_check_all)
+      {
+        break;
+      }
+      ++v_summand_number;
     }
-    else
+  }
+
+  prove_pairs(v_pairs);
+
+  std::size_t v_summand_number = 1;
+  for (summand_pair& v_pair: v_pairs)
+  {
+    if (!v_is_confluent && !f_check_all)
     {
-      v_is_confluent &= check_summands(a_invariant, a_summand, a_summand_number, v_summand, v_summand_number, a_condition_type);
+      break;
     }
+    v_is_confluent &= check_summands(v_pair, a_summand_number);
     if (v_is_confluent || f_check_all)
     {
       // Only increase number if we will continue
@@ -842,7 +1189,9 @@ Confluence_Checker<Specification>::Confluence_Checker(
   std::string a_conditions,
   bool a_counter_example,
   bool a_generate_invariants,
-  std::string const& a_dot_file_name):
+  std::string const& a_dot_file_name,
+  std::size_t a_number_of_threads,
+  std::string const& a_results_file_name):
   f_disjointness_checker(a_lps.process()),
   f_invariant_checker(a_lps, a_rewrite_strategy, a_time_limit, a_path_eliminator, a_solver_type, false, false, 0),
   f_bdd_prover(a_lps.data(), data::used_data_equation_selector(a_lps.data()), a_rewrite_strategy,
@@ -853,13 +1202,24 @@ Confluence_Checker<Specification>::Confluence_Checker(
   f_conditions(a_conditions),
   f_counter_example(a_counter_example),
   f_dot_file_name(a_dot_file_name),
-  f_generate_invariants(a_generate_invariants)
+  f_generate_invariants(a_generate_invariants),
+  f_time_limit(a_time_limit),
+  f_path_eliminator(a_path_eliminator),
+  f_solver_type(a_solver_type),
+  f_apply_induction(a_apply_induction),
+  f_number_of_threads(a_number_of_threads),
+  f_results_file_name(a_results_file_name)
 {
   if (has_ctau_action(a_lps))
   {
     throw mcrl2::runtime_error("An action named \'ctau\' already exists.\n");
   }
 
+  if (f_number_of_threads < 1)
+  {
+    throw mcrl2::runtime_error("The number of threads should at least be 1.");
+  }
+
   std::string v_conditions = std::string(f_conditions);
 
   while (v_conditions.length() > 0)
@@ -907,6 +1267,10 @@ void Confluence_Checker<Specification>::check_confluence_and_mark(const data::da
   f_set_identifier_generator.clear_context();
   f_set_identifier_generator.add_identifiers(find_identifiers(f_lps));
   f_set_identifier_generator.add_identifiers(data::function_and_mapping_identifiers(f_lps.data()));
+  f_renamed_identifiers.clear();
+  f_cache_hits = 0;
+  read_results();
+  start_workers();
 
   f_number_of_summands = v_summands.size();
   std::string v_conditions = std::string(f_conditions);
@@ -936,11 +1300,16 @@ void Confluence_Checker<Specification>::check_confluence_and_mark(const data::da
           v_unmarked_summands.erase(it);
           v_is_marked = true;
         }
+
+        // Store the results after every summand, such that an interrupted run can be resumed.
+        write_results();
       }
       v_summand_number++;
     }
   }
 
+  stop_workers();
+
   if (v_is_marked && !has_ctau_action(f_lps))
   {
     f_lps.action_labels().push_front(make_ctau_act_id());
@@ -948,6 +1317,7 @@ void Confluence_Checker<Specification>::check_confluence_and_mark(const data::da
 
   mCRL2log(log::info) << v_marked_summands.size() << " of " << (v_marked_summands.size() + v_unmarked_summands.size()) <<
                          " tau summands were found to be confluent" << std::endl;
+  mCRL2log(log::verbose) << f_cache_hits << " confluence conditions were found among the previously proven conditions." << std::endl;
 
   f_intermediate = std::vector<std::size_t>();
 }
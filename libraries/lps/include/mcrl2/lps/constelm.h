@@ -13,6 +13,10 @@
 #define MCRL2_LPS_CONSTELM_H
 
 #include "mcrl2/lps/detail/lps_algorithm.h"
+#include <atomic>
+#include <deque>
+#include <numeric>
+#include <thread>
 
 namespace mcrl2
 {
@@ -37,6 +41,9 @@ class constelm_algorithm: public lps::detail::lps_algorithm<Specification>
     /// \brief Maps process parameters to their index.
     std::map<data::variable, std::size_t> m_index_of;
 
+    /// \brief The process parameters, in the order of the process.
+    std::vector<data::variable> m_parameters;
+
     /// \brief The rewriter used by the constelm algorithm.
     const DataRewriter& R;
 
@@ -101,6 +108,39 @@ class constelm_algorithm: public lps::detail::lps_algorithm<Specification>
       return true;
     }
 
+    /// \brief The next state expressions d_j := g_ij of a summand, with j the index of d_j.
+    typedef std::vector<std::pair<std::size_t, data::data_expression> > next_state_vector;
+
+    /// \brief Returns true if the condition c_i may not be false under sigma.
+    bool is_enabled(const data::data_expression& c_i, const data::mutable_map_substitution<>& sigma, const DataRewriter& rewr) const
+    {
+      return m_ignore_conditions || rewr(c_i, sigma) != data::sort_bool::false_();
+    }
+
+    /// \brief Returns the positions in g_i of the next state expressions g_ij that may change the constant parameter d_j.
+    /// \details Neither sigma nor G is modified, so this function may be called for several summands in parallel,
+    /// provided that each thread uses its own rewriter.
+    std::vector<std::size_t> changed_parameters(const data::data_expression& c_i,
+                                                const next_state_vector& g_i,
+                                                const std::vector<bool>& G,
+                                                const data::mutable_map_substitution<>& sigma,
+                                                const DataRewriter& rewr) const
+    {
+      std::vector<std::size_t> result;
+      if (is_enabled(c_i, sigma, rewr))
+      {
+        for (std::size_t k = 0; k < g_i.size(); k++)
+        {
+          const auto& [j, g_ij] = g_i[k];
+          if (G[j] && rewr(g_ij, sigma) != sigma(m_parameters[j]))
+          {
+            result.push_back(k);
+          }
+        }
+      }
+      return result;
+    }
+
   public:
 
     /// \brief Constructor
@@ -112,10 +152,14 @@ class constelm_algorithm: public lps::detail::lps_algorithm<Specification>
     {}
 
     /// \brief Computes constant parameters
+    /// \details Summands are only examined again if one of the variables in their condition or next
+    /// state expressions is no longer constant. If number_of_threads is larger than one, the summands
+    /// that must be examined are rewritten in parallel, after which the changes are applied in order.
     /// \param instantiate_global_variables If true, the algorithm is allowed to instantiate free variables
     /// as a side effect
     /// \param ignore_conditions If true, the algorithm is allowed to ignore the conditions in the LPS.
-    data::mutable_map_substitution<> compute_constant_parameters(bool instantiate_global_variables = false, bool ignore_conditions = false)
+    /// \param number_of_threads The number of threads used to rewrite summands.
+    data::mutable_map_substitution<> compute_constant_parameters(bool instantiate_global_variables = false, bool ignore_conditions = false, std::size_t number_of_threads = 1)
     {
       using utilities::detail::contains;
 
@@ -142,9 +186,10 @@ class constelm_algorithm: public lps::detail::lps_algorithm<Specification>
       {
         m_index_of[v] = index++;
       }
+      m_parameters.assign(d.begin(), d.end());
 
-      std::set<data::variable> G(d.begin(), d.end());
-      std::set<data::variable> dG;
+      // G[j] is true if parameter d_j is (still) constant
+      std::vector<bool> G(m_parameters.size(), true);
       auto di = d.begin();
       auto ei = e.begin();
       for (; di != d.end(); ++di, ++ei)
@@ -157,68 +202,165 @@ class constelm_algorithm: public lps::detail::lps_algorithm<Specification>
         }
         else
         {
-          G.erase(*di);
+          G[m_index_of[*di]] = false;
         }
       }
 
-      // undo contains undo information of instantiations of free variables
-      std::map<data::variable, std::set<data::variable> > undo;
+      // Collect the conditions and the next state expressions of the summands, and for each
+      // variable the summands that must be examined again if the variable is no longer constant.
+      const auto& summands = process.action_summands();
+      std::vector<data::data_expression> c;
+      std::vector<next_state_vector> g;
+      std::map<data::variable, std::vector<std::size_t> > dependent_summands;
+      for (std::size_t i = 0; i < summands.size(); i++)
+      {
+        c.push_back(summands[i].condition());
+        g.emplace_back();
+        std::set<data::variable> V = m_ignore_conditions ? std::set<data::variable>() : data::find_free_variables(c.back());
+        for (const data::assignment& a: summands[i].assignments())
+        {
+          g.back().emplace_back(m_index_of[a.lhs()], a.rhs());
+          data::find_free_variables(a.rhs(), std::inserter(V, V.end()));
+        }
+        for (const data::variable& v: V)
+        {
+          dependent_summands[v].push_back(i);
+        }
+      }
 
-      do
+      // The summands that must be examined, in the order in which they are examined.
+      std::deque<std::size_t> todo;
+      std::vector<bool> in_todo(summands.size(), true);
+      for (std::size_t i = 0; i < summands.size(); i++)
       {
-        dG.clear();
-        for (const auto& summand: process.action_summands())
+        todo.push_back(i);
+      }
+      auto reexamine = [&](const data::variable& v)
+      {
+        auto k = dependent_summands.find(v);
+        if (k != dependent_summands.end())
         {
-          const data::data_expression& c_i = summand.condition();
-          if (m_ignore_conditions || (R(c_i, sigma) != data::sort_bool::false_()))
+          for (std::size_t i: k->second)
           {
-            for (const data::variable& j: G)
+            if (!in_todo[i])
             {
-              if (dG.find(j) != dG.end())
-              {
-                continue;
-              }
-              std::size_t index_j = m_index_of[j];
-              const data::variable& d_j = j;
-              data::data_expression g_ij = super::next_state(summand, d_j);
+              in_todo[i] = true;
+              todo.push_back(i);
+            }
+          }
+        }
+      };
 
-              if (R(g_ij, sigma) != R(d_j, sigma))
-              {
-                LOG_PARAMETER_CHANGE(d_j, R(d_j, sigma), R(g_ij, sigma), sigma, "POSSIBLE CHANGE FOR PARAMETER ");
-                data::data_expression z = R(g_ij, sigma);
-                if (is_variable(z) && contains(global_variables, atermpp::down_cast<data::variable>(z)))
-                {
-                  sigma[atermpp::down_cast<data::variable>(z)] = r[index_j];
-                  undo[d_j].insert(atermpp::down_cast<data::variable>(z));
-                }
-                else
-                {
-                  dG.insert(d_j);
-                  sigma[d_j] = d_j; // erase d_j
-                  for (const data::variable& w: undo[d_j])
-                  {
-                    sigma[w] = w; // erase *w
-                  }
-                  undo[d_j].clear();
-                }
-              }
-              else
+      // undo contains undo information of instantiations of free variables
+      std::vector<std::set<data::variable> > undo(m_parameters.size());
+
+      // Removes parameter d_j from G if g_ij changes it, for the next state expressions g_ij at the positions K in g[i].
+      auto update_parameters = [&](std::size_t i, const std::vector<std::size_t>& K)
+      {
+        for (std::size_t k: K)
+        {
+          const auto& [j, g_ij] = g[i][k];
+          if (!G[j])
+          {
+            continue;
+          }
+          const data::variable& d_j = m_parameters[j];
+          data::data_expression Rd_j = R(d_j, sigma);
+          data::data_expression z = R(g_ij, sigma);
+          if (z != Rd_j)
+          {
+            LOG_PARAMETER_CHANGE(d_j, Rd_j, z, sigma, "POSSIBLE CHANGE FOR PARAMETER ");
+            if (is_variable(z) && contains(global_variables, atermpp::down_cast<data::variable>(z)))
+            {
+              sigma[atermpp::down_cast<data::variable>(z)] = r[j];
+              undo[j].insert(atermpp::down_cast<data::variable>(z));
+            }
+            else
+            {
+              G[j] = false;
+              sigma[d_j] = d_j; // erase d_j
+              reexamine(d_j);
+              for (const data::variable& w: undo[j])
               {
-                LOG_PARAMETER_CHANGE(d_j, R(d_j, sigma), R(g_ij, sigma), sigma, "NO CHANGE FOR PARAMETER ");
+                sigma[w] = w; // erase *w
+                reexamine(w);
               }
+              undo[j].clear();
             }
           }
           else
           {
-            LOG_CONDITION(summand.condition(), R(c_i, sigma), sigma, "CONDITION IS FALSE: ");
+            LOG_PARAMETER_CHANGE(d_j, Rd_j, z, sigma, "NO CHANGE FOR PARAMETER ");
+          }
+        }
+      };
+
+      // It is essential that the rewriters are cloned, as one rewriter cannot be used in parallel.
+      std::vector<DataRewriter> thread_rewriters;
+      for (std::size_t t = 1; t < number_of_threads; t++)
+      {
+        thread_rewriters.push_back(DataRewriter(R).clone());
+      }
+
+      std::vector<std::size_t> all_positions;
+      std::vector<std::size_t> batch;
+      std::vector<std::vector<std::size_t> > changes;
+      while (!todo.empty())
+      {
+        if (thread_rewriters.empty())
+        {
+          std::size_t i = todo.front();
+          todo.pop_front();
+          in_todo[i] = false;
+          if (is_enabled(c[i], sigma, R))
+          {
+            all_positions.resize(g[i].size());
+            std::iota(all_positions.begin(), all_positions.end(), 0);
+            update_parameters(i, all_positions);
+          }
+          else
+          {
+            LOG_CONDITION(c[i], R(c[i], sigma), sigma, "CONDITION IS FALSE: ");
+          }
+          continue;
+        }
+
+        // Rewrite all summands in the todo list in parallel, and apply the changes in order.
+        batch.assign(todo.begin(), todo.end());
+        todo.clear();
+        for (std::size_t i: batch)
+        {
+          in_todo[i] = false;
+        }
+        changes.assign(batch.size(), std::vector<std::size_t>());
+        std::atomic<std::size_t> next(0);
+        auto rewrite_batch = [&](const DataRewriter& rewr)
+        {
+          for (std::size_t k = next++; k < batch.size(); k = next++)
+          {
+            changes[k] = changed_parameters(c[batch[k]], g[batch[k]], G, sigma, rewr);
           }
+        };
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t < thread_rewriters.size(); t++)
+        {
+          threads.emplace_back([&, t]() { thread_rewriters[t].thread_initialise(); rewrite_batch(thread_rewriters[t]); });
+        }
+        rewrite_batch(R);
+        for (std::thread& t: threads)
+        {
+          t.join();
         }
-        for (const data::variable& v: dG)
+
+        for (std::size_t k = 0; k < batch.size(); k++)
         {
-          G.erase(v);
+          // The changes were computed for the substitution before the changes of the preceding summands.
+          if (!changes[k].empty() && is_enabled(c[batch[k]], sigma, R))
+          {
+            update_parameters(batch[k], changes[k]);
+          }
         }
       }
-      while (!dG.empty());
 
       return sigma;
     }
@@ -249,9 +391,10 @@ class constelm_algorithm: public lps::detail::lps_algorithm<Specification>
     /// \param instantiate_global_variables If true, the algorithm is allowed to instantiate free variables
     /// as a side effect
     /// \param ignore_conditions If true, the algorithm is allowed to ignore the conditions in the LPS.
-    void run(bool instantiate_global_variables = false, bool ignore_conditions = false)
+    /// \param number_of_threads The number of threads used to rewrite summands.
+    void run(bool instantiate_global_variables = false, bool ignore_conditions = false, std::size_t number_of_threads = 1)
     {
-      data::mutable_map_substitution<> sigma = compute_constant_parameters(instantiate_global_variables, ignore_conditions);
+      data::mutable_map_substitution<> sigma = compute_constant_parameters(instantiate_global_variables, ignore_conditions, number_of_threads);
       remove_parameters(sigma);
     };
 };
@@ -260,11 +403,12 @@ class constelm_algorithm: public lps::detail::lps_algorithm<Specification>
 /// \param spec A linear process specification
 /// \param R A data rewriter
 /// \param instantiate_global_variables If true, free variables may be instantiated as a side effect of the algorithm
+/// \param number_of_threads The number of threads used to rewrite summands
 template <typename DataRewriter, typename Specification>
-void constelm(Specification& spec, const DataRewriter& R, bool instantiate_global_variables = false)
+void constelm(Specification& spec, const DataRewriter& R, bool instantiate_global_variables = false, std::size_t number_of_threads = 1)
 {
   constelm_algorithm<DataRewriter, Specification> algorithm(spec, R);
-  algorithm.run(instantiate_global_variables);
+  algorithm.run(instantiate_global_variables, false, number_of_threads);
 }
 
 } // namespace lps
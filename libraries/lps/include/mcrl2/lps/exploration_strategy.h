@@ -24,7 +24,9 @@ enum exploration_strategy { es_none,
                             es_random,
                             es_value_prioritized,
                             es_value_random_prioritized,
-                            es_highway
+                            es_highway,
+                            es_cluster,
+                            es_external_breadth
                           };
 
 inline
@@ -54,6 +56,14 @@ exploration_strategy parse_exploration_strategy(const std::string& s)
   {
     return es_highway;
   }
+  if (s=="c" || s == "cluster")
+  {
+    return es_cluster;
+  }
+  if (s=="e" || s == "external")
+  {
+    return es_external_breadth;
+  }
   return es_none;
 }
 
@@ -74,6 +84,10 @@ std::string print_exploration_strategy(const exploration_strategy es)
       return "rprioritized";
     case es_highway:
       return "highway";
+    case es_cluster:
+      return "cluster";
+    case es_external_breadth:
+      return "external";
     default:
       throw mcrl2::runtime_error("unknown exploration strategy");
   }
@@ -118,6 +132,10 @@ inline std::string description(const exploration_strategy strat)
       return "prioritize actions on its first argument being of sort Nat (see option --prioritized), and randomly select one of these to obtain a prioritized random simulation (option is experimental)";
     case es_highway:
       return "highway search. Only part of the state space is explored, by restricting the size of the todo list. N.B. The implementation deviates slightly from the published version.";
+    case es_cluster:
+      return "clustered search. States are explored in batches taken from the front of the todo list, in which states with the same values for the parameters in the conditions of the summands are grouped. Each batch is explored summand by summand, which improves the locality of rewriting and enumeration caching (see --cached).";
+    case es_external_breadth:
+      return "external breadth-first search. Only the current and the next level of the search are kept in memory. The other levels are stored on disk (see --external-dir), and duplicate states are detected per level by merging the new states with the levels on disk. Not available for stochastic specifications or in combination with --threads.";
     default:
       throw mcrl2::runtime_error("unknown exploration_strategy");
   }
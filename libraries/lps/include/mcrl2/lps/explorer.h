@@ -12,9 +12,12 @@
 #ifndef MCRL2_LPS_EXPLORER_H
 #define MCRL2_LPS_EXPLORER_H
 
+#include <numeric>
 #include <random>
 #include <thread>
+#include <tuple>
 #include <type_traits>
+#include <unordered_map>
 #include "mcrl2/utilities/detail/io.h"
 #include "mcrl2/utilities/skip.h"
 #include "mcrl2/atermpp/standard_containers/deque.h"
@@ -25,12 +28,15 @@
 #include "mcrl2/data/substitution_utility.h"
 #include "mcrl2/lps/detail/instantiate_global_variables.h"
 #include "mcrl2/lps/explorer_options.h"
+#include "mcrl2/lps/external_state_map.h"
+#include "mcrl2/lps/find.h"
 #include "mcrl2/lps/find_representative.h"
 #include "mcrl2/lps/one_point_rule_rewrite.h"
 #include "mcrl2/lps/order_summand_variables.h"
 #include "mcrl2/lps/replace_constants_by_variables.h"
 #include "mcrl2/lps/resolve_name_clashes.h"
 #include "mcrl2/lps/stochastic_state.h"
+#include "mcrl2/lps/stubborn_sets.h"
 
 namespace mcrl2::lps {
 
@@ -74,6 +80,13 @@ class todo_set
 
     virtual void choose_element(state& result) = 0;
 
+    /// \brief Chooses the states that are explored together. By default this is a single state.
+    virtual void choose_elements(std::vector<state>& result)
+    {
+      result.resize(1);
+      choose_element(result.front());
+    }
+
     virtual void insert(const state& s) = 0;
 
     virtual void finish_state()
@@ -204,6 +217,102 @@ class highway_todo_set : public todo_set
     }
 };
 
+/// \brief Todo set that hands out states in batches, taken from the front of the todo list. Within a batch,
+/// states are grouped on the values of a sequence of parameters, such that states that share the values of
+/// the first k parameters are adjacent for every k.
+class cluster_todo_set : public todo_set
+{
+  protected:
+    std::vector<std::size_t> m_parameters; // The positions of the parameters on which states are grouped.
+    std::size_t m_batch_size;
+    std::size_t m_batch_remaining = 0;     // The number of states at the front of todo that form the current batch.
+
+    // Reorders the first m_batch_size states of todo. Values are ordered on their first occurrence, such that
+    // the order does not depend on the addresses of terms.
+    void make_batch()
+    {
+      const std::size_t n = std::min(m_batch_size, todo.size());
+      m_batch_remaining = n;
+      if (m_parameters.empty() || n < 2)
+      {
+        return;
+      }
+
+      // The key of state i consists of the ranks of its values at the positions keys[i * m, ..., i * m + m - 1].
+      const std::size_t m = m_parameters.size();
+      std::vector<std::unordered_map<data::data_expression, std::size_t>> ranks(m);
+      std::vector<std::size_t> keys(n * m);
+      std::vector<data::data_expression> values;
+      for (std::size_t i = 0; i < n; i++)
+      {
+        const state& s = todo[i];
+        values.assign(s.begin(), s.end());
+        for (std::size_t k = 0; k < m; k++)
+        {
+          std::unordered_map<data::data_expression, std::size_t>& rank = ranks[k];
+          keys[i * m + k] = rank.insert({values[m_parameters[k]], rank.size()}).first->second;
+        }
+      }
+
+      std::vector<std::size_t> order(n);
+      std::iota(order.begin(), order.end(), 0);
+      std::stable_sort(order.begin(), order.end(), [&](std::size_t i, std::size_t j)
+        {
+          return std::lexicographical_compare(keys.begin() + i * m, keys.begin() + (i + 1) * m, keys.begin() + j * m, keys.begin() + (j + 1) * m);
+        });
+      std::vector<state> batch;
+      batch.reserve(n);
+      for (std::size_t i: order)
+      {
+        batch.push_back(todo[i]);
+      }
+      std::copy(batch.begin(), batch.end(), todo.begin());
+    }
+
+  public:
+    template<typename ForwardIterator>
+    cluster_todo_set(ForwardIterator first, ForwardIterator last, std::vector<std::size_t> parameters, std::size_t batch_size)
+      : todo_set(first, last),
+        m_parameters(std::move(parameters)),
+        m_batch_size(batch_size)
+    {}
+
+    explicit cluster_todo_set(const state& init, std::vector<std::size_t> parameters, std::size_t batch_size)
+      : todo_set(init),
+        m_parameters(std::move(parameters)),
+        m_batch_size(batch_size)
+    {}
+
+    void choose_element(state& result) override
+    {
+      if (m_batch_remaining == 0)
+      {
+        make_batch();
+      }
+      result = todo.front();
+      todo.pop_front();
+      m_batch_remaining--;
+    }
+
+    void choose_elements(std::vector<state>& result) override
+    {
+      if (m_batch_remaining == 0)
+      {
+        make_batch();
+      }
+      result.assign(todo.begin(), todo.begin() + m_batch_remaining);
+      for (; m_batch_remaining > 0; m_batch_remaining--)
+      {
+        todo.pop_front();
+      }
+    }
+
+    void insert(const state& s) override
+    {
+      todo.push_back(s);
+    }
+};
+
 template <typename Summand>
 const stochastic_distribution& summand_distribution(const Summand& /* summand */)
 {
@@ -246,8 +355,23 @@ struct explorer_summand
   mutable atermpp::unordered_map<atermpp::term_appl<data::data_expression>, atermpp::term_list<data::data_expression_list>> local_cache;
   mutable std::shared_ptr<std::mutex> cache_mutex;
 
+  // the indices of the process parameters that are read and written by the summand
+  std::vector<std::size_t> read;
+  std::vector<std::size_t> write;
+
+  // attributes for successor caching
+  bool cache_successors;
+  std::vector<data::variable> read_parameters;
+  atermpp::function_symbol f_read;
+  atermpp::function_symbol f_transition;
+
+  // Maps the values of the read parameters to the transitions of the summand. A transition
+  // is stored as a term f_transition(actions, time, d_1, ..., d_k), with d_1, ..., d_k the
+  // values of the written parameters.
+  mutable atermpp::unordered_map<atermpp::term_appl<data::data_expression>, atermpp::term_list<atermpp::aterm_appl>> successor_cache;
+
   template <typename ActionSummand>
-  explorer_summand(const ActionSummand& summand, std::size_t summand_index, const data::variable_list& process_parameters, caching cache_strategy_)
+  explorer_summand(const ActionSummand& summand, std::size_t summand_index, const data::variable_list& process_parameters, caching cache_strategy_, bool cache_successors_ = false)
     : variables(summand.summation_variables()),
       condition(summand.condition()),
       multi_action(summand.multi_action()),
@@ -255,7 +379,8 @@ struct explorer_summand
       next_state(make_data_expression_vector(summand.next_state(process_parameters))),
       index(summand_index),
       cache_strategy(cache_strategy_),
-      cache_mutex(new std::mutex)
+      cache_mutex(new std::mutex),
+      cache_successors(cache_successors_)
   {
     gamma = free_variables(summand.condition(), process_parameters);
     if (cache_strategy_ == caching::global)
@@ -263,6 +388,36 @@ struct explorer_summand
       gamma.insert(gamma.begin(), data::variable());
     }
     f_gamma = atermpp::function_symbol("@gamma", gamma.size());
+    compute_read_write_parameters(process_parameters);
+    f_read = atermpp::function_symbol("@read", read.size());
+    f_transition = atermpp::function_symbol("@transition", write.size() + 2);
+  }
+
+  // Computes the parameters that are read and written by the summand, based on syntactic occurrences.
+  void compute_read_write_parameters(const data::variable_list& process_parameters)
+  {
+    std::set<data::variable> FV = data::find_free_variables(condition);
+    lps::find_free_variables(multi_action, std::inserter(FV, FV.end()));
+    std::size_t j = 0;
+    for (const data::variable& x: process_parameters)
+    {
+      if (next_state[j] != x)
+      {
+        write.push_back(j);
+        data::find_free_variables(next_state[j], std::inserter(FV, FV.end()));
+      }
+      j++;
+    }
+    j = 0;
+    for (const data::variable& x: process_parameters)
+    {
+      if (FV.find(x) != FV.end())
+      {
+        read.push_back(j);
+        read_parameters.push_back(x);
+      }
+      j++;
+    }
   }
 
   template <typename T>
@@ -311,6 +466,18 @@ struct explorer_summand
                               );
     }
   }
+
+  // Computes the key of the successor cache, i.e. the values of the read parameters.
+  void compute_read_key(atermpp::term_appl<data::data_expression>& key,
+                        data::mutable_indexed_substitution<>& sigma) const
+  {
+    atermpp::make_term_appl(key, f_read, read_parameters.begin(), read_parameters.end(),
+                                      [&](data::data_expression& result, const data::variable& x)
+                                      {
+                                        sigma.apply(x, result);
+                                      }
+                           );
+  }
 };
 
 inline
@@ -335,7 +502,7 @@ class explorer: public abortable
 {
   public:
     using state_type = typename std::conditional<Stochastic, stochastic_state, state>::type;
-    using state_index_type = typename std::conditional<Stochastic, std::list<std::size_t>, std::size_t>::type;
+    using state_index_type = typename std::conditional<Stochastic, std::vector<std::size_t>, std::size_t>::type;
     static constexpr bool is_stochastic = Stochastic;
     static constexpr bool is_timed = Timed;
 
@@ -374,6 +541,20 @@ class explorer: public abortable
     std::vector<explorer_summand> m_regular_summands;
     std::vector<explorer_summand> m_confluent_summands;
 
+    // The positions of the parameters on which the cluster search strategy groups states, most frequently
+    // occurring in the conditions of the summands first.
+    std::vector<std::size_t> m_cluster_parameters;
+
+    // The number of lookups in the enumeration and successor caches, and the number of these that are hits.
+    std::atomic<std::size_t> m_cache_lookups{0};
+    std::atomic<std::size_t> m_cache_hits{0};
+
+    // The stubborn sets of the regular summands, if partial order reduction is applied, and the number of states
+    // that are explored partially together with the number of transitions that are skipped in these states.
+    std::unique_ptr<stubborn_sets> m_stubborn_sets;
+    std::atomic<std::size_t> m_reduced_states{0};
+    std::atomic<std::size_t> m_skipped_transitions{0};
+
     volatile bool m_must_abort = false;
 
     // N.B. The keys are stored in term_appl instead of data_expression_list for performance reasons.
@@ -381,6 +562,10 @@ class explorer: public abortable
 
     indexed_set_for_states_type m_discovered;
 
+    // The states of the external breadth-first search, and the number of states it has discovered.
+    std::unique_ptr<external_state_map> m_external_states;
+    std::size_t m_external_state_count = 0;
+
     // used by make_timed_state, to avoid needless creation of vectors
     mutable std::vector<data::data_expression> timed_state;
 
@@ -468,6 +653,7 @@ class explorer: public abortable
                     [](const data::data_expression& x) { return x == real_zero(); }
         );
         data::remove_assignments(sigma, distribution.variables());
+        join_duplicate_targets(result, rewr);
         if (m_options.check_probabilities)
         {
           check_stochastic_state(result, rewr);
@@ -561,6 +747,121 @@ class explorer: public abortable
     // It is assumed that the substitution sigma contains the assignments corresponding to the current state.
     template <typename SummandSequence, typename ReportTransition = utilities::skip>
     void generate_transitions(
+      const explorer_summand& summand,
+      const SummandSequence& confluent_summands,
+      data::mutable_indexed_substitution<>& sigma,
+      data::rewriter& rewr,
+      data::data_expression& condition,
+      state_type& s1,
+      atermpp::term_appl<data::data_expression>& key,
+      data::enumerator_algorithm<>& enumerator,
+      data::enumerator_identifier_generator& id_generator,
+      ReportTransition report_transition = ReportTransition()
+    )
+    {
+      if constexpr (!Stochastic)
+      {
+        // N.B. Successor caching cannot be combined with confluence reduction, since the
+        // representative of a successor depends on the parameters that are not read.
+        if (summand.cache_successors && !m_recursive && confluent_summands.empty())
+        {
+          generate_cached_transitions(summand, confluent_summands, sigma, rewr, condition, s1, key, enumerator, id_generator, report_transition);
+          return;
+        }
+      }
+      generate_summand_transitions(summand, confluent_summands, sigma, rewr, condition, s1, key, enumerator, id_generator, report_transition);
+    }
+
+    // Generates outgoing transitions for a summand using the successor cache of the summand.
+    // The cache maps the values of the parameters read by the summand to the actions and the
+    // values of the written parameters, such that no rewriting is needed if there is a hit.
+    template <typename SummandSequence, typename ReportTransition>
+    void generate_cached_transitions(
+      const explorer_summand& summand,
+      const SummandSequence& confluent_summands,
+      data::mutable_indexed_substitution<>& sigma,
+      data::rewriter& rewr,
+      data::data_expression& condition,
+      state_type& s1,
+      atermpp::term_appl<data::data_expression>& key,
+      data::enumerator_algorithm<>& enumerator,
+      data::enumerator_identifier_generator& id_generator,
+      ReportTransition& report_transition
+    )
+    {
+      bool must_lock = atermpp::detail::GlobalThreadSafe && m_options.number_of_threads > 1;
+      summand.compute_read_key(key, sigma);
+      if (must_lock)
+      {
+        summand.cache_mutex->lock();
+      }
+      auto q = summand.successor_cache.find(key);
+      m_cache_lookups.fetch_add(1, std::memory_order_relaxed);
+      if (q == summand.successor_cache.end())
+      {
+        if (must_lock)
+        {
+          summand.cache_mutex->unlock();
+        }
+        atermpp::term_appl<data::data_expression> read_key = key;
+        atermpp::term_list<atermpp::aterm_appl> transitions;
+        std::vector<atermpp::aterm> arguments(summand.write.size() + 2);
+        generate_summand_transitions(summand, confluent_summands, sigma, rewr, condition, s1, key, enumerator, id_generator,
+          [&](const lps::multi_action& a, const state_type& s)
+          {
+            arguments[0] = a.actions();
+            arguments[1] = a.time();
+            for (std::size_t k = 0; k < summand.write.size(); k++)
+            {
+              arguments[k + 2] = s[summand.write[k]];
+            }
+            transitions.push_front(atermpp::aterm_appl(summand.f_transition, arguments.begin(), arguments.end()));
+          }
+        );
+        if (must_lock)
+        {
+          summand.cache_mutex->lock();
+        }
+        q = summand.successor_cache.insert({read_key, transitions}).first;
+      }
+      else
+      {
+        m_cache_hits.fetch_add(1, std::memory_order_relaxed);
+      }
+      atermpp::term_list<atermpp::aterm_appl> transitions = q->second;
+      if (must_lock)
+      {
+        summand.cache_mutex->unlock();
+      }
+
+      // The successor is the current state in which the written parameters are replaced.
+      std::vector<data::data_expression> values(m_n);
+      for (std::size_t j = 0; j < m_n; j++)
+      {
+        values[j] = sigma(m_process_parameters[j]);
+      }
+      for (const atermpp::aterm_appl& t: transitions)
+      {
+        for (std::size_t k = 0; k < summand.write.size(); k++)
+        {
+          values[summand.write[k]] = atermpp::down_cast<data::data_expression>(t[k + 2]);
+        }
+        lps::make_state(s1, values.begin(), m_n);
+        if constexpr (utilities::is_applicable<ReportTransition,state_type,void>::value)
+        {
+          report_transition(s1);
+        }
+        else
+        {
+          report_transition(lps::multi_action(atermpp::down_cast<process::action_list>(t[0]), atermpp::down_cast<data::data_expression>(t[1])), s1);
+        }
+      }
+    }
+
+    // Generates outgoing transitions for a summand, and reports them via the callback function report_transition.
+    // It is assumed that the substitution sigma contains the assignments corresponding to the current state.
+    template <typename SummandSequence, typename ReportTransition = utilities::skip>
+    void generate_summand_transitions(
       const explorer_summand& summand,
       const SummandSequence& confluent_summands,
       data::mutable_indexed_substitution<>& sigma,
@@ -677,6 +978,7 @@ class explorer: public abortable
         auto& cache = summand.cache_strategy == caching::global ? global_cache : summand.local_cache;
         cache_lock(summand, global_cache_mutex);
         atermpp::unordered_map<atermpp::term_appl<data::data_expression>, atermpp::term_list<data::data_expression_list>>::iterator q = cache.find(key);
+        m_cache_lookups.fetch_add(1, std::memory_order_relaxed);
         if (q == cache.end())
         {
           cache_unlock(summand, global_cache_mutex);
@@ -703,6 +1005,7 @@ class explorer: public abortable
         else
         { 
           cache_unlock(summand, global_cache_mutex);
+          m_cache_hits.fetch_add(1, std::memory_order_relaxed);
         }
 
         // state_type s1;
@@ -853,6 +1156,34 @@ class explorer: public abortable
       return result;
     }
 
+    // Returns the positions of the parameters that occur in the conditions of the regular summands, ordered on the
+    // number of conditions in which they occur. States that agree on these parameters enable the same summands.
+    std::vector<std::size_t> cluster_parameters() const
+    {
+      std::vector<std::size_t> count(m_n, 0);
+      for (const explorer_summand& summand: m_regular_summands)
+      {
+        for (const data::variable& v: summand.gamma)
+        {
+          auto i = std::find(m_process_parameters.begin(), m_process_parameters.end(), v);
+          if (i != m_process_parameters.end())
+          {
+            count[i - m_process_parameters.begin()]++;
+          }
+        }
+      }
+      std::vector<std::size_t> result;
+      for (std::size_t j = 0; j < m_n; j++)
+      {
+        if (count[j] > 0)
+        {
+          result.push_back(j);
+        }
+      }
+      std::stable_sort(result.begin(), result.end(), [&](std::size_t i, std::size_t j) { return count[i] > count[j]; });
+      return result;
+    }
+
     std::unique_ptr<todo_set> make_todo_set(const state& init)
     {
       switch (m_options.search_strategy)
@@ -860,6 +1191,7 @@ class explorer: public abortable
         case lps::es_breadth: return std::make_unique<breadth_first_todo_set>(init);
         case lps::es_depth: return std::make_unique<depth_first_todo_set>(init);
         case lps::es_highway: return std::make_unique<highway_todo_set>(init, m_options.highway_todo_max);
+        case lps::es_cluster: return std::make_unique<cluster_todo_set>(init, m_cluster_parameters, m_options.cluster_batch_size);
         default: throw mcrl2::runtime_error("unsupported search strategy");
       }
     }
@@ -872,6 +1204,7 @@ class explorer: public abortable
         case lps::es_breadth: return std::make_unique<breadth_first_todo_set>(first, last);
         case lps::es_depth: return std::make_unique<depth_first_todo_set>(first, last);
         case lps::es_highway: return std::make_unique<highway_todo_set>(first, last, m_options.highway_todo_max);
+        case lps::es_cluster: return std::make_unique<cluster_todo_set>(first, last, m_cluster_parameters, m_options.cluster_batch_size);
         default: throw mcrl2::runtime_error("unsupported search strategy");
       }
     }
@@ -930,8 +1263,23 @@ class explorer: public abortable
         }
         else
         {
-          m_regular_summands.emplace_back(summand, i, m_global_lpsspec.process().process_parameters(), cache_strategy);
+          m_regular_summands.emplace_back(summand, i, m_global_lpsspec.process().process_parameters(), cache_strategy, m_options.successor_cache);
+        }
+      }
+      m_cluster_parameters = cluster_parameters();
+
+      if (m_options.partial_order_reduction)
+      {
+        if (Stochastic || Timed)
+        {
+          throw mcrl2::runtime_error("Partial order reduction is not supported for stochastic or timed specifications.");
         }
+        if (!m_confluent_summands.empty())
+        {
+          throw mcrl2::runtime_error("Partial order reduction cannot be combined with confluence reduction.");
+        }
+        m_stubborn_sets = std::make_unique<stubborn_sets>(m_regular_summands, m_process_parameters, m_options.visible_actions, m_global_lpsspec.data(),
+                                                          [&](const data::data_expression& x) { return m_global_rewr(x, m_global_sigma); });
       }
     }
 
@@ -962,6 +1310,111 @@ class explorer: public abortable
       return s;
     }
 
+    // Takes a batch of states from todo, and generates the outgoing transitions of these states summand by
+    // summand, such that the terms and caches that are used for a summand are reused for all states in the
+    // batch. The transitions of batch[k] are put in transitions[k], in the order in which they are generated
+    // when batch[k] is explored on its own.
+    template <typename SummandSequence>
+    void generate_batch_transitions(
+      std::unique_ptr<todo_set>& todo,
+      const SummandSequence& regular_summands,
+      const SummandSequence& confluent_summands,
+      data::mutable_indexed_substitution<>& sigma,
+      data::rewriter& rewr,
+      data::data_expression& condition,
+      state_type& s1,
+      atermpp::term_appl<data::data_expression>& key,
+      data::enumerator_algorithm<>& enumerator,
+      data::enumerator_identifier_generator& id_generator,
+      std::vector<state>& batch,
+      std::vector<std::vector<std::tuple<std::size_t, lps::multi_action, state_type>>>& transitions
+    )
+    {
+      todo->choose_elements(batch);
+      transitions.resize(batch.size());
+      for (auto& t: transitions)
+      {
+        t.clear();
+      }
+
+      // Only the parameters in which a state differs from the previously explored state are assigned to sigma.
+      // This is cheap, since the states in a cluster share most of their values.
+      std::vector<std::vector<data::data_expression>> values(batch.size());
+      for (std::size_t k = 0; k < batch.size(); k++)
+      {
+        values[k].assign(batch[k].begin(), batch[k].end());
+      }
+      const std::vector<data::data_expression>* assigned = nullptr;
+      for (const explorer_summand& summand: regular_summands)
+      {
+        for (std::size_t k = 0; k < batch.size(); k++)
+        {
+          for (std::size_t j = 0; j < m_n; j++)
+          {
+            if (assigned == nullptr || (*assigned)[j] != values[k][j])
+            {
+              sigma[m_process_parameters[j]] = values[k][j];
+            }
+          }
+          assigned = &values[k];
+          generate_transitions(summand, confluent_summands, sigma, rewr, condition, s1, key, enumerator, id_generator,
+            [&](const lps::multi_action& a, const state_type& s1_)
+            {
+              if constexpr (Timed)
+              {
+                const data::data_expression& t = batch[k][m_n];
+                if (a.has_time() && less_equal(a.time(), t, sigma, rewr))
+                {
+                  return;
+                }
+              }
+              transitions[k].emplace_back(summand.index, a, s1_);
+            }
+          );
+        }
+      }
+    }
+
+    // Generates the outgoing transitions of the state that is assigned to sigma, and computes a stubborn set. The
+    // transitions of regular_summands[i] are put in transitions[i].
+    template <typename SummandSequence>
+    void generate_stubborn_set_transitions(
+      const SummandSequence& regular_summands,
+      data::mutable_indexed_substitution<>& sigma,
+      data::rewriter& rewr,
+      data::data_expression& condition,
+      state_type& s1,
+      atermpp::term_appl<data::data_expression>& key,
+      data::enumerator_algorithm<>& enumerator,
+      data::enumerator_identifier_generator& id_generator,
+      std::vector<std::vector<std::pair<lps::multi_action, state_type>>>& transitions,
+      stubborn_sets::summand_set& enabled,
+      stubborn_sets::summand_set& stubborn
+    )
+    {
+      assert(regular_summands.size() == m_stubborn_sets->size());
+      transitions.resize(regular_summands.size());
+      enabled.resize(regular_summands.size());
+      for (std::size_t i = 0; i < regular_summands.size(); i++)
+      {
+        transitions[i].clear();
+        generate_transitions(regular_summands[i], SummandSequence(), sigma, rewr, condition, s1, key, enumerator, id_generator,
+          [&](const lps::multi_action& a, const state_type& s1_)
+          {
+            transitions[i].emplace_back(a, s1_);
+          }
+        );
+        enabled[i] = !transitions[i].empty();
+      }
+      m_stubborn_sets->compute(enabled,
+        [&](const data::data_expression& x)
+        {
+          rewr(condition, x, sigma);
+          return condition == data::sort_bool::false_();
+        },
+        stubborn);
+    }
+
     template <
       typename StateType,
       typename SummandSequence,
@@ -996,8 +1449,89 @@ class explorer: public abortable
       data::data_expression condition;   // The condition is used often, and it is effective not to declare it whenever it is used.
       state_type state_;                 // The same holds for state.
       std::vector<state> dummy;
+      std::vector<std::size_t> stochastic_targets; // The indices of the targets of a stochastic transition.
       std::unique_ptr<todo_set> thread_todo=make_todo_set(dummy.begin(),dummy.end()); // The new states for each process are temporarily stored in this vector for each thread. 
       atermpp::term_appl<data::data_expression> key;  
+      std::vector<state> batch;          // The batch of states that is explored by the cluster search strategy.
+      std::vector<std::vector<std::tuple<std::size_t, lps::multi_action, state_type>>> batch_transitions;
+      std::vector<std::vector<std::pair<lps::multi_action, state_type>>> summand_transitions; // The transitions per summand, for partial order reduction.
+      stubborn_sets::summand_set enabled;
+      stubborn_sets::summand_set stubborn;
+
+      // Reports a transition from source to s1 via the callback functions, and adds the targets that are new to thread_todo.
+      auto process_transition = [&](const state& source, std::size_t source_index, std::size_t summand_index, const lps::multi_action& a, const state_type& s1)
+      {
+        if constexpr (Stochastic)
+        { 
+          // The targets of s1 are distinct, see compute_stochastic_state.
+          std::vector<std::size_t>& s1_index = stochastic_targets;
+          s1_index.clear();
+          for (const state& s1_: s1.states)
+          { 
+            std::pair<std::size_t,bool> p = discovered.insert(s1_, thread_index);
+            if (p.second)  // Index is newly added. 
+            { 
+              discover_state(thread_index, s1_, p.first);
+              thread_todo->insert(s1_);
+            }
+            s1_index.push_back(p.first);
+          }
+
+          examine_transition(thread_index, m_options.number_of_threads, source, source_index, a, s1, s1_index, summand_index);
+        } 
+        else 
+        { 
+          std::size_t s1_index; 
+          if constexpr (Timed)
+          { 
+            s1_index = discovered.index(s1,thread_index);
+            if (s1_index >= discovered.size())
+            {   
+              const data::data_expression& t = source[m_n];
+              const data::data_expression& t1 = a.has_time() ? a.time() : t;
+              make_timed_state(state_, s1, t1);
+              s1_index = discovered.insert(state_, thread_index).first;
+              discover_state(thread_index, state_, s1_index);
+              thread_todo->insert(state_);
+            } 
+          }
+          else
+          { 
+            std::pair<std::size_t,bool> p = discovered.insert(s1, thread_index);
+            s1_index=p.first;
+            if (p.second)  // Index is newly added. 
+            {
+              discover_state(thread_index, s1, s1_index);
+              thread_todo->insert(s1); 
+            }
+          }
+
+          examine_transition(thread_index, m_options.number_of_threads, source, source_index, a, s1, s1_index, summand_index);
+        }
+      };
+
+      // Moves some of the states of this thread to the global todo buffer, if other threads are idle.
+      state shared_state;
+      auto share_states = [&]()
+      {
+        if (number_of_idle_processes>0 && thread_todo->size()>1)
+        {
+          if (todo->size()<m_options.number_of_threads)  // Not thread_safe, but number is not so important.
+          // if (todo->size()<=number_of_idle_processes)  // Not thread_safe, but number is not so important.
+          {
+            if (atermpp::detail::GlobalThreadSafe && m_options.number_of_threads>1) m_exclusive_state_access.lock();
+// std::cerr << "\nSHARE STATE " << todo->size() << "    " << thread_todo->size() << "    " <<  thread_index << "   " << number_of_active_processes << "\n";
+            // move 25% of the states of this thread to the global todo buffer.
+            for(std::size_t i=0; i<std::min(thread_todo->size()-1,1+(thread_todo->size()/4)); ++i)  
+            {
+              thread_todo->choose_element(shared_state);
+              todo->insert(shared_state);
+            }
+            if (atermpp::detail::GlobalThreadSafe && m_options.number_of_threads>1) m_exclusive_state_access.unlock();
+          }
+        }
+      };
+
       if (atermpp::detail::GlobalThreadSafe && m_options.number_of_threads>1) m_exclusive_state_access.lock();
 // std::cerr << "HAVE LOCK " << thread_index << "     " << number_of_active_processes << "\n";
       while (number_of_active_processes>0 || !todo->empty())
@@ -1013,10 +1547,76 @@ class explorer: public abortable
 
           while (!thread_todo->empty() && !m_must_abort)
           { 
+            if (m_options.search_strategy == lps::es_cluster)
+            {
+              generate_batch_transitions(thread_todo, regular_summands, confluent_summands, thread_sigma, thread_rewr, condition, state_, key,
+                                         thread_enumerator, thread_id_generator, batch, batch_transitions);
+              for (std::size_t k = 0; k < batch.size() && !m_must_abort; k++)
+              {
+                current_state = batch[k];
+                std::size_t s_index = discovered.index(current_state,thread_index);
+                start_state(thread_index, current_state, s_index);
+                for (const auto& [summand_index, a, s1]: batch_transitions[k])
+                {
+                  process_transition(current_state, s_index, summand_index, a, s1);
+                }
+                share_states();
+                finish_state(thread_index, current_state, s_index, thread_todo->size());
+                thread_todo->finish_state();
+              }
+              continue;
+            }
+
             thread_todo->choose_element(current_state);
             std::size_t s_index = discovered.index(current_state,thread_index);
             start_state(thread_index, current_state, s_index);
             data::add_assignments(thread_sigma, m_process_parameters, current_state);
+
+            if constexpr (!Stochastic && !Timed)
+            {
+              if (m_stubborn_sets)
+              {
+                generate_stubborn_set_transitions(regular_summands, thread_sigma, thread_rewr, condition, state_, key,
+                                                  thread_enumerator, thread_id_generator, summand_transitions, enabled, stubborn);
+                bool expand_fully = false;
+                for (std::size_t i = stubborn.find_first(); i != stubborn_sets::summand_set::npos; i = stubborn.find_next(i))
+                {
+                  for (const auto& [a, s1]: summand_transitions[i])
+                  {
+                    process_transition(current_state, s_index, regular_summands[i].index, a, s1);
+
+                    // The cycle proviso: a state is explored fully if one of its successors was discovered before
+                    // it, such that every cycle contains a state that is explored fully.
+                    expand_fully = expand_fully || (!m_options.visible_actions.empty() && discovered.index(s1, thread_index) <= s_index);
+                  }
+                }
+                if (!expand_fully && (enabled - stubborn).any())
+                {
+                  m_reduced_states++;
+                }
+                for (std::size_t i = enabled.find_first(); i != stubborn_sets::summand_set::npos; i = enabled.find_next(i))
+                {
+                  if (stubborn[i])
+                  {
+                    continue;
+                  }
+                  if (!expand_fully)
+                  {
+                    m_skipped_transitions += summand_transitions[i].size();
+                    continue;
+                  }
+                  for (const auto& [a, s1]: summand_transitions[i])
+                  {
+                    process_transition(current_state, s_index, regular_summands[i].index, a, s1);
+                  }
+                }
+                share_states();
+                finish_state(thread_index, current_state, s_index, thread_todo->size());
+                thread_todo->finish_state();
+                continue;
+              }
+            }
+
             for (const explorer_summand& summand: regular_summands)
             {   
               generate_transitions(
@@ -1039,74 +1639,11 @@ class explorer: public abortable
                       return;
                     }
                   } 
-                  if constexpr (Stochastic)
-                  { 
-                    std::list<std::size_t> s1_index;
-                    const auto& S1 = s1.states;
-                    // TODO: join duplicate targets
-                    for (const state& s1_: S1)
-                    { 
-                      std::size_t k = discovered.index(s1_,thread_index);
-                      if (k >= discovered.size())
-                      { 
-                        thread_todo->insert(s1_);
-                        k = discovered.insert(s1_, thread_index).first;
-                        discover_state(thread_index, s1_, k);
-                      }
-                      s1_index.push_back(k);
-                    }
-
-                    examine_transition(thread_index, m_options.number_of_threads, current_state, s_index, a, s1, s1_index, summand.index);
-                  } 
-                  else 
-                  { 
-                    std::size_t s1_index; 
-                    if constexpr (Timed)
-                    { 
-                      s1_index = discovered.index(s1,thread_index);
-                      if (s1_index >= discovered.size())
-                      {   
-                        const data::data_expression& t = current_state[m_n];
-                        const data::data_expression& t1 = a.has_time() ? a.time() : t;
-                        make_timed_state(state_, s1, t1);
-                        s1_index = discovered.insert(state_, thread_index).first;
-                        discover_state(thread_index, state_, s1_index);
-                        thread_todo->insert(state_);
-                      } 
-                    }
-                    else
-                    { 
-                      std::pair<std::size_t,bool> p = discovered.insert(s1, thread_index);
-                      s1_index=p.first;
-                      if (p.second)  // Index is newly added. 
-                      {
-                        discover_state(thread_index, s1, s1_index);
-                        thread_todo->insert(s1); 
-                      }
-                    }
-
-                    examine_transition(thread_index, m_options.number_of_threads, current_state, s_index, a, s1, s1_index, summand.index);
-                  }
+                  process_transition(current_state, s_index, summand.index, a, s1);
                 }
               );
             }
-            if (number_of_idle_processes>0 && thread_todo->size()>1)
-            {
-              if (todo->size()<m_options.number_of_threads)  // Not thread_safe, but number is not so important.
-              // if (todo->size()<=number_of_idle_processes)  // Not thread_safe, but number is not so important.
-              {
-                if (atermpp::detail::GlobalThreadSafe && m_options.number_of_threads>1) m_exclusive_state_access.lock();
-// std::cerr << "\nSHARE STATE " << todo->size() << "    " << thread_todo->size() << "    " <<  thread_index << "   " << number_of_active_processes << "\n";
-                // move 25% of the states of this thread to the global todo buffer.
-                for(std::size_t i=0; i<std::min(thread_todo->size()-1,1+(thread_todo->size()/4)); ++i)  
-                {
-                  thread_todo->choose_element(current_state);
-                  todo->insert(current_state);
-                }
-                if (atermpp::detail::GlobalThreadSafe && m_options.number_of_threads>1) m_exclusive_state_access.unlock();
-              }
-            }
-
+            share_states();
             finish_state(thread_index, current_state, s_index, thread_todo->size());
             thread_todo->finish_state();
           }
@@ -1144,6 +1681,185 @@ class explorer: public abortable
 
 
 
+    void report_partial_order_reduction() const
+    {
+      if (m_stubborn_sets)
+      {
+        mCRL2log(log::verbose) << "Partial order reduction explored " << m_reduced_states << " states partially, and skipped "
+                               << m_skipped_transitions << " transitions in these states." << std::endl;
+      }
+    }
+
+    void report_cache_hits() const
+    {
+      if (m_cache_lookups > 0)
+      {
+        mCRL2log(log::verbose) << "The caches were hit in " << m_cache_hits << " of " << m_cache_lookups << " lookups ("
+                               << (100 * m_cache_hits) / m_cache_lookups << "%)." << std::endl;
+      }
+    }
+
+    // Breadth-first search in which only the current and the next level of the search are kept in memory.
+    // The levels are stored on disk in m_external_states. The successors of the states in a level are
+    // collected first, and those that are not in the current level are looked up on disk in a single batch.
+    // The new states get their indices in the order in which they are reported, which is the same order as
+    // in the breadth-first search of generate_state_space_thread.
+    template <
+      typename SummandSequence,
+      typename DiscoverState,
+      typename ExamineTransition,
+      typename StartState,
+      typename FinishState
+    >
+    void generate_state_space_external(
+      const state& s0,
+      const SummandSequence& regular_summands,
+      const SummandSequence& confluent_summands,
+      DiscoverState discover_state,
+      ExamineTransition examine_transition,
+      StartState start_state,
+      FinishState finish_state
+    )
+    {
+      if (m_options.number_of_threads > 1)
+      {
+        throw mcrl2::runtime_error("External breadth-first search can only be used in single thread mode.");
+      }
+
+      struct level_transition
+      {
+        std::size_t summand_index;
+        lps::multi_action action;
+        std::size_t target; // The position of the target in successors.
+      };
+
+      m_external_states = std::make_unique<external_state_map>(m_options.external_directory);
+      external_state_map& stored = *m_external_states;
+
+      data::data_expression condition;
+      state_type state_;
+      atermpp::term_appl<data::data_expression> key;
+      state target;
+
+      std::vector<state> level{ s0 };  // The states of the current level.
+      std::size_t first_index = 0;     // The index of the first state of the current level.
+      std::unordered_map<state, std::size_t> level_indices{ { s0, 0 } };
+      std::vector<state> next_level;
+      std::vector<state> successors;   // The distinct targets of the transitions of the current level.
+      std::unordered_map<state, std::size_t> successor_positions;
+      std::vector<std::size_t> successor_indices;
+      std::vector<level_transition> transitions;
+      std::vector<std::size_t> first_transition; // The position in transitions of the first transition of each state in level.
+      std::vector<external_state_map::candidate> candidates;
+
+      m_external_state_count = 1;
+      discover_state(0, s0, 0);
+      stored.add_level(level);
+
+      while (!level.empty() && !m_must_abort)
+      {
+        // Generate the transitions of the current level.
+        transitions.clear();
+        first_transition.clear();
+        successors.clear();
+        successor_positions.clear();
+        for (const state& s: level)
+        {
+          first_transition.push_back(transitions.size());
+          data::add_assignments(m_global_sigma, m_process_parameters, s);
+          for (const explorer_summand& summand: regular_summands)
+          {
+            generate_transitions(summand, confluent_summands, m_global_sigma, m_global_rewr, condition, state_, key,
+                                 m_global_enumerator, m_global_id_generator,
+              [&](const lps::multi_action& a, const state& s1)
+              {
+                if constexpr (Timed)
+                {
+                  const data::data_expression& t = s[m_n];
+                  if (a.has_time() && less_equal(a.time(), t, m_global_sigma, m_global_rewr))
+                  {
+                    return;
+                  }
+                  make_timed_state(target, s1, a.has_time() ? a.time() : t);
+                }
+                else
+                {
+                  target = s1;
+                }
+                auto [i, inserted] = successor_positions.emplace(target, successors.size());
+                if (inserted)
+                {
+                  successors.push_back(target);
+                }
+                transitions.push_back(level_transition{ summand.index, a, i->second });
+              }
+            );
+          }
+        }
+        first_transition.push_back(transitions.size());
+
+        // Determine the indices of the successors that are in the current level or on disk.
+        successor_indices.assign(successors.size(), external_state_map::undefined_index());
+        candidates.clear();
+        for (std::size_t i = 0; i < successors.size(); i++)
+        {
+          auto j = level_indices.find(successors[i]);
+          if (j != level_indices.end())
+          {
+            successor_indices[i] = j->second;
+          }
+          else
+          {
+            candidates.emplace_back();
+            stored.make_candidate(candidates.back(), successors[i], i);
+          }
+        }
+        stored.find(candidates, stored.number_of_levels() - 1);
+        for (const external_state_map::candidate& c: candidates)
+        {
+          successor_indices[c.number] = c.index;
+        }
+        candidates.clear();
+
+        // Report the transitions, and give the new states their indices.
+        next_level.clear();
+        for (std::size_t k = 0; k < level.size() && !m_must_abort; k++)
+        {
+          const state& s = level[k];
+          const std::size_t s_index = first_index + k;
+          start_state(0, s, s_index);
+          for (std::size_t j = first_transition[k]; j < first_transition[k + 1]; j++)
+          {
+            const level_transition& tr = transitions[j];
+            std::size_t& s1_index = successor_indices[tr.target];
+            if (s1_index == external_state_map::undefined_index())
+            {
+              s1_index = m_external_state_count++;
+              next_level.push_back(successors[tr.target]);
+              discover_state(0, successors[tr.target], s1_index);
+            }
+            examine_transition(0, 1, s, s_index, tr.action, successors[tr.target], s1_index, tr.summand_index);
+          }
+          finish_state(0, s, s_index, level.size() - k - 1 + next_level.size());
+        }
+
+        first_index += level.size();
+        std::swap(level, next_level);
+        level_indices.clear();
+        for (std::size_t k = 0; k < level.size(); k++)
+        {
+          level_indices.emplace(level[k], first_index + k);
+        }
+        if (!level.empty())
+        {
+          stored.add_level(level);
+        }
+      }
+
+      mCRL2log(log::verbose) << "External breadth-first search stored " << stored.number_of_levels() << " levels, and wrote "
+                             << stored.bytes_written() << " bytes to and read " << stored.bytes_read() << " bytes from disk." << std::endl;
+    }
+
     // pre: s0 is in normal form
     template <
       typename StateType,
@@ -1173,6 +1889,25 @@ class explorer: public abortable
       assert(number_of_threads>0);
       const std::size_t initialisation_thread_index= (number_of_threads==1?0:1);
       m_recursive = recursive;
+      m_cache_lookups = 0;
+      m_cache_hits = 0;
+      m_reduced_states = 0;
+      m_skipped_transitions = 0;
+
+      if (m_options.search_strategy == es_external_breadth)
+      {
+        if constexpr (Stochastic)
+        {
+          throw mcrl2::runtime_error("External breadth-first search is not supported for stochastic specifications.");
+        }
+        else
+        {
+          generate_state_space_external(s0, regular_summands, confluent_summands, discover_state, examine_transition, start_state, finish_state);
+        }
+        report_cache_hits();
+        m_must_abort = false;
+        return;
+      }
       std::unique_ptr<todo_set> todo;
       discovered.clear(initialisation_thread_index);
 
@@ -1182,17 +1917,15 @@ class explorer: public abortable
         const auto& S = s0_.states;
         todo = make_todo_set(S.begin(), S.end());
         discovered.clear();
-        std::list<std::size_t> s0_index;
+        std::vector<std::size_t> s0_index;
         for (const state& s: S)
         {
-          // TODO: join duplicate targets
-          std::size_t s_index = discovered.index(s);
-          if (s_index >= discovered.size())
+          std::pair<std::size_t,bool> p = discovered.insert(s, initialisation_thread_index);
+          if (p.second)
           {
-            s_index = discovered.insert(s, initialisation_thread_index).first;
-            discover_state(initialisation_thread_index, s, s_index);
+            discover_state(initialisation_thread_index, s, p.first);
           }
-          s0_index.push_back(s_index);
+          s0_index.push_back(p.first);
         }
         discover_initial_state(s0_, s0_index);
       }
@@ -1247,6 +1980,8 @@ class explorer: public abortable
                                    m_global_rewr, m_global_sigma);  
       }
 
+      report_cache_hits();
+      report_partial_order_reduction();
       m_must_abort = false;
     }
 
@@ -1637,6 +2372,19 @@ std::cerr << "DFS EXPLORATION NOT THREAD SAFE\n";
       return m_discovered;
     }
 
+    /// \brief Returns the states that were stored on disk by the external breadth-first search.
+    const external_state_map& external_states() const
+    {
+      assert(m_external_states);
+      return *m_external_states;
+    }
+
+    /// \brief Returns the number of states that have been discovered.
+    std::size_t number_of_states(const std::size_t thread_index = 0) const
+    {
+      return m_options.search_strategy == es_external_breadth ? m_external_state_count : m_discovered.size(thread_index);
+    }
+
     const std::vector<explorer_summand>& regular_summands() const
     {
       return m_regular_summands;
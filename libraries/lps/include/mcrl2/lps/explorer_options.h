@@ -31,6 +31,7 @@ struct explorer_options
   bool remove_unused_rewrite_rules = false;
   bool cached = false;
   bool global_cache = false;
+  bool successor_cache = false;
   bool confluence = false;
   bool detect_deadlock = false;
   bool detect_nondeterminism = false;
@@ -43,17 +44,21 @@ struct explorer_options
   bool save_at_end = false;
   bool dfs_recursive = false;
   bool discard_lts_state_labels = false;
+  bool partial_order_reduction = false;
   bool rewrite_actions = true;    // If false, this option prevents rewriting actions.
                                   // Rewriting actions is only needed if they occur in the
                                   // generated lts, or in traces. 
   std::size_t max_states = std::numeric_limits<std::size_t>::max();
   std::size_t max_traces = 0;
   std::size_t highway_todo_max = std::numeric_limits<std::size_t>::max();
+  std::size_t cluster_batch_size = 1024;
   std::size_t number_of_threads = 1;
   std::string trace_prefix;
+  std::string external_directory; // The directory of the files of the external breadth-first search. If empty, the directory for temporary files is used.
   std::set<core::identifier_string> trace_actions;
   std::set<lps::multi_action> trace_multiactions;
   std::set<core::identifier_string> actions_internal_for_divergencies;
+  std::set<core::identifier_string> visible_actions; // The actions of which the traces are preserved by partial order reduction.
   std::string confluence_action = "ctau";
 };
 
@@ -64,8 +69,10 @@ std::ostream& operator<<(std::ostream& out, const explorer_options& options)
   out << "search-strategy = " << options.search_strategy << std::endl;
   out << "cached = " << std::boolalpha << options.cached << std::endl;
   out << "global-cache = " << std::boolalpha << options.global_cache << std::endl;
+  out << "successor-cache = " << std::boolalpha << options.successor_cache << std::endl;
   out << "confluence = " << std::boolalpha << options.confluence << std::endl;
   out << "confluence-action = " << options.confluence << std::endl;
+  out << "partial-order-reduction = " << std::boolalpha << options.partial_order_reduction << std::endl;
   out << "one-point-rule-rewrite = " << std::boolalpha << options.one_point_rule_rewrite << std::endl;
   out << "replace-constants-by-variables = " << std::boolalpha << options.replace_constants_by_variables << std::endl;
   out << "remove-unused-rewrite-rules = " << std::boolalpha << options.remove_unused_rewrite_rules << std::endl;
@@ -83,11 +90,14 @@ std::ostream& operator<<(std::ostream& out, const explorer_options& options)
   out << "max-states = " << options.max_states << std::endl;
   out << "max-traces = " << options.max_traces << std::endl;
   out << "todo-max = " << options.highway_todo_max << std::endl;
+  out << "cluster-batch-size = " << options.cluster_batch_size << std::endl;
   out << "threads = " << options.number_of_threads << std::endl;
   out << "trace-prefix = " << options.trace_prefix << std::endl;
+  out << "external-dir = " << options.external_directory << std::endl;
   out << "trace-actions = " << core::detail::print_set(options.trace_actions) << std::endl;
   out << "trace-multiactions = " << core::detail::print_set(options.trace_multiactions) << std::endl;
   out << "actions-internal-for-divergencies = " << core::detail::print_set(options.actions_internal_for_divergencies) << std::endl;
+  out << "visible-actions = " << core::detail::print_set(options.visible_actions) << std::endl;
   return out;
 }
 
@@ -0,0 +1,408 @@
+// Author(s): Wieger Wesselink
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file mcrl2/lps/external_state_map.h
+/// \brief A set of states that is stored on disk, level by level, for external breadth-first search.
+
+#ifndef MCRL2_LPS_EXTERNAL_STATE_MAP_H
+#define MCRL2_LPS_EXTERNAL_STATE_MAP_H
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "mcrl2/atermpp/aterm_int.h"
+#include "mcrl2/lps/state.h"
+#include "mcrl2/utilities/exception.h"
+
+namespace mcrl2 {
+
+namespace lps {
+
+namespace detail {
+
+inline
+void write_varint(std::string& out, std::size_t x)
+{
+  while (x >= 0x80)
+  {
+    out.push_back(static_cast<char>((x & 0x7f) | 0x80));
+    x >>= 7;
+  }
+  out.push_back(static_cast<char>(x));
+}
+
+inline
+std::size_t read_varint(const char*& p)
+{
+  std::size_t result = 0;
+  for (unsigned int shift = 0; ; shift += 7)
+  {
+    const auto byte = static_cast<unsigned char>(*p++);
+    result |= static_cast<std::size_t>(byte & 0x7f) << shift;
+    if (byte < 0x80)
+    {
+      return result;
+    }
+  }
+}
+
+// The tags that start the representation of a (sub)term.
+enum serialized_term_tag: char
+{
+  tag_reference,                  // followed by the number of a term that was written before
+  tag_integer,                    // followed by the value of an aterm_int
+  tag_application,                // followed by the number of a function symbol that was written before, and the arguments
+  tag_application_with_new_symbol // followed by the name and the arity of a function symbol, and the arguments
+};
+
+/// \brief Writes terms to a string, such that two terms are equal if and only if their strings are equal.
+/// \details Subterms and function symbols that occur more than once in a term are written once, and are
+///          referred to by the order in which they were written afterwards.
+class term_serializer
+{
+  protected:
+    std::unordered_map<atermpp::aterm, std::size_t> m_terms;
+    std::unordered_map<atermpp::function_symbol, std::size_t> m_function_symbols;
+
+    void write(std::string& out, const atermpp::aterm& t)
+    {
+      auto i = m_terms.find(t);
+      if (i != m_terms.end())
+      {
+        out.push_back(tag_reference);
+        write_varint(out, i->second);
+        return;
+      }
+
+      if (t.type_is_int())
+      {
+        out.push_back(tag_integer);
+        write_varint(out, atermpp::down_cast<atermpp::aterm_int>(t).value());
+      }
+      else
+      {
+        const atermpp::function_symbol& f = t.function();
+        auto j = m_function_symbols.find(f);
+        if (j == m_function_symbols.end())
+        {
+          out.push_back(tag_application_with_new_symbol);
+          write_varint(out, f.name().size());
+          out.append(f.name());
+          write_varint(out, f.arity());
+          m_function_symbols.emplace(f, m_function_symbols.size());
+        }
+        else
+        {
+          out.push_back(tag_application);
+          write_varint(out, j->second);
+        }
+        for (const atermpp::aterm& u: static_cast<const atermpp::aterm_appl&>(t))
+        {
+          write(out, u);
+        }
+      }
+      m_terms.emplace(t, m_terms.size());
+    }
+
+  public:
+    /// \brief Appends the representation of t to out.
+    void operator()(std::string& out, const atermpp::aterm& t)
+    {
+      m_terms.clear();
+      m_function_symbols.clear();
+      write(out, t);
+    }
+};
+
+/// \brief Reads terms that were written by a term_serializer.
+class term_deserializer
+{
+  protected:
+    std::vector<atermpp::aterm> m_terms;
+    std::vector<atermpp::function_symbol> m_function_symbols;
+
+    atermpp::aterm read(const char*& p)
+    {
+      const char tag = *p++;
+      if (tag == tag_reference)
+      {
+        return m_terms[read_varint(p)];
+      }
+
+      atermpp::aterm result;
+      if (tag == tag_integer)
+      {
+        result = atermpp::aterm_int(read_varint(p));
+      }
+      else
+      {
+        if (tag == tag_application_with_new_symbol)
+        {
+          const std::size_t size = read_varint(p);
+          std::string name(p, size);
+          p += size;
+          m_function_symbols.emplace_back(name, read_varint(p));
+        }
+        const atermpp::function_symbol f = tag == tag_application_with_new_symbol ? m_function_symbols.back() : m_function_symbols[read_varint(p)];
+        std::vector<atermpp::aterm> arguments;
+        arguments.reserve(f.arity());
+        for (std::size_t i = 0; i < f.arity(); i++)
+        {
+          arguments.push_back(read(p));
+        }
+        result = atermpp::aterm_appl(f, arguments.begin(), arguments.end());
+      }
+      m_terms.push_back(result);
+      return result;
+    }
+
+  public:
+    /// \brief Returns the term of which the representation starts at p.
+    atermpp::aterm operator()(const char* p)
+    {
+      m_terms.clear();
+      m_function_symbols.clear();
+      return read(p);
+    }
+};
+
+} // namespace detail
+
+/// \brief Stores the states of a breadth-first search on disk. Each level of the search is stored in a run file,
+/// in which the states are sorted on the hash of their representation. Duplicate states are detected by merging
+/// a sorted batch of states with the run files. Another file contains all states in the order of their indices.
+class external_state_map
+{
+  public:
+    /// \brief A state for which the index must be looked up.
+    struct candidate
+    {
+      std::string key;     // The representation of the state.
+      std::size_t hash;    // The hash of key.
+      std::size_t number;  // The number of the candidate in the batch.
+      std::size_t index;   // The index of the state, or undefined_index() if it is not stored.
+
+      bool operator<(const candidate& other) const
+      {
+        return hash < other.hash || (hash == other.hash && key < other.key);
+      }
+    };
+
+    static constexpr std::size_t undefined_index()
+    {
+      return std::numeric_limits<std::size_t>::max();
+    }
+
+  protected:
+    std::string m_prefix;                  // The prefix of the names of the files.
+    std::vector<std::string> m_run_files;  // The run file of each level.
+    std::ofstream m_state_file;            // The file with the states in the order of their indices.
+    std::size_t m_size = 0;
+    std::size_t m_bytes_written = 0;
+    mutable std::size_t m_bytes_read = 0;
+    detail::term_serializer m_serialize;
+
+    std::string state_file_name() const
+    {
+      return m_prefix + "states";
+    }
+
+    template <typename T>
+    void write_value(std::ostream& out, const T& x)
+    {
+      out.write(reinterpret_cast<const char*>(&x), sizeof(T));
+      m_bytes_written += sizeof(T);
+    }
+
+    void write_bytes(std::ostream& out, const std::string& s)
+    {
+      write_value(out, static_cast<std::uint32_t>(s.size()));
+      out.write(s.data(), s.size());
+      m_bytes_written += s.size();
+    }
+
+    template <typename T>
+    bool read_value(std::istream& in, T& x) const
+    {
+      in.read(reinterpret_cast<char*>(&x), sizeof(T));
+      m_bytes_read += in.gcount();
+      return static_cast<std::size_t>(in.gcount()) == sizeof(T);
+    }
+
+    void read_bytes(std::istream& in, std::string& s, std::uint32_t size) const
+    {
+      s.resize(size);
+      in.read(s.data(), size);
+      m_bytes_read += size;
+    }
+
+  public:
+    /// \brief Constructor. The files are created in the given directory, or in the directory for temporary
+    /// files if it is empty.
+    explicit external_state_map(const std::string& directory = "")
+    {
+      std::filesystem::path path = directory.empty() ? std::filesystem::temp_directory_path() : std::filesystem::path(directory);
+      std::random_device device;
+      do
+      {
+        m_prefix = (path / ("mcrl2_states_" + std::to_string(device()) + "_")).string();
+      }
+      while (std::filesystem::exists(state_file_name()));
+
+      m_state_file.open(state_file_name(), std::ios::binary);
+      if (!m_state_file)
+      {
+        throw mcrl2::runtime_error("Could not create the file " + state_file_name() + ".");
+      }
+    }
+
+    external_state_map(const external_state_map&) = delete;
+    external_state_map& operator=(const external_state_map&) = delete;
+
+    ~external_state_map()
+    {
+      m_state_file.close();
+      std::error_code error;
+      std::filesystem::remove(state_file_name(), error);
+      for (const std::string& filename: m_run_files)
+      {
+        std::filesystem::remove(filename, error);
+      }
+    }
+
+    /// \brief Returns the number of stored states.
+    std::size_t size() const
+    {
+      return m_size;
+    }
+
+    /// \brief Returns the number of stored levels.
+    std::size_t number_of_levels() const
+    {
+      return m_run_files.size();
+    }
+
+    /// \brief Returns the number of bytes that have been written to disk.
+    std::size_t bytes_written() const
+    {
+      return m_bytes_written;
+    }
+
+    /// \brief Returns the number of bytes that have been read from disk.
+    std::size_t bytes_read() const
+    {
+      return m_bytes_read;
+    }
+
+    /// \brief Sets the key and the hash of c to those of the state s.
+    void make_candidate(candidate& c, const state& s, std::size_t number)
+    {
+      c.key.clear();
+      m_serialize(c.key, s);
+      c.hash = std::hash<std::string_view>()(c.key);
+      c.number = number;
+      c.index = undefined_index();
+    }
+
+    /// \brief Stores the states of a level, which get the indices size(), size() + 1, ... in this order.
+    void add_level(const std::vector<state>& states)
+    {
+      std::vector<candidate> run(states.size());
+      for (std::size_t i = 0; i < states.size(); i++)
+      {
+        make_candidate(run[i], states[i], i);
+        write_bytes(m_state_file, run[i].key);
+      }
+      m_state_file.flush();
+
+      std::sort(run.begin(), run.end());
+      m_run_files.push_back(m_prefix + "level_" + std::to_string(m_run_files.size()));
+      std::ofstream out(m_run_files.back(), std::ios::binary);
+      for (const candidate& c: run)
+      {
+        write_value(out, static_cast<std::uint64_t>(c.hash));
+        write_value(out, static_cast<std::uint64_t>(m_size + c.number));
+        write_bytes(out, c.key);
+      }
+      if (!out || !m_state_file)
+      {
+        throw mcrl2::runtime_error("Could not write the states of level " + std::to_string(m_run_files.size() - 1) + " to disk.");
+      }
+      m_size += states.size();
+    }
+
+    /// \brief Sets the index of the candidates that are stored in one of the first number_of_levels levels.
+    /// The candidates are sorted as a side effect.
+    void find(std::vector<candidate>& candidates, std::size_t number_of_levels)
+    {
+      std::sort(candidates.begin(), candidates.end());
+      std::string key;
+      for (std::size_t level = 0; level < number_of_levels; level++)
+      {
+        std::ifstream in(m_run_files[level], std::ios::binary);
+        auto i = candidates.begin();
+        std::uint64_t hash;
+        std::uint64_t index;
+        std::uint32_t size;
+        while (i != candidates.end() && read_value(in, hash) && read_value(in, index) && read_value(in, size))
+        {
+          while (i != candidates.end() && i->hash < hash)
+          {
+            ++i;
+          }
+          if (i == candidates.end() || i->hash > hash)
+          {
+            in.seekg(size, std::ios::cur);
+            continue;
+          }
+          read_bytes(in, key, size);
+          for (auto j = i; j != candidates.end() && j->hash == hash; ++j)
+          {
+            if (j->key == key)
+            {
+              j->index = index;
+              break;
+            }
+          }
+        }
+      }
+    }
+
+    /// \brief Applies f to the stored states in the order of their indices.
+    template <typename Function>
+    void for_each_state(Function f) const
+    {
+      std::ifstream in(state_file_name(), std::ios::binary);
+      detail::term_deserializer deserialize;
+      std::string key;
+      std::uint32_t size;
+      for (std::size_t i = 0; i < m_size; i++)
+      {
+        if (!read_value(in, size))
+        {
+          throw mcrl2::runtime_error("Could not read the states from " + state_file_name() + ".");
+        }
+        read_bytes(in, key, size);
+        f(atermpp::down_cast<state>(deserialize(key.data())));
+      }
+    }
+};
+
+} // namespace lps
+
+} // namespace mcrl2
+
+#endif // MCRL2_LPS_EXTERNAL_STATE_MAP_H
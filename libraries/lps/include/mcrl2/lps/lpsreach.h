@@ -134,7 +134,7 @@ class lpsreach_algorithm
       m_summand_patterns = compute_read_write_patterns(lpsspec_);
       symbolic::adjust_read_write_patterns(m_summand_patterns, m_options);
 
-      m_variable_order = symbolic::compute_variable_order(m_options.variable_order, m_lts.process_parameters.size());
+      m_variable_order = symbolic::compute_variable_order(m_options.variable_order, m_lts.process_parameters.size(), m_summand_patterns);
       mCRL2log(log::debug) << "variable order = " << core::detail::print_list(m_variable_order) << std::endl;
       m_summand_patterns = symbolic::reorder_read_write_patterns(m_summand_patterns, m_variable_order);
       mCRL2log(log::debug) << symbolic::print_read_write_patterns(m_summand_patterns);
@@ -264,7 +264,7 @@ class lpsreach_algorithm
       return std::make_tuple(union_(visited, todo), minus(todo1, visited), potential_deadlocks);
     }
 
-    ldd run()
+    ldd run(bool report_states = true)
     {
       using namespace sylvan::ldds;
       auto& R = m_lts.summand_groups;
@@ -300,7 +300,14 @@ class lpsreach_algorithm
       }
 
       elapsed_seconds = std::chrono::steady_clock::now() - start;
-      std::cout << "number of states = " << print_size(visited) << " (time = " << std::setprecision(2) << std::fixed << elapsed_seconds.count() << "s)" << std::endl;
+      if (report_states)
+      {
+        std::cout << "number of states = " << print_size(visited) << " (time = " << std::setprecision(2) << std::fixed << elapsed_seconds.count() << "s)" << std::endl;
+      }
+      else
+      {
+        mCRL2log(log::verbose) << "number of states = " << print_size(visited) << " (time = " << std::setprecision(2) << std::fixed << elapsed_seconds.count() << "s)" << std::endl;
+      }
       mCRL2log(log::verbose) << "used variable order = " << core::detail::print_list(m_variable_order) << std::endl;
 
       double total_time = 0.0;
@@ -0,0 +1,311 @@
+// Author(s): Wieger Wesselink
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file mcrl2/lps/short_vector_explorer.h
+/// \brief A group-wise next-state interface on short (projected) state vectors.
+
+#ifndef MCRL2_LPS_SHORT_VECTOR_EXPLORER_H
+#define MCRL2_LPS_SHORT_VECTOR_EXPLORER_H
+
+#include <boost/dynamic_bitset.hpp>
+#include "mcrl2/atermpp/standard_containers/unordered_map.h"
+#include "mcrl2/lps/explorer.h"
+
+namespace mcrl2::lps {
+
+/// \brief A next-state interface on top of the explorer, in which every summand of the LPS
+/// is a group. The successors of a group are computed from a short vector, which contains only
+/// the values of the parameters that are read by the group. The successors are reported as
+/// short vectors that contain only the values of the parameters that are written by the group.
+/// This is the interface that is needed by model checkers that use the PINS interface, and
+/// by symbolic reachability algorithms.
+/// \details The read, write and guard dependencies are determined syntactically, in the same
+/// way as in the PINS interface of ltsmin.h. The computed successors can optionally be cached
+/// per group, with the short vector as a key. This class is not thread safe, since it uses the
+/// global substitution, rewriter and enumerator of the explorer.
+class short_vector_explorer: public explorer<false, false, lps::specification>
+{
+  public:
+    typedef explorer<false, false, lps::specification> super;
+    typedef std::vector<data::data_expression> short_vector;
+
+  protected:
+    using super::m_global_sigma;
+    using super::m_global_rewr;
+    using super::m_global_enumerator;
+    using super::m_global_id_generator;
+    using super::m_process_parameters;
+    using super::m_regular_summands;
+
+    // The read, write and guard dependencies of the groups. Entry (i, j) is true if
+    // group i depends on process parameter j.
+    std::vector<boost::dynamic_bitset<>> m_read_matrix;
+    std::vector<boost::dynamic_bitset<>> m_write_matrix;
+    std::vector<boost::dynamic_bitset<>> m_guard_matrix;
+
+    // The guard dependencies as sorted sequences of parameter indices. The read and write
+    // dependencies are stored in the summands.
+    std::vector<std::vector<std::size_t>> m_guard;
+
+    // Caches that map a short vector of a group to its transitions. A transition is stored as
+    // a term f(actions, time, d_1, ..., d_k), with d_1, ..., d_k the written values.
+    bool m_cache_successors;
+    std::vector<atermpp::unordered_map<atermpp::term_appl<data::data_expression>, atermpp::term_list<atermpp::aterm_appl>>> m_cache;
+
+    const std::vector<explorer_summand> m_no_confluent_summands;
+
+    static boost::dynamic_bitset<> indices_to_bits(const std::vector<std::size_t>& indices, std::size_t n)
+    {
+      boost::dynamic_bitset<> result(n);
+      for (std::size_t j: indices)
+      {
+        result[j] = true;
+      }
+      return result;
+    }
+
+    void compute_dependencies()
+    {
+      std::size_t n = m_process_parameters.size();
+      for (const explorer_summand& summand: m_regular_summands)
+      {
+        std::set<data::variable> FV = data::find_free_variables(summand.condition);
+        std::vector<std::size_t> guard;
+        for (std::size_t j = 0; j < n; j++)
+        {
+          if (FV.find(m_process_parameters[j]) != FV.end())
+          {
+            guard.push_back(j);
+          }
+        }
+        m_read_matrix.push_back(indices_to_bits(summand.read, n));
+        m_write_matrix.push_back(indices_to_bits(summand.write, n));
+        m_guard_matrix.push_back(indices_to_bits(guard, n));
+        m_guard.push_back(guard);
+      }
+      m_cache.resize(m_regular_summands.size());
+    }
+
+    atermpp::aterm_appl make_transition(std::size_t group, const lps::multi_action& a, const state& s1) const
+    {
+      const std::vector<std::size_t>& write = m_regular_summands[group].write;
+      std::vector<atermpp::aterm> args;
+      args.reserve(write.size() + 2);
+      args.push_back(a.actions());
+      args.push_back(a.time());
+      auto i = write.begin();
+      std::size_t j = 0;
+      for (auto k = s1.begin(); i != write.end(); ++k, ++j)
+      {
+        if (j == *i)
+        {
+          args.push_back(*k);
+          ++i;
+        }
+      }
+      return atermpp::aterm_appl(m_regular_summands[group].f_transition, args.begin(), args.end());
+    }
+
+    // Computes the transitions of the given group, and reports them as terms created by make_transition.
+    template <typename ReportTransition>
+    void generate_group_transitions(std::size_t group, const short_vector& src, ReportTransition report_transition)
+    {
+      const std::vector<std::size_t>& read = m_regular_summands[group].read;
+      assert(src.size() == read.size());
+      for (std::size_t k = 0; k < read.size(); k++)
+      {
+        m_global_sigma[m_process_parameters[read[k]]] = src[k];
+      }
+
+      data::data_expression condition;
+      state s1;
+      atermpp::term_appl<data::data_expression> key;
+      super::generate_summand_transitions(
+        m_regular_summands[group],
+        m_no_confluent_summands,
+        m_global_sigma,
+        m_global_rewr,
+        condition,
+        s1,
+        key,
+        m_global_enumerator,
+        m_global_id_generator,
+        [&](const lps::multi_action& a, const state& s)
+        {
+          report_transition(make_transition(group, a, s));
+        }
+      );
+
+      for (std::size_t j: read)
+      {
+        m_global_sigma[m_process_parameters[j]] = m_process_parameters[j];
+      }
+    }
+
+    template <typename ReportTransition>
+    void report_transition_term(std::size_t group, const atermpp::aterm_appl& t, ReportTransition& report_transition) const
+    {
+      short_vector dest;
+      dest.reserve(m_regular_summands[group].write.size());
+      for (auto i = t.begin() + 2; i != t.end(); ++i)
+      {
+        dest.push_back(atermpp::down_cast<data::data_expression>(*i));
+      }
+      report_transition(lps::multi_action(atermpp::down_cast<process::action_list>(t[0]), atermpp::down_cast<data::data_expression>(t[1])), dest);
+    }
+
+  public:
+    /// \brief Constructor.
+    /// \param lpsspec A linear process specification.
+    /// \param options The options of the explorer. Confluence reduction is not supported.
+    /// \param cache_successors If true, the successors of every short vector are cached.
+    short_vector_explorer(const lps::specification& lpsspec, const explorer_options& options, bool cache_successors = false)
+      : super(lpsspec, options),
+        m_cache_successors(cache_successors)
+    {
+      if (options.confluence)
+      {
+        throw mcrl2::runtime_error("Confluence reduction is not supported by the short vector explorer.");
+      }
+      compute_dependencies();
+    }
+
+    /// \brief Returns the number of groups, which equals the number of summands.
+    std::size_t group_count() const
+    {
+      return m_regular_summands.size();
+    }
+
+    /// \brief Returns the length of a full state vector, which equals the number of process parameters.
+    std::size_t state_length() const
+    {
+      return m_process_parameters.size();
+    }
+
+    /// \brief Returns the initial state as a full state vector.
+    short_vector initial_state()
+    {
+      state s0;
+      super::compute_state(s0, super::m_initial_state, m_global_sigma, m_global_rewr);
+      return short_vector(s0.begin(), s0.end());
+    }
+
+    /// \brief Returns the read dependency matrix. Entry (i, j) is true if group i reads parameter j.
+    const std::vector<boost::dynamic_bitset<>>& read_matrix() const
+    {
+      return m_read_matrix;
+    }
+
+    /// \brief Returns the write dependency matrix. Entry (i, j) is true if group i may change parameter j.
+    const std::vector<boost::dynamic_bitset<>>& write_matrix() const
+    {
+      return m_write_matrix;
+    }
+
+    /// \brief Returns the guard dependency matrix. Entry (i, j) is true if the condition of group i
+    /// depends on parameter j.
+    const std::vector<boost::dynamic_bitset<>>& guard_matrix() const
+    {
+      return m_guard_matrix;
+    }
+
+    /// \brief Returns the indices of the parameters that are read by the given group, in increasing order.
+    const std::vector<std::size_t>& read_parameters(std::size_t group) const
+    {
+      return m_regular_summands[group].read;
+    }
+
+    /// \brief Returns the indices of the parameters that are written by the given group, in increasing order.
+    const std::vector<std::size_t>& write_parameters(std::size_t group) const
+    {
+      return m_regular_summands[group].write;
+    }
+
+    /// \brief Returns the indices of the parameters that the condition of the given group depends on.
+    const std::vector<std::size_t>& guard_parameters(std::size_t group) const
+    {
+      return m_guard[group];
+    }
+
+    /// \brief Projects a full state vector on the read parameters of a group.
+    short_vector read_projection(std::size_t group, const short_vector& s) const
+    {
+      short_vector result;
+      result.reserve(m_regular_summands[group].read.size());
+      for (std::size_t j: m_regular_summands[group].read)
+      {
+        result.push_back(s[j]);
+      }
+      return result;
+    }
+
+    /// \brief Updates a full state vector with the values of a write projected vector of a group.
+    void write_projection(std::size_t group, short_vector& s, const short_vector& dest) const
+    {
+      const std::vector<std::size_t>& write = m_regular_summands[group].write;
+      assert(dest.size() == write.size());
+      for (std::size_t k = 0; k < write.size(); k++)
+      {
+        s[write[k]] = dest[k];
+      }
+    }
+
+    /// \brief Computes the transitions of a group.
+    /// \param group The index of a group.
+    /// \param src The values of the read parameters of the group, in the order of read_parameters(group).
+    /// \param report_transition A function that is called with arguments (a, dest) for every transition,
+    /// where a is a multi action, and dest contains the values of the write parameters of the group, in
+    /// the order of write_parameters(group).
+    template <typename ReportTransition>
+    void next_state_short(std::size_t group, const short_vector& src, ReportTransition report_transition)
+    {
+      if (!m_cache_successors)
+      {
+        generate_group_transitions(group, src, [&](const atermpp::aterm_appl& t) { report_transition_term(group, t, report_transition); });
+        return;
+      }
+
+      atermpp::term_appl<data::data_expression> key(m_regular_summands[group].f_read, src.begin(), src.end());
+      auto& cache = m_cache[group];
+      auto i = cache.find(key);
+      if (i == cache.end())
+      {
+        atermpp::term_list<atermpp::aterm_appl> transitions;
+        generate_group_transitions(group, src, [&](const atermpp::aterm_appl& t) { transitions.push_front(t); });
+        i = cache.insert({key, transitions}).first;
+      }
+      for (const atermpp::aterm_appl& t: static_cast<atermpp::term_list<atermpp::aterm_appl>&>(i->second))
+      {
+        report_transition_term(group, t, report_transition);
+      }
+    }
+
+    /// \brief Computes the transitions of a group for a full state vector.
+    /// \param report_transition A function that is called with arguments (a, s1) for every transition,
+    /// where a is a multi action and s1 a full state vector.
+    template <typename ReportTransition>
+    void next_state_long(std::size_t group, const short_vector& s, ReportTransition report_transition)
+    {
+      next_state_short(group, read_projection(group, s), [&](const lps::multi_action& a, const short_vector& dest)
+        {
+          short_vector s1 = s;
+          write_projection(group, s1, dest);
+          report_transition(a, s1);
+        });
+    }
+
+    /// \brief Returns the number of short vectors in the cache of the given group.
+    std::size_t cache_size(std::size_t group) const
+    {
+      return m_cache[group].size();
+    }
+};
+
+} // namespace mcrl2::lps
+
+#endif // MCRL2_LPS_SHORT_VECTOR_EXPLORER_H
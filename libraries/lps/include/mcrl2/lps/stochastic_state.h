@@ -15,6 +15,7 @@
 #include "mcrl2/data/print.h"
 #include "mcrl2/data/rewriter.h"
 #include "mcrl2/lps/state.h"
+#include <unordered_map>
 
 namespace mcrl2 {
 
@@ -113,6 +114,51 @@ void check_stochastic_state(const stochastic_state& s, const data::rewriter& rew
   }
 }
 
+/// \brief Joins equal elements of s.states by adding up their probabilities, such that the
+/// elements of s.states become unique. The first occurrence of each state is kept.
+inline
+void join_duplicate_targets(stochastic_state& s, const data::rewriter& rewr)
+{
+  const std::size_t n = s.states.size();
+  if (n <= 1)
+  {
+    return;
+  }
+
+  // For small distributions a linear search is cheaper than maintaining a hash table.
+  const bool use_hash_table = n > 16;
+  std::unordered_map<state, std::size_t> positions;
+  std::size_t size = 0; // The joined targets are stored at positions [0, size).
+  for (std::size_t i = 0; i < n; i++)
+  {
+    std::size_t j = size;
+    if (use_hash_table)
+    {
+      j = positions.emplace(s.states[i], size).first->second;
+    }
+    else
+    {
+      j = std::find(s.states.begin(), s.states.begin() + size, s.states[i]) - s.states.begin();
+    }
+
+    if (j == size)
+    {
+      if (i != size)
+      {
+        s.states[size] = s.states[i];
+        s.probabilities[size] = s.probabilities[i];
+      }
+      size++;
+    }
+    else
+    {
+      s.probabilities[j] = rewr(data::sort_real::plus(s.probabilities[j], s.probabilities[i]));
+    }
+  }
+  s.states.resize(size);
+  s.probabilities.resize(size);
+}
+
 } // namespace lps
 
 } // namespace mcrl2
@@ -0,0 +1,395 @@
+// Author(s): Wieger Wesselink
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file mcrl2/lps/stubborn_sets.h
+/// \brief Stubborn sets of summands, for partial order reduction during state space exploration.
+
+#ifndef MCRL2_LPS_STUBBORN_SETS_H
+#define MCRL2_LPS_STUBBORN_SETS_H
+
+#include <set>
+#include <boost/dynamic_bitset.hpp>
+#include "mcrl2/data/data_specification.h"
+#include "mcrl2/data/join.h"
+#include "mcrl2/lps/find.h"
+
+namespace mcrl2 {
+
+namespace lps {
+
+/// \brief Computes stubborn sets of summands of a linear process.
+/// \details Two summands are dependent if one of them writes a process parameter that the other reads or writes,
+/// and they may be enabled at the same time. Two summands cannot be enabled at the same time if their conditions
+/// require different values of a process parameter, e.g. s == 1 and s == 2. A disabled summand can only become
+/// enabled by a summand that writes a parameter of a conjunct of its condition that is false. These relations are
+/// computed once, based on syntactic occurrences of the process parameters. In a state, a stubborn set is closed
+/// under the dependency relation for its enabled summands, and contains a necessary enabling set for each of its
+/// disabled summands. Exploring only the transitions of the enabled summands in a stubborn set preserves deadlocks.
+/// If visible actions are given, a stubborn set that contains an enabled summand with a visible action contains all
+/// summands with a visible action. Together with a cycle proviso, that must be enforced by the caller, this also
+/// preserves the traces of visible actions.
+class stubborn_sets
+{
+  public:
+    typedef boost::dynamic_bitset<> summand_set;
+
+  protected:
+    // For some of the process parameters, the values that they must have for a condition to hold.
+    typedef std::map<std::size_t, std::set<data::data_expression>> value_map;
+
+    // A conjunct of the condition of a summand that does not contain summation variables, with the
+    // summands that write one of its parameters.
+    struct conjunct
+    {
+      data::data_expression expression;
+      summand_set writers;
+    };
+
+    std::size_t m_number_of_summands = 0;
+    std::vector<summand_set> m_dependent;        // m_dependent[i] contains the summands that are dependent on summand i
+    std::vector<std::vector<conjunct>> m_conjuncts;  // the conjuncts of summand i, ordered on the number of writers
+    std::vector<summand_set> m_condition_writers;  // the summands that write a parameter of the condition of summand i
+    summand_set m_visible;                       // the summands with a visible action
+
+    template <typename Summand>
+    static bool is_visible(const Summand& summand, const std::set<core::identifier_string>& visible_actions)
+    {
+      for (const process::action& a: summand.multi_action.actions())
+      {
+        if (visible_actions.find(a.label().name()) != visible_actions.end())
+        {
+          return true;
+        }
+      }
+      return visible_actions.find(core::identifier_string("tau")) != visible_actions.end() && summand.multi_action.actions().empty();
+    }
+
+    // Returns the summands that write one of the process parameters in v.
+    summand_set writers(const std::set<data::variable>& v,
+                        const std::map<data::variable, std::size_t>& parameter_index,
+                        const std::vector<summand_set>& parameter_writers) const
+    {
+      summand_set result(m_number_of_summands);
+      for (const data::variable& x: v)
+      {
+        auto i = parameter_index.find(x);
+        if (i != parameter_index.end())
+        {
+          result |= parameter_writers[i->second];
+        }
+      }
+      return result;
+    }
+
+    // Returns the normal form of x if it is a value that only contains constructors, and an empty expression otherwise.
+    template <typename Rewrite>
+    static data::data_expression value(const data::data_expression& x, const std::set<data::function_symbol>& constructors, Rewrite rewrite)
+    {
+      data::data_expression result = rewrite(x);
+      if (!data::find_free_variables(result).empty())
+      {
+        return data::data_expression();
+      }
+      for (const data::function_symbol& f: data::find_function_symbols(result))
+      {
+        if (constructors.find(f) == constructors.end())
+        {
+          return data::data_expression();
+        }
+      }
+      return result;
+    }
+
+    // Returns for some of the process parameters the values that they must have for x to hold, by recognizing
+    // equalities between process parameters and values that are combined with conjunctions, disjunctions and
+    // if-then-else expressions.
+    template <typename Rewrite>
+    static value_map required_values(const data::data_expression& x,
+                                     const std::map<data::variable, std::size_t>& parameter_index,
+                                     const std::set<data::function_symbol>& constructors,
+                                     Rewrite rewrite)
+    {
+      value_map result;
+      if (data::sort_bool::is_and_application(x))
+      {
+        result = required_values(data::sort_bool::left(x), parameter_index, constructors, rewrite);
+        for (auto& [p, values]: required_values(data::sort_bool::right(x), parameter_index, constructors, rewrite))
+        {
+          auto i = result.find(p);
+          if (i == result.end())
+          {
+            result[p] = values;
+          }
+          else
+          {
+            std::set<data::data_expression> both;
+            std::set_intersection(i->second.begin(), i->second.end(), values.begin(), values.end(), std::inserter(both, both.end()));
+            i->second = both;
+          }
+        }
+      }
+      else if (data::sort_bool::is_or_application(x) || data::is_if_application(x))
+      {
+        const data::data_expression& x1 = data::sort_bool::is_or_application(x) ? data::sort_bool::left(x) : data::application(x)[1];
+        const data::data_expression& x2 = data::sort_bool::is_or_application(x) ? data::sort_bool::right(x) : data::application(x)[2];
+        value_map result1 = required_values(x1, parameter_index, constructors, rewrite);
+        value_map result2 = required_values(x2, parameter_index, constructors, rewrite);
+        for (auto& [p, values]: result1)
+        {
+          auto i = result2.find(p);
+          if (i != result2.end())
+          {
+            values.insert(i->second.begin(), i->second.end());
+            result[p] = values;
+          }
+        }
+      }
+      else if (data::is_equal_to_application(x))
+      {
+        for (std::size_t k = 0; k < 2; k++)
+        {
+          const data::data_expression& parameter = k == 0 ? data::binary_left1(x) : data::binary_right1(x);
+          const data::data_expression& v = k == 0 ? data::binary_right1(x) : data::binary_left1(x);
+          if (data::is_variable(parameter))
+          {
+            auto i = parameter_index.find(atermpp::down_cast<data::variable>(parameter));
+            data::data_expression v1;
+            if (i != parameter_index.end() && (v1 = value(v, constructors, rewrite)) != data::data_expression())
+            {
+              result[i->second].insert(v1);
+              break;
+            }
+          }
+        }
+      }
+      return result;
+    }
+
+    // Returns true if x and y require different values of a process parameter.
+    static bool are_exclusive(const value_map& x, const value_map& y)
+    {
+      for (const auto& [p, values]: x)
+      {
+        auto i = y.find(p);
+        if (i != y.end() && std::none_of(values.begin(), values.end(), [&](const data::data_expression& v) { return i->second.count(v) > 0; }))
+        {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    // Adds a necessary enabling set of the disabled summand i to result. The first conjunct that is false
+    // has the fewest writers.
+    template <typename IsFalse>
+    void add_necessary_enabling_set(std::size_t i, IsFalse is_false, summand_set& result) const
+    {
+      for (const conjunct& c: m_conjuncts[i])
+      {
+        if (is_false(c.expression))
+        {
+          result |= c.writers;
+          return;
+        }
+      }
+      result |= m_condition_writers[i];
+    }
+
+  public:
+    stubborn_sets() = default;
+
+    /// \brief Constructor.
+    /// \param summands A sequence of summands with attributes condition, variables, multi_action, read and write,
+    /// where read and write contain the indices of the process parameters that are read and written.
+    /// \param process_parameters The process parameters.
+    /// \param visible_actions The names of the actions of which the traces must be preserved.
+    /// \param dataspec The data specification.
+    /// \param rewrite A function that returns the normal form of a data expression without process parameters.
+    template <typename SummandSequence, typename Rewrite>
+    stubborn_sets(const SummandSequence& summands,
+                  const std::vector<data::variable>& process_parameters,
+                  const std::set<core::identifier_string>& visible_actions,
+                  const data::data_specification& dataspec,
+                  Rewrite rewrite
+                 )
+      : m_number_of_summands(summands.size()),
+        m_visible(summands.size())
+    {
+      const std::size_t n = summands.size();
+      std::map<data::variable, std::size_t> parameter_index;
+      for (std::size_t p = 0; p < process_parameters.size(); p++)
+      {
+        parameter_index[process_parameters[p]] = p;
+      }
+
+      std::vector<summand_set> parameter_readers(process_parameters.size(), summand_set(n));
+      std::vector<summand_set> parameter_writers(process_parameters.size(), summand_set(n));
+      for (std::size_t i = 0; i < n; i++)
+      {
+        for (std::size_t p: summands[i].read)
+        {
+          parameter_readers[p].set(i);
+        }
+        for (std::size_t p: summands[i].write)
+        {
+          parameter_writers[p].set(i);
+        }
+        if (!visible_actions.empty() && is_visible(summands[i], visible_actions))
+        {
+          m_visible.set(i);
+        }
+      }
+
+      const std::set<data::function_symbol> constructors(dataspec.constructors().begin(), dataspec.constructors().end());
+      std::vector<value_map> values;
+      for (std::size_t i = 0; i < n; i++)
+      {
+        values.push_back(required_values(summands[i].condition, parameter_index, constructors, rewrite));
+      }
+
+      m_dependent.assign(n, summand_set(n));
+      for (std::size_t i = 0; i < n; i++)
+      {
+        m_dependent[i].set(i);
+        for (std::size_t p: summands[i].write)
+        {
+          m_dependent[i] |= parameter_readers[p];
+          m_dependent[i] |= parameter_writers[p];
+        }
+        for (std::size_t p: summands[i].read)
+        {
+          m_dependent[i] |= parameter_writers[p];
+        }
+        for (std::size_t j = m_dependent[i].find_first(); j != summand_set::npos; j = m_dependent[i].find_next(j))
+        {
+          if (are_exclusive(values[i], values[j]))
+          {
+            m_dependent[i].reset(j);
+          }
+        }
+      }
+
+      m_conjuncts.resize(n);
+      m_condition_writers.resize(n);
+      for (std::size_t i = 0; i < n; i++)
+      {
+        const auto& summand = summands[i];
+        const std::set<data::variable> summation_variables(summand.variables.begin(), summand.variables.end());
+        m_condition_writers[i] = writers(data::find_free_variables(summand.condition), parameter_index, parameter_writers);
+        for (const data::data_expression& c: data::split_and(summand.condition))
+        {
+          std::set<data::variable> v = data::find_free_variables(c);
+          if (std::none_of(v.begin(), v.end(), [&](const data::variable& x) { return summation_variables.count(x) > 0; }))
+          {
+            m_conjuncts[i].push_back(conjunct{c, writers(v, parameter_index, parameter_writers)});
+          }
+        }
+        std::stable_sort(m_conjuncts[i].begin(), m_conjuncts[i].end(),
+                         [](const conjunct& x, const conjunct& y) { return x.writers.count() < y.writers.count(); });
+      }
+    }
+
+    /// \brief Returns the number of summands.
+    std::size_t size() const
+    {
+      return m_number_of_summands;
+    }
+
+    /// \brief Computes a stubborn set in the current state.
+    /// \param enabled The summands that are enabled in the current state.
+    /// \param is_false A function that returns true if a condition without summation variables is false in the current state.
+    /// \param result The summands of the stubborn set.
+    /// \details Every enabled summand is tried as the start of a stubborn set, and the set with the fewest enabled
+    /// summands is returned. A set that contains an enabled summand with a visible action contains all summands
+    /// with a visible action. If no set has fewer enabled summands than the set of all summands, all summands
+    /// are returned.
+    template <typename IsFalse>
+    void compute(const summand_set& enabled, IsFalse is_false, summand_set& result) const
+    {
+      const std::size_t n = m_number_of_summands;
+      result.resize(n);
+      result.set();
+      std::size_t best = enabled.count();
+
+      // The necessary enabling sets of the disabled summands are computed at most once, and only if the enabled
+      // summands of a candidate do not already reach the number of enabled summands of the best set so far.
+      std::vector<summand_set> necessary_enabling_sets(n);
+      summand_set candidate(n);
+      std::vector<std::size_t> enabled_todo;
+      std::vector<std::size_t> disabled_todo;
+      std::size_t size;
+      bool contains_visible;
+      auto add_to_candidate = [&](const summand_set& summands)
+      {
+        for (std::size_t k = summands.find_first(); k != summand_set::npos; k = summands.find_next(k))
+        {
+          if (!candidate[k])
+          {
+            candidate.set(k);
+            if (enabled[k])
+            {
+              enabled_todo.push_back(k);
+              size++;
+              contains_visible = contains_visible || m_visible[k];
+            }
+            else
+            {
+              disabled_todo.push_back(k);
+            }
+          }
+        }
+      };
+
+      for (std::size_t i = enabled.find_first(); i != summand_set::npos && best > 1; i = enabled.find_next(i))
+      {
+        candidate.reset();
+        candidate.set(i);
+        enabled_todo.assign(1, i);
+        disabled_todo.clear();
+        size = 1;
+        contains_visible = m_visible[i];
+        bool visible_added = false;
+        while (size < best)
+        {
+          if (contains_visible && !visible_added)
+          {
+            visible_added = true;
+            add_to_candidate(m_visible);
+          }
+          else if (!enabled_todo.empty())
+          {
+            std::size_t j = enabled_todo.back();
+            enabled_todo.pop_back();
+            add_to_candidate(m_dependent[j]);
+          }
+          else if (!disabled_todo.empty())
+          {
+            std::size_t j = disabled_todo.back();
+            disabled_todo.pop_back();
+            if (necessary_enabling_sets[j].empty())
+            {
+              necessary_enabling_sets[j].resize(n);
+              add_necessary_enabling_set(j, is_false, necessary_enabling_sets[j]);
+            }
+            add_to_candidate(necessary_enabling_sets[j]);
+          }
+          else
+          {
+            best = size;
+            result = candidate;
+          }
+        }
+      }
+    }
+};
+
+} // namespace lps
+
+} // namespace mcrl2
+
+#endif // MCRL2_LPS_STUBBORN_SETS_H
@@ -17,6 +17,11 @@
 #include "mcrl2/data/enumerator.h"
 
 #include "mcrl2/lps/detail/lps_algorithm.h"
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
 
 namespace mcrl2
 {
@@ -66,9 +71,17 @@ class suminst_algorithm: public detail::lps_algorithm<Specification>
     std::size_t m_processed;
     std::size_t m_deleted;
     std::size_t m_added;
+    std::size_t m_duplicates;
+
+    /// The summands that have been added to the result, used to remove duplicate summands
+    std::unordered_set<atermpp::aterm_appl> m_emitted;
 
     template <typename SummandType, typename Container>
-    std::size_t instantiate_summand(const SummandType& s, Container& result)
+    std::size_t instantiate_summand(const SummandType& s,
+                                    Container& result,
+                                    DataRewriter& rewr,
+                                    data::enumerator_algorithm<>& enumerator,
+                                    const data::data_specification& dataspec)
     {
       using namespace data;
       std::size_t nr_summands = 0; // Counter for the number of new summands, used for verbose output
@@ -79,7 +92,7 @@ class suminst_algorithm: public detail::lps_algorithm<Specification>
       {
         if(m_sorts.find(v.sort()) != m_sorts.end())
         {
-          if (m_spec.data().is_certainly_finite(v.sort()))
+          if (dataspec.is_certainly_finite(v.sort()))
           {
             variables.push_front(v);
           }
@@ -107,21 +120,21 @@ class suminst_algorithm: public detail::lps_algorithm<Specification>
         {
           mCRL2log(log::debug, "suminst") << "enumerating variables " << vl << " in condition: " << data::pp(s.condition()) << std::endl;
           data::mutable_indexed_substitution<> local_sigma;
-          m_enumerator.enumerate(enumerator_element(vl, s.condition()),
-                                 local_sigma,
-                                 [&](const enumerator_element& p)
-                                 {
-                                   mutable_indexed_substitution<> sigma;
-                                   p.add_assignments(vl, sigma, m_rewriter);
-                                   mCRL2log(log::debug, "suminst") << "substitutions: " << sigma << std::endl;
-                                   SummandType t(s);
-                                   t.summation_variables() = new_summation_variables;
-                                   lps::rewrite(t, m_rewriter, sigma);
-                                   result.push_back(t);
-                                   ++nr_summands;
-                                   return false;
-                                 },
-                                 sort_bool::is_false_function_symbol
+          enumerator.enumerate(enumerator_element(vl, s.condition()),
+                               local_sigma,
+                               [&](const enumerator_element& p)
+                               {
+                                 mutable_indexed_substitution<> sigma;
+                                 p.add_assignments(vl, sigma, rewr);
+                                 mCRL2log(log::debug, "suminst") << "substitutions: " << sigma << std::endl;
+                                 SummandType t(s);
+                                 t.summation_variables() = new_summation_variables;
+                                 lps::rewrite(t, rewr, sigma);
+                                 result.push_back(t);
+                                 ++nr_summands;
+                                 return false;
+                               },
+                               sort_bool::is_false_function_symbol
           );
         }
         catch (mcrl2::runtime_error const& e)
@@ -150,30 +163,175 @@ class suminst_algorithm: public detail::lps_algorithm<Specification>
       return !m_tau_summands_only;
     }
 
+    static atermpp::aterm_appl summand_to_aterm(const action_summand_type& summand)
+    {
+      return action_summand_to_aterm(summand);
+    }
+
+    static atermpp::aterm_appl summand_to_aterm(const deadlock_summand& summand)
+    {
+      return deadlock_summand_to_aterm(summand);
+    }
+
+    /// \brief Puts the summands that replace s in instantiated.
+    template <typename SummandType>
+    void instantiate(const SummandType& s,
+                     std::vector<SummandType>& instantiated,
+                     DataRewriter& rewr,
+                     data::enumerator_algorithm<>& enumerator,
+                     const data::data_specification& dataspec)
+    {
+      if (must_instantiate(s))
+      {
+        instantiate_summand(s, instantiated, rewr, enumerator, dataspec);
+      }
+      else
+      {
+        instantiated.push_back(s);
+      }
+    }
+
+    /// \brief Adds the summands in instantiated that replace s to result, except for the ones that are already
+    /// in the result. Afterwards instantiated is empty.
+    template <typename SummandType, typename Container>
+    void add_summands(const SummandType& s, std::vector<SummandType>& instantiated, Container& result)
+    {
+      if (must_instantiate(s))
+      {
+        if (instantiated.size() > 0)
+        {
+          m_added += instantiated.size() - 1;
+        }
+        else
+        {
+          ++m_deleted;
+        }
+      }
+      for (const SummandType& t: instantiated)
+      {
+        if (m_emitted.insert(summand_to_aterm(t)).second)
+        {
+          result.push_back(t);
+        }
+        else
+        {
+          ++m_duplicates;
+        }
+      }
+      instantiated.clear();
+      ++m_processed;
+      mCRL2log(log::status) << "Replaced " << m_processed << " summands by " << (m_processed + m_added - m_deleted - m_duplicates)
+                            << " summands (" << m_deleted << " were deleted, " << m_duplicates << " were duplicates)" << std::endl;
+    }
+
+    /// \brief Instantiates the summands in list, and adds the results to result in the order of list.
+    /// \details If number_of_threads is larger than one, the summands are instantiated by that many threads,
+    /// each with its own rewriter and enumerator. The summands they produce are added to result as soon as
+    /// all summands before them have been handled, and at most a few summands are instantiated ahead of that,
+    /// such that the number of summands that is kept in memory besides the result remains bounded.
     template <typename SummandListType, typename Container>
-    void run(const SummandListType& list, Container& result)
+    void run(const SummandListType& list, Container& result, std::size_t number_of_threads)
     {
-      for (typename SummandListType::const_iterator i = list.begin(); i != list.end(); ++i)
+      typedef typename SummandListType::value_type summand_type;
+
+      std::vector<summand_type> instantiated;
+      if (number_of_threads <= 1)
       {
-        if (must_instantiate(*i))
+        for (const summand_type& s: list)
         {
-          std::size_t newsummands = instantiate_summand(*i, result);
-          if (newsummands > 0)
+          instantiate(s, instantiated, m_rewriter, m_enumerator, m_spec.data());
+          add_summands(s, instantiated, result);
+        }
+        return;
+      }
+
+      // The summands that replace summand i are stored at position i % window in buffer.
+      const std::size_t window = 2 * number_of_threads;
+      std::vector<std::vector<summand_type> > buffer(window);
+      std::vector<bool> ready(window, false);
+      std::size_t next = 0;    // the next summand that must be instantiated
+      std::size_t emitted = 0; // the number of summands that have been added to the result
+      std::exception_ptr error;
+      std::mutex mutex;
+      std::condition_variable condition;
+
+      auto instantiate_summands = [&](DataRewriter& rewr, const data::data_specification& dataspec)
+      {
+        rewr.thread_initialise();
+        data::enumerator_identifier_generator id_generator;
+        data::enumerator_algorithm<> enumerator(rewr, dataspec, rewr, id_generator, false);
+        std::vector<summand_type> summands;
+        while (true)
+        {
+          std::size_t i;
           {
-            m_added += newsummands - 1;
+            std::unique_lock<std::mutex> lock(mutex);
+            condition.wait(lock, [&]() { return error || next >= list.size() || next < emitted + window; });
+            if (error || next >= list.size())
+            {
+              return;
+            }
+            i = next++;
+          }
+          try
+          {
+            instantiate(list[i], summands, rewr, enumerator, dataspec);
+          }
+          catch (...)
+          {
+            std::lock_guard<std::mutex> lock(mutex);
+            error = std::current_exception();
+            condition.notify_all();
+            return;
           }
-          else
           {
-            ++m_deleted;
+            std::lock_guard<std::mutex> lock(mutex);
+            buffer[i % window].swap(summands);
+            ready[i % window] = true;
           }
+          condition.notify_all();
+          summands.clear();
         }
-        else
+      };
+
+      // It is essential that the rewriters are cloned, as one rewriter cannot be used in parallel. The data
+      // specification is copied, because it normalises itself lazily.
+      std::vector<DataRewriter> thread_rewriters;
+      std::vector<data::data_specification> thread_dataspecs(number_of_threads, m_spec.data());
+      for (std::size_t t = 0; t < number_of_threads; t++)
+      {
+        thread_rewriters.push_back(m_rewriter.clone());
+      }
+      std::vector<std::thread> threads;
+      for (std::size_t t = 0; t < number_of_threads; t++)
+      {
+        threads.emplace_back([&, t]() { instantiate_summands(thread_rewriters[t], thread_dataspecs[t]); });
+      }
+
+      for (std::size_t i = 0; i < list.size(); i++)
+      {
         {
-          result.push_back(*i);
+          std::unique_lock<std::mutex> lock(mutex);
+          condition.wait(lock, [&]() { return error || ready[i % window]; });
+          if (error)
+          {
+            break;
+          }
+          instantiated.swap(buffer[i % window]);
+          ready[i % window] = false;
+          emitted = i + 1;
         }
-        ++m_processed;
-        mCRL2log(log::status) << "Replaced " << m_processed << " summands by " << (m_processed + m_added - m_deleted)
-                              << " summands (" << m_deleted << " were deleted)" << std::endl;
+        condition.notify_all();
+        add_summands(list[i], instantiated, result);
+      }
+
+      for (std::thread& t: threads)
+      {
+        t.join();
+      }
+      if (error)
+      {
+        std::rethrow_exception(error);
       }
     }
 
@@ -189,7 +347,8 @@ class suminst_algorithm: public detail::lps_algorithm<Specification>
         m_enumerator(r, spec.data(), r, m_id_generator, false),
         m_processed(0),
         m_deleted(0),
-        m_added(0)
+        m_added(0),
+        m_duplicates(0)
     {
       if(sorts.empty())
       {
@@ -198,15 +357,21 @@ class suminst_algorithm: public detail::lps_algorithm<Specification>
       }
     }
 
-    void run()
+    /// \brief Instantiates the summation variables of the summands. Summands that are equal to an earlier
+    /// summand are removed.
+    /// \param number_of_threads The number of threads used to instantiate summands.
+    void run(std::size_t number_of_threads = 1)
     {
       action_summand_vector_type action_summands;
       deadlock_summand_vector deadlock_summands;
       m_added = 0;
       m_deleted = 0;
       m_processed = 0;
-      run(m_spec.process().action_summands(), action_summands);
-      run(m_spec.process().deadlock_summands(), deadlock_summands);
+      m_duplicates = 0;
+      m_emitted.clear();
+      run(m_spec.process().action_summands(), action_summands, number_of_threads);
+      run(m_spec.process().deadlock_summands(), deadlock_summands, number_of_threads);
+      m_emitted.clear();
       m_spec.process().action_summands().swap(action_summands);
       m_spec.process().deadlock_summands().swap(deadlock_summands);
       mCRL2log(log::status) << std::endl;
@@ -15,168 +15,339 @@
 #include "mcrl2/symbolic/ldd_stream.h"
 #include "mcrl2/symbolic/print.h"
 #include "mcrl2/lps/symbolic_lts.h"
+#include "mcrl2/utilities/stopwatch.h"
 
 #include <sylvan_ldd.hpp>
 
+#include <algorithm>
+#include <iomanip>
+#include <numeric>
+#include <unordered_map>
+
 namespace mcrl2::lps
 {
 
-namespace
+/// \brief The quotient of a symbolic LTS with respect to a partition of its states.
+struct symbolic_lts_quotient
 {
+  std::size_t number_of_blocks = 0;
 
-struct result
-{
-  sylvan::ldds::ldd projected;
-  std::size_t action_index;
+  /// \brief The block that contains the initial state.
+  std::uint32_t initial_block = 0;
+
+  /// \brief The transitions between blocks, as vectors [j, a, i] where j is the source block,
+  /// a an index in the action index of the symbolic LTS and i the target block.
+  sylvan::ldds::ldd transitions;
 };
 
-} // anonymous namespace
+/// \brief Signature based refinement of the states of a symbolic LTS, see Wijs, Blom, Orzan et al.
+/// \details The partition is represented by a single LDD with vectors [s, j], where s is a state
+/// and j the number of its block. The signature of a state s is the set of pairs (a, i) such that
+/// s can do an a-transition to block i. In every iteration the signatures of all states are computed
+/// as an LDD [s, a, i] by one relprev per summand group, in which the action label of the group is
+/// matched against an extra layer of the tagged partition. Afterwards every distinct signature is
+/// assigned a new block number. The LDD operations are executed in parallel by the Lace workers.
+/// For branching bisimulation the signature contains the pairs that can be reached by a sequence of
+/// inert tau-steps, i.e. tau-steps within the same block, after which a non-inert step follows.
+class sigref_algorithm
+{
+    using ldd = sylvan::ldds::ldd;
 
-/// \brief Project on all transitions where the last index is action_index.
-template <typename Context>
-void project_transitions(WorkerP*, Task*, std::uint32_t* x, std::size_t n, void* context)
-{  
-  using namespace sylvan::ldds;
+  protected:
+    const symbolic_lts& m_lts;
+    bool m_branching;
 
-  auto pointer = reinterpret_cast<Context*>(context);
-  auto& p = *pointer;
+    std::size_t m_n; // the length of a state vector
 
-  if (x[n-1] == p.action_index)
-  {
-    p.projected = union_(p.projected, cube(x, n));
-  }
-}
+    // For every summand group the meta data for relprev on vectors [s, a, ...], where the
+    // action label of the group is matched against the layer a.
+    std::vector<ldd> m_meta;
 
-/// \brief Returns the height of the LDD.
-std::size_t height(const sylvan::ldds::ldd& x)
-{
-  using namespace sylvan::ldds;
-  return sat_one_vector(x).size();
-}
+    std::uint32_t m_block_action; // an action index that does not occur in the LTS
+    ldd m_actions; // the layer with all action indices, and m_block_action
+    ldd m_tau;     // the layer with the action indices of tau
 
-/// \brief Project on all transitions where n is the height of the LDD and action_index the action that we want to keep. (Assumes that action label is the last).
-sylvan::ldds::ldd project_transitions(const sylvan::ldds::ldd& x, std::size_t height, std::size_t action_index)
-{
-  using namespace sylvan::ldds;
-
-  if (x == empty_set() || x == empty_list())
-  {
-    return x;
-  }
-  
-  if (height == 1)
-  {
-    // We are at the action label depth (keep only action_index).
-    if (x.value() < action_index)
+    ldd m_partition; // vectors [s, j]
+    ldd m_signature; // the (direct) transitions [s, a, i] w.r.t. m_partition, without the inert ones
+    std::size_t m_number_of_blocks = 1;
+
+    // Used for assigning block numbers to signatures.
+    std::unordered_map<ldd, std::uint32_t> m_blocks;
+    std::vector<std::unordered_map<ldd, ldd>> m_renumber_cache;
+
+    static ldd make_layer(const std::vector<std::uint32_t>& values)
     {
-      return project_transitions(x.right(), height, action_index);
+      using namespace sylvan::ldds;
+      ldd result = empty_set();
+      for (auto i = values.rbegin(); i != values.rend(); ++i)
+      {
+        result = node(*i, true_(), result);
+      }
+      return result;
     }
-    else if (x.value() == action_index)
+
+    static ldd make_layer(std::size_t size)
     {
-      return node(x.value());
+      std::vector<std::uint32_t> values(size);
+      std::iota(values.begin(), values.end(), 0);
+      return make_layer(values);
     }
-    else 
+
+    /// \brief Returns the set of vectors [x_0, ..., x_k-1, y, x_k, ..., x_n-1] with x in X and y in Y.
+    /// \param X An LDD of height n.
+    /// \param Y An LDD of height one.
+    static ldd insert_layer(const ldd& X, std::size_t n, std::size_t k, const ldd& Y)
     {
-      return false_();
+      using namespace sylvan::ldds;
+      std::vector<std::uint32_t> px(n + 2, 1);
+      std::vector<std::uint32_t> py(n + 2, 0);
+      px[k] = 0;
+      py[k] = 1;
+      px.back() = static_cast<std::uint32_t>(-2);
+      py.back() = static_cast<std::uint32_t>(-2);
+      return join(X, Y, cube(px), cube(py));
     }
-  }
-  else
-  {
-    return node(x.value(), project_transitions(x.down(), height - 1, action_index), project_transitions(x.right(), height, action_index));
-  }
-}
 
-void bisim(const symbolic_lts& lts)
-{
-  using namespace sylvan::ldds;
+    /// \brief Returns the meta data of relprev for the given group, where the action label is matched
+    /// against layer n of the set and the universe.
+    ldd compute_meta(const lps_summand_group& group) const
+    {
+      using namespace sylvan::ldds;
+      std::vector<std::uint32_t> meta;
+      for (std::size_t i = 0; i < m_n; i++)
+      {
+        bool is_read = std::binary_search(group.read.begin(), group.read.end(), i);
+        bool is_write = std::binary_search(group.write.begin(), group.write.end(), i);
+        if (is_read && is_write)
+        {
+          meta.push_back(1);
+          meta.push_back(2);
+        }
+        else if (is_read)
+        {
+          meta.push_back(3);
+        }
+        else if (is_write)
+        {
+          meta.push_back(4);
+        }
+        else
+        {
+          meta.push_back(0);
+        }
+      }
+      meta.push_back(3); // the action label
+      meta.push_back(static_cast<std::uint32_t>(-1));
+      return cube(meta);
+    }
+
+    /// \brief Returns the vectors [s, a, ...] such that s can do an a-transition to a vector [s', a, ...] in X.
+    ldd predecessors(const ldd& X, const ldd& universe) const
+    {
+      using namespace sylvan::ldds;
+      ldd result = empty_set();
+      for (std::size_t i = 0; i < m_lts.summand_groups.size(); i++)
+      {
+        result = union_(result, relprev(X, m_lts.summand_groups[i].L, m_meta[i], universe));
+      }
+      return result;
+    }
+
+    /// \brief Returns the LDD [s, k] where k is the number of the signature of s in X.
+    ldd renumber(const ldd& X, std::size_t depth)
+    {
+      using namespace sylvan::ldds;
+      if (X == empty_set())
+      {
+        return X;
+      }
+
+      if (depth == m_n)
+      {
+        auto [i, inserted] = m_blocks.try_emplace(X, static_cast<std::uint32_t>(m_blocks.size()));
+        return node(i->second);
+      }
+
+      auto& cache = m_renumber_cache[depth];
+      auto i = cache.find(X);
+      if (i != cache.end())
+      {
+        return i->second;
+      }
 
-  // Split all transition groups such that there is only one action label for each. 
-  mCRL2log(log::verbose) << "Preprocessing the transition groups..." << std::endl;
-  std::vector<lps_summand_group> new_groups;
+      std::vector<std::pair<std::uint32_t, ldd>> elements;
+      for (ldd x = X; x != empty_set(); x = x.right())
+      {
+        elements.emplace_back(x.value(), renumber(x.down(), depth + 1));
+      }
+      ldd result = empty_set();
+      for (auto j = elements.rbegin(); j != elements.rend(); ++j)
+      {
+        result = node(j->first, j->second, result);
+      }
+      cache.emplace(X, result);
+      return result;
+    }
 
-  for (const auto& group : lts.summand_groups)
-  {
-    for (const auto& action : lts.action_index)
+    /// \brief Extends the signatures [s, a, i] in X with the pairs that can be reached by inert tau-steps.
+    ldd inert_closure(const ldd& X, const ldd& universe) const
     {
-      // Explore all transitions in the LDD.
-      result res;
-      //res.action_index = lts.action_index.index(action);
-      //sat_all_nopar(group.L, project_transitions<result>, &res);
-      res.projected = project_transitions(group.L, height(group.L), lts.action_index.index(action));
+      using namespace sylvan::ldds;
 
-      if (res.projected != sylvan::ldds::empty_set())
+      // Vectors [s, j, a, i] are extended to [s, tau, j, a, i], and the relation is applied on tau-steps
+      // between states in the same block j.
+      std::vector<std::uint32_t> px(m_n + 1, 1);
+      std::vector<std::uint32_t> py(m_n + 3, 1);
+      px.insert(px.end(), { 0, 0, static_cast<std::uint32_t>(-2) });
+      py[m_n] = 0;
+      py.push_back(static_cast<std::uint32_t>(-2));
+      ldd proj_x = cube(px);
+      ldd proj_y = cube(py);
+      std::vector<std::uint32_t> p(m_n, 1);
+      p.insert(p.end(), { 0, 0, static_cast<std::uint32_t>(-1) });
+      ldd proj = cube(p);
+
+      ldd result = X;
+      ldd todo = X;
+      while (todo != empty_set())
       {
-        new_groups.emplace_back(group);
-        new_groups.back().L = res.projected;
+        ldd Y = insert_layer(join(m_partition, todo, proj_x, proj_y), m_n + 3, m_n, m_tau);
+        todo = minus(project(predecessors(Y, universe), proj), result);
+        result = union_(result, todo);
       }
+      return result;
     }
-  }
 
-  mcrl2::utilities::unordered_set<ldd> partition; // The set of sets of states, where each set of states is an LDD.
-  mcrl2::utilities::unordered_set<ldd> new_partition;
-  partition.emplace(lts.states);
+    /// \brief Computes the signatures of the states with respect to the current partition, and the refined partition.
+    void refine()
+    {
+      using namespace sylvan::ldds;
+
+      ldd blocks = make_layer(m_number_of_blocks);
+      ldd universe = insert_layer(insert_layer(m_lts.states, m_n, m_n, m_actions), m_n + 1, m_n + 1, blocks);
+      m_signature = predecessors(insert_layer(m_partition, m_n + 1, m_n, m_actions), universe);
 
-  bool refined_block = false;
-  bool refined_any_block = false;
-  std::size_t iterations = 0;
+      ldd signature = m_signature;
+      if (m_branching && m_tau != empty_set())
+      {
+        m_signature = minus(m_signature, insert_layer(m_partition, m_n + 1, m_n, m_tau));
+        ldd universe_tau = insert_layer(insert_layer(insert_layer(m_partition, m_n + 1, m_n + 1, m_actions), m_n + 2, m_n + 2, blocks), m_n + 3, m_n, m_tau);
+        signature = inert_closure(m_signature, universe_tau);
+      }
 
-  mCRL2log(log::verbose) << "Starting signature refinement..." << std::endl;
-  do
-  {
-    refined_any_block = false;
+      // Every state keeps its old block number in its signature, such that the new partition is a refinement
+      // of the old one. This also takes care of the states without outgoing transitions.
+      signature = union_(signature, insert_layer(m_partition, m_n + 1, m_n, node(m_block_action)));
 
-    for (const ldd& C : partition)
+      m_blocks.clear();
+      m_renumber_cache = std::vector<std::unordered_map<ldd, ldd>>(m_n);
+      m_partition = renumber(signature, 0);
+      m_renumber_cache.clear();
+    }
+
+  public:
+    sigref_algorithm(const symbolic_lts& lts, bool branching = false)
+      : m_lts(lts), m_branching(branching), m_n(lts.process_parameters.size())
     {
-      refined_block = false;
+      using namespace sylvan::ldds;
+
+      for (const lps_summand_group& group: m_lts.summand_groups)
+      {
+        m_meta.push_back(compute_meta(group));
+      }
 
-      for (const ldd& C_prime : partition)
+      m_block_action = static_cast<std::uint32_t>(m_lts.action_index.size());
+      m_actions = make_layer(m_lts.action_index.size() + 1);
+      std::vector<std::uint32_t> tau;
+      for (const lps::multi_action& a: m_lts.action_index)
       {
-        // Refine each block one by one.
-        for (const lps_summand_group& group : new_groups)
+        if (a.actions().empty())
         {
-          ldd A = relprev(C_prime, group.L, group.Ir, C);
-          if (A != sylvan::ldds::empty_set() && A != C)
-          {
-            // This block must be refined.
-            new_partition.emplace(A),
-            new_partition.emplace(minus(C, A));
-            refined_block = true;
-            break;
-          }
+          tau.push_back(static_cast<std::uint32_t>(m_lts.action_index.index(a)));
         }
+      }
+      std::sort(tau.begin(), tau.end());
+      m_tau = make_layer(tau);
+
+      m_partition = insert_layer(m_lts.states, m_n, m_n, node(0));
+    }
+
+    /// \brief Computes the coarsest (branching) bisimulation, and returns it as an LDD with vectors [s, j],
+    /// where j is the number of the block that contains s.
+    ldd run()
+    {
+      using namespace sylvan::ldds;
+      mCRL2log(log::verbose) << "Starting signature refinement..." << std::endl;
+      stopwatch timer;
+
+      std::size_t iterations = 0;
+      for (;;)
+      {
+        ldd partition = m_partition;
+        std::size_t number_of_blocks = m_number_of_blocks;
 
-        if (refined_block)
+        refine();
+        m_number_of_blocks = m_blocks.size();
+        ++iterations;
+        mCRL2log(log::verbose) << "found " << std::setw(12) << m_number_of_blocks << " equivalence classes after " << std::setw(4) << iterations << " iterations (time = " << std::setprecision(2) << std::fixed << timer.seconds() << "s)." << std::endl;
+
+        if (m_number_of_blocks == number_of_blocks)
         {
-          refined_any_block = true;
+          // The partition is stable; keep the old numbering, since the signatures refer to it.
+          m_partition = partition;
           break;
         }
       }
 
-      if (!refined_block)
+      mCRL2log(log::verbose) << "There are " << m_number_of_blocks << " equivalence classes." << std::endl;
+      mCRL2log(log::debug) << symbolic::print_size(m_partition, true) << std::endl;
+      return m_partition;
+    }
+
+    /// \brief Returns the number of blocks of the partition.
+    std::size_t number_of_blocks() const
+    {
+      return m_number_of_blocks;
+    }
+
+    /// \brief Returns the quotient of the LTS with respect to the partition computed by run.
+    /// \details For branching bisimulation the inert tau-transitions are removed.
+    symbolic_lts_quotient quotient() const
+    {
+      using namespace sylvan::ldds;
+      symbolic_lts_quotient result;
+      result.number_of_blocks = m_number_of_blocks;
+
+      ldd x = m_partition;
+      for (std::uint32_t value: sat_one_vector(m_lts.initial_state))
       {
-        new_partition.emplace(C); // Keep the old block for the next iteration.
+        x = follow(x, value);
       }
+      result.initial_block = x.value();
+
+      std::vector<std::uint32_t> px(m_n + 1, 1);
+      std::vector<std::uint32_t> py(m_n + 3, 1);
+      px.insert(px.end(), { 0, 0, static_cast<std::uint32_t>(-2) });
+      py[m_n] = 0;
+      py.push_back(static_cast<std::uint32_t>(-2));
+      std::vector<std::uint32_t> p(m_n, 0);
+      p.push_back(static_cast<std::uint32_t>(-1));
+      result.transitions = project(join(m_partition, m_signature, cube(px), cube(py)), cube(p));
+      return result;
     }
+};
 
-    swap(partition, new_partition);
-    new_partition.clear();
-
-    ++iterations;
-    mCRL2log(log::verbose) << "found " << std::setw(12) << partition.size() << " equivalence classes after " << std::setw(4) << iterations << " iterations." << std::endl;
-  }
-  while (refined_any_block);
-
-  // The partition is now a bisimulation.
-  mCRL2log(log::verbose) << "There are " << partition.size() << " equivalence classes." << std::endl;
-  for (const ldd& C : partition)
-  {
-    mCRL2log(log::debug) << symbolic::print_size(C, true) << std::endl;
-    mCRL2log(log::debug) << symbolic::print_states(lts.data_index, C) << std::endl;
-  }
+/// \brief Minimises the symbolic LTS modulo strong or (divergence blind) branching bisimulation.
+inline
+symbolic_lts_quotient bisim(const symbolic_lts& lts, bool branching = false)
+{
+  sigref_algorithm algorithm(lts, branching);
+  algorithm.run();
+  return algorithm.quotient();
 }
 
 } // namespace mcrl2::lps
 
 #endif // MCRL2_ENABLE_SYLVAN
 
-#endif // MCRL2_LPS_SYMBOLIC_LTS_BISIM_H
\ No newline at end of file
+#endif // MCRL2_LPS_SYMBOLIC_LTS_BISIM_H
@@ -31,7 +31,8 @@ void lpsconstelm(const std::string& input_filename,
                  bool instantiate_free_variables,
                  bool ignore_conditions,
                  bool remove_trivial_summands,
-                 bool remove_singleton_sorts
+                 bool remove_singleton_sorts,
+                 std::size_t number_of_threads = 1
                 );
 
 void lpsinfo(const std::string& input_filename,
@@ -79,7 +80,8 @@ void lpssuminst(const std::string& input_filename,
                 const data::rewriter::strategy rewrite_strategy,
                 const std::string& sorts_string,
                 const bool finite_sorts_only,
-                const bool tau_summands_only);
+                const bool tau_summands_only,
+                const std::size_t number_of_threads = 1);
 
 void lpsuntime(const std::string& input_filename,
                const std::string& output_filename,
@@ -45,7 +45,8 @@ void lpsconstelm(const std::string& input_filename,
                  bool instantiate_free_variables,
                  bool ignore_conditions,
                  bool remove_trivial_summands,
-                 bool remove_singleton_sorts
+                 bool remove_singleton_sorts,
+                 std::size_t number_of_threads
                 )
 {
   lps::stochastic_specification spec;
@@ -60,7 +61,7 @@ void lpsconstelm(const std::string& input_filename,
   }
 
   // apply constelm
-  algorithm.run(instantiate_free_variables, ignore_conditions);
+  algorithm.run(instantiate_free_variables, ignore_conditions, number_of_threads);
 
   // postprocess: remove trivial summands
   if (remove_trivial_summands)
@@ -254,7 +255,8 @@ void lpssuminst(const std::string& input_filename,
                 const data::rewriter::strategy rewrite_strategy,
                 const std::string& sorts_string,
                 const bool finite_sorts_only,
-                const bool tau_summands_only)
+                const bool tau_summands_only,
+                const std::size_t number_of_threads)
 {
   stochastic_specification spec;
   load_lps(spec, input_filename);
@@ -282,7 +284,7 @@ void lpssuminst(const std::string& input_filename,
   mCRL2log(log::verbose, "lpssuminst") << "expanding summation variables of sorts: " << data::pp(sorts) << std::endl;
 
   mcrl2::data::rewriter r(spec.data(), rewrite_strategy);
-  lps::suminst_algorithm<data::rewriter, stochastic_specification>(spec, r, sorts, tau_summands_only).run();
+  lps::suminst_algorithm<data::rewriter, stochastic_specification>(spec, r, sorts, tau_summands_only).run(number_of_threads);
   save_lps(spec, output_filename);
 }
 
@@ -14,6 +14,7 @@
 
 #include "mcrl2/lps/confluence_checker.h"
 #include "mcrl2/lps/parse.h"
+#include <cstdio>
 
 
 using namespace mcrl2;
@@ -55,6 +56,20 @@ void run_confluence_test_case(const std::string& s, const std::size_t ctau_count
   checker1.check_confluence_and_mark(data::sort_bool::true_(),0);
 
   BOOST_CHECK_EQUAL(count_ctau(s0), ctau_count);
+
+  // Check confluence using two threads, storing the results in a file. The
+  // second run only uses the results in that file.
+  const std::string results_file = "confcheck_test.results";
+  std::remove(results_file.c_str());
+  for (int i = 0; i < 2; ++i)
+  {
+    specification s1 = parse_linear_process_specification(s);
+    Confluence_Checker<specification> checker2(s1, data::jitty, 0, false, data::detail::solver_type_cvc, false, false, false,
+                                               "c", false, false, std::string(), 2, results_file);
+    checker2.check_confluence_and_mark(data::sort_bool::true_(),0);
+    BOOST_CHECK_EQUAL(count_ctau(s1), ctau_count);
+  }
+  std::remove(results_file.c_str());
 }
 
 BOOST_AUTO_TEST_CASE(case_1)
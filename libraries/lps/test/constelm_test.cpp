@@ -391,12 +391,15 @@ const std::string expected_10 = "process_parameter_count = 1";
 
 void test_constelm(const std::string& message, const std::string& spec_text, const std::string& expected_result)
 {
-  specification spec = parse_linear_process_specification(spec_text);
-  data::rewriter R(spec.data());
-  bool instantiate_free_variables = false;
-  constelm(spec, R, instantiate_free_variables);
-  lps::detail::specification_property_map<> info(spec);
-  BOOST_CHECK(data::detail::compare_property_maps(message, info, expected_result));
+  for (std::size_t number_of_threads: { 1, 2 })
+  {
+    specification spec = parse_linear_process_specification(spec_text);
+    data::rewriter R(spec.data());
+    bool instantiate_free_variables = false;
+    constelm(spec, R, instantiate_free_variables, number_of_threads);
+    lps::detail::specification_property_map<> info(spec);
+    BOOST_CHECK(data::detail::compare_property_maps(message, info, expected_result));
+  }
 }
 
 void test_constelm()
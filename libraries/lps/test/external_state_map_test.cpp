@@ -0,0 +1,93 @@
+// Author(s): Wieger Wesselink
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file external_state_map_test.cpp
+/// \brief Tests for the states that are stored on disk by external breadth-first search.
+
+#define BOOST_TEST_MODULE external_state_map_test
+#include <boost/test/included/unit_test.hpp>
+
+#include "mcrl2/data/standard_container_utility.h"
+#include "mcrl2/data/standard_numbers_utility.h"
+#include "mcrl2/lps/external_state_map.h"
+
+using namespace mcrl2;
+using namespace mcrl2::lps;
+
+static state make_test_state(std::size_t n, bool b)
+{
+  std::vector<data::data_expression> l = { data::sort_nat::nat(n), data::sort_nat::nat(n), data::sort_nat::nat(n + 1) };
+  std::vector<data::data_expression> v = { data::sort_nat::nat(n), b ? data::sort_bool::true_() : data::sort_bool::false_(),
+                                           data::sort_list::list(data::sort_nat::nat(), l) };
+  return state(v.begin(), v.size());
+}
+
+BOOST_AUTO_TEST_CASE(test_serialization)
+{
+  detail::term_serializer serialize;
+  detail::term_deserializer deserialize;
+  for (std::size_t n: { 0, 1, 200, 100000 })
+  {
+    state s = make_test_state(n, n % 2 == 0);
+    std::string key;
+    serialize(key, s);
+    BOOST_CHECK(deserialize(key.data()) == s);
+
+    // Equal states have equal representations, and different states different ones.
+    std::string key1;
+    serialize(key1, make_test_state(n, n % 2 == 0));
+    std::string key2;
+    serialize(key2, make_test_state(n, n % 2 != 0));
+    BOOST_CHECK(key == key1);
+    BOOST_CHECK(key != key2);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_find)
+{
+  external_state_map states;
+  std::vector<state> level0 = { make_test_state(0, true) };
+  std::vector<state> level1 = { make_test_state(2, true), make_test_state(1, false), make_test_state(1, true) };
+  states.add_level(level0);
+  states.add_level(level1);
+  BOOST_CHECK_EQUAL(states.size(), 4u);
+  BOOST_CHECK_EQUAL(states.number_of_levels(), 2u);
+
+  std::vector<state> successors = { make_test_state(1, true), make_test_state(3, true), make_test_state(0, true), make_test_state(2, true) };
+  std::vector<external_state_map::candidate> candidates(successors.size());
+  for (std::size_t i = 0; i < successors.size(); i++)
+  {
+    states.make_candidate(candidates[i], successors[i], i);
+  }
+  states.find(candidates, 2);
+
+  std::vector<std::size_t> indices(successors.size());
+  for (const external_state_map::candidate& c: candidates)
+  {
+    indices[c.number] = c.index;
+  }
+  BOOST_CHECK_EQUAL(indices[0], 3u);
+  BOOST_CHECK_EQUAL(indices[1], external_state_map::undefined_index());
+  BOOST_CHECK_EQUAL(indices[2], 0u);
+  BOOST_CHECK_EQUAL(indices[3], 1u);
+
+  // Only the first level is searched.
+  states.find(candidates, 1);
+  for (const external_state_map::candidate& c: candidates)
+  {
+    indices[c.number] = c.index;
+  }
+  BOOST_CHECK_EQUAL(indices[2], 0u);
+
+  std::vector<state> stored;
+  states.for_each_state([&](const state& s) { stored.push_back(s); });
+  std::vector<state> expected = { level0[0], level1[0], level1[1], level1[2] };
+  BOOST_CHECK(stored == expected);
+  BOOST_CHECK(states.bytes_written() > 0);
+  BOOST_CHECK(states.bytes_read() > 0);
+}
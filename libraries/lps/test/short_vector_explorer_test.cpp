@@ -0,0 +1,169 @@
+// Author(s): Wieger Wesselink
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file short_vector_explorer_test.cpp
+/// \brief Tests for the short vector next-state interface.
+
+#define BOOST_TEST_MODULE short_vector_explorer_test
+#include <boost/test/included/unit_test.hpp>
+
+#include "mcrl2/lps/linearise.h"
+#include "mcrl2/lps/short_vector_explorer.h"
+
+using namespace mcrl2;
+
+typedef lps::short_vector_explorer::short_vector short_vector;
+
+inline
+lps::explorer_options make_options()
+{
+  lps::explorer_options options;
+  options.search_strategy = lps::es_breadth;
+  options.rewrite_strategy = data::jitty;
+  return options;
+}
+
+// Explores the state space using next_state_long, and returns the reachable transitions.
+std::set<std::pair<short_vector, std::pair<lps::multi_action, short_vector>>> explore(lps::short_vector_explorer& explorer)
+{
+  std::set<std::pair<short_vector, std::pair<lps::multi_action, short_vector>>> result;
+  std::set<short_vector> discovered;
+  std::deque<short_vector> todo;
+  short_vector s0 = explorer.initial_state();
+  todo.push_back(s0);
+  discovered.insert(s0);
+  while (!todo.empty())
+  {
+    short_vector s = todo.front();
+    todo.pop_front();
+    for (std::size_t group = 0; group < explorer.group_count(); group++)
+    {
+      explorer.next_state_long(group, s, [&](const lps::multi_action& a, const short_vector& s1)
+        {
+          result.insert({s, {a, s1}});
+          if (discovered.insert(s1).second)
+          {
+            todo.push_back(s1);
+          }
+        });
+    }
+  }
+  return result;
+}
+
+void test_explorer(const std::string& text)
+{
+  lps::specification lpsspec = remove_stochastic_operators(lps::linearise(text));
+  lps::explorer_options options = make_options();
+
+  lps::short_vector_explorer explorer1(lpsspec, options);
+  lps::short_vector_explorer explorer2(lpsspec, options, true);
+  auto transitions1 = explore(explorer1);
+  auto transitions2 = explore(explorer2);
+  BOOST_CHECK(transitions1 == transitions2);
+
+  // compare the result with the transitions computed by the explorer on full states
+  lps::explorer<false, false, lps::specification> explorer3(lpsspec, options);
+  std::set<std::pair<short_vector, std::pair<lps::multi_action, short_vector>>> transitions3;
+  std::set<short_vector> sources;
+  for (const auto& t: transitions1)
+  {
+    sources.insert(t.first);
+  }
+  for (const short_vector& s: sources)
+  {
+    lps::state d0;
+    lps::make_state(d0, s.begin(), s.size());
+    for (const auto& [a, d1]: explorer3.generate_transitions(d0))
+    {
+      transitions3.insert({s, {a, short_vector(d1.begin(), d1.end())}});
+    }
+  }
+  BOOST_CHECK(transitions1 == transitions3);
+}
+
+BOOST_AUTO_TEST_CASE(test_dependencies)
+{
+  std::string text =
+    "act a: Nat;                                             \n"
+    "    b;                                                  \n"
+    "proc P(i: Nat, j: Nat, k: Bool) =                       \n"
+    "       (i < 3) -> a(j).P(i = i + 1)                     \n"
+    "     + k -> b.P(j = 2, k = false);                      \n"
+    "init P(0, 0, true);                                     \n"
+    ;
+  lps::specification lpsspec = remove_stochastic_operators(lps::linearise(text));
+  lps::explorer_options options = make_options();
+  lps::short_vector_explorer explorer(lpsspec, options);
+  BOOST_CHECK_EQUAL(explorer.group_count(), 2u);
+  BOOST_CHECK_EQUAL(explorer.state_length(), 3u);
+
+  for (std::size_t group = 0; group < explorer.group_count(); group++)
+  {
+    const auto& read = explorer.read_parameters(group);
+    const auto& write = explorer.write_parameters(group);
+    const auto& guard = explorer.guard_parameters(group);
+    if (explorer.regular_summands()[group].multi_action.actions().size() == 1 && explorer.regular_summands()[group].multi_action.actions().front().arguments().size() == 1)
+    {
+      BOOST_CHECK(read == std::vector<std::size_t>({0, 1}));
+      BOOST_CHECK(write == std::vector<std::size_t>({0}));
+      BOOST_CHECK(guard == std::vector<std::size_t>({0}));
+    }
+    else
+    {
+      BOOST_CHECK(read == std::vector<std::size_t>({2}));
+      BOOST_CHECK(write == std::vector<std::size_t>({1, 2}));
+      BOOST_CHECK(guard == std::vector<std::size_t>({2}));
+    }
+    BOOST_CHECK_EQUAL(explorer.read_matrix()[group].count(), read.size());
+    BOOST_CHECK_EQUAL(explorer.write_matrix()[group].count(), write.size());
+    BOOST_CHECK_EQUAL(explorer.guard_matrix()[group].count(), guard.size());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_next_state)
+{
+  test_explorer(
+    "act a: Nat;                                             \n"
+    "    b;                                                  \n"
+    "proc P(i: Nat, j: Nat, k: Bool) =                       \n"
+    "       (i < 3) -> a(j).P(i = i + 1)                     \n"
+    "     + k -> b.P(j = 2, k = false);                      \n"
+    "init P(0, 0, true);                                     \n"
+  );
+
+  test_explorer(
+    "act a: Nat;                                             \n"
+    "    b;                                                  \n"
+    "sort D = struct d1 | d2;                                \n"
+    "proc X(n: Nat, m: Nat, dd: D) =                         \n"
+    "       sum d: D. (n < 3) -> a(n).X(n + 1, m, d)         \n"
+    "     + (dd == d2 && m < 2) -> b.X(n, m + 1, d1);        \n"
+    "init X(0, 0, d1);                                       \n"
+  );
+}
+
+BOOST_AUTO_TEST_CASE(test_cache)
+{
+  std::string text =
+    "act a, b;                                               \n"
+    "proc P(i: Nat, j: Nat) =                                \n"
+    "       (i < 5) -> a.P(i = i + 1)                        \n"
+    "     + (j < 5) -> b.P(j = j + 1);                       \n"
+    "init P(0, 0);                                           \n"
+    ;
+  lps::specification lpsspec = remove_stochastic_operators(lps::linearise(text));
+  lps::explorer_options options = make_options();
+  lps::short_vector_explorer explorer(lpsspec, options, true);
+  auto transitions = explore(explorer);
+  BOOST_CHECK_EQUAL(transitions.size(), 60u);
+
+  // The 36 states only have 6 different projections on the read parameters of each group
+  BOOST_CHECK_EQUAL(explorer.cache_size(0), 6u);
+  BOOST_CHECK_EQUAL(explorer.cache_size(1), 6u);
+}
@@ -206,6 +206,53 @@ void test_case_7()
   BOOST_CHECK(sum_count == 1);
 }
 
+///Instantiating b yields two equal summands, of which only one should be kept.
+void test_case_8()
+{
+  const std::string text(
+    "act a;\n"
+    "proc P = sum b : Bool . a . P;\n"
+    "init P;\n"
+  );
+
+  specification s0=remove_stochastic_operators(linearise(text));
+  rewriter r(s0.data());
+  for (std::size_t number_of_threads: { 1, 2 })
+  {
+    specification s1(s0);
+    suminst_algorithm<rewriter, specification>(s1, r).run(number_of_threads);
+    const action_summand_vector& summands1 = s1.process().action_summands();
+    BOOST_CHECK_EQUAL(summands1.size(), 1u);
+    BOOST_CHECK(summands1.front().summation_variables().empty());
+  }
+}
+
+///The summands should be the same, and in the same order, regardless of the number of threads.
+void test_case_9()
+{
+  const std::string text(
+    "sort D = struct d1 | d2 | d3;\n"
+    "act a:D;\n"
+    "    b;\n"
+    "proc P(x:D) = sum d : D . a(d) . P(d)\n"
+    "            + sum d : D . (d == x) -> b . P(d)\n"
+    "            + sum d, e : D . (d != e) -> a(e) . P(x)\n"
+    "            + sum d : D . (d == x) -> delta;\n"
+    "init P(d1);\n"
+  );
+
+  specification s0=remove_stochastic_operators(linearise(text));
+  rewriter r(s0.data());
+  specification s1(s0);
+  suminst_algorithm<rewriter, specification>(s1, r).run(1);
+  for (std::size_t number_of_threads: { 2, 3 })
+  {
+    specification s2(s0);
+    suminst_algorithm<rewriter, specification>(s2, r).run(number_of_threads);
+    BOOST_CHECK_EQUAL(lps::pp(s1), lps::pp(s2));
+  }
+}
+
 BOOST_AUTO_TEST_CASE(test_main)
 {
   std::clog << "test case 1" << std::endl;
@@ -220,5 +267,9 @@ BOOST_AUTO_TEST_CASE(test_main)
   test_case_5();
   std::clog << "test case 6" << std::endl;
   test_case_6();
+  std::clog << "test case 8" << std::endl;
+  test_case_8();
+  std::clog << "test case 9" << std::endl;
+  test_case_9();
 }
 
@@ -0,0 +1,278 @@
+// Author(s): Muck van Weerdenburg, Jan Friso Groote
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file lts/detail/liblts_determinise.h
+/// \brief A breadth-first subset construction, of which the frontier is
+///        explored by a number of threads.
+
+#ifndef _LIBLTS_DETERMINISE_H
+#define _LIBLTS_DETERMINISE_H
+
+#include <algorithm>
+#include "mcrl2/utilities/hash_utility.h"
+#include "mcrl2/lts/lts_utilities.h"
+#include "mcrl2/lts/detail/parallel_for.h"
+
+namespace mcrl2
+{
+namespace lts
+{
+namespace detail
+{
+
+/// \brief Determinises an LTS by a breadth-first subset construction.
+/// \details The subsets of states that are reached are stored once, as sorted sequences of states, in a
+///          table that is split into shards on the hash of the subsets. The frontier is explored in batches
+///          of consecutive subsets. First the successors of all subsets in a batch are computed in parallel.
+///          Next, each thread looks up the successors of which the hash belongs to its own shards, such that
+///          the table is accessed without locks. Finally, the new subsets are numbered in the order in which
+///          a sequential subset construction finds them, such that the result does not depend on the number
+///          of threads. Transitions with a hidden label are treated as tau transitions.
+template < class LTS_TYPE>
+class subset_constructor
+{
+  public:
+    /** \brief Creates the deterministic transition system of which the states are the subsets of
+     *         states of l that can be reached from the initial state.
+     *  \details The transitions of l are removed, as they are not needed anymore after they are indexed.
+     *  \param[in] l The LTS that is determinised.
+     *  \param[in] number_of_threads The number of threads that explore the frontier. */
+    subset_constructor(LTS_TYPE& l, const std::size_t number_of_threads = 1);
+
+    /** \brief Replaces the transition system by the deterministic transition system.
+     *  \details The state labels are removed. */
+    void replace_transition_system();
+
+    /** \brief The number of subsets that can be reached from the initial state. */
+    std::size_t num_subsets() const
+    {
+      return subsets.size();
+    }
+
+  private:
+    typedef std::size_t state_type;
+    typedef std::size_t label_type;
+
+    // A part of the table of subsets. The subsets are stored one after the other, and are found via
+    // a hash table with open addressing, of which each entry is zero or one plus the index of a subset.
+    struct shard
+    {
+      std::vector<state_type> states;
+      std::vector<std::size_t> begin = std::vector<std::size_t>(1, 0);  // Subset j consists of states[begin[j]], ..., states[begin[j+1]-1].
+      std::vector<std::size_t> hashes;
+      std::vector<std::size_t> numbers;
+      std::vector<std::size_t> table = std::vector<std::size_t>(16, 0);
+
+      std::size_t size() const
+      {
+        return hashes.size();
+      }
+
+      // Returns the index of the subset [first, last), and whether it has been inserted.
+      std::pair<std::size_t, bool> insert(const state_type* first, const state_type* last, const std::size_t hash)
+      {
+        if (2 * size() >= table.size())
+        {
+          table.assign(2 * table.size(), 0);
+          for (std::size_t j = 0; j < size(); ++j)
+          {
+            std::size_t position = hashes[j] & (table.size() - 1);
+            while (table[position] != 0)
+            {
+              position = (position + 1) & (table.size() - 1);
+            }
+            table[position] = j + 1;
+          }
+        }
+
+        std::size_t position = hash & (table.size() - 1);
+        for (; table[position] != 0; position = (position + 1) & (table.size() - 1))
+        {
+          const std::size_t j = table[position] - 1;
+          if (hashes[j] == hash && std::equal(first, last, states.begin() + begin[j], states.begin() + begin[j + 1]))
+          {
+            return std::make_pair(j, false);
+          }
+        }
+        table[position] = size() + 1;
+        states.insert(states.end(), first, last);
+        begin.push_back(states.size());
+        hashes.push_back(hash);
+        numbers.push_back(0);
+        return std::make_pair(size() - 1, true);
+      }
+    };
+
+    // A subset that is reached by a transition with the given label, of which the states are stored in
+    // the states of the frontier entry.
+    struct successor
+    {
+      label_type label;
+      std::size_t first;
+      std::size_t last;
+      std::size_t hash;
+      std::size_t index = 0;   // The index of the subset in its shard.
+      bool is_new = false;     // Whether the subset is inserted in the table by this successor.
+    };
+
+    struct frontier_entry
+    {
+      std::vector<state_type> states;
+      std::vector<successor> successors;
+    };
+
+    static constexpr std::size_t number_of_shards = 256;
+    static constexpr std::size_t batch_size = 1 << 14;
+    static constexpr std::size_t chunk_size = 16;
+
+    LTS_TYPE& aut;
+    const outgoing_transitions_per_state_t outgoing_transitions;
+    const std::size_t number_of_threads;
+    std::vector<shard> shards;
+    std::vector<std::pair<std::size_t, std::size_t> > subsets;  // The shard and the index in the shard of each subset.
+    std::vector<transition> resulting_transitions;
+
+    static std::size_t hash(const state_type* first, const state_type* last)
+    {
+      std::size_t result = 0;
+      for (; first != last; ++first)
+      {
+        result = utilities::detail::hash_combine(result, *first);
+      }
+      return result;
+    }
+
+    void compute_successors(const std::size_t subset, frontier_entry& entry) const;
+    void explore_batch(const std::size_t first, const std::size_t last);
+};
+
+
+template < class LTS_TYPE>
+subset_constructor<LTS_TYPE>::subset_constructor(LTS_TYPE& l, const std::size_t number_of_threads)
+  : aut(l),
+    outgoing_transitions(l.get_transitions(), l.num_states(), true),
+    number_of_threads(number_of_threads),
+    shards(number_of_shards)
+{
+  aut.clear_transitions();
+
+  const state_type initial_state = aut.initial_state();
+  const std::size_t initial_hash = hash(&initial_state, &initial_state + 1);
+  const std::size_t initial_shard = initial_hash % number_of_shards;
+  subsets.emplace_back(initial_shard, shards[initial_shard].insert(&initial_state, &initial_state + 1, initial_hash).first);
+
+  for (std::size_t first = 0; first < subsets.size(); )
+  {
+    const std::size_t last = std::min(subsets.size(), first + batch_size);
+    explore_batch(first, last);
+    first = last;
+    mCRL2log(log::debug) << "generated " << subsets.size() << " states and " << resulting_transitions.size()
+                         << " transitions; explored " << first << " states" << std::endl;
+  }
+}
+
+
+template < class LTS_TYPE>
+void subset_constructor<LTS_TYPE>::compute_successors(const std::size_t subset, frontier_entry& entry) const
+{
+  const shard& s = shards[subsets[subset].first];
+  const std::size_t index = subsets[subset].second;
+
+  thread_local std::vector<std::pair<label_type, state_type> > steps;
+  steps.clear();
+  for (std::size_t j = s.begin[index]; j < s.begin[index + 1]; ++j)
+  {
+    const state_type from = s.states[j];
+    for (std::size_t i = outgoing_transitions.lowerbound(from); i < outgoing_transitions.upperbound(from); ++i)
+    {
+      const outgoing_pair_t& p = outgoing_transitions.get_transitions()[i];
+      steps.emplace_back(aut.apply_hidden_label_map(label(p)), to(p));
+    }
+  }
+  std::sort(steps.begin(), steps.end());
+  steps.erase(std::unique(steps.begin(), steps.end()), steps.end());
+
+  entry.states.reserve(steps.size());
+  for (auto i = steps.begin(); i != steps.end(); )
+  {
+    successor next;
+    next.label = i->first;
+    next.first = entry.states.size();
+    for (; i != steps.end() && i->first == next.label; ++i)
+    {
+      entry.states.push_back(i->second);
+    }
+    next.last = entry.states.size();
+    next.hash = hash(entry.states.data() + next.first, entry.states.data() + next.last);
+    entry.successors.push_back(next);
+  }
+}
+
+
+template < class LTS_TYPE>
+void subset_constructor<LTS_TYPE>::explore_batch(const std::size_t first, const std::size_t last)
+{
+  std::vector<frontier_entry> frontier(last - first);
+  parallel_for(first, last, number_of_threads, chunk_size, [&](std::size_t i)
+  {
+    compute_successors(i, frontier[i - first]);
+  });
+
+  // Each thread looks up the successors in the shards that belong to it.
+  parallel_for(0, number_of_threads, number_of_threads, 1, [&](std::size_t thread)
+  {
+    for (frontier_entry& entry: frontier)
+    {
+      for (successor& next: entry.successors)
+      {
+        const std::size_t s = next.hash % number_of_shards;
+        if (s % number_of_threads == thread)
+        {
+          const std::pair<std::size_t, bool> result =
+                  shards[s].insert(entry.states.data() + next.first, entry.states.data() + next.last, next.hash);
+          next.index = result.first;
+          next.is_new = result.second;
+        }
+      }
+    }
+  });
+
+  for (std::size_t i = first; i < last; ++i)
+  {
+    for (const successor& next: frontier[i - first].successors)
+    {
+      const std::size_t s = next.hash % number_of_shards;
+      if (next.is_new)
+      {
+        shards[s].numbers[next.index] = subsets.size();
+        subsets.emplace_back(s, next.index);
+      }
+      resulting_transitions.emplace_back(i, next.label, shards[s].numbers[next.index]);
+    }
+  }
+}
+
+
+template < class LTS_TYPE>
+void subset_constructor<LTS_TYPE>::replace_transition_system()
+{
+  aut.clear_state_labels();
+  aut.set_num_states(subsets.size(), false); // remove the state values, and reset the number of states.
+  aut.set_initial_state(0);
+
+  aut.clear_transitions(resulting_transitions.size());
+  for (const transition& t: resulting_transitions)
+  {
+    aut.add_transition(t);
+  }
+}
+
+}
+}
+}
+#endif // _LIBLTS_DETERMINISE_H
@@ -16,10 +16,20 @@
 // There are six algorithms. One for trace inclusion, one for failures inclusion and one for failures-divergence inclusion.
 // All algorithms come in a variant with and without internal steps.
 // It is possible to generate a counter transition system in case the inclusion is answered by no.
+//
+// The sets of specification states are hash-consed, i.e. every set is stored only once as a sorted
+// vector, and pairs in the working list and the antichain refer to it by its index. For every
+// implementation state the antichain keeps a vector of these indices together with a bit signature
+// of each set, such that most subset checks are decided without looking at the sets themselves.
 
 #ifndef LIBLTS_FAILURES_REFINEMENT_H
 #define LIBLTS_FAILURES_REFINEMENT_H
 
+#include <atomic>
+#include <thread>
+#include <unordered_set>
+#include "mcrl2/utilities/hash_utility.h"
+#include "mcrl2/utilities/indexed_set.h"
 #include "mcrl2/lts/detail/counter_example.h"
 #include "mcrl2/lps/exploration_strategy.h"
 #include "mcrl2/lts/detail/liblts_bisim_dnj.h"
@@ -32,16 +42,158 @@ namespace detail
 {
   typedef std::size_t state_type;
   typedef std::size_t label_type;
-  typedef std::set<state_type> set_of_states;
-  typedef std::multimap <detail::state_type,detail::set_of_states> anti_chain_type;
+  typedef std::vector<state_type> set_of_states;  // A sorted vector without duplicates.
+  typedef std::size_t set_of_states_index;         // The index of a set of states in a set_of_states_store.
   typedef std::set < label_type > action_label_set;
 
+  /// \brief A store in which every set of states occurs only once. A set is referred to by its index.
+  class set_of_states_store
+  {
+    protected:
+      utilities::indexed_set<set_of_states> m_sets;
+      std::vector<std::uint64_t> m_signatures;
+      std::size_t m_number_of_states = 0; // The sum of the sizes of all stored sets.
+
+    public:
+      /// \brief A bit vector in which bit s%64 is set for every state s in the set. If the
+      ///        signature of s1 is not contained in that of s2, s1 is not a subset of s2.
+      static std::uint64_t signature(const set_of_states& s)
+      {
+        std::uint64_t result = 0;
+        for (const state_type x: s)
+        {
+          result |= std::uint64_t(1) << (x % 64);
+        }
+        return result;
+      }
+
+      /// \brief Returns the index of s, and adds s to the store if it does not occur in it.
+      set_of_states_index insert(const set_of_states& s)
+      {
+        const std::pair<std::size_t, bool> p = m_sets.insert(s);
+        if (p.second)
+        {
+          m_signatures.push_back(signature(s));
+          m_number_of_states += s.size();
+        }
+        return p.first;
+      }
+
+      const set_of_states& operator[](const set_of_states_index i) const
+      {
+        return m_sets[i];
+      }
+
+      std::uint64_t signature(const set_of_states_index i) const
+      {
+        return m_signatures[i];
+      }
+
+      /// \brief The number of different sets in the store.
+      std::size_t size() const
+      {
+        return m_sets.size();
+      }
+
+      /// \brief The sum of the sizes of all sets in the store.
+      std::size_t number_of_states() const
+      {
+        return m_number_of_states;
+      }
+  };
+
+  /* An anti_chain contains for each implementation state a collection of sets of specification
+     states of which no set is a subset of another. The idea is that if such two sets occur, it is
+     enough to keep the smallest. The sets are hash-consed in a set_of_states_store. Sets that are
+     removed from the anti_chain remain in the store, as they can still be referred to by the working list.
+   */
+  class anti_chain_type
+  {
+    protected:
+      struct entry
+      {
+        set_of_states_index index;
+        std::uint64_t signature;
+      };
+
+      set_of_states_store& m_store;
+      std::vector<std::vector<entry> > m_entries; // The sets associated to each implementation state.
+      std::size_t m_size = 0;
+
+      static bool is_subset(const set_of_states& s1, const std::uint64_t signature1,
+                            const set_of_states& s2, const std::uint64_t signature2)
+      {
+        return (signature1 & ~signature2) == 0 &&
+               s1.size() <= s2.size() &&
+               std::includes(s2.begin(), s2.end(), s1.begin(), s1.end());
+      }
+
+    public:
+      anti_chain_type(set_of_states_store& store, const std::size_t number_of_states)
+        : m_store(store),
+          m_entries(number_of_states)
+      {}
+
+      /* This function implements the insertion of <impl, spec> in the anti_chain.
+         If spec is smaller than a set si associated to impl, this set is removed.
+         If spec is larger than a set si, there is no need to add spec, as a better candidate
+         is already there. In that case false is returned. Otherwise spec is added to the
+         store, and true is returned together with the index of spec in the store.
+       */
+      std::pair<bool, set_of_states_index> insert(const state_type impl, const set_of_states& spec)
+      {
+        assert(impl<m_entries.size());
+        std::vector<entry>& entries = m_entries[impl];
+        const std::uint64_t spec_signature = set_of_states_store::signature(spec);
+
+        // First check whether there is a set in the antichain for impl which is smaller than spec.
+        for (const entry& e: entries)
+        {
+          if (is_subset(m_store[e.index], e.signature, spec, spec_signature))
+          {
+            return std::make_pair(false, e.index);
+          }
+        }
+
+        // Here spec must be inserted in the antichain. Moreover, all sets in the antichain that
+        // are a superset of spec must be removed.
+        for (std::size_t i = 0; i < entries.size(); )
+        {
+          if (is_subset(spec, spec_signature, m_store[entries[i].index], entries[i].signature))
+          {
+            entries[i] = entries.back();
+            entries.pop_back();
+            --m_size;
+          }
+          else
+          {
+            ++i;
+          }
+        }
+        const set_of_states_index index = m_store.insert(spec);
+        entries.push_back(entry{index, spec_signature});
+        ++m_size;
+        return std::make_pair(true, index);
+      }
+
+      /// \brief The number of pairs in the anti_chain.
+      std::size_t size() const
+      {
+        return m_size;
+      }
+
+      const set_of_states_store& store() const
+      {
+        return m_store;
+      }
+  };
+
   template < class COUNTER_EXAMPLE_CONSTRUCTOR >
   class state_states_counter_example_index_triple
   {
     protected:
       detail::state_type m_state;
-      detail::set_of_states m_states;
+      detail::set_of_states_index m_states;
       typename COUNTER_EXAMPLE_CONSTRUCTOR::index_type m_counter_example_index;
 
     public:
@@ -51,7 +203,7 @@ namespace detail
       /// \brief Constructor.
       state_states_counter_example_index_triple(
               const state_type state,
-              const set_of_states& states,
+              const set_of_states_index states,
               const typename COUNTER_EXAMPLE_CONSTRUCTOR::index_type& counter_example_index)
        : m_state(state),
          m_states(states),
@@ -71,8 +223,8 @@ namespace detail
         std::swap(m_counter_example_index,other.m_counter_example_index);
       }
 
-      /// \brief Get the set of states.
-      const set_of_states& states() const
+      /// \brief Get the index of the set of states.
+      set_of_states_index states() const
       {
         return m_states;
       }
@@ -84,11 +236,6 @@ namespace detail
       }
   };
 
-  template <  class COUNTER_EXAMPLE_CONSTRUCTOR >
-  inline bool antichain_insert(
-                  anti_chain_type& anti_chain,
-                  const state_states_counter_example_index_triple<COUNTER_EXAMPLE_CONSTRUCTOR>& impl_spec);
-
   // The class below recalls what the stable states and the states with a divergent
   // self loop of a transition system are, such that it does not have to be recalculated each time again.
   template < class LTS_TYPE >
@@ -170,7 +317,7 @@ namespace detail
 
   template < class LTS_TYPE >
   set_of_states collect_reachable_states_via_an_action(
-                 const state_type s,
+                 const set_of_states& spec,
                  const label_type e,
                  const lts_cache<LTS_TYPE>& weak_property_cache,
                  const bool weak_reduction,
@@ -204,6 +351,22 @@ struct refinement_statistics
   std::size_t max_antichain = 0; // The largest size of the antichain.
   std::size_t antichain_misses = 0; // Number of times a pair was inserted into the antichain.
   std::size_t antichain_inserts = 0; // Number of times antichain_insert was called.
+  std::size_t next_report = 1024; // The size of the antichain at which its growth is reported next.
+
+  /// \brief Updates the maxima, and reports the size of the antichain each time it has doubled.
+  void update()
+  {
+    max_working   = std::max(working.size(), max_working);
+    max_antichain = std::max(antichain.size(), max_antichain);
+    if (antichain.size() >= next_report)
+    {
+      mCRL2log(log::verbose) << "The antichain contains " << antichain.size() << " pairs with "
+                             << antichain.store().size() << " different sets of states ("
+                             << antichain.store().number_of_states() << " states in total); "
+                             << working.size() << " pairs are waiting to be explored.\n";
+      next_report = 2 * next_report;
+    }
+  }
 };
 
 /// \brief Print a message to debugging containing information about the given statistics.
@@ -215,6 +378,8 @@ void report_statistics(refinement_statistics<T>& stats)
       << ", misses: " << stats.antichain_misses
       << ", size: " << stats.antichain.size()
       << ", max: " << stats.max_antichain << ")\n";
+  mCRL2log(log::debug, "Performance") << "sets of states (different: " << stats.antichain.store().size()
+      << ", total size: " << stats.antichain.store().number_of_states() << ")\n";
 }
 
 /// \brief Preprocess the LTS for destructive refinement checking.
@@ -256,6 +421,9 @@ std::pair<std::size_t, bool> reduce(LTS_TYPE& lts,
 /// \param generate_counter_example If set, a labelled transition system is generated
 ///        that can act as a counterexample. It consists of a trace, followed by
 ///        outgoing transitions representing a refusal set.
+/// \param number_of_threads If larger than one and the strategy is breadth first, the successors
+///        of the pairs at the front of the working list are computed in parallel. The pairs are
+///        inserted in the antichain in the same order as in the sequential algorithm.
 template < class LTS_TYPE, class COUNTER_EXAMPLE_CONSTRUCTOR = detail::dummy_counter_example_constructor >
 bool destructive_refinement_checker(
                         LTS_TYPE& l1,
@@ -264,7 +432,8 @@ bool destructive_refinement_checker(
                         const bool weak_reduction,
                         const lps::exploration_strategy strategy,
                         const bool preprocess = true,
-                        COUNTER_EXAMPLE_CONSTRUCTOR generate_counter_example = detail::dummy_counter_example_constructor())
+                        COUNTER_EXAMPLE_CONSTRUCTOR generate_counter_example = detail::dummy_counter_example_constructor(),
+                        const std::size_t number_of_threads = 1)
 {
   assert(strategy == lps::exploration_strategy::es_breadth || strategy == lps::exploration_strategy::es_depth); // Need a valid strategy.
 
@@ -302,36 +471,33 @@ bool destructive_refinement_checker(
     }
   }
 
+  typedef detail::state_states_counter_example_index_triple<COUNTER_EXAMPLE_CONSTRUCTOR> state_states_triple;
 
   const detail::lts_cache<LTS_TYPE> weak_property_cache(l1,weak_reduction);
-  std::deque<detail::state_states_counter_example_index_triple<COUNTER_EXAMPLE_CONSTRUCTOR>>
-              working(  // let working be a stack containg the triple (init1,{s|init2-->s},root_index);
-                    { detail::state_states_counter_example_index_triple<COUNTER_EXAMPLE_CONSTRUCTOR>(
-                                  l1.initial_state(),
-                                  detail::collect_reachable_states_via_taus(init_l2,weak_property_cache,weak_reduction),
-                                  generate_counter_example.root_index() ) });
-                                                      // let antichain := emptyset;
-  detail::anti_chain_type anti_chain;
-  detail::antichain_insert(anti_chain, working.front());   // antichain := antichain united with (impl,spec);
-                                                           // This line occurs at another place in the code than in
-                                                           // the original algorithm, where insertion in the anti-chain
-                                                           // was too late, causing too many impl-spec pairs to be investigated.
-  refinement_statistics<detail::state_states_counter_example_index_triple<COUNTER_EXAMPLE_CONSTRUCTOR>> stats(anti_chain, working);
-
-  while (!working.empty())                            // while working!=empty
+  detail::set_of_states_store spec_sets;
+  detail::anti_chain_type anti_chain(spec_sets, l1.num_states());   // let antichain := emptyset;
+  std::deque<state_states_triple> working;
+  refinement_statistics<state_states_triple> stats(anti_chain, working);
+
+  // let working be a stack containg the triple (init1,{s|init2-->s},root_index);
+  // antichain := antichain united with (impl,spec);
+  // The insertion in the antichain occurs at another place in the code than in the original algorithm,
+  // where insertion in the anti-chain was too late, causing too many impl-spec pairs to be investigated.
+  working.emplace_back(l1.initial_state(),
+                       anti_chain.insert(l1.initial_state(), detail::collect_reachable_states_via_taus(init_l2,weak_property_cache,weak_reduction)).second,
+                       generate_counter_example.root_index());
+
+  // Returns false if (impl, spec) is a counter example due to divergence or refusals. The boolean
+  // expand is set to true if the successors of (impl, spec) must be investigated.
+  auto check_divergence_and_refusals = [&](const state_states_triple& impl_spec, bool& expand, const bool print_counter_example)
   {
-    detail::state_states_counter_example_index_triple < COUNTER_EXAMPLE_CONSTRUCTOR > impl_spec;   // pop (impl,spec) from working;
-    impl_spec.swap(working.front());
-    stats.max_working   = std::max(working.size(), stats.max_working);
-    stats.max_antichain = std::max(anti_chain.size(), stats.max_antichain);
-    working.pop_front();     // At this point it could be checked whether impl_spec still exists in anti_chain.
-                             // Small scale experiments show that this is a little bit more expensive than doing the explicit check below.
-
+    const detail::set_of_states& spec = spec_sets[impl_spec.states()];
+    expand = false;
     bool spec_diverges = false;
     if (refinement == refinement_type::failures_divergence)
     {
       // Only compute when the result is required.
-      for (detail::state_type s : impl_spec.states())
+      for (detail::state_type s : spec)
       {
         if (weak_property_cache.diverges(s))
         {
@@ -346,8 +512,6 @@ bool destructive_refinement_checker(
     {
       if (weak_property_cache.diverges(impl_spec.state()) && refinement == refinement_type::failures_divergence) // if impl diverges and CheckDiv
       {
-        generate_counter_example.save_counter_example(impl_spec.counter_example_index(),l1);
-        report_statistics(stats);
         return false;  // return false;
       }
 
@@ -356,59 +520,162 @@ bool destructive_refinement_checker(
         detail::label_type offending_action=std::size_t(-1);
         // if refusals(impl) not contained in refusals(spec) then
         if (!detail::refusals_contained_in(impl_spec.state(),
-                                           impl_spec.states(),
+                                           spec,
                                            weak_property_cache,
                                            offending_action,
                                            l1,
-                                           !generate_counter_example.is_dummy(),
+                                           print_counter_example,
                                            generate_counter_example.is_structured()))
         {
-          generate_counter_example.save_counter_example(impl_spec.counter_example_index(), l1);
-          report_statistics(stats);
           return false;                               // return false;
         }
       }
+      expand = true;
+    }
+    return true;
+  };
 
-      for(const transition& t: weak_property_cache.transitions(impl_spec.state()))
+  // spec' := {s' | exists s in spec. s-e->s'}, where e is the label of the transition t.
+  auto successor_states = [&](const detail::set_of_states& spec, const transition& t)
+  {
+    if (l1.is_tau(l1.apply_hidden_label_map(t.label())) && weak_reduction)                   // if e=tau then
+    {
+      return spec;        // spec' := spec;
+    }
+    return detail::collect_reachable_states_via_an_action(spec,l1.apply_hidden_label_map(t.label()),weak_property_cache,weak_reduction,l1);
+  };
+
+  // Adds the pair (t.to(), spec_prime) to the working list if it is not covered by the antichain.
+  // Returns false if spec_prime is empty, in which case a counter example has been found.
+  auto add_successor = [&](const state_states_triple& impl_spec, const transition& t, const detail::set_of_states& spec_prime)
+  {
+    const typename COUNTER_EXAMPLE_CONSTRUCTOR::index_type new_counterexample_index=
+           generate_counter_example.add_transition(t.label(),impl_spec.counter_example_index());
+    if (spec_prime.empty())                     // if spec'={} then
+    {
+      generate_counter_example.save_counter_example(new_counterexample_index,l1);
+      return false;                             //    return false;
+    }
+                                                // if (impl',spec') in antichain is not true then
+    ++stats.antichain_inserts;
+    const std::pair<bool, detail::set_of_states_index> inserted = anti_chain.insert(t.to(), spec_prime);
+    if (inserted.first)
+    {
+      ++stats.antichain_misses;
+      if (strategy == lps::exploration_strategy::es_breadth)
       {
-        const typename COUNTER_EXAMPLE_CONSTRUCTOR::index_type new_counterexample_index=
-               generate_counter_example.add_transition(t.label(),impl_spec.counter_example_index());
-        detail::set_of_states spec_prime;
-        if (l1.is_tau(l1.apply_hidden_label_map(t.label())) && weak_reduction)                   // if e=tau then
+        working.emplace_back(t.to(), inserted.second, new_counterexample_index);   // add(impl,spec') at the bottom of the working;
+      }
+      else if (strategy == lps::exploration_strategy::es_depth)
+      {
+        working.emplace_front(t.to(), inserted.second, new_counterexample_index);   // push(impl,spec') into working;
+      }
+    }
+    return true;
+  };
+
+  if (number_of_threads > 1 && strategy == lps::exploration_strategy::es_breadth)
+  {
+    // The successor sets of a batch of pairs at the front of working are computed in parallel. New
+    // pairs are added at the back of working, so processing the batch sequentially afterwards visits
+    // the pairs in the same order as the sequential algorithm.
+    struct expansion
+    {
+      bool counter_example = false;
+      std::vector<detail::set_of_states> successors; // The successor sets, one per outgoing transition of impl.
+    };
+    const std::size_t batch_size = 256 * number_of_threads;
+    std::vector<state_states_triple> batch;
+    std::vector<expansion> expansions;
+
+    while (!working.empty())
+    {
+      const std::size_t n = std::min(batch_size, working.size());
+      batch.assign(working.begin(), working.begin() + n);
+      working.erase(working.begin(), working.begin() + n);
+      expansions.assign(n, expansion());
+
+      std::atomic<std::size_t> next(0);
+      auto expand_batch = [&]()
+      {
+        for (std::size_t i = next++; i < n; i = next++)
         {
-          spec_prime=impl_spec.states();        // spec' := spec;
-        }
-        else
-        {                                           // spec' := {s' | exists s in spec. s-e->s'};
-          for(const detail::state_type s: impl_spec.states())
+          bool expand = false;
+          expansions[i].counter_example = !check_divergence_and_refusals(batch[i], expand, false);
+          if (expand && !expansions[i].counter_example)
           {
-            detail::set_of_states reachable_states_from_s_via_e=
-                    detail::collect_reachable_states_via_an_action(s,l1.apply_hidden_label_map(t.label()),weak_property_cache,weak_reduction,l1);
-            spec_prime.insert(reachable_states_from_s_via_e.begin(),reachable_states_from_s_via_e.end());
+            const detail::set_of_states& spec = spec_sets[batch[i].states()];
+            for (const transition& t: weak_property_cache.transitions(batch[i].state()))
+            {
+              expansions[i].successors.push_back(successor_states(spec, t));
+            }
           }
         }
-        if (spec_prime.empty())                     // if spec'={} then
+      };
+      std::vector<std::thread> threads;
+      for (std::size_t i = 1; i < number_of_threads; ++i)
+      {
+        threads.emplace_back(expand_batch);
+      }
+      expand_batch();
+      for (std::thread& thread: threads)
+      {
+        thread.join();
+      }
+
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        stats.update();
+        if (expansions[i].counter_example)
         {
-          generate_counter_example.save_counter_example(new_counterexample_index,l1);
+          bool expand = false;
+          check_divergence_and_refusals(batch[i], expand, !generate_counter_example.is_dummy()); // Print the refusals.
+          generate_counter_example.save_counter_example(batch[i].counter_example_index(), l1);
           report_statistics(stats);
-          return false;                             //    return false;
+          return false;
         }
-                                                    // if (impl',spec') in antichain is not true then
-        ++stats.antichain_inserts;
-        const detail::state_states_counter_example_index_triple < COUNTER_EXAMPLE_CONSTRUCTOR >
-                          impl_spec_counterex(t.to(),spec_prime,new_counterexample_index);
-        if (detail::antichain_insert(anti_chain, impl_spec_counterex))
+        const std::vector<transition>& transitions = weak_property_cache.transitions(batch[i].state());
+        for (std::size_t j = 0; j < expansions[i].successors.size(); ++j)
         {
-          ++stats.antichain_misses;
-          if (strategy == lps::exploration_strategy::es_breadth)
-          {
-            working.push_back(impl_spec_counterex);   // add(impl,spec') at the bottom of the working;
-          }
-          else if (strategy == lps::exploration_strategy::es_depth)
+          if (!add_successor(batch[i], transitions[j], expansions[i].successors[j]))
           {
-            working.push_front(impl_spec_counterex);   // push(impl,spec') into working;
+            report_statistics(stats);
+            return false;
           }
         }
+        expansions[i].successors.clear();
+      }
+    }
+
+    report_statistics(stats);
+    return true;
+  }
+
+  while (!working.empty())                            // while working!=empty
+  {
+    const state_states_triple impl_spec = working.front();   // pop (impl,spec) from working;
+    stats.update();
+    working.pop_front();     // At this point it could be checked whether impl_spec still exists in anti_chain.
+                             // Small scale experiments show that this is a little bit more expensive than doing the explicit check below.
+
+    bool expand = false;
+    if (!check_divergence_and_refusals(impl_spec, expand, !generate_counter_example.is_dummy()))
+    {
+      generate_counter_example.save_counter_example(impl_spec.counter_example_index(),l1);
+      report_statistics(stats);
+      return false;
+    }
+
+    if (expand)
+    {
+      const detail::set_of_states& spec = spec_sets[impl_spec.states()];
+      for(const transition& t: weak_property_cache.transitions(impl_spec.state()))
+      {
+        if (!add_successor(impl_spec, t, successor_states(spec, t)))
+        {
+          report_statistics(stats);
+          return false;
+        }
       }
     }
   }
@@ -420,9 +687,9 @@ bool destructive_refinement_checker(
 
 namespace detail
 {
-  /* This function generates the set of states reachable from s within labelled
+  /* This function generates the set of states reachable from the sorted vector s within labelled
      transition system l1 by internal transitions, provided weak_reduction is true.
-     Otherwise it generates a set with only state s in it.
+     Otherwise it returns s.
   */
   template < class LTS_TYPE >
   set_of_states collect_reachable_states_via_taus(
@@ -435,7 +702,7 @@ namespace detail
     {
       return result;
     }
-    set_of_states visited(s);
+    std::unordered_set<state_type> visited(s.begin(), s.end());
     std::deque<state_type> todo_stack(s.begin(),s.end());
     while (todo_stack.size()>0)
     {
@@ -446,11 +713,12 @@ namespace detail
         if (visited.insert(s).second)  // The element has been inserted.
         {
           todo_stack.push_back(s);
-          result.insert(s);
+          result.push_back(s);
         }
       }
     }
 
+    std::sort(result.begin(), result.end());
     return result;
   }
 
@@ -460,143 +728,37 @@ namespace detail
                   const lts_cache<LTS_TYPE>& weak_property_cache,
                   const bool weak_reduction)
   {
-    set_of_states set_with_s({s});
-    return collect_reachable_states_via_taus(set_with_s, weak_property_cache, weak_reduction);
+    return collect_reachable_states_via_taus(set_of_states({s}), weak_property_cache, weak_reduction);
   }
 
+  /* This function generates the set of states reachable from the set spec via an action e, followed by
+     internal transitions if weak_reduction is true. The set spec must be closed under internal transitions,
+     which holds for all sets in the working list, such that no internal steps have to be taken before e.
+  */
   template < class LTS_TYPE >
   set_of_states collect_reachable_states_via_an_action(
-                 const state_type s,
+                 const set_of_states& spec,
                  const label_type e,  // This is already the hidden action.
                  const lts_cache<LTS_TYPE>& weak_property_cache,
                  const bool weak_reduction,
                  const LTS_TYPE& l)
   {
-    const set_of_states set_before_action_e=collect_reachable_states_via_taus(s,weak_property_cache,weak_reduction);
     set_of_states states_reachable_via_e;
-    for(const state_type s: set_before_action_e)
+    for(const state_type s: spec)
     {
       for(const transition& t: weak_property_cache.transitions(s))
       {
+        if (l.apply_hidden_label_map(t.label())==e)
         {
-          if (l.apply_hidden_label_map(t.label())==e)
-          {
-            assert(set_before_action_e.count(t.from())>0);
-            states_reachable_via_e.insert(t.to());
-          }
+          states_reachable_via_e.push_back(t.to());
         }
       }
     }
+    std::sort(states_reachable_via_e.begin(), states_reachable_via_e.end());
+    states_reachable_via_e.erase(std::unique(states_reachable_via_e.begin(), states_reachable_via_e.end()), states_reachable_via_e.end());
     return collect_reachable_states_via_taus(states_reachable_via_e, weak_property_cache, weak_reduction);
   }
 
-  /* This function implements the insertion of <p,state(), p.states()> in the anti_chain.
-     Concretely, this means that p.states() is inserted among the sets s1,...,sn associated to p.state().
-     It is important that an anti_chain contains for each state a set of states of which
-     no set is a subset of another. The idea is that if such two sets occur, it is enough
-     to keep the smallest.
-     If p.states() is smaller than a set si associated to p.state(), this set is removed.
-     If p.states() is larger than a set si, there is no need to add p.states(), as a better candidate
-     is already there.
-     This function returns true if insertion was succesful, and false otherwise.
-   */
-  template <  class COUNTER_EXAMPLE_CONSTRUCTOR >
-  inline bool antichain_insert(
-                  anti_chain_type& anti_chain,
-                  const state_states_counter_example_index_triple<COUNTER_EXAMPLE_CONSTRUCTOR>& impl_spec)
-  {
-    // First check whether there is a set in the antichain for impl_spec.state() which is smaller than impl_spec.states().
-    // If so, impl_spec.states() does not have to be inserted in the anti_chain.
-    for(anti_chain_type::const_iterator i=anti_chain.lower_bound(impl_spec.state()); i!=anti_chain.upper_bound(impl_spec.state()); ++i)
-    {
-      const set_of_states s=i->second;
-      // If s is included in impl_spec.states()
-      if (std::includes(impl_spec.states().begin(), impl_spec.states().end(), s.begin(),s.end()))
-      {
-        return false;
-      }
-    }
-
-    // Here impl_spec.states() must be inserted in the antichain. Moreover, all sets in the antichain that
-    // are a superset of impl_spec.states() must be removed.
-    for(anti_chain_type::iterator i=anti_chain.lower_bound(impl_spec.state()); i!=anti_chain.upper_bound(impl_spec.state()); )
-    {
-      const set_of_states s=i->second;
-      // if s is a superset of impl_spec.states()
-      // if (std::includes(impl_spec.states().begin(),impl_spec.states().end(),s.begin(),s.end()))
-      if (std::includes(s.begin(), s.end(), impl_spec.states().begin(),impl_spec.states().end()))
-      {
-        // set s must be removed.
-        i=anti_chain.erase(i);
-      }
-      else
-      {
-        ++i;
-      }
-    }
-    anti_chain.insert(std::pair<detail::state_type,detail::set_of_states>(impl_spec.state(),impl_spec.states()));
-    return true;
-  }
-
-  /* Calculate the states that are stable and reachable through tau-steps */
-  template < class LTS_TYPE >
-  const set_of_states& calculate_tau_reachable_states(
-        const set_of_states& states,
-        const lts_cache<LTS_TYPE>& weak_property_cache)
-  {
-    static std::map<set_of_states, set_of_states> cache;
-    const std::map<set_of_states, set_of_states>::const_iterator i=cache.find(states);
-    if (i!=cache.end())
-    {
-      return i->second;
-    }
-
-    static set_of_states visited;
-    assert(visited.empty());
-    static std::stack < state_type > todo_stack;
-    assert(todo_stack.empty());
-    set_of_states result;
-
-    for(const state_type s: states)
-    {
-      if (weak_property_cache.stable(s))
-      {
-        // Put the outgoing action labels in a set and put these in the result.
-        result.insert(s);
-      }
-      else
-      {
-        visited.insert(s);
-        todo_stack.push(s);
-      }
-    }
-
-    while (todo_stack.size()>0)
-    {
-      const state_type current_state=todo_stack.top();
-      todo_stack.pop();
-      // Consider the states reachable in one tau step.
-      for(const state_type s: weak_property_cache.tau_reachable_states(current_state))
-      {
-        if (weak_property_cache.stable(s))
-        {
-          // Put the outgoing action labels in a set and put these in the result.
-          result.insert(s);
-        }
-        else
-        {
-          if (visited.insert(s).second) // t.to() is a new state.
-          {
-            todo_stack.push(s);
-          }
-        }
-      }
-    }
-    cache[states]=result;
-    visited.clear();
-    return cache[states];
-  }
-
   /// \brief This function checks that the refusals(impl) are contained in the refusals of spec, where
   ///        the refusals of spec are defined by { r | exists s in spec. r in refusals(s) and stable(r) }.
   /// \details This is equivalent to saying that for all enabled actions of impl it must be contained in the enabled actions
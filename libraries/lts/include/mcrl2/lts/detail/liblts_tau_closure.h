@@ -0,0 +1,341 @@
+// Author(s): Jan Friso Groote
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file lts/detail/liblts_tau_closure.h
+/// \brief Closures over the internal transitions of an LTS. The strongly connected
+///        components of the internal transitions are condensed into an acyclic graph,
+///        and closures are computed per component in reverse topological order, such
+///        that the transitive tau closure itself is never stored.
+
+#ifndef _LIBLTS_TAU_CLOSURE_H
+#define _LIBLTS_TAU_CLOSURE_H
+
+#include <limits>
+#include "mcrl2/lts/lts_utilities.h"
+#include "mcrl2/lts/detail/parallel_for.h"
+
+namespace mcrl2
+{
+namespace lts
+{
+namespace detail
+{
+
+/// \brief The acyclic graph of the strongly connected components (sccs) of the internal transitions of an LTS.
+/// \details The sccs are numbered such that the tau successors of an scc have a smaller number than the scc itself.
+///          Furthermore, the sccs are grouped in levels: the level of an scc is the length of the longest path
+///          of internal transitions from it to an scc without tau successors.
+template < class LTS_TYPE>
+class tau_scc_graph
+{
+  public:
+    typedef std::size_t state_type;
+    typedef std::size_t label_type;
+    typedef std::pair<label_type, state_type> visible_transition;
+
+  protected:
+    static constexpr std::size_t undefined = std::numeric_limits<std::size_t>::max();
+
+    // The number of sccs on which the values are computed by a single thread.
+    static constexpr std::size_t chunk_size = 64;
+
+    std::size_t m_number_of_sccs = 0;
+    std::vector<std::size_t> m_scc_of_state;
+
+    // The states of scc c are m_states[m_states_begin[c]], ..., m_states[m_states_begin[c+1]-1]. The same
+    // representation is used for the tau successors, the visible transitions and the levels.
+    std::vector<std::size_t> m_states_begin;
+    std::vector<state_type> m_states;
+    std::vector<std::size_t> m_successors_begin;
+    std::vector<std::size_t> m_successors;
+    std::vector<std::size_t> m_visible_begin;
+    std::vector<visible_transition> m_visible;
+    std::vector<std::size_t> m_levels_begin;
+    std::vector<std::size_t> m_levels;
+
+    // Distributes the elements 0, ..., n-1 with key(i) over buckets, such that the elements with key k are
+    // result[begin[k]], ..., result[begin[k+1]-1], in increasing order.
+    template <typename Key>
+    static void group(const std::size_t n,
+                      const std::size_t number_of_keys,
+                      Key key,
+                      std::vector<std::size_t>& begin,
+                      std::vector<std::size_t>& result)
+    {
+      begin.assign(number_of_keys + 1, 0);
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        begin[key(i) + 1]++;
+      }
+      for (std::size_t k = 0; k < number_of_keys; ++k)
+      {
+        begin[k + 1] += begin[k];
+      }
+      result.resize(n);
+      std::vector<std::size_t> position(begin.begin(), begin.end() - 1);
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        result[position[key(i)]++] = i;
+      }
+    }
+
+    // Numbers the sccs using Tarjan's algorithm. An explicit stack is used, as long sequences of
+    // internal transitions would otherwise exhaust the call stack.
+    void number_sccs(const std::vector<std::size_t>& tau_begin, const std::vector<state_type>& tau_targets)
+    {
+      const std::size_t n = m_scc_of_state.size();
+      std::vector<std::size_t> index(n, undefined);
+      std::vector<std::size_t> lowlink(n);
+      std::vector<state_type> stack;
+      std::vector<std::pair<state_type, std::size_t> > calls;
+      std::size_t next_index = 0;
+
+      for (state_type root = 0; root < n; ++root)
+      {
+        if (index[root] != undefined)
+        {
+          continue;
+        }
+        index[root] = lowlink[root] = next_index++;
+        stack.push_back(root);
+        calls.emplace_back(root, tau_begin[root]);
+        while (!calls.empty())
+        {
+          const state_type s = calls.back().first;
+          if (calls.back().second < tau_begin[s + 1])
+          {
+            const state_type t = tau_targets[calls.back().second++];
+            if (index[t] == undefined)
+            {
+              index[t] = lowlink[t] = next_index++;
+              stack.push_back(t);
+              calls.emplace_back(t, tau_begin[t]);
+            }
+            else if (m_scc_of_state[t] == undefined)  // t is on the stack.
+            {
+              lowlink[s] = std::min(lowlink[s], index[t]);
+            }
+            continue;
+          }
+
+          calls.pop_back();
+          if (!calls.empty())
+          {
+            const state_type parent = calls.back().first;
+            lowlink[parent] = std::min(lowlink[parent], lowlink[s]);
+          }
+          if (lowlink[s] == index[s])
+          {
+            state_type t;
+            do
+            {
+              t = stack.back();
+              stack.pop_back();
+              m_scc_of_state[t] = m_number_of_sccs;
+            }
+            while (t != s);
+            m_number_of_sccs++;
+          }
+        }
+      }
+    }
+
+  public:
+    /// \brief Constructor. Transitions with a label that is hidden or tau are internal.
+    explicit tau_scc_graph(const LTS_TYPE& l)
+      : m_scc_of_state(l.num_states(), undefined)
+    {
+      const std::vector<transition>& transitions = l.get_transitions();
+      auto is_internal = [&](const transition& t) { return l.is_tau(l.apply_hidden_label_map(t.label())); };
+
+      // Group the targets of the internal transitions per source state.
+      std::vector<std::size_t> internal;
+      for (std::size_t i = 0; i < transitions.size(); ++i)
+      {
+        if (is_internal(transitions[i]))
+        {
+          internal.push_back(i);
+        }
+      }
+      std::vector<std::size_t> tau_begin;
+      std::vector<state_type> tau_targets;
+      group(internal.size(), l.num_states(), [&](std::size_t i) { return transitions[internal[i]].from(); }, tau_begin, tau_targets);
+      for (state_type& t: tau_targets)
+      {
+        t = transitions[internal[t]].to();
+      }
+      internal = std::vector<std::size_t>();
+
+      number_sccs(tau_begin, tau_targets);
+      mCRL2log(log::debug) << "The internal transitions of " << l.num_states() << " states form " << m_number_of_sccs << " strongly connected components." << std::endl;
+
+      group(l.num_states(), m_number_of_sccs, [&](state_type s) { return m_scc_of_state[s]; }, m_states_begin, m_states);
+
+      // Collect the tau successors of each scc, without duplicates and without the scc itself.
+      std::vector<std::size_t> last_predecessor(m_number_of_sccs, undefined);
+      m_successors_begin.assign(1, 0);
+      for (std::size_t c = 0; c < m_number_of_sccs; ++c)
+      {
+        last_predecessor[c] = c;
+        for (std::size_t i = m_states_begin[c]; i < m_states_begin[c + 1]; ++i)
+        {
+          const state_type s = m_states[i];
+          for (std::size_t j = tau_begin[s]; j < tau_begin[s + 1]; ++j)
+          {
+            const std::size_t d = m_scc_of_state[tau_targets[j]];
+            if (last_predecessor[d] != c)
+            {
+              assert(d < c);
+              last_predecessor[d] = c;
+              m_successors.push_back(d);
+            }
+          }
+        }
+        m_successors_begin.push_back(m_successors.size());
+      }
+
+      // Collect the visible transitions leaving each scc.
+      std::vector<std::size_t> visible;
+      for (std::size_t i = 0; i < transitions.size(); ++i)
+      {
+        if (!is_internal(transitions[i]))
+        {
+          visible.push_back(i);
+        }
+      }
+      std::vector<std::size_t> order;
+      group(visible.size(), m_number_of_sccs, [&](std::size_t i) { return m_scc_of_state[transitions[visible[i]].from()]; }, m_visible_begin, order);
+      m_visible.reserve(order.size());
+      for (std::size_t i: order)
+      {
+        const transition& t = transitions[visible[i]];
+        m_visible.emplace_back(l.apply_hidden_label_map(t.label()), t.to());
+      }
+
+      // Determine the levels. As successors have smaller numbers, the level of each successor is known.
+      std::vector<std::size_t> level(m_number_of_sccs, 0);
+      std::size_t number_of_levels = m_number_of_sccs == 0 ? 0 : 1;
+      for (std::size_t c = 0; c < m_number_of_sccs; ++c)
+      {
+        for (std::size_t i = m_successors_begin[c]; i < m_successors_begin[c + 1]; ++i)
+        {
+          level[c] = std::max(level[c], level[m_successors[i]] + 1);
+        }
+        number_of_levels = std::max(number_of_levels, level[c] + 1);
+      }
+      group(m_number_of_sccs, number_of_levels, [&](std::size_t c) { return level[c]; }, m_levels_begin, m_levels);
+    }
+
+    /// \brief The number of strongly connected components.
+    std::size_t number_of_sccs() const
+    {
+      return m_number_of_sccs;
+    }
+
+    /// \brief The scc to which state s belongs.
+    std::size_t scc(const state_type s) const
+    {
+      return m_scc_of_state[s];
+    }
+
+    /// \brief The states of scc c are states()[states_begin(c)], ..., states()[states_begin(c+1)-1].
+    std::size_t states_begin(const std::size_t c) const
+    {
+      return m_states_begin[c];
+    }
+
+    const std::vector<state_type>& states() const
+    {
+      return m_states;
+    }
+
+    /// \brief The sccs that can be reached from scc c by a single internal transition, except c itself, are
+    ///        successors()[successors_begin(c)], ..., successors()[successors_begin(c+1)-1].
+    std::size_t successors_begin(const std::size_t c) const
+    {
+      return m_successors_begin[c];
+    }
+
+    const std::vector<std::size_t>& successors() const
+    {
+      return m_successors;
+    }
+
+    /// \brief The pairs (a, t) for which s-a->t is a visible transition from a state s in scc c are
+    ///        visible_transitions()[visible_begin(c)], ..., visible_transitions()[visible_begin(c+1)-1].
+    std::size_t visible_begin(const std::size_t c) const
+    {
+      return m_visible_begin[c];
+    }
+
+    const std::vector<visible_transition>& visible_transitions() const
+    {
+      return m_visible;
+    }
+
+    /// \brief Computes a value for each scc from the values of its tau successors, and applies visit to it.
+    /// \details The sccs are handled level by level, starting with the sccs without tau successors. The values
+    ///          of the sccs on one level are computed by compute(c, values, values[c]), using at most
+    ///          number_of_threads threads, where values[d] is available for each tau successor d of c. Next,
+    ///          visit(c, values[c]) is applied to these sccs by the calling thread, in increasing order of c.
+    ///          The value of an scc is released once the values of all its predecessors have been computed,
+    ///          such that only the values on the frontier of the traversal are stored.
+    template <typename Value, typename Compute, typename Visit>
+    void for_each_closure(Compute compute, Visit visit, const std::size_t number_of_threads = 1) const
+    {
+      std::vector<Value> values(m_number_of_sccs);
+      std::vector<std::size_t> waiting_predecessors(m_number_of_sccs, 0);
+      for (std::size_t d: m_successors)
+      {
+        waiting_predecessors[d]++;
+      }
+
+      for (std::size_t level = 0; level + 1 < m_levels_begin.size(); ++level)
+      {
+        const std::size_t first = m_levels_begin[level];
+        const std::size_t last = m_levels_begin[level + 1];
+        parallel_for(first, last, number_of_threads, chunk_size, [&](std::size_t i)
+        {
+          compute(m_levels[i], values, values[m_levels[i]]);
+        });
+
+        for (std::size_t i = first; i < last; ++i)
+        {
+          const std::size_t c = m_levels[i];
+          visit(c, values[c]);
+          if (waiting_predecessors[c] == 0)
+          {
+            values[c] = Value();
+          }
+          for (std::size_t j = m_successors_begin[c]; j < m_successors_begin[c + 1]; ++j)
+          {
+            const std::size_t d = m_successors[j];
+            if (--waiting_predecessors[d] == 0)
+            {
+              values[d] = Value();
+            }
+          }
+        }
+      }
+    }
+};
+
+/// \brief Inserts the sorted range [first, last) into the sorted vector v, without duplicates.
+template <typename T, typename Iterator>
+void merge_sorted(std::vector<T>& v, Iterator first, Iterator last)
+{
+  const std::size_t size = v.size();
+  v.insert(v.end(), first, last);
+  std::inplace_merge(v.begin(), v.begin() + size, v.end());
+  v.erase(std::unique(v.begin(), v.end()), v.end());
+}
+
+}
+}
+}
+#endif // _LIBLTS_TAU_CLOSURE_H
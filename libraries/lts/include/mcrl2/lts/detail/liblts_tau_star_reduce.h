@@ -12,6 +12,7 @@
 #define _LIBLTS_TAUSTARREDUCE_H
 
 #include "mcrl2/lts/lts_utilities.h"
+#include "mcrl2/lts/detail/liblts_tau_closure.h"
 
 namespace mcrl2
 {
@@ -241,43 +242,52 @@ void remove_redundant_transitions(lts<STATE_LABEL_T, ACTION_LABEL_T, LTS_BASE_CL
 }
 
 
+/// \brief Replaces the transitions of l by a transition s-a->t for each sequence s-tau*->-a->t with a visible action a.
+/// \details The sequences are collected per strongly connected component of internal transitions, on the acyclic
+///          graph of these components, such that the transitive tau closure is not stored. Unreachable states are
+///          removed afterwards.
+/// \param l A labelled transition system
+/// \param number_of_threads The number of threads that collect the sequences.
 template < class STATE_LABEL_T, class ACTION_LABEL_T, class LTS_BASE_CLASS >
-void tau_star_reduce(lts< STATE_LABEL_T, ACTION_LABEL_T, LTS_BASE_CLASS >& l)
-// This method assumes there are no tau loops!
+void tau_star_reduce(lts< STATE_LABEL_T, ACTION_LABEL_T, LTS_BASE_CLASS >& l, const std::size_t number_of_threads = 1)
 {
-  typedef typename lts<STATE_LABEL_T, ACTION_LABEL_T, LTS_BASE_CLASS>::states_size_type state_t;
-  std::vector < transition >& original_transitions=l.get_transitions();
-  std::set < transition> new_transitions;
+  typedef lts< STATE_LABEL_T, ACTION_LABEL_T, LTS_BASE_CLASS > lts_t;
+  typedef typename tau_scc_graph<lts_t>::visible_transition visible_transition;
 
-  // Add all the original non tau transitions.
-  for(std::vector < transition >::const_iterator i=original_transitions.begin(); i!=original_transitions.end(); ++i)
+  std::vector < transition > new_transitions;
   {
-    if (!l.is_tau(l.apply_hidden_label_map(i->label())))
-    {
-      new_transitions.insert(*i);
-    }
-  }
-
-  // Add for every tau*.a transitions sequence a single transition a, provided a is not tau.
-  std::map <state_t, std::set <state_t> > backward_tau_closure=calculate_non_reflexive_transitive_tau_closure(l,false);
-  for(std::vector < transition >::const_iterator i=original_transitions.begin(); i!=original_transitions.end(); ++i)
-  {
-    if (!l.is_tau(l.apply_hidden_label_map(i->label())))
-    {
-      std::set<state_t>& new_from_states=backward_tau_closure[i->from()];
-      for(typename std::set<state_t>::const_iterator j=new_from_states.begin(); j!=new_from_states.end(); ++j)
+    const tau_scc_graph<lts_t> graph(l);
+    graph.template for_each_closure<std::vector<visible_transition> >(
+      [&](const std::size_t c, const std::vector<std::vector<visible_transition> >& closures, std::vector<visible_transition>& closure)
       {
-        new_transitions.insert(transition(*j,i->label(),i->to()));
-      }
-    }
+        closure.assign(graph.visible_transitions().begin() + graph.visible_begin(c),
+                       graph.visible_transitions().begin() + graph.visible_begin(c + 1));
+        std::sort(closure.begin(), closure.end());
+        closure.erase(std::unique(closure.begin(), closure.end()), closure.end());
+        for (std::size_t i = graph.successors_begin(c); i < graph.successors_begin(c + 1); ++i)
+        {
+          const std::vector<visible_transition>& successor = closures[graph.successors()[i]];
+          merge_sorted(closure, successor.begin(), successor.end());
+        }
+      },
+      [&](const std::size_t c, const std::vector<visible_transition>& closure)
+      {
+        for (std::size_t i = graph.states_begin(c); i < graph.states_begin(c + 1); ++i)
+        {
+          for (const visible_transition& t: closure)
+          {
+            new_transitions.emplace_back(graph.states()[i], t.first, t.second);
+          }
+        }
+      },
+      number_of_threads);
   }
-  l.clear_transitions();
-  
-  // Add the newly generated transitions
-  for(std::set < transition >::const_iterator i=new_transitions.begin();
-            i!=new_transitions.end(); ++i)
+  std::sort(new_transitions.begin(), new_transitions.end());
+
+  l.clear_transitions(new_transitions.size());
+  for (const transition& t: new_transitions)
   {
-    l.add_transition(*i);
+    l.add_transition(t);
   }
 
   reachability_check(l, true); // Remove unreachable parts.
@@ -8,13 +8,20 @@
 //
 /// \file lts/detail/liblts_weak_bisim.h
 /// \brief This file defines an algorithm for weak bisimulation, by
-///        calculating the transitive tau closure and apply strong
-///        bisimulation afterwards. In order to apply this algorithm
-///        it is advisable to first apply a branching bisimulation reduction.
+///        refining a partition of the strongly connected components of
+///        internal transitions with respect to weak signatures. The
+///        signatures are computed on the acyclic graph of these components,
+///        such that the transitive tau closure is never stored. In order to
+///        apply this algorithm it is advisable to first apply a branching
+///        bisimulation reduction.
 
 #ifndef _LIBLTS_WEAK_BISIM_H
 #define _LIBLTS_WEAK_BISIM_H
+#include <unordered_map>
+#include <unordered_set>
+#include "mcrl2/utilities/hash_utility.h"
 #include "mcrl2/lts/detail/liblts_scc.h"
+#include "mcrl2/lts/detail/liblts_tau_closure.h"
 #include "mcrl2/lts/detail/liblts_tau_star_reduce.h"
 #include "mcrl2/lts/detail/liblts_merge.h"
 #include "mcrl2/lts/lts_aut.h"
@@ -28,14 +35,250 @@ namespace lts
 namespace detail
 {
 
+/// \brief The weak signature of a strongly connected component of internal transitions, with
+///        respect to a partition of these components into blocks.
+struct weak_signature
+{
+  std::size_t reachable_blocks = 0;                                // The number of the set of blocks that can be reached by tau*.
+  std::vector<std::pair<std::size_t, std::size_t> > transitions;   // The pairs (a,B) such that B can be reached by tau*.a.tau*.
+  std::size_t hash = 0;
+
+  bool operator==(const weak_signature& other) const
+  {
+    return hash == other.hash && reachable_blocks == other.reachable_blocks && transitions == other.transitions;
+  }
+};
+
+/// \brief Partitions the states of an LTS with respect to weak bisimulation.
+/// \details The strongly connected components of internal transitions consist of weakly bisimilar
+///          states, and are therefore partitioned as a whole. The partition is refined until it is stable,
+///          where two components remain in the same block iff they were in the same block and their weak
+///          signatures are equal. The signatures are computed on the fly, level by level on the acyclic
+///          graph of the components, and are released once they are not needed anymore. Only the sets of
+///          blocks that can be reached by internal transitions are stored for all components, and each
+///          distinct set is stored once.
+template < class LTS_TYPE>
+class weak_bisim_partitioner
+{
+  public:
+    /** \brief Creates a weak bisimulation partitioner for an LTS.
+     *  \param[in] l The LTS that is partitioned.
+     *  \param[in] number_of_threads The number of threads that compute signatures. */
+    weak_bisim_partitioner(LTS_TYPE& l, const std::size_t number_of_threads = 1);
+
+    /** \brief Replaces the transition system by its quotient with respect to weak bisimulation.
+     *  \details Only the transitions of the original transition system are kept, such that
+     *           the transitive tau closure is not added. */
+    void replace_transition_system();
+
+    /** \brief Gives the number of weak bisimulation equivalence classes of the LTS.
+     *  \return The number of equivalence classes. */
+    std::size_t num_eq_classes() const;
+
+    /** \brief Gives the equivalence class number of a state.
+     *  \param[in] s A state number.
+     *  \return The number of the equivalence class to which the state belongs. */
+    std::size_t get_eq_class(const std::size_t s) const;
+
+    /** \brief Returns whether two states are in the same weak bisimulation equivalence class.
+     *  \param[in] s A state number.
+     *  \param[in] t A state number.
+     *  \retval true if s and t are weakly bisimilar;
+     *  \retval false otherwise. */
+    bool in_same_class(const std::size_t s, const std::size_t t) const;
+
+  private:
+    LTS_TYPE& aut;
+    const tau_scc_graph<LTS_TYPE> graph;
+    const std::size_t number_of_threads;
+    std::vector<std::size_t> block_of_a_component;
+    std::size_t number_of_blocks;
+
+    void refine();
+};
+
+
+template < class LTS_TYPE>
+weak_bisim_partitioner<LTS_TYPE>::weak_bisim_partitioner(LTS_TYPE& l, const std::size_t number_of_threads)
+  : aut(l),
+    graph(l),
+    number_of_threads(number_of_threads),
+    block_of_a_component(graph.number_of_sccs(), 0),
+    number_of_blocks(graph.number_of_sccs() == 0 ? 0 : 1)
+{
+  mCRL2log(log::debug) << "Weak bisimulation partitioner created for " << l.num_states() << " states and " <<
+              l.num_transitions() << " transitions" << std::endl;
+
+  std::size_t previous_number_of_blocks;
+  std::size_t iterations = 0;
+  do
+  {
+    previous_number_of_blocks = number_of_blocks;
+    refine();
+    iterations++;
+  }
+  while (number_of_blocks != previous_number_of_blocks);
+
+  mCRL2log(log::debug) << "Weak bisimulation partitioner found " << number_of_blocks << " equivalence classes in " <<
+              iterations << " iterations." << std::endl;
+}
+
+
+template < class LTS_TYPE>
+void weak_bisim_partitioner<LTS_TYPE>::refine()
+{
+  // Determine for each component the set of blocks that it can reach by internal transitions.
+  std::unordered_map<std::vector<std::size_t>, std::size_t> reachable_blocks_index;
+  std::vector<const std::vector<std::size_t>*> reachable_blocks;
+  std::vector<std::size_t> reachable_blocks_of_a_component(graph.number_of_sccs());
+  graph.template for_each_closure<std::vector<std::size_t> >(
+    [&](const std::size_t c, const std::vector<std::vector<std::size_t> >& closures, std::vector<std::size_t>& blocks)
+    {
+      blocks.push_back(block_of_a_component[c]);
+      for (std::size_t i = graph.successors_begin(c); i < graph.successors_begin(c + 1); ++i)
+      {
+        const std::vector<std::size_t>& successor = closures[graph.successors()[i]];
+        merge_sorted(blocks, successor.begin(), successor.end());
+      }
+    },
+    [&](const std::size_t c, const std::vector<std::size_t>& blocks)
+    {
+      const auto i = reachable_blocks_index.emplace(blocks, reachable_blocks.size());
+      if (i.second)
+      {
+        reachable_blocks.push_back(&i.first->first);
+      }
+      reachable_blocks_of_a_component[c] = i.first->second;
+    },
+    number_of_threads);
+
+  // Compute the signatures, and number the blocks of the new partition. For each new block the old
+  // block and the signature of its first component are stored, which are looked up via their hash.
+  std::vector<std::size_t> new_block_of_a_component(graph.number_of_sccs());
+  std::vector<std::pair<std::size_t, weak_signature> > representatives;
+  std::unordered_multimap<std::size_t, std::size_t> blocks_with_hash;
+
+  graph.template for_each_closure<weak_signature>(
+    [&](const std::size_t c, const std::vector<weak_signature>& signatures, weak_signature& signature)
+    {
+      signature.reachable_blocks = reachable_blocks_of_a_component[c];
+      for (std::size_t i = graph.visible_begin(c); i < graph.visible_begin(c + 1); ++i)
+      {
+        const std::pair<std::size_t, std::size_t>& t = graph.visible_transitions()[i];
+        for (const std::size_t b: *reachable_blocks[reachable_blocks_of_a_component[graph.scc(t.second)]])
+        {
+          signature.transitions.emplace_back(t.first, b);
+        }
+      }
+      std::sort(signature.transitions.begin(), signature.transitions.end());
+      signature.transitions.erase(std::unique(signature.transitions.begin(), signature.transitions.end()), signature.transitions.end());
+
+      for (std::size_t i = graph.successors_begin(c); i < graph.successors_begin(c + 1); ++i)
+      {
+        const weak_signature& successor = signatures[graph.successors()[i]];
+        merge_sorted(signature.transitions, successor.transitions.begin(), successor.transitions.end());
+      }
+      signature.hash = utilities::detail::hash_combine(
+                         utilities::detail::hash_combine(block_of_a_component[c], signature.reachable_blocks),
+                         std::hash<std::vector<std::pair<std::size_t, std::size_t> > >()(signature.transitions));
+    },
+    [&](const std::size_t c, const weak_signature& signature)
+    {
+      const auto range = blocks_with_hash.equal_range(signature.hash);
+      for (auto i = range.first; i != range.second; ++i)
+      {
+        if (representatives[i->second].first == block_of_a_component[c] && representatives[i->second].second == signature)
+        {
+          new_block_of_a_component[c] = i->second;
+          return;
+        }
+      }
+      new_block_of_a_component[c] = representatives.size();
+      blocks_with_hash.emplace(signature.hash, representatives.size());
+      representatives.emplace_back(block_of_a_component[c], signature);
+    },
+    number_of_threads);
+
+  block_of_a_component.swap(new_block_of_a_component);
+  number_of_blocks = representatives.size();
+}
+
+
+template < class LTS_TYPE>
+void weak_bisim_partitioner<LTS_TYPE>::replace_transition_system()
+{
+  // Put the transitions between blocks in a set, except for internal transitions within a block.
+  // A set is used to remove double occurrences of transitions.
+  std::unordered_set < transition > resulting_transitions;
+  for (const transition& t: aut.get_transitions())
+  {
+    const std::size_t from = get_eq_class(t.from());
+    const std::size_t to = get_eq_class(t.to());
+    const std::size_t label = aut.apply_hidden_label_map(t.label());
+    if (!aut.is_tau(label) || from != to)
+    {
+      resulting_transitions.insert(transition(from, label, to));
+    }
+  }
+
+  aut.clear_transitions(resulting_transitions.size());
+  for (const transition& t: resulting_transitions)
+  {
+    aut.add_transition(t);
+  }
+
+  // Merge the states, by setting the state labels of each state to the concatenation of the state labels of its
+  // equivalence class.
+  if (aut.has_state_info())   /* If there are no state labels this step can be ignored */
+  {
+    std::vector<typename LTS_TYPE::state_label_t> new_labels(num_eq_classes());
+
+    for(std::size_t i=aut.num_states(); i>0; )
+    {
+      --i;
+      const std::size_t new_index=get_eq_class(i);
+      new_labels[new_index]=new_labels[new_index]+aut.state_label(i);
+    }
+
+    for(std::size_t i=0; i<num_eq_classes(); ++i)
+    {
+      aut.set_state_label(i,new_labels[i]);
+    }
+  }
+
+  aut.set_num_states(num_eq_classes());
+  aut.set_initial_state(get_eq_class(aut.initial_state()));
+}
+
+template < class LTS_TYPE>
+std::size_t weak_bisim_partitioner<LTS_TYPE>::num_eq_classes() const
+{
+  return number_of_blocks;
+}
+
+template < class LTS_TYPE>
+std::size_t weak_bisim_partitioner<LTS_TYPE>::get_eq_class(const std::size_t s) const
+{
+  return block_of_a_component[graph.scc(s)];
+}
+
+template < class LTS_TYPE>
+bool weak_bisim_partitioner<LTS_TYPE>::in_same_class(const std::size_t s, const std::size_t t) const
+{
+  return get_eq_class(s)==get_eq_class(t);
+}
+
+
 /** \brief Reduce LTS l with respect to (divergence-preserving) weak bisimulation.
  * \param[in/out] l The transition system that is reduced.
  * \param[in] preserve_divergences Indicates whether loops of internal actions on states must be preserved. If false
- *            these are removed. If true these are preserved.  */
+ *            these are removed. If true these are preserved.
+ * \param[in] number_of_threads The number of threads used to compute weak signatures. */
 template < class LTS_TYPE>
 void weak_bisimulation_reduce(
   LTS_TYPE& l,
-  const bool preserve_divergences = false)
+  const bool preserve_divergences = false,
+  const std::size_t number_of_threads = 1)
 {
   if (1 < l.num_states())
   {
@@ -49,13 +292,12 @@ void weak_bisimulation_reduce(
   }
   if (1 < l.num_states())
   {
-    reflexive_transitive_tau_closure(l);                      // Apply transitive tau closure to l.
-    bisimulation_reduce_dnj(l, false, false);                 // Apply strong bisimulation to l.
+    weak_bisim_partitioner<LTS_TYPE> partitioner(l, number_of_threads);
+    partitioner.replace_transition_system();                  // Take the quotient modulo weak bisimulation.
   }
   scc_reduce(l);                                              // Remove tau loops.
   remove_redundant_transitions(l);                            // Remove transitions s -a-> s' if also s-a->-tau->s' or s-tau->-a->s' is present.
-                                                              // Note that this is correct, because l is reduced modulo strong bisimulation and
-                                                              // does not contain tau loops.
+                                                              // Note that this is correct, because l does not contain tau loops.
   if (preserve_divergences)
   {
     unmark_explicit_divergence_transitions(l,divergence_label);
@@ -65,21 +307,38 @@ void weak_bisimulation_reduce(
 
 /** \brief Checks whether the initial states of two LTSs are weakly bisimilar.
  * \details The LTSs l1 and l2 are not usable anymore after this call.
- *          The space consumption is O(n) and running time is dominated by the
- *          transitive closure (after branching bisimulation).
+ *          After a branching bisimulation reduction of both, the disjoint union
+ *          of l1 and l2 is partitioned with respect to weak bisimulation.
  * \param[in/out] l1 A first transition system.
  * \param[in/out] l2 A second transistion system.
  * \param[preserve_divergences] If true and branching is true, preserve tau loops on states.
+ * \param[in] number_of_threads The number of threads used to compute weak signatures.
  * \retval True iff the initial states of the current transition system and l2 are (divergence preserving) (branching) bisimilar */
 template < class LTS_TYPE>
 bool destructive_weak_bisimulation_compare(
   LTS_TYPE& l1,
   LTS_TYPE& l2,
-  const bool preserve_divergences=false)
+  const bool preserve_divergences=false,
+  const std::size_t number_of_threads = 1)
 {
-  weak_bisimulation_reduce(l1,preserve_divergences);
-  weak_bisimulation_reduce(l2,preserve_divergences);
-  return destructive_bisimulation_compare_dnj(l1,l2);
+  if (1 < l1.num_states())
+  {
+    bisimulation_reduce_dnj(l1, true, preserve_divergences);
+  }
+  if (1 < l2.num_states())
+  {
+    bisimulation_reduce_dnj(l2, true, preserve_divergences);
+  }
+  const std::size_t init_l2 = l2.initial_state() + l1.num_states();
+  detail::merge(l1, l2);
+  l2.clear(); // No use for l2 anymore.
+
+  if (preserve_divergences)
+  {
+    mark_explicit_divergence_transitions(l1);
+  }
+  weak_bisim_partitioner<LTS_TYPE> partitioner(l1, number_of_threads);
+  return partitioner.in_same_class(l1.initial_state(), init_l2);
 }
 
 
@@ -87,10 +346,8 @@ bool destructive_weak_bisimulation_compare(
  *  \details The LTSs l1 and l2 are first duplicated and subsequently
  *           reduced modulo bisimulation. If memory space is a concern, one could consider to
  *           use destructive_weak_bisimulation_compare.  The running time
- *           of this routine is dominated by the transitive closure
- *           (after branching bisimulation).  It uses O(m+n) memory
- *           in addition to the copies of l1 and l2, where n is the
- *           number of states and m is the number of transitions.
+ *           of this routine is dominated by the computation of weak
+ *           signatures (after branching bisimulation).
  * \param[in/out] l1 A first transition system.
  * \param[in/out] l2 A second transistion system.
  * \param[preserve_divergences] If true and branching is true, preserve tau loops on states.
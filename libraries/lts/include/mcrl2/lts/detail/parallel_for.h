@@ -0,0 +1,92 @@
+// Author(s): Jan Friso Groote
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file lts/detail/parallel_for.h
+/// \brief Applies a function to a range of numbers using a number of threads.
+
+#ifndef _LIBLTS_PARALLEL_FOR_H
+#define _LIBLTS_PARALLEL_FOR_H
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace mcrl2
+{
+namespace lts
+{
+namespace detail
+{
+
+/// \brief Applies f to each number in [first, last), using at most number_of_threads threads.
+/// \details The numbers are handed out in chunks of chunk_size consecutive numbers. If the range
+///          consists of a single chunk, f is applied by the calling thread only. An exception thrown
+///          by f stops the handing out of chunks, and is rethrown when all threads have finished.
+template <typename Function>
+void parallel_for(const std::size_t first,
+                  const std::size_t last,
+                  const std::size_t number_of_threads,
+                  const std::size_t chunk_size,
+                  Function f)
+{
+  if (number_of_threads <= 1 || last <= first + chunk_size)
+  {
+    for (std::size_t i = first; i < last; ++i)
+    {
+      f(i);
+    }
+    return;
+  }
+
+  std::atomic<std::size_t> next(first);
+  std::atomic<bool> failed(false);
+  std::exception_ptr exception;
+  auto work = [&]()
+  {
+    try
+    {
+      for (std::size_t begin = next.fetch_add(chunk_size); begin < last && !failed; begin = next.fetch_add(chunk_size))
+      {
+        for (std::size_t i = begin; i < std::min(begin + chunk_size, last); ++i)
+        {
+          f(i);
+        }
+      }
+    }
+    catch (...)
+    {
+      if (!failed.exchange(true))
+      {
+        exception = std::current_exception();
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  const std::size_t number_of_chunks = (last - first + chunk_size - 1) / chunk_size;
+  for (std::size_t i = 1; i < std::min(number_of_threads, number_of_chunks); ++i)
+  {
+    threads.emplace_back(work);
+  }
+  work();
+  for (std::thread& t: threads)
+  {
+    t.join();
+  }
+  if (exception)
+  {
+    std::rethrow_exception(exception);
+  }
+}
+
+}
+}
+}
+#endif // _LIBLTS_PARALLEL_FOR_H
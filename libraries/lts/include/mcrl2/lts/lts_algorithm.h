@@ -26,7 +26,7 @@
 #include "mcrl2/lts/detail/liblts_ready_sim.h"
 #include "mcrl2/lts/detail/liblts_failures_refinement.h"
 #include "mcrl2/lts/detail/liblts_coupledsim.h"
-#include "mcrl2/lts/detail/tree_set.h"
+#include "mcrl2/lts/detail/liblts_determinise.h"
 #include "mcrl2/lts/lts_equivalence.h"
 #include "mcrl2/lts/lts_preorder.h"
 #include "mcrl2/lts/sigref.h"
@@ -40,9 +40,11 @@ namespace lts
  * \param[in] l A labelled transition system that must be reduced.
  * \param[in] eq The equivalence with respect to which the LTS will be
  *            reduced.
+ * \param[in] number_of_threads The number of threads used by the weak
+ *            bisimulation and tau star reductions.
  **/
 template <class LTS_TYPE>
-void reduce(LTS_TYPE& l, lts_equivalence eq);
+void reduce(LTS_TYPE& l, lts_equivalence eq, std::size_t number_of_threads = 1);
 
 /** \brief Checks whether this LTS is equivalent to another LTS.
  * \param[in] l1 The first LTS that will be compared.
@@ -249,6 +251,7 @@ bool compare(const LTS_TYPE& l1,
  * \param[in] strategy Choose breadth-first or depth-first for exploration strategy
  *            of the antichain algorithms.
  * \param[in] preprocess Whether to allow preprocessing of the given LTSs.
+ * \param[in] number_of_threads The number of threads used by the breadth-first antichain algorithms.
  * \retval true if LTS \a l1 is smaller than LTS \a l2 according to
  * preorder \a pre.
  * \retval false otherwise.
@@ -267,7 +270,8 @@ bool destructive_compare(LTS_TYPE& l1,
                          const std::string& counter_example_file = "",
                          const bool structured_output = false,
                          const lps::exploration_strategy strategy = lps::es_breadth,
-                         const bool preprocess = true);
+                         const bool preprocess = true,
+                         const std::size_t number_of_threads = 1);
 
 /** \brief Checks whether this LTS is smaller than another LTS according
  * to a preorder.
@@ -279,6 +283,7 @@ bool destructive_compare(LTS_TYPE& l1,
  * \param[in] strategy Choose breadth-first or depth-first for exploration strategy
  *            of the antichain algorithms.
  * \param[in] preprocess Whether to allow preprocessing of the given LTSs.
+ * \param[in] number_of_threads The number of threads used by the breadth-first antichain algorithms.
  * \retval true if this LTS is smaller than LTS \a l according to
  * preorder \a pre.
  * \retval false otherwise.
@@ -291,11 +296,13 @@ bool compare(const LTS_TYPE&  l1,
              const std::string& counter_example_file = "",
              const bool structured_output = false,
              const lps::exploration_strategy strategy = lps::es_breadth,
-             const bool preprocess = true);
+             const bool preprocess = true,
+             const std::size_t number_of_threads = 1);
 
-/** \brief Determinises this LTS. */
+/** \brief Determinises this LTS.
+ * \param[in] number_of_threads The number of threads used by the subset construction. */
 template <class LTS_TYPE>
-void determinise(LTS_TYPE& l);
+void determinise(LTS_TYPE& l, std::size_t number_of_threads = 1);
 
 
 /** \brief Checks whether all states in this LTS are reachable
@@ -551,7 +558,7 @@ void merge(LTS_TYPE& l1, const LTS_TYPE& l2)
 
 
 template <class LTS_TYPE>
-void reduce(LTS_TYPE& l,lts_equivalence eq)
+void reduce(LTS_TYPE& l,lts_equivalence eq, const std::size_t number_of_threads)
 {
 
   switch (eq)
@@ -623,7 +630,7 @@ void reduce(LTS_TYPE& l,lts_equivalence eq)
     }
     case lts_eq_weak_bisim:
     {
-      detail::weak_bisimulation_reduce(l,false);
+      detail::weak_bisimulation_reduce(l,false,number_of_threads);
       return;
     }
     /*
@@ -644,7 +651,7 @@ void reduce(LTS_TYPE& l,lts_equivalence eq)
     */
     case lts_eq_divergence_preserving_weak_bisim:
     {
-      detail::weak_bisimulation_reduce(l,true);
+      detail::weak_bisimulation_reduce(l,true,number_of_threads);
       return;
     }
     /*
@@ -721,28 +728,28 @@ void reduce(LTS_TYPE& l,lts_equivalence eq)
     }
     case lts_eq_trace:
       detail::bisimulation_reduce(l,false);
-      determinise(l);
+      determinise(l,number_of_threads);
       detail::bisimulation_reduce(l,false);
       return;
     case lts_eq_weak_trace:
     {
       detail::bisimulation_reduce(l,true,false);
-      detail::tau_star_reduce(l);
+      detail::tau_star_reduce(l,number_of_threads);
       detail::bisimulation_reduce(l,false);
-      determinise(l);
+      determinise(l,number_of_threads);
       detail::bisimulation_reduce(l,false);
       return;
     }
     case lts_red_tau_star:
     {
       detail::bisimulation_reduce(l,true,false);
-      detail::tau_star_reduce(l);
+      detail::tau_star_reduce(l,number_of_threads);
       detail::bisimulation_reduce(l,false);
       return;
     }
     case lts_red_determinisation:
     {
-      determinise(l);
+      determinise(l,number_of_threads);
       return;
     }
     default:
@@ -766,15 +773,15 @@ bool compare(const LTS_TYPE& l1, const LTS_TYPE& l2, const lts_equivalence eq, c
 }
 
 template <class LTS_TYPE>
-bool compare(const LTS_TYPE& l1, const LTS_TYPE& l2, const lts_preorder pre, const bool generate_counter_example, const std::string& counter_example_file, const bool structured_output, const lps::exploration_strategy strategy, const bool preprocess)
+bool compare(const LTS_TYPE& l1, const LTS_TYPE& l2, const lts_preorder pre, const bool generate_counter_example, const std::string& counter_example_file, const bool structured_output, const lps::exploration_strategy strategy, const bool preprocess, const std::size_t number_of_threads)
 {
   LTS_TYPE l1_copy(l1);
   LTS_TYPE l2_copy(l2);
-  return destructive_compare(l1_copy, l2_copy, pre, generate_counter_example, counter_example_file, structured_output, strategy, preprocess);
+  return destructive_compare(l1_copy, l2_copy, pre, generate_counter_example, counter_example_file, structured_output, strategy, preprocess, number_of_threads);
 }
 
 template <class LTS_TYPE>
-bool destructive_compare(LTS_TYPE& l1, LTS_TYPE& l2, const lts_preorder pre, const bool generate_counter_example, const std::string& counter_example_file, const bool structured_output, const lps::exploration_strategy strategy, const bool preprocess)
+bool destructive_compare(LTS_TYPE& l1, LTS_TYPE& l2, const lts_preorder pre, const bool generate_counter_example, const std::string& counter_example_file, const bool structured_output, const lps::exploration_strategy strategy, const bool preprocess, const std::size_t number_of_threads)
 {
   switch (pre)
   {
@@ -826,14 +833,14 @@ bool destructive_compare(LTS_TYPE& l1, LTS_TYPE& l2, const lts_preorder pre, con
       // strong bisimulation equivalence. This is not strictly
       // necessary, but may reduce time/memory needed for simulation
       // preorder checking.
-      determinise(l1);
+      determinise(l1,number_of_threads);
       detail::bisimulation_reduce(l1,false);
 
-      determinise(l2);
+      determinise(l2,number_of_threads);
       detail::bisimulation_reduce(l2,false);
 
       // Trace preorder now corresponds to simulation preorder
-      return destructive_compare(l1, l2, lts_pre_sim, generate_counter_example, counter_example_file, structured_output, strategy);
+      return destructive_compare(l1, l2, lts_pre_sim, generate_counter_example, counter_example_file, structured_output, strategy, preprocess, number_of_threads);
     }
     case lts_pre_weak_trace:
     {
@@ -846,52 +853,52 @@ bool destructive_compare(LTS_TYPE& l1, LTS_TYPE& l2, const lts_preorder pre, con
       detail::tau_star_reduce(l2);
 
       // Weak trace preorder now corresponds to strong trace preorder
-      return destructive_compare(l1, l2, lts_pre_trace, generate_counter_example, counter_example_file, structured_output, strategy);
+      return destructive_compare(l1, l2, lts_pre_trace, generate_counter_example, counter_example_file, structured_output, strategy, preprocess, number_of_threads);
     }
     case lts_pre_trace_anti_chain:
     {
       if (generate_counter_example)
       {
         detail::counter_example_constructor cec("counter_example_trace_preorder", counter_example_file, structured_output);
-        return destructive_refinement_checker(l1, l2, refinement_type::trace, false, strategy, preprocess, cec);
+        return destructive_refinement_checker(l1, l2, refinement_type::trace, false, strategy, preprocess, cec, number_of_threads);
       }
-      return destructive_refinement_checker(l1, l2, refinement_type::trace, false, strategy, preprocess);
+      return destructive_refinement_checker(l1, l2, refinement_type::trace, false, strategy, preprocess, detail::dummy_counter_example_constructor(), number_of_threads);
     }
     case lts_pre_weak_trace_anti_chain:
     {
       if (generate_counter_example)
       {
         detail::counter_example_constructor cec("counter_example_weak_trace_preorder", counter_example_file, structured_output);
-        return destructive_refinement_checker(l1, l2, refinement_type::trace, true, strategy, preprocess, cec);
+        return destructive_refinement_checker(l1, l2, refinement_type::trace, true, strategy, preprocess, cec, number_of_threads);
       }
-      return destructive_refinement_checker(l1, l2, refinement_type::trace, true, strategy, preprocess);
+      return destructive_refinement_checker(l1, l2, refinement_type::trace, true, strategy, preprocess, detail::dummy_counter_example_constructor(), number_of_threads);
     }
     case lts_pre_failures_refinement:
     {
       if (generate_counter_example)
       {
         detail::counter_example_constructor cec("counter_example_failures_refinement", counter_example_file, structured_output);
-        return destructive_refinement_checker(l1, l2, refinement_type::failures, false, strategy, preprocess, cec);
+        return destructive_refinement_checker(l1, l2, refinement_type::failures, false, strategy, preprocess, cec, number_of_threads);
       }
-      return destructive_refinement_checker(l1, l2, refinement_type::failures, false, strategy, preprocess);
+      return destructive_refinement_checker(l1, l2, refinement_type::failures, false, strategy, preprocess, detail::dummy_counter_example_constructor(), number_of_threads);
     }
     case lts_pre_weak_failures_refinement:
     {
       if (generate_counter_example)
       {
         detail::counter_example_constructor cec("counter_example_weak_failures_refinement", counter_example_file, structured_output);
-        return destructive_refinement_checker(l1, l2, refinement_type::failures, true, strategy, preprocess, cec);
+        return destructive_refinement_checker(l1, l2, refinement_type::failures, true, strategy, preprocess, cec, number_of_threads);
       }
-      return destructive_refinement_checker(l1, l2, refinement_type::failures, true, strategy, preprocess);
+      return destructive_refinement_checker(l1, l2, refinement_type::failures, true, strategy, preprocess, detail::dummy_counter_example_constructor(), number_of_threads);
     }
     case lts_pre_failures_divergence_refinement:
     {
       if (generate_counter_example)
       {
         detail::counter_example_constructor cec("counter_example_failures_divergence_refinement", counter_example_file, structured_output);
-        return destructive_refinement_checker(l1, l2, refinement_type::failures_divergence, true, strategy, preprocess, cec);
+        return destructive_refinement_checker(l1, l2, refinement_type::failures_divergence, true, strategy, preprocess, cec, number_of_threads);
       }
-      return destructive_refinement_checker(l1, l2, refinement_type::failures_divergence, true, strategy, preprocess);
+      return destructive_refinement_checker(l1, l2, refinement_type::failures_divergence, true, strategy, preprocess, detail::dummy_counter_example_constructor(), number_of_threads);
     }
     default:
       mCRL2log(log::error) << "Comparison for this preorder is not available\n";
@@ -933,120 +940,13 @@ bool is_deterministic(const LTS_TYPE& l)
 }
 
 
-namespace detail
-{
-
-template <class LTS_TYPE>
-void get_trans(const outgoing_transitions_per_state_t& begin,
-               tree_set_store& tss,
-               std::size_t d,
-               std::vector<transition>& d_trans,
-               LTS_TYPE& aut)
-{
-  if (!tss.is_set_empty(d))
-  {
-    if (tss.is_set_empty(tss.get_set_child_right(d)))
-    {
-      // for (outgoing_transitions_per_state_t:: const_iterator
-      //     j=begin.lower_bound(tss.get_set_child_left(d)); j!=begin.upper_bound(tss.get_set_child_left(d)); ++j)
-      const state_type from=tss.get_set_child_left(d);
-      // for(const outgoing_pair_t& p: begin[from])
-      for (detail::state_type i=begin.lowerbound(from); i<begin.upperbound(from); ++i)
-      {
-        const outgoing_pair_t& p=begin.get_transitions()[i];
-        d_trans.push_back(transition(from, aut.apply_hidden_label_map(label(p)), to(p)));
-      }
-    }
-    else
-    {
-      get_trans(begin,tss,tss.get_set_child_left(d),d_trans,aut);
-      get_trans(begin,tss,tss.get_set_child_right(d),d_trans,aut);
-    }
-  }
-}
-} // namespace detail
 
 
 template <class LTS_TYPE>
-void determinise(LTS_TYPE& l)
+void determinise(LTS_TYPE& l, const std::size_t number_of_threads)
 {
-  tree_set_store tss;
-
-  std::vector<transition> d_transs;
-  std::vector<std::ptrdiff_t> d_states;
-
-  // create the initial state of the DLTS
-  d_states.push_back(l.initial_state());
-  std::ptrdiff_t d_id = tss.set_set_tag(tss.create_set(d_states));
-  d_states.clear();
-
-  const outgoing_transitions_per_state_t begin(l.get_transitions(),l.num_states(),true);
-
-  l.clear_transitions();
-  l.clear_state_labels();
-  std::size_t d_ntransitions = 0;
-  std::vector < transition > d_transitions;
-
-  std::size_t s;
-  std::size_t i,to,lbl,n_t;
-
-  while (d_id < tss.get_next_tag())
-  {
-    // collect the outgoing transitions of every state of DLTS state d_id in
-    // the vector d_transs
-    detail::get_trans(begin,tss,tss.get_set(d_id),d_transs,l);
-
-    // sort d_transs by label and (if labels are equal) by destination
-    const detail::compare_transitions_lts compare(l.hidden_label_set());
-    sort(d_transs.begin(),d_transs.end(),compare);
-
-    n_t = d_transs.size();
-    i = 0;
-    for (lbl = 0; lbl < l.num_action_labels(); ++lbl)
-    {
-      // compute the destination of the transition with label lbl
-      while (i < n_t && l.apply_hidden_label_map(d_transs[i].label()) < lbl)
-      {
-        ++i;
-      }
-      while (i < n_t && l.apply_hidden_label_map(d_transs[i].label()) == lbl)
-      {
-        to = d_transs[i].to();
-        d_states.push_back(to);
-        while (i < n_t && l.apply_hidden_label_map(d_transs[i].label()) == lbl &&
-               d_transs[i].to() == to)
-        {
-          ++i;
-        }
-      }
-      s = tss.create_set(d_states);
-
-      // generate the transitions to each of the next states
-      if (!tss.is_set_empty(s))
-      {
-        d_transitions.push_back(transition(d_id,lbl,tss.set_set_tag(s)));
-
-        if (d_ntransitions%10000 == 0)
-        {
-          mCRL2log(log::debug) <<
-            "generated " << tss.get_next_tag() << " states and " << d_ntransitions
-                         << " transitions; explored " << d_id << " states" << std::endl;
-        }
-      }
-      d_states.clear();
-    }
-    d_transs.clear();
-    ++d_id;
-  }
-
-
-  l.set_num_states(d_id,false); // remove the state values, and reset the number of states.
-  l.set_initial_state(0);
-
-  for (const transition& t: d_transitions)
-  {
-    l.add_transition(t);
-  }
+  detail::subset_constructor<LTS_TYPE> subsets(l, number_of_threads);
+  subsets.replace_transition_system();
   assert(is_deterministic(l));
 }
 
@@ -15,6 +15,9 @@
 #include "mcrl2/lps/explorer.h"
 #include "mcrl2/lts/detail/lts_convert.h"
 #include "mcrl2/lts/lts_io.h"
+#include <atomic>
+#include <exception>
+#include <thread>
 
 namespace mcrl2 {
 
@@ -27,6 +30,89 @@ lps::state remove_time_stamp(const lps::state& s)
   return lps::state(s.begin(), s.size() - 1);
 }
 
+/// \brief Returns the state label of the state s
+inline
+state_label_lts make_state_label(const lps::state& s, bool timed)
+{
+  return timed ? state_label_lts(remove_time_stamp(s)) : state_label_lts(s);
+}
+
+/// \brief Stores the state labels of the states with indices in [first, last) of state_map at the
+///        positions [0, last - first) of labels. The states are divided in blocks over number_of_threads threads.
+/// \details Positions of state_map that are not filled, which may happen in a parallel context, are skipped.
+template <typename StateMap>
+void make_state_labels(const StateMap& state_map,
+                       bool timed,
+                       std::size_t first,
+                       std::size_t last,
+                       std::vector<state_label_lts>& labels,
+                       std::size_t number_of_threads)
+{
+  constexpr std::size_t block_size = 4096;
+  assert(labels.size() >= last - first);
+
+  std::atomic<std::size_t> next_block(first);
+  auto convert = [&]()
+  {
+    for (std::size_t begin = next_block.fetch_add(block_size); begin < last; begin = next_block.fetch_add(block_size))
+    {
+      const std::size_t end = std::min(begin + block_size, last);
+      for (std::size_t i = begin; i < end; i++)
+      {
+        const lps::state& s = state_map[i];
+        if (is_aterm_balanced_tree(s))
+        {
+          labels[i - first] = make_state_label(s, timed);
+        }
+      }
+    }
+  };
+
+  const std::size_t number_of_blocks = (last - first + block_size - 1) / block_size;
+  const std::size_t number_of_workers = std::min(number_of_threads, number_of_blocks);
+  if (number_of_workers <= 1)
+  {
+    convert();
+    return;
+  }
+
+  std::vector<std::exception_ptr> exceptions(number_of_workers);
+  std::vector<std::thread> workers;
+  for (std::size_t k = 1; k < number_of_workers; k++)
+  {
+    workers.emplace_back([&, k]()
+      {
+        try
+        {
+          convert();
+        }
+        catch (...)
+        {
+          exceptions[k] = std::current_exception();
+        }
+      });
+  }
+  try
+  {
+    convert();
+  }
+  catch (...)
+  {
+    exceptions[0] = std::current_exception();
+  }
+  for (std::thread& worker: workers)
+  {
+    worker.join();
+  }
+  for (const std::exception_ptr& e: exceptions)
+  {
+    if (e)
+    {
+      std::rethrow_exception(e);
+    }
+  }
+}
+
 struct lts_builder
 {
   typedef atermpp::indexed_set<lps::state, atermpp::detail::GlobalThreadSafe> indexed_set_for_states_type;
@@ -57,6 +143,9 @@ struct lts_builder
   // Add actions and states to the LTS
   virtual void finalize(const indexed_set_for_states_type& state_map, bool timed) = 0;
 
+  // Add actions and states to the LTS, where the states were stored on disk by an external breadth-first search
+  virtual void finalize(const lps::external_state_map& state_map, bool timed) = 0;
+
   // Save the LTS to a file
   virtual void save(const std::string& filename) = 0;
 
@@ -72,6 +161,9 @@ class lts_none_builder: public lts_builder
     void finalize(const indexed_set_for_states_type& /* state_map */, bool /* timed */) override
     {}
 
+    void finalize(const lps::external_state_map& /* state_map */, bool /* timed */) override
+    {}
+
     void save(const std::string& /* filename */) override
     {}
 };
@@ -93,16 +185,25 @@ class lts_aut_builder: public lts_builder
       if (atermpp::detail::GlobalThreadSafe && number_of_threads>1) m_exclusive_transition_access.unlock();
     }
 
-    // Add actions and states to the LTS
-    void finalize(const indexed_set_for_states_type& state_map, bool /* timed */) override
+    void add_action_labels()
     {
-      // add actions
       m_lts.set_num_action_labels(m_actions.size());
       for (const auto& p: m_actions)
       {
         m_lts.set_action_label(p.second, action_label_string(lps::pp(p.first)));
       }
+    }
+
+    // Add actions and states to the LTS
+    void finalize(const indexed_set_for_states_type& state_map, bool /* timed */) override
+    {
+      add_action_labels();
+      m_lts.set_num_states(state_map.size());
+    }
 
+    void finalize(const lps::external_state_map& state_map, bool /* timed */) override
+    {
+      add_action_labels();
       m_lts.set_num_states(state_map.size());
     }
 
@@ -141,15 +242,25 @@ class lts_aut_disk_builder: public lts_builder
       if (atermpp::detail::GlobalThreadSafe && number_of_threads>1) m_exclusive_transition_access.unlock();
     }
 
-    // Add actions and states to the LTS
-    void finalize(const indexed_set_for_states_type& state_map, bool /* timed */) override
+    void write_header(std::size_t number_of_states)
     {
       out.flush();
       out.seekp(0);
-      out << "des (0," << m_transition_count << "," << state_map.size() << ")";
+      out << "des (0," << m_transition_count << "," << number_of_states << ")";
       out.close();
     }
 
+    // Add actions and states to the LTS
+    void finalize(const indexed_set_for_states_type& state_map, bool /* timed */) override
+    {
+      write_header(state_map.size());
+    }
+
+    void finalize(const lps::external_state_map& state_map, bool /* timed */) override
+    {
+      write_header(state_map.size());
+    }
+
     void save(const std::string& /* filename */) override
     { }
 };
@@ -159,6 +270,7 @@ class lts_lts_builder: public lts_builder
   protected:
     lts_lts_t m_lts;
     bool m_discard_state_labels = false;
+    std::size_t m_number_of_threads = 1;
     std::mutex m_exclusive_transition_access;
 
   public:
@@ -166,9 +278,11 @@ class lts_lts_builder: public lts_builder
       const data::data_specification& dataspec,
       const process::action_label_list& action_labels,
       const data::variable_list& process_parameters,
-      bool discard_state_labels = false
+      bool discard_state_labels = false,
+      std::size_t number_of_threads = 1
     )
-     : m_discard_state_labels(discard_state_labels)
+     : m_discard_state_labels(discard_state_labels),
+       m_number_of_threads(number_of_threads)
     {
       m_lts.set_data(dataspec);
       m_lts.set_process_parameters(process_parameters);
@@ -183,32 +297,43 @@ class lts_lts_builder: public lts_builder
       if (atermpp::detail::GlobalThreadSafe && number_of_threads>1) m_exclusive_transition_access.unlock();
     }
 
-    // Add actions and states to the LTS
-    void finalize(const indexed_set_for_states_type& state_map, bool timed) override
+    void add_action_labels()
     {
-      // add actions
       m_lts.set_num_action_labels(m_actions.size());
       for (const auto& p: m_actions)
       {
         m_lts.set_action_label(p.second, action_label_lts(lps::multi_action(p.first.actions(), p.first.time())));
       }
+    }
+
+    // Add actions and states to the LTS
+    void finalize(const indexed_set_for_states_type& state_map, bool timed) override
+    {
+      add_action_labels();
 
       // add state labels
       if (!m_discard_state_labels)
       {
         std::size_t n = state_map.size();
         std::vector<state_label_lts> state_labels(n);
-        for (std::size_t i = 0; i < n; i++)
-        {
-          if (timed)
-          {
-            state_labels[i] = state_label_lts(remove_time_stamp(state_map[i]));
-          }
-          else
-          {
-            state_labels[i] = state_label_lts(state_map[i]);
-          }
-        }
+        make_state_labels(state_map, timed, 0, n, state_labels, m_number_of_threads);
+        m_lts.state_labels() = std::move(state_labels);
+      }
+
+      m_lts.set_num_states(state_map.size(), true);
+      m_lts.set_initial_state(0);
+    }
+
+    void finalize(const lps::external_state_map& state_map, bool timed) override
+    {
+      add_action_labels();
+
+      // add state labels
+      if (!m_discard_state_labels)
+      {
+        std::vector<state_label_lts> state_labels;
+        state_labels.reserve(state_map.size());
+        state_map.for_each_state([&](const lps::state& s) { state_labels.push_back(make_state_label(s, timed)); });
         m_lts.state_labels() = std::move(state_labels);
       }
 
@@ -228,17 +353,23 @@ class lts_lts_disk_builder: public lts_builder
     std::fstream fstream;
     std::unique_ptr<atermpp::binary_aterm_ostream> stream;
     bool m_discard_state_labels = false;
+    std::size_t m_number_of_threads = 1;
     std::mutex m_exclusive_transition_access;
 
+    // The number of state labels that is kept in memory while the state labels are written.
+    static constexpr std::size_t m_chunk_size = 1 << 16;
+
   public:
     lts_lts_disk_builder(
       const std::string& filename,
       const data::data_specification& dataspec,
       const process::action_label_list& action_labels,
       const data::variable_list& process_parameters,
-      bool discard_state_labels = false
+      bool discard_state_labels = false,
+      std::size_t number_of_threads = 1
     )
-     : m_discard_state_labels(discard_state_labels)
+     : m_discard_state_labels(discard_state_labels),
+       m_number_of_threads(number_of_threads)
     {
       fstream.open(filename, std::ofstream::out | std::ofstream::binary);
       if (fstream.fail())
@@ -264,18 +395,20 @@ class lts_lts_disk_builder: public lts_builder
     {
       if (!m_discard_state_labels)
       {
-        // Write the state labels in the order of their indices.
-        for (std::size_t i = 0; i < state_map.size(); i++)
+        // Write the state labels in the order of their indices. The labels are computed in parallel
+        // per chunk, and only the labels of the current chunk are kept in memory.
+        const std::size_t n = state_map.size();
+        std::vector<state_label_lts> state_labels;
+        for (std::size_t first = 0; first < n; first += m_chunk_size)
         {
-          if (is_aterm_balanced_tree(state_map[i]))  // in a parallel context not all positions may be filled.
+          const std::size_t last = std::min(first + m_chunk_size, n);
+          state_labels.assign(last - first, state_label_lts());
+          make_state_labels(state_map, timed, first, last, state_labels, m_number_of_threads);
+          for (std::size_t i = first; i < last; i++)
           {
-            if (timed)
-            {
-              write_state_label(*stream, state_label_lts(remove_time_stamp(state_map[i])));
-            }
-            else
+            if (is_aterm_balanced_tree(state_map[i]))  // in a parallel context not all positions may be filled.
             {
-              write_state_label(*stream, state_label_lts(state_map[i]));
+              write_state_label(*stream, state_labels[i - first]);
             }
           }
         }
@@ -285,6 +418,15 @@ class lts_lts_disk_builder: public lts_builder
       write_initial_state(*stream, 0);
     }
 
+    void finalize(const lps::external_state_map& state_map, bool timed) override
+    {
+      if (!m_discard_state_labels)
+      {
+        state_map.for_each_state([&](const lps::state& s) { write_state_label(*stream, make_state_label(s, timed)); });
+      }
+      write_initial_state(*stream, 0);
+    }
+
     void save(const std::string&) override {}
 };
 
@@ -292,8 +434,8 @@ class lts_dot_builder: public lts_lts_builder
 {
   public:
     typedef lts_lts_builder super;
-    lts_dot_builder(const data::data_specification& dataspec, const process::action_label_list& action_labels, const data::variable_list& process_parameters)
-      : super(dataspec, action_labels, process_parameters)
+    lts_dot_builder(const data::data_specification& dataspec, const process::action_label_list& action_labels, const data::variable_list& process_parameters, std::size_t number_of_threads = 1)
+      : super(dataspec, action_labels, process_parameters, false, number_of_threads)
     { }
 
     void save(const std::string& filename) override
@@ -308,8 +450,8 @@ class lts_fsm_builder: public lts_lts_builder
 {
   public:
     typedef lts_lts_builder super;
-    lts_fsm_builder(const data::data_specification& dataspec, const process::action_label_list& action_labels, const data::variable_list& process_parameters)
-      : super(dataspec, action_labels, process_parameters)
+    lts_fsm_builder(const data::data_specification& dataspec, const process::action_label_list& action_labels, const data::variable_list& process_parameters, std::size_t number_of_threads = 1)
+      : super(dataspec, action_labels, process_parameters, false, number_of_threads)
     { }
 
     void save(const std::string& filename) override
@@ -336,17 +478,17 @@ std::unique_ptr<lts_builder> create_lts_builder(const lps::specification& lpsspe
         return std::make_unique<lts_aut_disk_builder>(output_filename);
       }
     }
-    case lts_dot: return std::make_unique<lts_dot_builder>(lpsspec.data(), lpsspec.action_labels(), lpsspec.process().process_parameters());
-    case lts_fsm: return std::make_unique<lts_fsm_builder>(lpsspec.data(), lpsspec.action_labels(), lpsspec.process().process_parameters());
+    case lts_dot: return std::make_unique<lts_dot_builder>(lpsspec.data(), lpsspec.action_labels(), lpsspec.process().process_parameters(), options.number_of_threads);
+    case lts_fsm: return std::make_unique<lts_fsm_builder>(lpsspec.data(), lpsspec.action_labels(), lpsspec.process().process_parameters(), options.number_of_threads);
     case lts_lts:
     {
       if (options.save_at_end)
       {
-        return std::make_unique<lts_lts_builder>(lpsspec.data(), lpsspec.action_labels(), lpsspec.process().process_parameters(), options.discard_lts_state_labels);
+        return std::make_unique<lts_lts_builder>(lpsspec.data(), lpsspec.action_labels(), lpsspec.process().process_parameters(), options.discard_lts_state_labels, options.number_of_threads);
       }
       else
       {
-        return std::make_unique<lts_lts_disk_builder>(output_filename, lpsspec.data(), lpsspec.action_labels(), lpsspec.process().process_parameters(), options.discard_lts_state_labels);
+        return std::make_unique<lts_lts_disk_builder>(output_filename, lpsspec.data(), lpsspec.action_labels(), lpsspec.process().process_parameters(), options.discard_lts_state_labels, options.number_of_threads);
       }
     }
     default: return std::make_unique<lts_none_builder>();
@@ -556,7 +556,7 @@ class progress_monitor
 
     void finish_state(std::size_t state_count, std::size_t todo_list_size)
     {
-      if (search_strategy == lps::es_breadth)
+      if (search_strategy == lps::es_breadth || search_strategy == lps::es_external_breadth)
       {
         if (++count == level_up)
         {
@@ -593,7 +593,7 @@ class progress_monitor
 
     void finish_exploration(std::size_t state_count)
     {
-      if (search_strategy == lps::es_breadth)
+      if (search_strategy == lps::es_breadth || search_strategy == lps::es_external_breadth)
       {
         mCRL2log(log::verbose) << "done with state space generation ("
                                << level-1 << " level" << ((level==2)?"":"s") << ", "
@@ -644,7 +644,7 @@ struct state_space_generator
 
   bool max_states_exceeded(const std::size_t thread_index)
   {
-    return explorer.state_map().size(thread_index) >= options.max_states;
+    return explorer.number_of_states(thread_index) >= options.max_states;
   }
 
   // Explore the specification passed via the constructor, and put the results in builder.
@@ -738,12 +738,12 @@ struct state_space_generator
           }
           if (!options.suppress_progress_messages)
           {
-            m_progress_monitor.finish_state(explorer.state_map().size(), todo_list_size);
+            m_progress_monitor.finish_state(explorer.number_of_states(), todo_list_size);
           }
         },
 
         // discover_initial_state
-        [&](const lps::stochastic_state& s, const std::list<std::size_t>& s_index)
+        [&](const lps::stochastic_state& s, const std::vector<std::size_t>& s_index)
         {
           if constexpr (Stochastic)
           {
@@ -751,7 +751,15 @@ struct state_space_generator
           }
         }
       );
-      m_progress_monitor.finish_exploration(explorer.state_map().size());
+      m_progress_monitor.finish_exploration(explorer.number_of_states());
+      if constexpr (!Stochastic)
+      {
+        if (options.search_strategy == lps::es_external_breadth)
+        {
+          builder.finalize(explorer.external_states(), Timed);
+          return;
+        }
+      }
       builder.finalize(explorer.state_map(), Timed);
     }
     catch (const data::enumerator_error& e)
@@ -13,6 +13,8 @@
 #define MCRL2_LTS_STOCHASTIC_LTS_BUILDER_H
 
 #include "mcrl2/lts/lts_builder.h"
+#include "mcrl2/utilities/hash_utility.h"
+#include "mcrl2/utilities/indexed_set.h"
 
 namespace mcrl2 {
 
@@ -42,10 +44,10 @@ struct stochastic_lts_builder
   }
 
   // Set the initial (stochastic) state of the LTS
-  virtual void set_initial_state(const std::list<std::size_t>& targets, const std::vector<data::data_expression>& probabilities) = 0;
+  virtual void set_initial_state(const std::vector<std::size_t>& targets, const std::vector<data::data_expression>& probabilities) = 0;
 
   // Add a transition to the LTS
-  virtual void add_transition(std::size_t from, const lps::multi_action& a, const std::list<std::size_t>& targets, const std::vector<data::data_expression>& probabilities, const std::size_t number_of_threads = 1) = 0;
+  virtual void add_transition(std::size_t from, const lps::multi_action& a, const std::vector<std::size_t>& targets, const std::vector<data::data_expression>& probabilities, const std::size_t number_of_threads = 1) = 0;
 
   // Add actions and states to the LTS
   virtual void finalize(const indexed_set_for_states_type& state_map, bool timed) = 0;
@@ -59,10 +61,10 @@ struct stochastic_lts_builder
 class stochastic_lts_none_builder: public stochastic_lts_builder
 {
   public:
-    void set_initial_state(const std::list<std::size_t>& /* to */, const std::vector<data::data_expression>& /* probabilities */) override
+    void set_initial_state(const std::vector<std::size_t>& /* to */, const std::vector<data::data_expression>& /* probabilities */) override
     {}
 
-    void add_transition(std::size_t /* from */, const lps::multi_action& /* a */, const std::list<std::size_t>& /* targets */, const std::vector<data::data_expression>& /* probabilities */, const std::size_t /* number_of_threads */) override
+    void add_transition(std::size_t /* from */, const lps::multi_action& /* a */, const std::vector<std::size_t>& /* targets */, const std::vector<data::data_expression>& /* probabilities */, const std::size_t /* number_of_threads */) override
     {}
 
     void finalize(const indexed_set_for_states_type& /* state_map */, bool /* timed */) override
@@ -77,15 +79,20 @@ class stochastic_lts_aut_builder: public stochastic_lts_builder
   protected:
     struct stochastic_state
     {
-      std::list<std::size_t> targets;
+      std::vector<std::size_t> targets;
       std::vector<data::data_expression> probabilities;
 
       stochastic_state() = default;
 
-      stochastic_state(std::list<std::size_t>  targets_, std::vector<data::data_expression>  probabilities_)
+      stochastic_state(std::vector<std::size_t>  targets_, std::vector<data::data_expression>  probabilities_)
         : targets(std::move(targets_)), probabilities(std::move(probabilities_))
       {}
 
+      bool operator==(const stochastic_state& other) const
+      {
+        return targets == other.targets && probabilities == other.probabilities;
+      }
+
       void save_to_aut(std::ostream& out) const
       {
         auto j = targets.begin();
@@ -116,7 +123,17 @@ class stochastic_lts_aut_builder: public stochastic_lts_builder
       }
     };
 
-    std::vector<stochastic_state> m_stochastic_states;
+    struct stochastic_state_hash
+    {
+      std::size_t operator()(const stochastic_state& s) const
+      {
+        return utilities::detail::hash_combine(std::hash<std::vector<std::size_t> >()(s.targets),
+                                               std::hash<std::vector<data::data_expression> >()(s.probabilities));
+      }
+    };
+
+    // Equal stochastic states are stored only once. The initial state has index 0.
+    utilities::indexed_set<stochastic_state, false, stochastic_state_hash> m_stochastic_states;
     std::vector<transition> m_transitions;
     std::size_t m_number_of_states = 0;
     std::mutex m_exclusive_transition_access;
@@ -125,18 +142,17 @@ class stochastic_lts_aut_builder: public stochastic_lts_builder
     stochastic_lts_aut_builder() = default;
 
     // Set the initial (stochastic) state of the LTS
-    void set_initial_state(const std::list<std::size_t>& targets, const std::vector<data::data_expression>& probabilities) override
+    void set_initial_state(const std::vector<std::size_t>& targets, const std::vector<data::data_expression>& probabilities) override
     {
-      m_stochastic_states.emplace_back(targets, probabilities);
+      m_stochastic_states.insert(stochastic_state(targets, probabilities));
     }
 
     // Add a transition to the LTS
-    void add_transition(std::size_t from, const lps::multi_action& a, const std::list<std::size_t>& targets, const std::vector<data::data_expression>& probabilities, const std::size_t number_of_threads) override
+    void add_transition(std::size_t from, const lps::multi_action& a, const std::vector<std::size_t>& targets, const std::vector<data::data_expression>& probabilities, const std::size_t number_of_threads) override
     {
       if (atermpp::detail::GlobalThreadSafe && number_of_threads>1) m_exclusive_transition_access.lock();
-      std::size_t to = m_stochastic_states.size();
+      std::size_t to = m_stochastic_states.insert(stochastic_state(targets, probabilities)).first;
       std::size_t label = add_action(a);
-      m_stochastic_states.emplace_back(targets, probabilities);
       m_transitions.emplace_back(from, label, to);
       if (atermpp::detail::GlobalThreadSafe && number_of_threads>1) m_exclusive_transition_access.unlock();
     }
@@ -192,24 +208,30 @@ class stochastic_lts_lts_builder: public stochastic_lts_builder
   protected:
     probabilistic_lts_lts_t m_lts;
     bool m_discard_state_labels = false;
+    std::size_t m_number_of_threads = 1;
     probabilistic_state<std::size_t, lps::probabilistic_data_expression> m_initial_state;
     std::mutex m_exclusive_transition_access;
 
+    // Maps the probabilistic states of the LTS to their index, such that equal probabilistic states are stored only once.
+    utilities::indexed_set<probabilistic_state<std::size_t, lps::probabilistic_data_expression> > m_probabilistic_states;
+
   public:
     stochastic_lts_lts_builder(
       const data::data_specification& dataspec,
       const process::action_label_list& action_labels,
       const data::variable_list& process_parameters,
-      bool discard_state_labels = false
+      bool discard_state_labels = false,
+      std::size_t number_of_threads = 1
     )
-      : m_discard_state_labels(discard_state_labels)
+      : m_discard_state_labels(discard_state_labels),
+        m_number_of_threads(number_of_threads)
     {
       m_lts.set_data(dataspec);
       m_lts.set_process_parameters(process_parameters);
       m_lts.set_action_label_declarations(action_labels);
     }
 
-    static probabilistic_state<std::size_t, lps::probabilistic_data_expression> make_probabilistic_state(const std::list<std::size_t>& targets, const std::vector<data::data_expression>& probabilities)
+    static probabilistic_state<std::size_t, lps::probabilistic_data_expression> make_probabilistic_state(const std::vector<std::size_t>& targets, const std::vector<data::data_expression>& probabilities)
     {
       probabilistic_state<std::size_t, lps::probabilistic_data_expression> result;
       auto ti = targets.begin();
@@ -222,18 +244,24 @@ class stochastic_lts_lts_builder: public stochastic_lts_builder
     }
 
     // Set the initial (stochastic) state of the LTS
-    void set_initial_state(const std::list<std::size_t>& targets, const std::vector<data::data_expression>& probabilities) override
+    void set_initial_state(const std::vector<std::size_t>& targets, const std::vector<data::data_expression>& probabilities) override
     {
       m_initial_state = make_probabilistic_state(targets, probabilities);
     }
 
     // Add a transition to the LTS
-    void add_transition(std::size_t from, const lps::multi_action& a, const std::list<std::size_t>& targets, const std::vector<data::data_expression>& probabilities, const std::size_t number_of_threads) override
+    void add_transition(std::size_t from, const lps::multi_action& a, const std::vector<std::size_t>& targets, const std::vector<data::data_expression>& probabilities, const std::size_t number_of_threads) override
     {
       if (atermpp::detail::GlobalThreadSafe && number_of_threads>1) m_exclusive_transition_access.lock();
       auto s1 = make_probabilistic_state(targets, probabilities);
       std::size_t label = add_action(a);
-      std::size_t to = m_lts.add_probabilistic_state(s1);
+      const auto [to, inserted] = m_probabilistic_states.insert(s1);
+      if (inserted)
+      {
+        std::size_t actual_index = m_lts.add_probabilistic_state(s1);
+        utilities::mcrl2_unused(actual_index);
+        assert(actual_index == to);
+      }
       m_lts.add_transition(transition(from, label, to));
       if (atermpp::detail::GlobalThreadSafe && number_of_threads>1) m_exclusive_transition_access.unlock();
 
@@ -254,17 +282,7 @@ class stochastic_lts_lts_builder: public stochastic_lts_builder
       {
         std::size_t n = state_map.size();
         std::vector<state_label_lts> state_labels(n);
-        for (std::size_t i = 0; i < n; i++)
-        {
-          if (timed)
-          {
-            state_labels[i] = state_label_lts(remove_time_stamp(state_map[i]));
-          }
-          else
-          {
-            state_labels[i] = state_label_lts(state_map[i]);
-          }
-        }
+        make_state_labels(state_map, timed, 0, n, state_labels, m_number_of_threads);
         m_lts.state_labels() = std::move(state_labels);
       }
 
@@ -283,8 +301,8 @@ class stochastic_lts_fsm_builder: public stochastic_lts_lts_builder
 {
   public:
     typedef stochastic_lts_lts_builder super;
-    stochastic_lts_fsm_builder(const data::data_specification& dataspec, const process::action_label_list& action_labels, const data::variable_list& process_parameters)
-      : super(dataspec, action_labels, process_parameters)
+    stochastic_lts_fsm_builder(const data::data_specification& dataspec, const process::action_label_list& action_labels, const data::variable_list& process_parameters, std::size_t number_of_threads = 1)
+      : super(dataspec, action_labels, process_parameters, false, number_of_threads)
     { }
 
     void save(const std::string& filename) override
@@ -301,8 +319,8 @@ std::unique_ptr<stochastic_lts_builder> create_stochastic_lts_builder(const lps:
   switch (output_format)
   {
     case lts_aut: return std::make_unique<stochastic_lts_aut_builder>();
-    case lts_lts: return std::make_unique<stochastic_lts_lts_builder>(lpsspec.data(), lpsspec.action_labels(), lpsspec.process().process_parameters(), options.discard_lts_state_labels);
-    case lts_fsm: return std::make_unique<stochastic_lts_fsm_builder>(lpsspec.data(), lpsspec.action_labels(), lpsspec.process().process_parameters());
+    case lts_lts: return std::make_unique<stochastic_lts_lts_builder>(lpsspec.data(), lpsspec.action_labels(), lpsspec.process().process_parameters(), options.discard_lts_state_labels, options.number_of_threads);
+    case lts_fsm: return std::make_unique<stochastic_lts_fsm_builder>(lpsspec.data(), lpsspec.action_labels(), lpsspec.process().process_parameters(), options.number_of_threads);
     default: return std::make_unique<stochastic_lts_none_builder>();
   }
 }
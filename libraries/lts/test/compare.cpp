@@ -453,3 +453,29 @@ BOOST_AUTO_TEST_CASE(coupled_similarity_test)
   BOOST_CHECK(compare(philosophers_gradual, philosophers_merged, lts_eq_coupled_sim)); // These transition systems must be equal.
   BOOST_CHECK(!compare(philosophers_gradual, philosophers_merged, lts_eq_bisim)); // These transition systems must be different.
 }
+
+// The parallel breadth-first antichain algorithms must give the same results as the sequential ones.
+BOOST_AUTO_TEST_CASE(parallel_refinement_test)
+{
+  const std::vector<std::string> ltss = { l1, l2, l2a, l3, l4, a, b, abc_div, lts_impl, lts_spec, aPtauP, bP };
+  const std::vector<lts_preorder> preorders = { lts_pre_trace_anti_chain,
+                                                lts_pre_weak_trace_anti_chain,
+                                                lts_pre_failures_refinement,
+                                                lts_pre_weak_failures_refinement,
+                                                lts_pre_failures_divergence_refinement };
+  for (const std::string& s1: ltss)
+  {
+    for (const std::string& s2: ltss)
+    {
+      for (const lts_preorder pre: preorders)
+      {
+        lts_aut_t t1=parse_aut(s1);
+        lts_aut_t t2=parse_aut(s2);
+        const bool sequential = compare(t1, t2, pre, false, "", false, mcrl2::lps::es_breadth, true, 1);
+        BOOST_CHECK_EQUAL(sequential, compare(t1, t2, pre, false, "", false, mcrl2::lps::es_breadth, true, 3));
+        BOOST_CHECK_EQUAL(sequential, compare(t1, t2, pre, false, "", false, mcrl2::lps::es_breadth, false, 3));
+        BOOST_CHECK_EQUAL(sequential, compare(t1, t2, pre, false, "", false, mcrl2::lps::es_depth, true, 1));
+      }
+    }
+  }
+}
@@ -73,7 +73,8 @@ void run_generatelts(
   lps::exploration_strategy estrategy,
   lts::lts_type output_format,
   const std::string& outputfile,
-  const std::string& priority_action
+  const std::string& priority_action,
+  bool successor_cache = false
 )
 {
   lps::explorer_options options;
@@ -82,6 +83,7 @@ void run_generatelts(
   options.rewrite_strategy = rstrategy;
   options.search_strategy = estrategy;
   options.save_at_end = true;
+  options.successor_cache = successor_cache;
 
   bool is_timed = stochastic_lpsspec.process().has_time();
 
@@ -128,13 +130,18 @@ void check_lts(
   std::cerr << format << " FORMAT\n";
   LTSType result1;
   LTSType result2;
+  LTSType result3;
   lts::lts_type output_format = result1.type();
   std::string outputfile1 = static_cast<std::string>(boost::unit_test::framework::current_test_case().p_name) + ".lps2lts" + file_extension(output_format);
   std::string outputfile2 = static_cast<std::string>(boost::unit_test::framework::current_test_case().p_name) + ".generatelts" + file_extension(output_format);
-  run_lps2lts(stochastic_lpsspec, rstrategy, estrategy, output_format, outputfile1, priority_action);
+  std::string outputfile3 = static_cast<std::string>(boost::unit_test::framework::current_test_case().p_name) + ".generatelts_cached" + file_extension(output_format);
+  // The cluster and external strategies are only supported by the explorer.
+  run_lps2lts(stochastic_lpsspec, rstrategy, estrategy == lps::es_cluster || estrategy == lps::es_external_breadth ? lps::es_breadth : estrategy, output_format, outputfile1, priority_action);
   run_generatelts(stochastic_lpsspec, rstrategy, estrategy, output_format, outputfile2, priority_action);
+  run_generatelts(stochastic_lpsspec, rstrategy, estrategy, output_format, outputfile3, priority_action, true);
   result1.load(outputfile1);
   result2.load(outputfile2);
+  result3.load(outputfile3);
 
   BOOST_CHECK_EQUAL(result1.num_states(), expected_states);
   BOOST_CHECK_EQUAL(result1.num_transitions(), expected_transitions);
@@ -142,9 +149,13 @@ void check_lts(
   BOOST_CHECK_EQUAL(result2.num_states(), expected_states);
   BOOST_CHECK_EQUAL(result2.num_transitions(), expected_transitions);
   BOOST_CHECK_EQUAL(result2.num_action_labels(), expected_labels);
+  BOOST_CHECK_EQUAL(result3.num_states(), expected_states);
+  BOOST_CHECK_EQUAL(result3.num_transitions(), expected_transitions);
+  BOOST_CHECK_EQUAL(result3.num_action_labels(), expected_labels);
 
   std::remove(outputfile1.c_str());
   std::remove(outputfile2.c_str());
+  std::remove(outputfile3.c_str());
 }
 
 static void check_lps2lts_specification(const std::string& specification,
@@ -160,10 +171,14 @@ static void check_lps2lts_specification(const std::string& specification,
 
   for (data::rewrite_strategy rstrategy: data::detail::get_test_rewrite_strategies(false))
   {
-    for (lps::exploration_strategy estrategy: { lps::es_breadth, lps::es_depth })
+    for (lps::exploration_strategy estrategy: { lps::es_breadth, lps::es_depth, lps::es_cluster, lps::es_external_breadth })
     {
       if (contains_probabilities)
       {
+        if (estrategy == lps::es_external_breadth)
+        {
+          continue;
+        }
         check_lts<lts::probabilistic_lts_aut_t>("PROBABILISTIC AUT", lpsspec, rstrategy, estrategy, expected_states, expected_transitions, expected_labels, priority_action);
         check_lts<lts::probabilistic_lts_lts_t>("PROBABILISTIC LTS", lpsspec, rstrategy, estrategy, expected_states, expected_transitions, expected_labels, priority_action);
         check_lts<lts::probabilistic_lts_fsm_t>("PROBABILISTIC FSM", lpsspec, rstrategy, estrategy, expected_states, expected_transitions, expected_labels, priority_action);
@@ -469,6 +484,97 @@ BOOST_AUTO_TEST_CASE(test_max_states)
   BOOST_CHECK_LT(result.num_states(), 10u);
 }
 
+// The state labels are computed in parallel blocks, so the number of states exceeds the block size.
+BOOST_AUTO_TEST_CASE(test_parallel_state_labels)
+{
+  std::string spec(
+  "act a;\n"
+  "proc P(s: Pos) =\n"
+  "  (s <= 10000) -> a . P(s+1);\n"
+  "init P(1);\n");
+
+  lps::specification lpsspec;
+  parse_lps(spec, lpsspec);
+
+  lps::explorer_options options;
+  options.trace_prefix = "lps2lts_test";
+  options.search_strategy = lps::es_breadth;
+  options.save_at_end = true;
+
+  std::vector<lts::lts_lts_t> results;
+  for (std::size_t number_of_threads: { 1, 3 })
+  {
+    std::string filename1 = utilities::temporary_filename("lps2lts_test_file");
+    lts::lts_lts_builder builder1(lpsspec.data(), lpsspec.action_labels(), lpsspec.process().process_parameters(), false, number_of_threads);
+    generate_state_space<false, false>(lpsspec, builder1, filename1, options);
+
+    std::string filename2 = utilities::temporary_filename("lps2lts_test_file");
+    {
+      lts::lts_lts_disk_builder builder2(filename2, lpsspec.data(), lpsspec.action_labels(), lpsspec.process().process_parameters(), false, number_of_threads);
+      generate_state_space<false, false>(lpsspec, builder2, filename2, options);
+    }
+
+    for (const std::string& filename: { filename1, filename2 })
+    {
+      results.emplace_back();
+      results.back().load(filename);
+      std::remove(filename.c_str());
+    }
+  }
+
+  for (const lts::lts_lts_t& result: results)
+  {
+    BOOST_CHECK_EQUAL(result.num_states(), 10001u);
+    BOOST_CHECK(result.state_labels() == results.front().state_labels());
+  }
+}
+
+// The two summands are independent, so a stubborn set contains one of them, unless its action is visible.
+BOOST_AUTO_TEST_CASE(test_partial_order_reduction)
+{
+  std::string spec(
+  "act a, b;\n"
+  "proc P(x, y: Nat) =\n"
+  "  (x < 10) -> a . P(x = x + 1) +\n"
+  "  (y < 10) -> b . P(y = y + 1);\n"
+  "init P(0, 0);\n");
+
+  lps::specification lpsspec;
+  parse_lps(spec, lpsspec);
+
+  auto generate = [&](const std::set<core::identifier_string>& visible_actions, std::size_t number_of_threads)
+  {
+    lps::explorer_options options;
+    options.trace_prefix = "lps2lts_test";
+    options.search_strategy = lps::es_breadth;
+    options.save_at_end = true;
+    options.partial_order_reduction = true;
+    options.visible_actions = visible_actions;
+    options.number_of_threads = number_of_threads;
+    std::string filename = utilities::temporary_filename("lps2lts_test_file");
+    lts::lts_lts_builder builder(lpsspec.data(), lpsspec.action_labels(), lpsspec.process().process_parameters(), false, number_of_threads);
+    generate_state_space<false, false>(lpsspec, builder, filename, options);
+    lts::lts_lts_t result;
+    result.load(filename);
+    std::remove(filename.c_str());
+    return result;
+  };
+
+  for (std::size_t number_of_threads: { 1, 3 })
+  {
+    lts::lts_lts_t result = generate({}, number_of_threads);
+    BOOST_CHECK_EQUAL(result.num_states(), 21u);
+    BOOST_CHECK_EQUAL(result.num_transitions(), 20u);
+
+    result = generate({ core::identifier_string("b") }, number_of_threads);
+    BOOST_CHECK_EQUAL(result.num_states(), 21u);
+
+    result = generate({ core::identifier_string("a"), core::identifier_string("b") }, number_of_threads);
+    BOOST_CHECK_EQUAL(result.num_states(), 121u);
+    BOOST_CHECK_EQUAL(result.num_transitions(), 220u);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(test_interaction_sum_and_assignment_notation1)
 {
   std::string spec(
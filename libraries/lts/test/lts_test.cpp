@@ -936,3 +936,114 @@ BOOST_AUTO_TEST_CASE(hide_actions4)
   test_lts("regression test for GJKW bug (branching bisimulation [Jansen/Groote/Keiren/Wijs 2019])",l,expected_label_count, expected_state_count, expected_transition_count);
 }
 
+
+// A long sequence of internal steps, in which each state can also do one of five visible actions.
+static std::string long_tau_chain(const std::size_t length)
+{
+  std::ostringstream out;
+  out << "des (0," << 2 * length + 1 << "," << length + 2 << ")\n";
+  for (std::size_t i = 0; i < length; ++i)
+  {
+    out << "(" << i << ",\"tau\"," << i + 1 << ")\n";
+    out << "(" << i << ",\"a" << i % 5 << "\"," << length + 1 << ")\n";
+  }
+  out << "(" << length << ",\"done\"," << length + 1 << ")\n";
+  return out.str();
+}
+
+BOOST_AUTO_TEST_CASE(weak_bisimulation_long_tau_chain)
+{
+  std::istringstream is(long_tau_chain(5000));
+  lts::lts_aut_t l_chain;
+  l_chain.load(is);
+
+  lts::lts_aut_t l = l_chain;
+  lts::detail::weak_bisimulation_reduce(l, false, 1);
+  lts::lts_aut_t l_parallel = l_chain;
+  lts::detail::weak_bisimulation_reduce(l_parallel, false, 4);
+  test_lts("long tau chain (weak bisimulation)", l, 7, 7, 14);
+  test_lts("long tau chain (weak bisimulation, 4 threads)", l_parallel, 7, 7, 14);
+  BOOST_CHECK(lts::detail::weak_bisimulation_compare(l, l_chain));
+
+  l = l_chain;
+  lts::detail::tau_star_reduce(l);
+  test_lts("long tau chain (tau star reduction)", l, 7, 2, 6);
+}
+
+// a.(tau.b+c) and a.(tau.b+c)+a.b are weakly bisimilar, but not if the trailing internal step is ignored.
+BOOST_AUTO_TEST_CASE(weak_bisimulation_trailing_tau)
+{
+  std::string automaton1 =
+     "des (0,4,4)\n"
+     "(0,\"a\",1)\n"
+     "(1,\"tau\",2)\n"
+     "(1,\"c\",3)\n"
+     "(2,\"b\",3)\n";
+  std::string automaton2 =
+     "des (0,5,4)\n"
+     "(0,\"a\",1)\n"
+     "(0,\"a\",2)\n"
+     "(1,\"tau\",2)\n"
+     "(1,\"c\",3)\n"
+     "(2,\"b\",3)\n";
+
+  std::istringstream is1(automaton1);
+  lts::lts_aut_t l1;
+  l1.load(is1);
+  std::istringstream is2(automaton2);
+  lts::lts_aut_t l2;
+  l2.load(is2);
+  BOOST_CHECK(compare(l1, l2, lts::lts_eq_weak_bisim));
+  BOOST_CHECK(compare(l1, l2, lts::lts_eq_divergence_preserving_weak_bisim));
+
+  reduce(l2, lts::lts_eq_weak_bisim);
+  test_lts("trailing internal step (weak bisimulation)", l2, 4, 4, 4);
+}
+
+// Internal loops are contracted before the visible actions are collected.
+BOOST_AUTO_TEST_CASE(tau_star_reduce_with_tau_loop)
+{
+  std::string automaton =
+     "des (0,5,4)\n"
+     "(0,\"tau\",1)\n"
+     "(1,\"tau\",0)\n"
+     "(1,\"tau\",2)\n"
+     "(0,\"a\",3)\n"
+     "(2,\"b\",3)\n";
+
+  std::istringstream is(automaton);
+  lts::lts_aut_t l;
+  l.load(is);
+  lts::detail::tau_star_reduce(l);
+  test_lts("tau star reduction with an internal loop", l, 3, 2, 2);
+}
+
+// The automaton for (a|b)*a(a|b)^length, of which the deterministic automaton has 2^(length+1) states.
+static std::string nondeterministic_suffix_automaton(const std::size_t length)
+{
+  std::ostringstream out;
+  out << "des (0," << 2 * length + 3 << "," << length + 2 << ")\n";
+  out << "(0,\"a\",0)\n(0,\"b\",0)\n(0,\"a\",1)\n";
+  for (std::size_t i = 1; i <= length; ++i)
+  {
+    out << "(" << i << ",\"a\"," << i + 1 << ")\n";
+    out << "(" << i << ",\"b\"," << i + 1 << ")\n";
+  }
+  return out.str();
+}
+
+BOOST_AUTO_TEST_CASE(determinise_with_threads)
+{
+  std::istringstream is(nondeterministic_suffix_automaton(6));
+  lts::lts_aut_t l_nfa;
+  l_nfa.load(is);
+
+  lts::lts_aut_t l = l_nfa;
+  lts::determinise(l, 1);
+  lts::lts_aut_t l_parallel = l_nfa;
+  lts::determinise(l_parallel, 3);
+  test_lts("subset construction", l, 3, 128, 256);
+  test_lts("subset construction (3 threads)", l_parallel, 3, 128, 256);
+  BOOST_CHECK(l.get_transitions() == l_parallel.get_transitions());
+  BOOST_CHECK(compare(l, l_nfa, lts::lts_eq_trace));
+}
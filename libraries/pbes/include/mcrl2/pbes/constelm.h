@@ -873,13 +873,17 @@ class pbes_constelm_algorithm
         }
       }
 
-      // initialize the todo list of vertices that need to be processed
+      // initialize the todo list of vertices that need to be processed. A vertex is
+      // added to the todo list only if it is not already in it, such that the vertices are
+      // processed in the order in which they were first added.
       propositional_variable_instantiation init = p.initial_state();
       std::deque<propositional_variable> todo;
+      std::set<core::identifier_string> in_todo;
       const data::data_expression_list& e_init = init.parameters();
       vertex& u_init = m_vertices[init.name()];
       u_init.update(qvar_list(), e_init, constraint_map(), m_data_rewriter);
       todo.push_back(u_init.variable());
+      in_todo.insert(u_init.variable().name());
 
       mCRL2log(log::debug) << "\n--- initial vertices ---\n" << print_vertices();
       mCRL2log(log::debug) << "\n--- edges ---\n" << print_edges();
@@ -889,20 +893,22 @@ class pbes_constelm_algorithm
       {
         mCRL2log(log::debug) << print_todo_list(todo);
         propositional_variable var = todo.front();
-
-        // remove all occurrences of var from todo
-        todo.erase(std::remove(todo.begin(), todo.end(), var), todo.end());
+        todo.pop_front();
+        in_todo.erase(var.name());
 
         const vertex& u = m_vertices[var.name()];
         const std::vector<edge>& u_edges = m_edges[var.name()];
 
+        // The substitution corresponding to the constraints of u. It only needs to be
+        // recomputed if u itself is the target of an edge that changes it.
+        data::rewriter::substitution_type sigma;
+        detail::make_constelm_substitution(u.constraints(), sigma);
+
         for (const edge& e: u_edges)
         {
           vertex& v = m_vertices[e.target().name()];
           mCRL2log(log::debug) << print_edge_update(e, u, v);
 
-          data::rewriter::substitution_type sigma;
-          detail::make_constelm_substitution(u.constraints(), sigma);
           pbes_expression needs_update = m_pbes_rewriter(e.condition(), sigma);
           mCRL2log(log::debug) << print_condition(e, u, needs_update);
 
@@ -919,7 +925,15 @@ class pbes_constelm_algorithm
                               m_data_rewriter);
             if (changed)
             {
-              todo.push_back(v.variable());
+              if (in_todo.insert(v.variable().name()).second)
+              {
+                todo.push_back(v.variable());
+              }
+              if (&v == &u)
+              {
+                sigma.clear();
+                detail::make_constelm_substitution(u.constraints(), sigma);
+              }
             }
           }
           mCRL2log(log::debug) << "  <target vertex after > " << v.to_string() << "\n";
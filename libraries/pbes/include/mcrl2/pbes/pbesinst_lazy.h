@@ -9,6 +9,7 @@
 /// \file mcrl2/pbes/pbesinst_lazy_algorithm.h
 /// \brief A lazy algorithm for instantiating a PBES, ported from bes_deprecated.h.
 
+#include <condition_variable>
 #include <thread>
 #include <mutex>
 #include <shared_mutex>
@@ -216,6 +217,12 @@ class pbesinst_lazy_algorithm
     std::mutex m_todo_access;
     std::shared_mutex m_graph_access;
 
+    // Signals idle threads that elements have been added to the todo list
+    std::condition_variable m_todo_available;
+
+    /// \brief The maximum number of todo elements that a thread takes at once.
+    static constexpr std::size_t max_batch_size = 64;
+
     volatile bool m_must_abort = false;
 
     // \brief Returns a status message about the progress
@@ -374,6 +381,16 @@ class pbesinst_lazy_algorithm
       return false;
     }
 
+    // Returns the number of todo elements that a thread takes at once
+    std::size_t batch_size(std::size_t todo_size) const
+    {
+      if (m_options.number_of_threads <= 1)
+      {
+        return 1;
+      }
+      return std::min(max_batch_size, std::max(std::size_t(1), todo_size / m_options.number_of_threads));
+    }
+
     virtual void run_thread(const std::size_t thread_index,
                             pbesinst_lazy_todo& todo,
                             std::atomic<std::size_t>& number_of_active_processes,
@@ -386,66 +403,95 @@ class pbesinst_lazy_algorithm
       if (m_options.number_of_threads>1) mCRL2log(log::debug) << "Start thread " << thread_index << ".\n";
       R.thread_initialise();
 
-      propositional_variable_instantiation X_e;
-      pbes_expression psi_e;
-
-      while (number_of_active_processes > 0)
+      // The equations X = psi that are handled in one go. The right hand sides are computed
+      // without holding the todo lock, after which the equations are reported together.
+      // This reduces the number of times the todo lock is acquired by a factor of the batch size.
+      struct batch_element
+      {
+        propositional_variable_instantiation X;
+        pbes_expression psi;
+        std::set<propositional_variable_instantiation> occ;
+      };
+      std::vector<batch_element> batch;
+
+      std::unique_lock<std::mutex> todo_lock(m_todo_access);
+      while (true)
       {
-        m_todo_access.lock();
         while (!todo.elements().empty() && !m_must_abort)
         {
-          ++m_iteration_count;
-          mCRL2log(log::status) << status_message(m_iteration_count);
-          detail::check_bes_equation_limit(m_iteration_count);
-
-          next_todo(X_e);
-          m_todo_access.unlock();
-
-          std::size_t index = m_equation_index.index(X_e.name());
-          const pbes_equation& eqn = m_pbes.equations()[index];
-          const auto& phi = eqn.formula();
-          data::add_assignments(sigma, eqn.variable().parameters(), X_e.parameters());
-          R(psi_e, phi, sigma);
-          R.clear_identifier_generator();
-          data::remove_assignments(sigma, eqn.variable().parameters());
-
-          // optional step
-          m_graph_access.lock_shared();
-          rewrite_psi(thread_index, psi_e, eqn.symbol(), X_e, psi_e);
-          m_graph_access.unlock_shared();
-
-          std::set<propositional_variable_instantiation> occ = find_propositional_variable_instantiations(psi_e);
-
-          // report the generated equation
-          std::size_t k = m_equation_index.rank(X_e.name());
-          m_todo_access.lock();
-          mCRL2log(log::debug) << "generated equation " << X_e << " = " << psi_e
-                               << " with rank " << k << std::endl;
-          on_report_equation(thread_index, m_graph_access, X_e, psi_e, k);
-          todo.insert(occ.begin(), occ.end(), discovered, thread_index);
-          for (auto i = occ.begin(); i != occ.end(); ++i)
+          batch.resize(batch_size(todo.size()));
+          for (batch_element& e: batch)
+          {
+            ++m_iteration_count;
+            mCRL2log(log::status) << status_message(m_iteration_count);
+            detail::check_bes_equation_limit(m_iteration_count);
+            next_todo(e.X);
+          }
+          todo_lock.unlock();
+
+          for (batch_element& e: batch)
           {
-            discovered.insert(*i, thread_index);
+            std::size_t index = m_equation_index.index(e.X.name());
+            const pbes_equation& eqn = m_pbes.equations()[index];
+            const auto& phi = eqn.formula();
+            data::add_assignments(sigma, eqn.variable().parameters(), e.X.parameters());
+            R(e.psi, phi, sigma);
+            R.clear_identifier_generator();
+            data::remove_assignments(sigma, eqn.variable().parameters());
           }
-          on_discovered_elements(occ);
 
-          if (solution_found(init))
+          // report the generated equations
+          todo_lock.lock();
+          for (auto i = batch.begin(); i != batch.end(); ++i)
           {
-            break;
+            // optional step, which is done while holding the todo lock, since it may depend on
+            // the information that is stored when reporting equations
+            m_graph_access.lock_shared();
+            rewrite_psi(thread_index, i->psi, symbol(m_equation_index.index(i->X.name())), i->X, i->psi);
+            m_graph_access.unlock_shared();
+            i->occ = find_propositional_variable_instantiations(i->psi);
+
+            std::size_t k = m_equation_index.rank(i->X.name());
+            mCRL2log(log::debug) << "generated equation " << i->X << " = " << i->psi
+                                 << " with rank " << k << std::endl;
+            on_report_equation(thread_index, m_graph_access, i->X, i->psi, k);
+            todo.insert(i->occ.begin(), i->occ.end(), discovered, thread_index);
+            for (const propositional_variable_instantiation& Y: i->occ)
+            {
+              discovered.insert(Y, thread_index);
+            }
+            on_discovered_elements(i->occ);
+
+            if (solution_found(init))
+            {
+              // Put back the equations that have not been reported, and make all threads stop.
+              for (auto j = i + 1; j != batch.end(); ++j)
+              {
+                todo.insert(j->X);
+              }
+              m_must_abort = true;
+              break;
+            }
           }
+          if (m_options.number_of_threads > 1)
+          {
+            m_todo_available.notify_all();
+          }
+        }
+
+        // This thread becomes idle. If all threads are idle the todo list is empty and the
+        // computation is finished. Otherwise wait until another thread adds new work.
+        if (--number_of_active_processes == 0 || m_must_abort)
+        {
+          m_todo_available.notify_all();
+          break;
         }
-        m_todo_access.unlock();
-
-        // Check whether all processes are ready. If so the
-        // number_of_active_processes becomes 0. Otherwise, this thread becomes
-        // active again, and tries to see whether the todo buffer is not empty,
-        // to take up more work.
-        number_of_active_processes--;
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
-        if (number_of_active_processes > 0)
+        m_todo_available.wait(todo_lock, [&]() { return !todo.elements().empty() || number_of_active_processes == 0 || m_must_abort; });
+        if (number_of_active_processes == 0 || m_must_abort)
         {
-          number_of_active_processes++;
+          break;
         }
+        number_of_active_processes++;
       }
 
       if (m_options.number_of_threads>1) mCRL2log(log::debug) << "Stop thread " << thread_index << ".\n";
@@ -455,6 +501,7 @@ class pbesinst_lazy_algorithm
     virtual void run()
     {
       m_iteration_count = 0;
+      m_must_abort = false;
 
       const std::size_t number_of_threads = m_options.number_of_threads;
       const std::size_t initialisation_thread_index = (number_of_threads==1?0:1);
@@ -19,6 +19,7 @@
 #include "mcrl2/pbes/join.h"
 #include "mcrl2/pbes/pbesinst_lazy.h"
 #include "mcrl2/pbes/structure_graph_builder.h"
+#include "mcrl2/utilities/memory_usage.h"
 
 namespace mcrl2 {
 
@@ -31,6 +32,34 @@ class pbesinst_structure_graph_algorithm: public pbesinst_lazy_algorithm
   protected:
     detail::structure_graph_builder m_graph_builder;
 
+    // the number of reported equations, used for checking the memory limit periodically
+    std::size_t m_report_count = 0;
+
+    // Spills formulas of the structure graph to disk if the memory limit is exceeded
+    void check_memory_limit(std::shared_mutex& realloc_mutex)
+    {
+      if (m_options.memory_limit == 0 || ++m_report_count % 1024 != 0)
+      {
+        return;
+      }
+      if (utilities::resident_memory_size() > m_options.memory_limit)
+      {
+        realloc_mutex.lock();
+        m_graph_builder.spill_formulas(false);
+        realloc_mutex.unlock();
+      }
+    }
+
+    // Spills the formulas of all vertices to disk, and clears the data structures that are only needed for the instantiation
+    void spill_structure_graph()
+    {
+      m_graph_builder.spill_formulas(true);
+      m_graph_builder.m_vertex_map.clear();
+      discovered.clear();
+      mCRL2log(log::verbose) << "Spilled the formulas of the structure graph to disk ("
+                             << m_graph_builder.m_graph.formula_store()->bytes_written() << " bytes written)" << std::endl;
+    }
+
     void SG0(const propositional_variable_instantiation& X, const pbes_expression& psi, std::size_t k, std::shared_mutex& realloc_mutex)
     {
       auto vertex_phi = m_graph_builder.insert_variable(X, psi, k, realloc_mutex);
@@ -119,7 +148,12 @@ class pbesinst_structure_graph_algorithm: public pbesinst_lazy_algorithm
     )
       : pbesinst_lazy_algorithm(options, p),
         m_graph_builder(G)
-    {}
+    {
+      if (options.memory_limit > 0 && !G.formula_store())
+      {
+        G.set_formula_store(std::make_shared<structure_graph_formula_store>(options.spill_file));
+      }
+    }
 
     void on_report_equation(const std::size_t /* thread_index */,
                             std::shared_mutex& realloc_mutex,
@@ -134,12 +168,17 @@ class pbesinst_structure_graph_algorithm: public pbesinst_lazy_algorithm
         m_graph_builder.set_initial_state(X);
       }
       SG0(X, psi, k, realloc_mutex);
+      check_memory_limit(realloc_mutex);
     }
 
     void run() override
     {
       pbesinst_lazy_algorithm::run();
       m_graph_builder.finalize();
+      if (m_options.memory_limit > 0)
+      {
+        spill_structure_graph();
+      }
     }
 };
 
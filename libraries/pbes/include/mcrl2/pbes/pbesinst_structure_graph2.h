@@ -12,6 +12,7 @@
 #ifndef MCRL2_PBES_PBESINST_STRUCTURE_GRAPH2_H
 #define MCRL2_PBES_PBESINST_STRUCTURE_GRAPH2_H
 
+#include <future>
 #include <shared_mutex>
 
 #include "mcrl2/atermpp/standard_containers/deque.h"
@@ -84,6 +85,20 @@ class pbesinst_structure_graph_algorithm2: public pbesinst_structure_graph_algor
     detail::computation_guard fatal_attractors_guard;
     detail::periodic_guard reset_guard;
 
+    // Partial solving that is done on a background thread (optimizations 4, 5 and 6).
+    // It operates on a snapshot of the structure graph, and the results are merged into
+    // S and tau once it has finished. Since the successors of a vertex do not change once
+    // it has been defined, a solution of the snapshot is also a solution of the graph.
+    struct background_solving_job
+    {
+      atermpp::vector<structure_graph::vertex> vertices;
+      std::array<vertex_set, 2> S;
+      std::array<strategy_vector, 2> tau;
+      stopwatch timer;
+    };
+    std::unique_ptr<background_solving_job> m_background_job;
+    std::future<void> m_background_result; // N.B. must be declared after m_background_job
+
     template<typename T>
     pbes_expression expr(const T& x) const
     {
@@ -490,6 +505,87 @@ class pbesinst_structure_graph_algorithm2: public pbesinst_structure_graph_algor
       return true;
     }
 
+    void start_background_solving()
+    {
+      mCRL2log(log::verbose) << "start partial solving (background)\n";
+
+      // The snapshot does not contain formulas, since they are not needed for solving.
+      m_background_job = std::make_unique<background_solving_job>();
+      background_solving_job& job = *m_background_job;
+      job.vertices.reserve(m_graph_builder.vertices().size());
+      for (const structure_graph::vertex& u: m_graph_builder.vertices())
+      {
+        job.vertices.emplace_back(pbes_expression(), u.decoration, u.rank, u.predecessors, u.successors, u.strategy);
+      }
+      job.S = S;
+      job.tau = tau;
+
+      int optimization = m_options.optimization;
+      std::size_t iteration_count = m_iteration_count;
+      m_background_result = std::async(std::launch::async, [&job, optimization, iteration_count]()
+        {
+          simple_structure_graph G(job.vertices);
+          if (optimization == 4)
+          {
+            detail::find_loops2(G, job.S, job.tau, iteration_count);
+          }
+          else if (optimization == 5)
+          {
+            detail::fatal_attractors(G, job.S, job.tau, iteration_count);
+          }
+          else
+          {
+            detail::fatal_attractors_original(G, job.S, job.tau, iteration_count);
+          }
+        });
+    }
+
+    // Waits until the background job has finished, and adds its results to S and tau.
+    void merge_background_solving()
+    {
+      m_background_result.get();
+      background_solving_job& job = *m_background_job;
+      for (std::size_t alpha: {0, 1})
+      {
+        for (structure_graph::index_type u: job.S[alpha].vertices())
+        {
+          if (!S[alpha].contains(u))
+          {
+            S[alpha].insert(u);
+            tau[alpha][u] = job.tau[alpha][u];
+          }
+        }
+      }
+
+      // Propagate the new solutions to the vertices that were added after the snapshot was made.
+      simple_structure_graph G(m_graph_builder.vertices());
+      S[0] = attr_default_with_tau(G, S[0], 0, tau);
+      S[1] = attr_default_with_tau(G, S[1], 1, tau);
+      assert(strategies_are_set_in_solved_nodes());
+
+      mCRL2log(log::verbose) << "found solution for" << std::setw(12) << S[0].size() + S[1].size() << " BES equations" << std::endl;
+      mCRL2log(log::verbose) << "finished partial solving (background, time = " << std::setprecision(2) << std::fixed << job.timer.seconds() << "s)\n";
+      m_background_job.reset();
+    }
+
+    // Merges the results of the background job if it has finished, and starts a new one if needed.
+    void apply_background_solving()
+    {
+      if (m_background_job)
+      {
+        if (m_background_result.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        {
+          return;
+        }
+        merge_background_solving();
+      }
+      detail::computation_guard& guard = m_options.optimization == 4 ? find_loops_guard : fatal_attractors_guard;
+      if (m_options.aggressive || guard(m_iteration_count))
+      {
+        start_background_solving();
+      }
+    }
+
   public:
     typedef pbesinst_structure_graph_algorithm super;
 
@@ -556,7 +652,11 @@ class pbesinst_structure_graph_algorithm2: public pbesinst_structure_graph_algor
       stopwatch timer;
 
       bool report = false;
-      if (m_options.optimization == 3)
+      if (m_options.background_solving && 4 <= m_options.optimization && m_options.optimization <= 6)
+      {
+        apply_background_solving();
+      }
+      else if (m_options.optimization == 3)
       {
         if (S_guard[0](S[0].size()))
         {
@@ -630,6 +730,11 @@ class pbesinst_structure_graph_algorithm2: public pbesinst_structure_graph_algor
     {
       using  utilities::detail::contains;
 
+      if (m_background_job)
+      {
+        merge_background_solving();
+      }
+
       simple_structure_graph G(m_graph_builder.vertices());
 
       structure_graph::index_type u = m_graph_builder.find_vertex(init);
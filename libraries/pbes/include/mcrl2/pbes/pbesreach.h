@@ -298,7 +298,7 @@ class pbesreach_algorithm
       m_summand_patterns = compute_read_write_patterns(m_pbes, m_process_parameters);
       symbolic::adjust_read_write_patterns(m_summand_patterns, m_options);
 
-      m_variable_order = symbolic::compute_variable_order(m_options.variable_order, m_process_parameters.size(), true);
+      m_variable_order = symbolic::compute_variable_order(m_options.variable_order, m_process_parameters.size(), m_summand_patterns, true);
       assert(m_variable_order[0] == 0); // It is required that the propositional variable name stays up front
       mCRL2log(log::debug) << "variable order = " << core::detail::print_list(m_variable_order) << std::endl;
       m_summand_patterns = symbolic::reorder_read_write_patterns(m_summand_patterns, m_variable_order);
@@ -33,12 +33,22 @@ struct pbessolve_options
   // if true, apply optimization 4 and 5 at every iteration
   bool aggressive = false;
 
+  // if true, optimizations 4, 5 and 6 are applied on a separate thread
+  bool background_solving = false;
+
   // for doing a consistency check on the computed strategy
   bool check_strategy = false;
 
   bool prune_todo_alternative = false;
 
   std::size_t number_of_threads = 1;
+
+  // if non-zero, formulas of the structure graph are spilled to disk when the
+  // resident memory of the process exceeds this number of bytes
+  std::size_t memory_limit = 0;
+
+  // the prefix of the files that are used for spilling the structure graph
+  std::string spill_file = "pbessolve.spill";
 };
 
 inline
@@ -51,9 +61,12 @@ std::ostream& operator<<(std::ostream& out, const pbessolve_options& options)
   out << "search-strategy = " << options.exploration_strategy << std::endl;
   out << "optimization = " << options.optimization << std::endl;
   out << "aggressive = " << std::boolalpha << options.aggressive << std::endl;
+  out << "background-solving = " << std::boolalpha << options.background_solving << std::endl;
   out << "check-strategy = " << std::boolalpha << options.check_strategy << std::endl;
   out << "prune-todo-alternative = " << std::boolalpha << options.prune_todo_alternative << std::endl;
   out << "threads = " << options.number_of_threads << std::endl;
+  out << "memory-limit = " << options.memory_limit << std::endl;
+  out << "spill-file = " << options.spill_file << std::endl;
   return out;
 }
 
@@ -17,6 +17,7 @@
 #include "mcrl2/lts/lts_algorithm.h"
 #include "mcrl2/pbes/pbes_equation_index.h"
 #include "mcrl2/pbes/pbessolve_attractors.h"
+#include "mcrl2/pbes/structure_graph_formula_store.h"
 
 namespace mcrl2 {
 
@@ -403,6 +404,11 @@ class lps_solve_structure_graph_algorithm: public solve_structure_graph_algorith
       std::regex re("Z(neg|pos)_(\\d+)_.*");
       std::size_t n = lpsspec.process().process_parameters().size();
 
+      if (G.formula_store())
+      {
+        G.formula_store()->restore(G, V);
+      }
+
       for (structure_graph::index_type vi: V)
       {
         const auto& v = G.find_vertex(vi);
@@ -524,6 +530,10 @@ class lts_solve_structure_graph_algorithm: public solve_structure_graph_algorith
       std::regex re("Z(neg|pos)_(\\d+)_.*");
 
       std::set<std::size_t> transition_indices;
+      if (G.formula_store())
+      {
+        G.formula_store()->restore(G, V);
+      }
       for (structure_graph::index_type vi: V)
       {
         const auto& v = G.find_vertex(vi);
@@ -13,6 +13,7 @@
 #define MCRL2_PBES_STRUCTURE_GRAPH_H
 
 #include <iomanip>
+#include <memory>
 #include <boost/dynamic_bitset.hpp>
 #include <boost/range/adaptor/filtered.hpp>
 
@@ -51,6 +52,8 @@ struct manual_structure_graph_builder;
 
 } // namespace detail
 
+class structure_graph_formula_store;
+
 constexpr inline
 unsigned int undefined_vertex()
 {
@@ -87,6 +90,7 @@ class structure_graph
       std::vector<index_type> predecessors;
       std::vector<index_type> successors;
       mutable index_type strategy;
+      bool is_spilled = false; // if true, the formula has been moved to a structure_graph_formula_store
 
       explicit vertex(pbes_expression  formula_,
              decoration_type decoration_ = structure_graph::d_none,
@@ -136,6 +140,9 @@ class structure_graph
     index_type m_initial_vertex = 0;
     boost::dynamic_bitset<> m_exclude;
 
+    // contains the formulas of spilled vertices, may be nullptr
+    std::shared_ptr<structure_graph_formula_store> m_formula_store;
+
     struct integers_not_contained_in
     {
       const boost::dynamic_bitset<>& subset;
@@ -256,6 +263,16 @@ class structure_graph
       return !m_exclude[u];
     }
 
+    const std::shared_ptr<structure_graph_formula_store>& formula_store() const
+    {
+      return m_formula_store;
+    }
+
+    void set_formula_store(std::shared_ptr<structure_graph_formula_store> store)
+    {
+      m_formula_store = std::move(store);
+    }
+
     // TODO: avoid this linear time check
     bool is_empty() const
     {
@@ -16,6 +16,7 @@
 
 #include <mcrl2/atermpp/standard_containers/unordered_map.h>
 #include "mcrl2/pbes/pbessolve_vertex_set.h"
+#include "mcrl2/pbes/structure_graph_formula_store.h"
 
 namespace mcrl2 {
 
@@ -30,6 +31,7 @@ struct structure_graph_builder
   structure_graph& m_graph;
   atermpp::unordered_map<pbes_expression, index_type> m_vertex_map;
   pbes_expression m_initial_state; // The initial state.
+  index_type m_spill_watermark = 0; // vertices below this index have been considered for spilling
 
   explicit structure_graph_builder(structure_graph& G)
     : m_graph(G), m_initial_state(data::undefined_data_expression())
@@ -260,12 +262,44 @@ struct structure_graph_builder
 
     vertices().erase(vertices().begin() + vertices().size() - U.size(), vertices().end());
 
+    if (m_graph.formula_store())
+    {
+      m_graph.formula_store()->renumber(index);
+    }
+    m_spill_watermark = 0;
+
     // Recreate the index
     m_vertex_map.clear();
     for (std::size_t i = 0; i < vertices().size(); i++)
     {
-      m_vertex_map.insert({vertex(i).formula(), i});
+      if (!vertex(i).is_spilled)
+      {
+        m_vertex_map.insert({vertex(i).formula(), i});
+      }
+    }
+  }
+
+  // Moves formulas of vertices to the formula store of the graph, and removes them from the vertex map.
+  // If all is false, only the formulas of conjunctive and disjunctive subformulas are spilled. These
+  // are not needed for the instantiation, apart from sharing vertices of identical subformulas.
+  // If all is true, the formulas of all vertices are spilled, after which the vertex map is empty.
+  // N.B. Spilling subformulas is incompatible with pruning the todo list, since that traverses
+  // the formulas of the vertices.
+  void spill_formulas(bool all)
+  {
+    assert(m_graph.formula_store());
+    std::vector<index_type> V;
+    for (index_type u = all ? 0 : m_spill_watermark; u != vertices().size(); u++)
+    {
+      const structure_graph::vertex& u_ = vertex(u);
+      if (!u_.is_spilled && (all || is_and(u_.formula()) || is_or(u_.formula())))
+      {
+        V.push_back(u);
+        m_vertex_map.erase(u_.formula());
+      }
     }
+    m_spill_watermark = vertices().size();
+    m_graph.formula_store()->spill(m_graph, V);
   }
 };
 
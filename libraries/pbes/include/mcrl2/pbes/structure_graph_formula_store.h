@@ -0,0 +1,158 @@
+// Author(s): Wieger Wesselink
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file mcrl2/pbes/structure_graph_formula_store.h
+/// \brief An on-disk store for the formulas of structure graph vertices.
+
+#ifndef MCRL2_PBES_STRUCTURE_GRAPH_FORMULA_STORE_H
+#define MCRL2_PBES_STRUCTURE_GRAPH_FORMULA_STORE_H
+
+#include <cstdio>
+#include <fstream>
+#include "mcrl2/atermpp/aterm_io_binary.h"
+#include "mcrl2/data/detail/io.h"
+#include "mcrl2/pbes/structure_graph.h"
+
+namespace mcrl2 {
+
+namespace pbes_system {
+
+/// \brief Stores the formulas of structure graph vertices on disk, such that they
+/// can be removed from memory and be restored on demand.
+/// \details Formulas are written in batches. Each batch is a separate file in the
+/// binary aterm format, such that no references to the written terms have to be kept
+/// alive once a batch is complete. The vertex indices of the spilled formulas are kept
+/// in memory, and are updated when vertices of the structure graph are renumbered.
+class structure_graph_formula_store
+{
+  public:
+    typedef structure_graph::index_type index_type;
+
+  protected:
+    std::string m_prefix;
+
+    // m_vertices[i] contains the vertices of the formulas in batch i, in the order in which they were written
+    std::vector<std::vector<index_type>> m_vertices;
+
+    // the number of bytes written to disk
+    std::size_t m_bytes_written = 0;
+
+    std::string batch_filename(std::size_t i) const
+    {
+      return m_prefix + "." + std::to_string(i);
+    }
+
+  public:
+    /// \brief Constructor.
+    /// \param prefix The prefix of the names of the files in which the formulas are stored.
+    explicit structure_graph_formula_store(std::string prefix)
+      : m_prefix(std::move(prefix))
+    {}
+
+    structure_graph_formula_store(const structure_graph_formula_store&) = delete;
+    structure_graph_formula_store& operator=(const structure_graph_formula_store&) = delete;
+
+    ~structure_graph_formula_store()
+    {
+      for (std::size_t i = 0; i < m_vertices.size(); i++)
+      {
+        std::remove(batch_filename(i).c_str());
+      }
+    }
+
+    /// \brief Writes the formulas of the vertices in V to disk, and removes them from G.
+    /// \pre The formulas of the vertices in V have not been spilled before.
+    void spill(structure_graph& G, const std::vector<index_type>& V)
+    {
+      if (V.empty())
+      {
+        return;
+      }
+      std::string filename = batch_filename(m_vertices.size());
+      std::ofstream to(filename, std::ofstream::out | std::ofstream::binary);
+      if (!to.good())
+      {
+        throw mcrl2::runtime_error("Could not open file " + filename + " for spilling the structure graph.");
+      }
+      {
+        atermpp::binary_aterm_ostream stream(to);
+        stream << data::detail::remove_index_impl;
+        for (index_type u: V)
+        {
+          structure_graph::vertex& u_ = G.find_vertex(u);
+          assert(!u_.is_spilled);
+          stream << u_.formula();
+          u_.m_formula = pbes_expression();
+          u_.is_spilled = true;
+        }
+      }
+      m_bytes_written += static_cast<std::size_t>(to.tellp());
+      m_vertices.push_back(V);
+    }
+
+    /// \brief Restores the formulas of the vertices in V that have been spilled.
+    template <typename VertexSet>
+    void restore(structure_graph& G, const VertexSet& V)
+    {
+      for (std::size_t i = 0; i < m_vertices.size(); i++)
+      {
+        std::vector<index_type>& batch = m_vertices[i];
+        if (std::none_of(batch.begin(), batch.end(), [&](index_type u) { return u != undefined_vertex() && V.count(u) > 0; }))
+        {
+          continue;
+        }
+        std::string filename = batch_filename(i);
+        std::ifstream from(filename, std::ifstream::in | std::ifstream::binary);
+        if (!from.good())
+        {
+          throw mcrl2::runtime_error("Could not open file " + filename + " for restoring the structure graph.");
+        }
+        atermpp::binary_aterm_istream stream(from);
+        stream >> data::detail::add_index_impl;
+        for (index_type& u: batch)
+        {
+          pbes_expression x;
+          stream >> x;
+          if (u != undefined_vertex() && V.count(u) > 0)
+          {
+            structure_graph::vertex& u_ = G.find_vertex(u);
+            u_.m_formula = x;
+            u_.is_spilled = false;
+            u = undefined_vertex();
+          }
+        }
+      }
+    }
+
+    /// \brief Renumbers the spilled vertices. Vertices that are mapped to undefined_vertex() are discarded.
+    void renumber(const std::vector<index_type>& index)
+    {
+      for (std::vector<index_type>& batch: m_vertices)
+      {
+        for (index_type& u: batch)
+        {
+          if (u != undefined_vertex())
+          {
+            u = index[u];
+          }
+        }
+      }
+    }
+
+    /// \brief Returns the number of bytes that have been written to disk.
+    std::size_t bytes_written() const
+    {
+      return m_bytes_written;
+    }
+};
+
+} // namespace pbes_system
+
+} // namespace mcrl2
+
+#endif // MCRL2_PBES_STRUCTURE_GRAPH_FORMULA_STORE_H
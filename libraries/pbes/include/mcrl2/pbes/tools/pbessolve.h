@@ -110,6 +110,16 @@ class pbessolve_tool
         "use strategy STRATEGY (N.B. This is a developer option that overrides "
         "--strategy)",
         'l');
+    desc.add_option("background-solving",
+                    "Apply the on-the-fly solving of strategies 2 and 3 on a "
+                    "separate thread, such that the instantiation does not have "
+                    "to wait for it. Partial solutions are merged into the "
+                    "parity game as soon as they become available.");
+    desc.add_option("memory-limit", utilities::make_mandatory_argument("NUM"),
+                    "Spill formulas of the parity game to disk when the memory "
+                    "usage exceeds NUM megabytes. After instantiation all formulas "
+                    "are spilled, and only the ones needed for the evidence are "
+                    "restored. This option cannot be combined with --prune-todo-list.");
     desc.add_hidden_option(
         "no-replace-constants-by-variables",
         "Do not move constant expressions to a substitution.");
@@ -129,6 +139,7 @@ class pbessolve_tool
     options.remove_unused_rewrite_rules =
         !parser.has_option("no-remove-unused-rewrite-rules");
     options.aggressive = parser.has_option("aggressive");
+    options.background_solving = parser.has_option("background-solving");
     options.prune_todo_list = parser.has_option("prune-todo-list");
     options.prune_todo_alternative =
         parser.has_option("prune-todo-alternative");
@@ -139,6 +150,20 @@ class pbessolve_tool
     options.number_of_threads = number_of_threads();
     
 
+    if (parser.has_option("memory-limit"))
+    {
+      options.memory_limit = parser.option_argument_as<std::size_t>("memory-limit") * 1024 * 1024;
+      if (options.memory_limit == 0)
+      {
+        throw mcrl2::runtime_error("The argument of --memory-limit must be positive.");
+      }
+      if (options.prune_todo_list)
+      {
+        throw mcrl2::runtime_error("Option --memory-limit cannot be combined with --prune-todo-list.");
+      }
+      options.spill_file = (input_filename().empty() ? std::string("pbessolve") : input_filename()) + ".spill";
+    }
+
     if (parser.has_option("file"))
     {
       std::string filename = parser.option_argument("file");
@@ -196,6 +221,12 @@ class pbessolve_tool
       throw mcrl2::runtime_error("Invalid strategy " +
                                  std::to_string(options.optimization));
     }
+    if (options.background_solving && (options.optimization < 4 || options.optimization > 6))
+    {
+      mCRL2log(log::warning) << "Option --background-solving has no effect for "
+                                "strategies other than 2 and 3."
+                             << std::endl;
+    }
     if (options.prune_todo_list && options.optimization < 2)
     {
       mCRL2log(log::warning) << "Option --prune-todo-list has no effect for "
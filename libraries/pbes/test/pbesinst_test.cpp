@@ -18,8 +18,10 @@
 #include "mcrl2/pbes/is_bes.h"
 #include "mcrl2/pbes/lps2pbes.h"
 #include "mcrl2/pbes/pbesinst_finite_algorithm.h"
+#include "mcrl2/pbes/pbesinst_structure_graph2.h"
 #include "mcrl2/pbes/pbesinst_symbolic.h"
 #include "mcrl2/pbes/rewriter.h"
+#include "mcrl2/pbes/solve_structure_graph.h"
 #include "mcrl2/pbes/txt2pbes.h"
 
 using namespace mcrl2;
@@ -298,6 +300,137 @@ BOOST_AUTO_TEST_CASE(test_pbesinst_symbolic1)
   test_pbesinst_symbolic(test6);
 }
 
+// Solves p using a structure graph, with and without spilling the formulas to disk
+void test_structure_graph_spilling(const std::string& text, int optimization)
+{
+  pbes p = txt2pbes(text);
+  pbes_system::algorithms::normalize(p);
+
+  pbessolve_options options;
+  options.optimization = optimization;
+  structure_graph G1;
+  pbesinst_structure_graph_algorithm2 algorithm1(options, p, G1);
+  algorithm1.run();
+
+  // A memory limit of one byte forces the formulas to be spilled at every check
+  options.memory_limit = 1;
+  options.spill_file = "pbesinst_test.spill";
+  structure_graph G2;
+  pbesinst_structure_graph_algorithm2 algorithm2(options, p, G2);
+  algorithm2.run();
+
+  BOOST_CHECK(G2.formula_store());
+  BOOST_CHECK_EQUAL(G1.all_vertices().size(), G2.all_vertices().size());
+  std::set<structure_graph::index_type> V;
+  for (std::size_t u = 0; u < G2.all_vertices().size(); u++)
+  {
+    BOOST_CHECK(G2.find_vertex(u).is_spilled);
+    V.insert(u);
+  }
+  BOOST_CHECK_EQUAL(solve_structure_graph(G1), solve_structure_graph(G2));
+
+  G2.formula_store()->restore(G2, V);
+  for (std::size_t u = 0; u < G2.all_vertices().size(); u++)
+  {
+    BOOST_CHECK(!G2.find_vertex(u).is_spilled);
+    BOOST_CHECK_EQUAL(G1.find_vertex(u).formula(), G2.find_vertex(u).formula());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_pbesinst_structure_graph_spilling)
+{
+  // This pbes has enough equations to trigger spilling during the instantiation
+  std::string text =
+    "pbes                                                                     \n"
+    "mu X(n: Nat) = val(n < 2500) && (Y(n) || (X(n + 1) && X(n + 2)));        \n"
+    "nu Y(n: Nat) = val(n > 2000) || (Y(n + 1) && (X(n) || Y(n + 2)));        \n"
+    "                                                                         \n"
+    "init X(0);                                                               \n"
+    ;
+
+  for (int optimization: { 0, 2, 4 })
+  {
+    test_structure_graph_spilling(test4, optimization);
+    test_structure_graph_spilling(test5, optimization);
+    test_structure_graph_spilling(test8, optimization);
+    test_structure_graph_spilling(text, optimization);
+  }
+}
+
+bool solve_with_threads(const std::string& text, int optimization, std::size_t number_of_threads)
+{
+  pbes p = txt2pbes(text);
+  pbes_system::algorithms::normalize(p);
+  pbessolve_options options;
+  options.optimization = optimization;
+  options.number_of_threads = number_of_threads;
+  structure_graph G;
+  pbesinst_structure_graph_algorithm2 algorithm(options, p, G);
+  algorithm.run();
+  return solve_structure_graph(G);
+}
+
+BOOST_AUTO_TEST_CASE(test_pbesinst_structure_graph_threads)
+{
+  std::string text =
+    "pbes                                                                     \n"
+    "mu X(n: Nat) = val(n < 500) && (Y(n) || (X(n + 1) && X(n + 2)));         \n"
+    "nu Y(n: Nat) = val(n > 400) || (Y(n + 1) && (X(n) || Y(n + 2)));         \n"
+    "                                                                         \n"
+    "init X(0);                                                               \n"
+    ;
+
+  for (const std::string& pbesspec: { test4, test5, test8, text })
+  {
+    for (int optimization: { 0, 2, 3 })
+    {
+      bool expected = solve_with_threads(pbesspec, optimization, 1);
+      for (std::size_t number_of_threads: { 2, 4 })
+      {
+        BOOST_CHECK_EQUAL(expected, solve_with_threads(pbesspec, optimization, number_of_threads));
+      }
+    }
+  }
+}
+
+bool solve_in_background(const std::string& text, int optimization, std::size_t number_of_threads)
+{
+  pbes p = txt2pbes(text);
+  pbes_system::algorithms::normalize(p);
+  pbessolve_options options;
+  options.optimization = optimization;
+  options.number_of_threads = number_of_threads;
+  options.background_solving = true;
+  options.aggressive = true;
+  structure_graph G;
+  pbesinst_structure_graph_algorithm2 algorithm(options, p, G);
+  algorithm.run();
+  return solve_structure_graph(G);
+}
+
+BOOST_AUTO_TEST_CASE(test_pbesinst_structure_graph_background_solving)
+{
+  std::string text =
+    "pbes                                                                     \n"
+    "mu X(n: Nat) = val(n < 500) && (Y(n) || (X(n + 1) && X(n + 2)));         \n"
+    "nu Y(n: Nat) = val(n > 400) || (Y(n + 1) && (X(n) || Y(n + 2)));         \n"
+    "                                                                         \n"
+    "init X(0);                                                               \n"
+    ;
+
+  for (const std::string& pbesspec: { test2, test4, test5, test6, test8, text })
+  {
+    bool expected = solve_with_threads(pbesspec, 0, 1);
+    for (int optimization: { 4, 5, 6 })
+    {
+      for (std::size_t number_of_threads: { 1, 2 })
+      {
+        BOOST_CHECK_EQUAL(expected, solve_in_background(pbesspec, optimization, number_of_threads));
+      }
+    }
+  }
+}
+
 #ifdef MCRL2_EXTENDED_TESTS
 BOOST_AUTO_TEST_CASE(test_pbesinst_slow)
 {
@@ -18,8 +18,11 @@
 #include <boost/dynamic_bitset.hpp>
 
 #include <algorithm>
+#include <cmath>
+#include <deque>
 #include <iomanip>
 #include <iterator>
+#include <numeric>
 #include <random>
 #include <regex>
 
@@ -130,6 +133,35 @@ std::vector<std::set<std::size_t>> compute_summand_groups_simple(const std::vect
   return groups;
 }
 
+// joins summands of which the read/write pattern is included in the pattern of another summand,
+// such that the group patterns are the same as the patterns of the largest summands
+inline
+std::vector<std::set<std::size_t>> compute_summand_groups_auto(const std::vector<boost::dynamic_bitset<>>& patterns)
+{
+  // handle the summands with the largest patterns first
+  std::vector<std::size_t> summands(patterns.size());
+  std::iota(summands.begin(), summands.end(), 0);
+  std::stable_sort(summands.begin(), summands.end(), [&](std::size_t i, std::size_t j) { return patterns[i].count() > patterns[j].count(); });
+
+  std::vector<boost::dynamic_bitset<>> group_patterns;
+  std::vector<std::set<std::size_t>> groups;
+  for (std::size_t i: summands)
+  {
+    auto j = std::find_if(group_patterns.begin(), group_patterns.end(), [&](const boost::dynamic_bitset<>& pattern) { return patterns[i].is_subset_of(pattern); });
+    if (j == group_patterns.end())
+    {
+      group_patterns.push_back(patterns[i]);
+      groups.push_back({i});
+    }
+    else
+    {
+      groups[j - group_patterns.begin()].insert(i);
+    }
+  }
+  std::sort(groups.begin(), groups.end());
+  return groups;
+}
+
 inline
 std::vector<std::set<std::size_t>> compute_summand_groups(const std::string& text, const std::vector<boost::dynamic_bitset<>>& patterns)
 {
@@ -145,6 +177,10 @@ std::vector<std::set<std::size_t>> compute_summand_groups(const std::string& tex
   {
     return compute_summand_groups_simple(patterns);
   }
+  else if (text == "auto")
+  {
+    return compute_summand_groups_auto(patterns);
+  }
   else
   {
     return parse_summand_groups(text, patterns.size());
@@ -177,6 +213,395 @@ std::vector<std::size_t> compute_variable_order_random(std::size_t n, bool exclu
   return result;
 }
 
+namespace detail {
+
+// Returns for every summand the sorted sequence of variables that it uses (i.e. reads or writes). If
+// exclude_first_variable is true, the first variable is left out.
+inline
+std::vector<std::vector<std::size_t>> used_variables(const std::vector<boost::dynamic_bitset<>>& patterns, std::size_t n, bool exclude_first_variable)
+{
+  std::vector<std::vector<std::size_t>> result;
+  for (const boost::dynamic_bitset<>& pattern: patterns)
+  {
+    std::vector<std::size_t> used;
+    for (std::size_t j = exclude_first_variable ? 1 : 0; j < n; j++)
+    {
+      if (pattern[2*j] || pattern[2*j+1])
+      {
+        used.push_back(j);
+      }
+    }
+    if (!used.empty())
+    {
+      result.push_back(used);
+    }
+  }
+  return result;
+}
+
+// Returns the variable interaction graph: two variables are adjacent if they are used by the same summand.
+inline
+std::vector<std::vector<std::size_t>> variable_interaction_graph(const std::vector<boost::dynamic_bitset<>>& patterns, std::size_t n, bool exclude_first_variable)
+{
+  std::vector<std::set<std::size_t>> adjacent(n);
+  for (const std::vector<std::size_t>& used: used_variables(patterns, n, exclude_first_variable))
+  {
+    for (std::size_t i: used)
+    {
+      for (std::size_t j: used)
+      {
+        if (i != j)
+        {
+          adjacent[i].insert(j);
+        }
+      }
+    }
+  }
+  std::vector<std::vector<std::size_t>> result;
+  for (const std::set<std::size_t>& A: adjacent)
+  {
+    result.emplace_back(A.begin(), A.end());
+  }
+  return result;
+}
+
+// Returns the distances from u to the vertices reachable from u, or n for unreachable vertices.
+inline
+std::vector<std::size_t> bfs_distances(const std::vector<std::vector<std::size_t>>& G, std::size_t u)
+{
+  std::size_t n = G.size();
+  std::vector<std::size_t> result(n, n);
+  std::deque<std::size_t> todo{u};
+  result[u] = 0;
+  while (!todo.empty())
+  {
+    std::size_t v = todo.front();
+    todo.pop_front();
+    for (std::size_t w: G[v])
+    {
+      if (result[w] == n)
+      {
+        result[w] = result[v] + 1;
+        todo.push_back(w);
+      }
+    }
+  }
+  return result;
+}
+
+// Returns a pseudo-peripheral vertex of the component of u, using the algorithm of George and Liu.
+inline
+std::size_t pseudo_peripheral_vertex(const std::vector<std::vector<std::size_t>>& G, std::size_t u)
+{
+  std::size_t n = G.size();
+  std::size_t eccentricity = 0;
+  for (;;)
+  {
+    std::vector<std::size_t> dist = bfs_distances(G, u);
+    std::size_t max_dist = 0;
+    for (std::size_t d: dist)
+    {
+      if (d != n)
+      {
+        max_dist = std::max(max_dist, d);
+      }
+    }
+    if (max_dist <= eccentricity && eccentricity != 0)
+    {
+      return u;
+    }
+    eccentricity = max_dist;
+
+    // choose a vertex of minimal degree at maximal distance
+    std::size_t v = u;
+    for (std::size_t w = 0; w < n; w++)
+    {
+      if (dist[w] == max_dist && (v == u || G[w].size() < G[v].size()))
+      {
+        v = w;
+      }
+    }
+    if (v == u)
+    {
+      return u;
+    }
+    u = v;
+  }
+}
+
+// Returns the unnumbered vertex of minimal degree, or n if all vertices are numbered.
+inline
+std::size_t minimal_degree_vertex(const std::vector<std::vector<std::size_t>>& G, const std::vector<bool>& numbered)
+{
+  std::size_t n = G.size();
+  std::size_t result = n;
+  for (std::size_t v = 0; v < n; v++)
+  {
+    if (!numbered[v] && (result == n || G[v].size() < G[result].size()))
+    {
+      result = v;
+    }
+  }
+  return result;
+}
+
+// Puts the first variable in front, if exclude_first_variable is true, and appends the variables that
+// are not in order.
+inline
+std::vector<std::size_t> complete_variable_order(const std::vector<std::size_t>& order, std::size_t n, bool exclude_first_variable)
+{
+  std::vector<std::size_t> result;
+  std::vector<bool> done(n, false);
+  if (exclude_first_variable && n > 0)
+  {
+    result.push_back(0);
+    done[0] = true;
+  }
+  for (std::size_t i: order)
+  {
+    if (!done[i])
+    {
+      result.push_back(i);
+      done[i] = true;
+    }
+  }
+  for (std::size_t i = 0; i < n; i++)
+  {
+    if (!done[i])
+    {
+      result.push_back(i);
+    }
+  }
+  return result;
+}
+
+} // namespace detail
+
+/// \brief Returns the sum over all summands of the distance between the first and the last used variable
+/// with respect to the given variable order. Lower values typically lead to smaller LDDs.
+inline
+std::size_t variable_order_span(const std::vector<boost::dynamic_bitset<>>& patterns, const std::vector<std::size_t>& variable_order)
+{
+  std::size_t n = variable_order.size();
+  std::vector<std::size_t> position(n);
+  for (std::size_t i = 0; i < n; i++)
+  {
+    position[variable_order[i]] = i;
+  }
+  std::size_t result = 0;
+  for (const std::vector<std::size_t>& used: detail::used_variables(patterns, n, false))
+  {
+    std::size_t first = n;
+    std::size_t last = 0;
+    for (std::size_t j: used)
+    {
+      first = std::min(first, position[j]);
+      last = std::max(last, position[j]);
+    }
+    result += last - first + 1;
+  }
+  return result;
+}
+
+/// \brief Returns the span of the patterns with respect to the identity order.
+inline
+std::size_t variable_order_span(const std::vector<boost::dynamic_bitset<>>& patterns)
+{
+  std::size_t n = patterns.empty() ? 0 : patterns.front().size() / 2;
+  return variable_order_span(patterns, compute_variable_order_default(n));
+}
+
+/// \brief Computes a variable order using the FORCE heuristic of Aloul, Markov and Sakallah. Every summand is
+/// a hyperedge on the variables it uses, and the variables are repeatedly moved to the average of the centers
+/// of gravity of their hyperedges. The order with the smallest span is returned.
+inline
+std::vector<std::size_t> compute_variable_order_force(const std::vector<boost::dynamic_bitset<>>& patterns, std::size_t n, bool exclude_first_variable = false)
+{
+  // N.B. The first variable is kept in front, but it still attracts the variables that are used together with it.
+  std::vector<std::vector<std::size_t>> edges = detail::used_variables(patterns, n, false);
+  std::vector<std::size_t> order = compute_variable_order_default(n);
+  std::vector<std::size_t> best_order = order;
+  std::size_t best_span = variable_order_span(patterns, order);
+
+  std::size_t max_iterations = 10 * (static_cast<std::size_t>(std::log2(n + 1)) + 1);
+  for (std::size_t iteration = 0; iteration < max_iterations; iteration++)
+  {
+    std::vector<double> position(n);
+    for (std::size_t i = 0; i < n; i++)
+    {
+      position[order[i]] = static_cast<double>(i);
+    }
+
+    std::vector<double> sum(n, 0.0);
+    std::vector<std::size_t> count(n, 0);
+    for (const std::vector<std::size_t>& edge: edges)
+    {
+      double center = 0.0;
+      for (std::size_t j: edge)
+      {
+        center += position[j];
+      }
+      center = center / edge.size();
+      for (std::size_t j: edge)
+      {
+        sum[j] += center;
+        count[j]++;
+      }
+    }
+    for (std::size_t j = 0; j < n; j++)
+    {
+      if (count[j] > 0)
+      {
+        position[j] = sum[j] / count[j];
+      }
+    }
+
+    std::vector<std::size_t> new_order = order;
+    std::stable_sort(new_order.begin(), new_order.end(), [&](std::size_t i, std::size_t j) { return position[i] < position[j]; });
+    new_order = detail::complete_variable_order(new_order, n, exclude_first_variable);
+    if (new_order == order)
+    {
+      break;
+    }
+    order = new_order;
+    std::size_t span = variable_order_span(patterns, order);
+    if (span < best_span)
+    {
+      best_span = span;
+      best_order = order;
+    }
+  }
+  return best_order;
+}
+
+/// \brief Computes a variable order using the profile reduction algorithm of Sloan on the variable
+/// interaction graph.
+inline
+std::vector<std::size_t> compute_variable_order_sloan(const std::vector<boost::dynamic_bitset<>>& patterns, std::size_t n, bool exclude_first_variable = false)
+{
+  enum class status { inactive, preactive, active, postactive };
+  const long W1 = 1; // the weight of the distance to the end vertex
+  const long W2 = 2; // the weight of the degree
+
+  std::vector<std::vector<std::size_t>> G = detail::variable_interaction_graph(patterns, n, exclude_first_variable);
+  std::vector<bool> numbered(n, false);
+  if (exclude_first_variable && n > 0)
+  {
+    numbered[0] = true;
+  }
+
+  std::vector<std::size_t> order;
+  std::vector<status> state(n, status::inactive);
+  std::vector<long> priority(n, 0);
+  for (;;)
+  {
+    std::size_t u = detail::minimal_degree_vertex(G, numbered);
+    if (u == n)
+    {
+      break;
+    }
+
+    // handle the component of u, from start vertex s to end vertex e
+    std::size_t e = detail::pseudo_peripheral_vertex(G, u);
+    std::size_t s = detail::pseudo_peripheral_vertex(G, e);
+    std::vector<std::size_t> dist = detail::bfs_distances(G, e);
+    for (std::size_t v = 0; v < n; v++)
+    {
+      priority[v] = W1 * static_cast<long>(dist[v]) - W2 * static_cast<long>(G[v].size() + 1);
+    }
+
+    std::vector<std::size_t> queue{s};
+    state[s] = status::preactive;
+    while (!queue.empty())
+    {
+      auto i = std::max_element(queue.begin(), queue.end(), [&](std::size_t v, std::size_t w) { return priority[v] < priority[w]; });
+      std::size_t v = *i;
+      queue.erase(i);
+
+      if (state[v] == status::preactive)
+      {
+        for (std::size_t w: G[v])
+        {
+          priority[w] += W2;
+          if (state[w] == status::inactive)
+          {
+            state[w] = status::preactive;
+            queue.push_back(w);
+          }
+        }
+      }
+      state[v] = status::postactive;
+      numbered[v] = true;
+      order.push_back(v);
+
+      for (std::size_t w: G[v])
+      {
+        if (state[w] == status::preactive)
+        {
+          state[w] = status::active;
+          priority[w] += W2;
+          for (std::size_t x: G[w])
+          {
+            if (state[x] != status::postactive)
+            {
+              priority[x] += W2;
+              if (state[x] == status::inactive)
+              {
+                state[x] = status::preactive;
+                queue.push_back(x);
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  return detail::complete_variable_order(order, n, exclude_first_variable);
+}
+
+/// \brief Computes a variable order that reduces the bandwidth of the variable interaction graph, using
+/// the reverse Cuthill-McKee algorithm.
+inline
+std::vector<std::size_t> compute_variable_order_bandwidth(const std::vector<boost::dynamic_bitset<>>& patterns, std::size_t n, bool exclude_first_variable = false)
+{
+  std::vector<std::vector<std::size_t>> G = detail::variable_interaction_graph(patterns, n, exclude_first_variable);
+  std::vector<bool> numbered(n, false);
+  if (exclude_first_variable && n > 0)
+  {
+    numbered[0] = true;
+  }
+
+  std::vector<std::size_t> order;
+  for (;;)
+  {
+    std::size_t u = detail::minimal_degree_vertex(G, numbered);
+    if (u == n)
+    {
+      break;
+    }
+    std::size_t s = detail::pseudo_peripheral_vertex(G, u);
+    std::size_t first = order.size();
+    order.push_back(s);
+    numbered[s] = true;
+    for (std::size_t i = first; i < order.size(); i++)
+    {
+      std::vector<std::size_t> neighbours;
+      for (std::size_t w: G[order[i]])
+      {
+        if (!numbered[w])
+        {
+          neighbours.push_back(w);
+          numbered[w] = true;
+        }
+      }
+      std::stable_sort(neighbours.begin(), neighbours.end(), [&](std::size_t v, std::size_t w) { return G[v].size() < G[w].size(); });
+      order.insert(order.end(), neighbours.begin(), neighbours.end());
+    }
+    std::reverse(order.begin() + first, order.end());
+  }
+  return detail::complete_variable_order(order, n, exclude_first_variable);
+}
+
 inline
 std::vector<std::size_t> parse_variable_order(std::string text, std::size_t n, bool exclude_first_variable = false)
 {
@@ -210,8 +635,12 @@ std::vector<std::size_t> parse_variable_order(std::string text, std::size_t n, b
   return result;
 }
 
+/// \brief Computes a variable order.
+/// \param text Either the name of a heuristic, or a permutation of [0 .. number_of_variables - 1]
+/// \param patterns The read/write patterns of the summands, which are used by the heuristics
+/// \param exclude_first_variable If true, the first variable is kept in front
 inline
-std::vector<std::size_t> compute_variable_order(const std::string& text, std::size_t number_of_variables, bool exclude_first_variable = false)
+std::vector<std::size_t> compute_variable_order(const std::string& text, std::size_t number_of_variables, const std::vector<boost::dynamic_bitset<>>& patterns, bool exclude_first_variable = false)
 {
   if (text == "none")
   {
@@ -221,6 +650,18 @@ std::vector<std::size_t> compute_variable_order(const std::string& text, std::si
   {
     return compute_variable_order_random(number_of_variables, exclude_first_variable);
   }
+  else if (text == "force")
+  {
+    return compute_variable_order_force(patterns, number_of_variables, exclude_first_variable);
+  }
+  else if (text == "sloan")
+  {
+    return compute_variable_order_sloan(patterns, number_of_variables, exclude_first_variable);
+  }
+  else if (text == "bandwidth")
+  {
+    return compute_variable_order_bandwidth(patterns, number_of_variables, exclude_first_variable);
+  }
   else
   {
     return parse_variable_order(text, number_of_variables, exclude_first_variable);
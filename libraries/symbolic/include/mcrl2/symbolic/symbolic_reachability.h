@@ -19,6 +19,7 @@
 #include "mcrl2/data/undefined.h"
 #include "mcrl2/utilities/stopwatch.h"
 #include "mcrl2/symbolic/alternative_relprod.h"
+#include "mcrl2/symbolic/ordering.h"
 #include "mcrl2/symbolic/summand_group.h"
 
 #include <sylvan_ldd.hpp>
@@ -190,6 +191,33 @@ void learn_successors_callback(WorkerP*, Task*, std::uint32_t* x, std::size_t, v
   }
 }
 
+/// \brief Compares the variable order heuristics by running the reachability algorithm for each of them,
+/// and prints the sizes of the resulting LDDs. The exploration is limited to max_iterations breadth-first
+/// iterations, or to 10 iterations if max_iterations is zero.
+template <typename ReachabilityAlgorithm, typename Specification, typename Options>
+void print_variable_order_comparison(std::ostream& out, const Specification& spec, const Options& options, const std::vector<std::string>& orders = { "none", "force", "sloan", "bandwidth" })
+{
+  using namespace sylvan::ldds;
+
+  Options options_ = options;
+  options_.max_iterations = options.max_iterations == 0 ? 10 : options.max_iterations;
+
+  out << "variable orders (" << options_.max_iterations << " iterations)" << std::endl;
+  out << std::setw(10) << "order" << std::setw(10) << "span" << std::setw(16) << "states" << std::setw(12) << "nodes" << std::setw(10) << "time" << std::endl;
+  for (const std::string& order: orders)
+  {
+    options_.variable_order = order;
+    stopwatch timer;
+    ReachabilityAlgorithm algorithm(spec, options_);
+    ldd V = algorithm.run(false);
+    out << std::setw(10) << order
+        << std::setw(10) << variable_order_span(algorithm.read_write_patterns())
+        << std::setw(16) << std::setprecision(0) << std::fixed << satcount(V)
+        << std::setw(12) << nodecount(V)
+        << std::setw(9) << std::setprecision(2) << std::fixed << timer.seconds() << "s" << std::endl;
+  }
+}
+
 } // namespace mcrl2::symbolic
 
 #endif // MCRL2_ENABLE_SYLVAN
@@ -0,0 +1,96 @@
+// Author(s): Wieger Wesselink
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file ordering_test.cpp
+/// \brief Tests for the variable order and summand group heuristics.
+
+#define BOOST_TEST_MODULE ordering_test
+#include <boost/test/included/unit_test.hpp>
+
+#include "mcrl2/symbolic/ordering.h"
+
+using namespace mcrl2;
+
+// Creates read/write patterns from strings in the compact format of print_read_write_patterns.
+std::vector<boost::dynamic_bitset<>> make_patterns(const std::vector<std::string>& rows)
+{
+  std::vector<boost::dynamic_bitset<>> result;
+  for (const std::string& row: rows)
+  {
+    boost::dynamic_bitset<> pattern(2 * row.size());
+    for (std::size_t i = 0; i < row.size(); i++)
+    {
+      pattern[2*i] = row[i] == 'r' || row[i] == '+';
+      pattern[2*i+1] = row[i] == 'w' || row[i] == '+';
+    }
+    result.push_back(pattern);
+  }
+  return result;
+}
+
+void check_permutation(const std::vector<std::size_t>& order, std::size_t n, bool exclude_first_variable)
+{
+  std::vector<std::size_t> sorted = order;
+  std::sort(sorted.begin(), sorted.end());
+  BOOST_CHECK(sorted == symbolic::compute_variable_order_default(n));
+  if (exclude_first_variable)
+  {
+    BOOST_CHECK_EQUAL(order.front(), 0u);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_variable_order_heuristics)
+{
+  // The variables 0, 2, 4 and 1, 3, 5 are used together.
+  std::vector<boost::dynamic_bitset<>> patterns = make_patterns({
+    "+-r-w-",
+    "-+-r-w",
+    "r-+---",
+    "-r-+--",
+  });
+  std::size_t n = 6;
+  std::size_t span = symbolic::variable_order_span(patterns);
+  BOOST_CHECK_EQUAL(span, 16u);
+
+  for (const char* heuristic: { "force", "sloan", "bandwidth" })
+  {
+    for (bool exclude_first_variable: { false, true })
+    {
+      std::vector<std::size_t> order = symbolic::compute_variable_order(heuristic, n, patterns, exclude_first_variable);
+      check_permutation(order, n, exclude_first_variable);
+      BOOST_CHECK_LT(symbolic::variable_order_span(patterns, order), span);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_disconnected_variables)
+{
+  std::vector<boost::dynamic_bitset<>> patterns = make_patterns({
+    "+---",
+    "---r",
+  });
+  for (const char* heuristic: { "force", "sloan", "bandwidth" })
+  {
+    check_permutation(symbolic::compute_variable_order(heuristic, 4, patterns), 4, false);
+    check_permutation(symbolic::compute_variable_order(heuristic, 4, {}), 4, false);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_summand_groups_auto)
+{
+  std::vector<boost::dynamic_bitset<>> patterns = make_patterns({
+    "r-w-",
+    "+-w-",
+    "--+r",
+    "r---",
+    "---r",
+  });
+  std::vector<std::set<std::size_t>> groups = symbolic::compute_summand_groups("auto", patterns);
+  std::vector<std::set<std::size_t>> expected = { { 0, 1, 3 }, { 2, 4 } };
+  BOOST_CHECK(groups == expected);
+}
@@ -0,0 +1,102 @@
+// Author(s): Maurice Laveaux
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef MCRL2_UTILITIES_DETAIL_THREAD_INDEX_H_
+#define MCRL2_UTILITIES_DETAIL_THREAD_INDEX_H_
+
+#include <cstddef>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+namespace mcrl2
+{
+namespace utilities
+{
+namespace detail
+{
+
+/// \brief The thread index of a thread that has not yet requested one.
+constexpr std::size_t UnassignedThreadIndex = std::numeric_limits<std::size_t>::max();
+
+/// \brief The thread index of a thread whose index has been returned, during the destruction of its thread_local objects.
+constexpr std::size_t ReleasedThreadIndex = std::numeric_limits<std::size_t>::max() - 1;
+
+/// \brief The index of the current thread. This is trivially destructible such that it can be read during the
+///        destruction of other thread_local objects.
+inline thread_local std::size_t g_thread_index = UnassignedThreadIndex;
+
+/// \brief Hands out the smallest indices that are not in use by a running thread.
+class thread_index_registry
+{
+public:
+  std::size_t acquire()
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    if (m_free.empty())
+    {
+      return m_next++;
+    }
+
+    std::size_t index = m_free.back();
+    m_free.pop_back();
+    return index;
+  }
+
+  void release(std::size_t index)
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    m_free.push_back(index);
+  }
+
+private:
+  std::mutex m_mutex;
+  std::vector<std::size_t> m_free;
+  std::size_t m_next = 0;
+};
+
+/// \brief The registry is never destroyed, because threads can terminate during the destruction of static objects.
+inline thread_index_registry& g_thread_index_registry()
+{
+  static thread_index_registry& registry = *new thread_index_registry();
+  return registry;
+}
+
+/// \brief Owns the index of the current thread and returns it to the registry when the thread terminates.
+struct thread_index_owner
+{
+  thread_index_owner()
+  {
+    g_thread_index = g_thread_index_registry().acquire();
+  }
+
+  ~thread_index_owner()
+  {
+    g_thread_index_registry().release(g_thread_index);
+    g_thread_index = ReleasedThreadIndex;
+  }
+};
+
+/// \returns A small number that uniquely identifies the current thread among the running threads. The index
+///          of a terminated thread is reused by threads that are created afterwards.
+/// \details After the index has been released this returns ReleasedThreadIndex.
+inline std::size_t thread_index()
+{
+  if (g_thread_index == UnassignedThreadIndex)
+  {
+    thread_local thread_index_owner owner;
+  }
+
+  return g_thread_index;
+}
+
+} // namespace detail
+} // namespace utilities
+} // namespace mcrl2
+
+#endif // MCRL2_UTILITIES_DETAIL_THREAD_INDEX_H_
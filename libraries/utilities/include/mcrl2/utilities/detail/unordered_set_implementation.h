@@ -112,6 +112,28 @@ auto MCRL2_UNORDERED_SET_CLASS::emplace(Args&&... args) -> std::pair<iterator, b
   }
 }
 
+MCRL2_UNORDERED_SET_TEMPLATES
+template<typename ...Args>
+auto MCRL2_UNORDERED_SET_CLASS::emplace_hashed(std::size_t hash, Args&&... args) -> std::pair<iterator, bool>
+{
+  static_assert(allow_transparent, "emplace_hashed requires transparent hash and equals functions.");
+  assert(hash == m_hash(args...));
+
+  if constexpr (Resize) { rehash_if_needed(); }
+
+  const size_type bucket_index = hash & m_buckets_mask;
+  iterator it = find_impl(bucket_index, args...);
+
+  if (it != end())
+  {
+    return std::make_pair(it, false);
+  }
+  else
+  {
+    return emplace_impl(bucket_index, std::forward<Args>(args)...);
+  }
+}
+
 MCRL2_UNORDERED_SET_TEMPLATES
 auto MCRL2_UNORDERED_SET_CLASS::erase(typename MCRL2_UNORDERED_SET_CLASS::const_iterator it) -> iterator
 {
@@ -11,8 +11,10 @@
 #define MCRL2_UTILITIES_MEMORY_POOL_H_
 
 #include "mcrl2/utilities/detail/free_list.h"
+#include "mcrl2/utilities/detail/thread_index.h"
 #include "mcrl2/utilities/noncopyable.h"
 
+#include <algorithm>
 #include <array>
 #include <cstdint>
 #include <forward_list>
@@ -25,7 +27,9 @@ namespace utilities
 {
 
 /// \brief The memory pool allocates elements of size T from blocks.
-/// \details When ThreadSafe is true then the thread-safe guarantees will be satisfied.
+/// \details When ThreadSafe is true then the thread-safe guarantees will be satisfied. In that case every thread
+///          keeps a magazine of free slots, from which it allocates and to which it deallocates without locking.
+///          Only when a magazine is empty, or full, are MagazineSize slots exchanged with the shared free list.
 template <class T, 
           std::size_t ElementsPerBlock = 1024, 
           bool ThreadSafe = false>
@@ -38,6 +42,7 @@ public:
   ///        in the pool.
   ~memory_pool()
   {
+    drain_magazines();
     m_freelist.destructive_mark();
 
     /// For all actual elements stored in the pool trigger the destructor.
@@ -78,6 +83,24 @@ public:
   /// \threadsafe
   T* allocate()
   {
+    if constexpr (ThreadSafe)
+    {
+      const std::size_t index = detail::thread_index();
+      if (index < NumberOfMagazines)
+      {
+        magazine& local = m_magazines[index];
+        if (local.first == nullptr)
+        {
+          refill(local);
+        }
+
+        Slot* slot = local.first;
+        local.first = slot->next();
+        --local.size;
+        return &slot->element();
+      }
+    }
+
     // Only allow one thread to allocate at the time.
     if constexpr (ThreadSafe) { m_block_mutex.lock(); }
 
@@ -105,8 +128,24 @@ public:
   }
 
   /// \brief Free the memory used by the given pointer that has been allocated by this pool.
+  /// \threadsafe
   void deallocate(T* pointer)
-  {    
+  {
+    if constexpr (ThreadSafe)
+    {
+      const std::size_t index = detail::thread_index();
+      if (index < NumberOfMagazines)
+      {
+        magazine& local = m_magazines[index];
+        push(local, reinterpret_cast<Slot&>(*pointer));
+        if (local.size >= 2 * MagazineSize)
+        {
+          flush(local, MagazineSize);
+        }
+        return;
+      }
+    }
+
     if constexpr (ThreadSafe) { m_block_mutex.lock(); }
 
     assert(contains(pointer));
@@ -117,8 +156,10 @@ public:
 
   /// \brief Frees blocks that are no longer storing elements of T.
   /// \returns The number of blocks that have been removed.
+  /// \details Must not be called concurrently with allocate or deallocate.
   std::size_t consolidate()
   {
+    drain_magazines();
     m_freelist.destructive_mark();
     std::size_t old_number_of_blocks = m_number_of_blocks;
 
@@ -192,6 +233,21 @@ private:
   /// \brief An array that stores ElementsPerBlock number of objects of type T.
   using Block = std::array<Slot, ElementsPerBlock>;
 
+  /// \brief The number of slots that are exchanged between a magazine and the shared free list at once.
+  static constexpr std::size_t MagazineSize = 64;
+
+  /// \brief The number of threads that have a magazine, the threads with a higher index use the shared free list.
+  static constexpr std::size_t NumberOfMagazines = 64;
+
+  /// \brief A list of free slots that is only accessed by the thread with the corresponding thread index. The
+  ///        padding ensures that the magazines of different threads do not share a cache line.
+  struct magazine
+  {
+    Slot* first = nullptr;
+    std::size_t size = 0;
+    char padding[64 - sizeof(Slot*) - sizeof(std::size_t)];
+  };
+
   /// \brief The last slot in the first block that has never been returned by allocate.
   using SizeType = typename std::conditional<ThreadSafe, std::atomic<std::size_t>, std::size_t>::type;
   SizeType m_current_index = ElementsPerBlock;
@@ -208,6 +264,78 @@ private:
   /// \brief Indicates the head of the freelist.
   Freelist m_freelist;
 
+  /// \brief The magazine of each thread, indexed by its thread index.
+  std::array<magazine, ThreadSafe ? NumberOfMagazines : 0> m_magazines = {};
+
+  /// \brief Puts the given slot at the front of the magazine.
+  static void push(magazine& local, Slot& slot)
+  {
+    slot.next(local.first);
+    local.first = &slot;
+    ++local.size;
+  }
+
+  /// \brief Fills the empty magazine with slots from the free list, or otherwise with unused slots of a block.
+  void refill(magazine& local)
+  {
+    std::lock_guard<std::mutex> guard(m_block_mutex);
+
+    while (local.size < MagazineSize && !m_freelist.empty())
+    {
+      push(local, reinterpret_cast<Slot&>(m_freelist.pop_front()));
+    }
+
+    if (local.size == 0)
+    {
+      if (m_current_index >= ElementsPerBlock)
+      {
+        // The whole buffer was used so allocate a new one.
+        m_blocks.emplace_front();
+        ++m_number_of_blocks;
+        m_current_index = 0;
+      }
+
+      // Push the slots in reverse such that they are allocated in the order of the block.
+      Block& block = m_blocks.front();
+      const std::size_t begin = m_current_index;
+      const std::size_t end = std::min(ElementsPerBlock, begin + MagazineSize);
+      for (std::size_t index = end; index > begin; --index)
+      {
+        push(local, block[index - 1]);
+      }
+      m_current_index = end;
+    }
+  }
+
+  /// \brief Moves the given number of slots from the magazine to the free list.
+  void flush(magazine& local, std::size_t number_of_slots)
+  {
+    std::lock_guard<std::mutex> guard(m_block_mutex);
+
+    for (std::size_t i = 0; i < number_of_slots; ++i)
+    {
+      Slot* slot = local.first;
+      local.first = slot->next();
+      m_freelist.push_front(*slot);
+    }
+    local.size -= number_of_slots;
+  }
+
+  /// \brief Moves the slots of all magazines to the free list, requires that no other thread uses this pool.
+  void drain_magazines()
+  {
+    for (magazine& local : m_magazines)
+    {
+      while (local.first != nullptr)
+      {
+        Slot* slot = local.first;
+        local.first = slot->next();
+        m_freelist.push_front(*slot);
+      }
+      local.size = 0;
+    }
+  }
+
   /// \returns Check whether the pointer is contained in this memory pool.
   bool contains(T* p)
   {
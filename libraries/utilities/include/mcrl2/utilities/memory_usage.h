@@ -0,0 +1,61 @@
+// Author(s): Wieger Wesselink
+// Copyright: see the accompanying file COPYING or copy at
+// https://github.com/mCRL2org/mCRL2/blob/master/COPYING
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+/// \file mcrl2/utilities/memory_usage.h
+/// \brief Functions to query the amount of memory used by the current process.
+
+#ifndef MCRL2_UTILITIES_MEMORY_USAGE_H
+#define MCRL2_UTILITIES_MEMORY_USAGE_H
+
+#include <cstddef>
+#include "mcrl2/utilities/platform.h"
+
+#ifdef MCRL2_PLATFORM_LINUX
+  #include <fstream>
+  #include <unistd.h>
+#elif MCRL2_PLATFORM_MAC
+  #include <mach/mach.h>
+#endif
+
+namespace mcrl2 {
+
+namespace utilities {
+
+/// \returns The resident set size of the current process in bytes, or 0 if this
+///          cannot be determined on the current platform.
+inline
+std::size_t resident_memory_size()
+{
+#ifdef MCRL2_PLATFORM_LINUX
+  // The second field of /proc/self/statm contains the number of resident pages.
+  std::ifstream statm("/proc/self/statm");
+  std::size_t size = 0;
+  std::size_t resident = 0;
+  if (statm >> size >> resident)
+  {
+    return resident * static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+  }
+  return 0;
+#elif MCRL2_PLATFORM_MAC
+  mach_task_basic_info info;
+  mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+  if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) == KERN_SUCCESS)
+  {
+    return static_cast<std::size_t>(info.resident_size);
+  }
+  return 0;
+#else
+  return 0;
+#endif
+}
+
+} // namespace utilities
+
+} // namespace mcrl2
+
+#endif // MCRL2_UTILITIES_MEMORY_USAGE_H
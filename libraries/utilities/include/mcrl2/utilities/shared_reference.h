@@ -97,8 +97,9 @@ protected:
 /// \brief A reference counted reference to a shared_reference_counted object.
 /// \details Similar to a shared_ptr except that reference counts are only atomic when
 ///          thread safety is desired and that it stores the reference count in the
-///          inherited object.
-template<typename T>
+///          inherited object. The Pointer type stores the address of the object together with a tag,
+///          it can be replaced by a smaller representation when all objects reside in a known memory range.
+template<typename T, typename Pointer = tagged_pointer<T>>
 class shared_reference
 {
 public:
@@ -118,7 +119,7 @@ public:
   }
 
   /// \brief Copy constructor.
-  shared_reference(const shared_reference<T>& other) noexcept
+  shared_reference(const shared_reference& other) noexcept
     : m_reference(other.m_reference)
   {
     if (defined())
@@ -128,7 +129,7 @@ public:
   }
 
   /// \brief Move constructor.
-  shared_reference(shared_reference<T>&& other) noexcept
+  shared_reference(shared_reference&& other) noexcept
     : m_reference(other.m_reference)
   {
     other.m_reference = nullptr;
@@ -143,7 +144,7 @@ public:
   }
 
   /// \brief Copy assignment constructor.
-  shared_reference<T>& operator=(const shared_reference<T>& other) noexcept
+  shared_reference& operator=(const shared_reference& other) noexcept
   {
     // Increment first to prevent the same reference from getting a reference count of zero temporarily.
     if (other.defined())
@@ -162,7 +163,7 @@ public:
   }
 
   /// \brief Move assignment constructor.
-  shared_reference<T>& operator=(shared_reference<T>&& other) noexcept
+  shared_reference& operator=(shared_reference&& other) noexcept
   {
     if (defined())
     {
@@ -180,28 +181,28 @@ public:
     return m_reference.get() != nullptr;
   }
 
-  bool operator ==(const shared_reference<T>& other) const noexcept
+  bool operator ==(const shared_reference& other) const noexcept
   {
     return m_reference == other.m_reference;
   }
 
-  bool operator <(const shared_reference<T>& other) const noexcept
+  bool operator <(const shared_reference& other) const noexcept
   {
     return m_reference < other.m_reference;
   }
 
   // Comparison operators follow from equivalence and less than.
-  bool operator !=(const shared_reference<T>& other) const noexcept
+  bool operator !=(const shared_reference& other) const noexcept
   {
     return m_reference != other.m_reference;
   }
 
-  bool operator <=(const shared_reference<T>& other) const noexcept
+  bool operator <=(const shared_reference& other) const noexcept
   {
     return m_reference <= other.m_reference;
   }
 
-  bool operator >(const shared_reference<T>& other) const noexcept
+  bool operator >(const shared_reference& other) const noexcept
   {
     return m_reference > other.m_reference;
   }
@@ -231,7 +232,7 @@ public:
 
   /// \brief Swaps *this with the other shared reference.
   /// \details Prevents the change of any reference count adaptations
-  void swap(shared_reference<T>& other)
+  void swap(shared_reference& other)
   {
     using std::swap;
     swap(m_reference, other.m_reference);
@@ -253,7 +254,7 @@ public:
   }
 
 private:
-  mutable utilities::tagged_pointer<T> m_reference;
+  mutable Pointer m_reference;
 };
 
 } // namespace utilities
@@ -262,8 +263,8 @@ private:
 namespace std
 {
 
-template<typename T>
-void swap(mcrl2::utilities::shared_reference<T>& a, mcrl2::utilities::shared_reference<T>& b) noexcept
+template<typename T, typename Pointer>
+void swap(mcrl2::utilities::shared_reference<T, Pointer>& a, mcrl2::utilities::shared_reference<T, Pointer>& b) noexcept
 {
   a.swap(b);
 }
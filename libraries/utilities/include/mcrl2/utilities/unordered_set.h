@@ -271,6 +271,13 @@ public:
   template<typename ...Args>
   std::pair<iterator, bool> emplace(Args&&... args);
 
+  /// \brief Inserts an element Key(args...) into the set if it did not already exist, where hash is
+  ///        equal to hash_function()(args...). Requires transparent hash and equals functions.
+  /// \details Not standard. Avoids computing the hash again when the caller already needed it.
+  /// \threadsafe
+  template<typename ...Args>
+  std::pair<iterator, bool> emplace_hashed(std::size_t hash, Args&&... args);
+
   /// \brief Erases the given key_type(args...) from the unordered set.
   template<typename...Args>
   void erase(const Args&... args);
@@ -12,6 +12,8 @@
 #define BOOST_AUTO_TEST_MAIN
 #include <boost/test/included/unit_test.hpp>
 
+#include <atomic>
+#include <thread>
 #include <vector>
 
 using namespace mcrl2::utilities;
@@ -67,3 +69,61 @@ BOOST_AUTO_TEST_CASE(test_has_extension)
 
   BOOST_CHECK(allocator.consolidate() == 1024/16); // Whole allocator should be emptied.
 }
+
+/// \brief Runs the given function on the given number of threads, which obtain their id as argument.
+template<typename F>
+void run_threads(std::size_t number_of_threads, F function)
+{
+  std::vector<std::thread> threads;
+  for (std::size_t id = 0; id < number_of_threads; ++id)
+  {
+    threads.emplace_back(function, id);
+  }
+
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_thread_safe_consolidate)
+{
+  block_allocator<std::size_t, 16, true> allocator;
+
+  // Every thread allocates elements and frees every other one, then it frees the rest of the elements of
+  // its neighbour. As such slots move between the magazines of the threads.
+  const std::size_t number_of_threads = 4;
+  std::vector<std::vector<std::size_t*>> elements(number_of_threads);
+  run_threads(number_of_threads, [&](std::size_t id)
+    {
+      for (std::size_t i = 0; i < 1000; ++i)
+      {
+        elements[id].push_back(allocator.allocate(1));
+        *elements[id].back() = id;
+      }
+
+      for (std::size_t i = 1; i < elements[id].size(); i += 2)
+      {
+        allocator.deallocate(elements[id][i], 1);
+      }
+    });
+
+  std::atomic<bool> overwritten(false);
+  run_threads(number_of_threads, [&](std::size_t id)
+    {
+      const std::size_t neighbour = (id + 1) % number_of_threads;
+      for (std::size_t i = 0; i < elements[neighbour].size(); i += 2)
+      {
+        overwritten = overwritten || *elements[neighbour][i] != neighbour;
+        allocator.deallocate(elements[neighbour][i], 1);
+      }
+    });
+
+  BOOST_CHECK(!overwritten);
+
+  // All slots are free, so every block is removed.
+  const std::size_t capacity = allocator.capacity();
+  BOOST_CHECK(capacity >= number_of_threads * 1000);
+  BOOST_CHECK(allocator.consolidate() == capacity / 16);
+  BOOST_CHECK(allocator.capacity() == 0);
+}
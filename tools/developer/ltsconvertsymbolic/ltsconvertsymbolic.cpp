@@ -32,7 +32,8 @@ using mcrl2::utilities::tools::input_output_tool;
 enum class symbolic_lts_equivalence
 {
   none,
-  bisim
+  bisim,
+  branching_bisim
 };
 
 // \overload
@@ -50,6 +51,9 @@ std::istream& operator>>(std::istream& is, symbolic_lts_equivalence& eq)
     else if (s == "bisim") {
       eq = symbolic_lts_equivalence::bisim;
     }
+    else if (s == "branching-bisim") {
+      eq = symbolic_lts_equivalence::branching_bisim;
+    }
   }
   catch(mcrl2::runtime_error&)
   {
@@ -74,6 +78,11 @@ std::ostream& operator<<(std::ostream& os, const symbolic_lts_equivalence eq)
       os << "bisim";
       break;
     }
+    case symbolic_lts_equivalence::branching_bisim:
+    {
+      os << "branching-bisim";
+      break;
+    }
   }
 
   return os;
@@ -86,7 +95,9 @@ inline std::string description(const symbolic_lts_equivalence eq)
     case symbolic_lts_equivalence::none:
       return "identity equivalence to concrete LTS";
     case symbolic_lts_equivalence::bisim:
-      return "naive symbolic strong bisimilarity algorithm requiring O(n^2) symbolic operations.";
+      return "strong bisimilarity using symbolic signature refinement";
+    case symbolic_lts_equivalence::branching_bisim:
+      return "divergence blind branching bisimilarity using symbolic signature refinement";
   }
 }
 
@@ -118,7 +129,8 @@ class ltsconvert_tool : public input_output_tool
       desc.add_option("equivalence", 
         make_enum_argument<symbolic_lts_equivalence>("NAME")
           .add_value(symbolic_lts_equivalence::none, true)
-          .add_value(symbolic_lts_equivalence::bisim),
+          .add_value(symbolic_lts_equivalence::bisim)
+          .add_value(symbolic_lts_equivalence::branching_bisim),
           "generate an equivalent LTS, preserving equivalence NAME:",
           'e');
       desc.add_option("lace-workers", utilities::make_optional_argument("NUM", "1"), "set number of Lace workers (threads for parallelization), (0=autodetect, default 1)");
@@ -211,20 +223,20 @@ class ltsconvert_tool : public input_output_tool
         ifs >> m_input;
       }
 
+      if (outtype == lts_none)
+      {
+        mCRL2log(verbose) << "Trying to detect output format by extension..." << std::endl;
+
+        outtype = mcrl2::lts::detail::guess_format(output_filename(), true);
+      }
+
       if (m_equivalence == symbolic_lts_equivalence::none)
       {
         // Convert into a concrete LTS.
         lps::specification lpsspec;
         lps::explorer_options options;
         options.save_at_end = false;
-        
-        if (outtype == lts_none)
-        {
-          mCRL2log(verbose) << "Trying to detect output format by extension..." << std::endl;
 
-          outtype = mcrl2::lts::detail::guess_format(output_filename(), true);
-        }
-        
         std::unique_ptr<lts_builder> builder = create_lts_builder(lpsspec, options, outtype, output_filename());
 
         convert_concrete_lts algorithm(m_input, std::move(builder));
@@ -233,7 +245,9 @@ class ltsconvert_tool : public input_output_tool
       }
       else
       {
-        bisim(m_input);
+        lps::symbolic_lts_quotient quotient = lps::bisim(m_input, m_equivalence == symbolic_lts_equivalence::branching_bisim);
+        mCRL2log(verbose) << "The minimised LTS has " << quotient.number_of_blocks << " states and " << satcount(quotient.transitions) << " transitions." << std::endl;
+        save_quotient(quotient);
       }
 
       sylvan::sylvan_quit();
@@ -242,6 +256,57 @@ class ltsconvert_tool : public input_output_tool
     }
 
   private:
+    template <typename LTS, typename ActionLabel>
+    void save_quotient(LTS& result, const lps::symbolic_lts_quotient& quotient, ActionLabel make_action_label)
+    {
+      for (std::size_t i = 0; i < quotient.number_of_blocks; i++)
+      {
+        result.add_state();
+      }
+      result.set_initial_state(quotient.initial_block);
+
+      std::map<std::uint32_t, std::size_t> labels;
+      for (const std::vector<std::uint32_t>& t: ldd_solutions(quotient.transitions))
+      {
+        auto i = labels.find(t[1]);
+        if (i == labels.end())
+        {
+          i = labels.insert({t[1], result.add_action(make_action_label(m_input.action_index[t[1]]))}).first;
+        }
+        result.add_transition(transition(t[0], i->second, t[2]));
+      }
+      result.save(output_filename());
+    }
+
+    /// \brief Writes the quotient as an explicit LTS to the output file.
+    void save_quotient(const lps::symbolic_lts_quotient& quotient)
+    {
+      switch (outtype)
+      {
+        case lts_none:
+        {
+          break;
+        }
+        case lts_aut:
+        {
+          lts_aut_t result;
+          save_quotient(result, quotient, [](const lps::multi_action& a) { return action_label_string(lps::pp(a)); });
+          break;
+        }
+        case lts_lts:
+        {
+          lts_lts_t result;
+          result.set_data(m_input.data_spec);
+          save_quotient(result, quotient, [](const lps::multi_action& a) { return action_label_lts(a); });
+          break;
+        }
+        default:
+        {
+          throw mcrl2::runtime_error("The minimised LTS can only be saved in the .aut or .lts format.");
+        }
+      }
+    }
+
     lts_type outtype = lts_none;
     symbolic_lts_equivalence m_equivalence = symbolic_lts_equivalence::none;
 
@@ -55,6 +55,10 @@ class lps2lts_tool: public parallel_tool<rewriter_tool<input_output_tool>>
       desc.add_option("no-probability-checking", "do not check if probabilities in stochastic specifications have sensible values");
       desc.add_hidden_option("dfs-recursive", "use recursive depth first search for divergence detection");
       desc.add_option("cached", "use enumeration caching techniques to speed up state space generation. ");
+      desc.add_option("successor-cache", "cache the successors of every summand, using the values of the parameters that "
+                 "the summand depends on as a key. This avoids rewriting for models with many independent components, "
+                 "at the expense of memory. This option has no effect in combination with confluence reduction "
+                 "or for stochastic specifications. ");
       desc.add_option("todo-max", utilities::make_mandatory_argument("NUM"),
                  "keep at most NUM states in the todo list; this option is only relevant for "
                  "highway search, where NUM is the maximum number of states per level. ");
@@ -97,6 +101,12 @@ class lps2lts_tool: public parallel_tool<rewriter_tool<input_output_tool>>
                  "to tau use the flag -ctau. Only if the linear process is tau-confluent, the generated "
                  "state space is branching bisimilar to the state space of the lps. The generation "
                  "algorithm that is used does not require the linear process to be tau convergent. ", 'c');
+      desc.add_option("partial-order-reduction", utilities::make_optional_argument("NAMES", ""),
+                 "only explore the transitions of a stubborn set of summands in each state. This preserves "
+                 "deadlocks, and the traces of the actions in the comma-separated list of action names NAMES, "
+                 "in which the other actions are considered internal. The summands are considered dependent "
+                 "if one of them writes a parameter that the other reads or writes. This option cannot be "
+                 "combined with confluence reduction, or with the search strategies cluster and external. ");
       desc.add_option("out", utilities::make_mandatory_argument("FORMAT"), "save the output in the specified FORMAT. ", 'o');
       desc.add_option("tau", utilities::make_mandatory_argument("NAMES"),
                  "consider actions that occur in the comma-separated list of action names "
@@ -105,8 +115,13 @@ class lps2lts_tool: public parallel_tool<rewriter_tool<input_output_tool>>
                    .add_value_short(lps::es_breadth, "b", true)
                    .add_value_short(lps::es_depth, "d")
                    .add_value_short(lps::es_highway, "h")
+                   .add_value_short(lps::es_cluster, "c")
+                   .add_value_short(lps::es_external_breadth, "e")
         , "explore the state space using strategy NAME:"
         , 's');
+      desc.add_option("external-dir", utilities::make_mandatory_argument("DIR"),
+                 "store the levels of the external breadth-first search (--strategy=external) in directory DIR. "
+                 "By default the directory for temporary files is used.");
       desc.add_option("suppress","in verbose mode, do not print progress messages indicating the number of visited states and transitions.");
       desc.add_option("save-at-end", "delay saving of the generated LTS until the end. "
                  "This option only applies to .aut and .lts files, which are by default saved on the fly.");
@@ -195,6 +210,13 @@ class lps2lts_tool: public parallel_tool<rewriter_tool<input_output_tool>>
           throw mcrl2::runtime_error(std::string("Action label ") + core::pp(ta) + " is not declared.");
         }
       }
+      for (const mcrl2::core::identifier_string& ta: options.visible_actions)
+      {
+        if (std::string(ta) != "tau" && std::none_of(action_labels.begin(), action_labels.end(), [&](const process::action_label& al) { return al.name() == ta; }))
+        {
+          throw mcrl2::runtime_error(std::string("Action label ") + core::pp(ta) + " is not declared.");
+        }
+      }
     }
 
     void parse_options(const utilities::command_line_parser& parser) override
@@ -203,6 +225,7 @@ class lps2lts_tool: public parallel_tool<rewriter_tool<input_output_tool>>
       options.save_at_end                           = parser.has_option("save-at-end");
       options.cached                                = parser.has_option("cached");
       options.global_cache                          = parser.has_option("global-cache");
+      options.successor_cache                       = parser.has_option("successor-cache");
       options.confluence                            = parser.has_option("confluence");
       options.one_point_rule_rewrite                = !parser.has_option("no-one-point-rule-rewrite");
       options.remove_unused_rewrite_rules           = !parser.has_option("no-remove-unused-rewrite-rules");
@@ -230,6 +253,18 @@ class lps2lts_tool: public parallel_tool<rewriter_tool<input_output_tool>>
       {
         parser.error("Option 'todo-max' can only be used in combination with highway search.");
       }
+      if (parser.has_option("external-dir"))
+      {
+        if (options.search_strategy != lps::es_external_breadth)
+        {
+          parser.error("Option 'external-dir' can only be used in combination with external breadth-first search.");
+        }
+        options.external_directory = parser.option_argument("external-dir");
+      }
+      if (options.search_strategy == lps::es_external_breadth && options.number_of_threads > 1)
+      {
+        parser.error("Search strategy 'external' can only be used in single thread mode.");
+      }
 
       if (parser.has_option("out"))
       {
@@ -294,6 +329,23 @@ class lps2lts_tool: public parallel_tool<rewriter_tool<input_output_tool>>
         options.confluence_action = parser.option_argument("confluence");
       }
 
+      if (parser.has_option("partial-order-reduction"))
+      {
+        if (parser.has_option("confluence"))
+        {
+          parser.error("Option --partial-order-reduction cannot be combined with --confluence.");
+        }
+        if (options.search_strategy == lps::es_cluster || options.search_strategy == lps::es_external_breadth)
+        {
+          parser.error("Option --partial-order-reduction cannot be combined with the search strategies cluster and external.");
+        }
+        options.partial_order_reduction = true;
+        for (const std::string& s: split_actions(parser.option_argument("partial-order-reduction")))
+        {
+          options.visible_actions.insert(core::identifier_string(s));
+        }
+      }
+
       if (2 < parser.arguments.size())
       {
         parser.error("Too many file arguments.");
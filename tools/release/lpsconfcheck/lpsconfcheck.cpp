@@ -12,6 +12,7 @@
 #include "mcrl2/lps/io.h"
 #include "mcrl2/lps/confluence_checker.h"
 #include "mcrl2/utilities/input_output_tool.h"
+#include "mcrl2/utilities/parallel_tool.h"
 #include "mcrl2/data/rewriter_tool.h"
 #include "mcrl2/data/prover_tool.h"
 
@@ -38,11 +39,11 @@ using mcrl2::data::tools::prover_tool;
 /// \brief tau-summands of an LPS are confluent. The tau-actions of all confluent tau-summands are
 /// \brief renamed to ctau
 
-class lpsconfcheck_tool : public prover_tool< rewriter_tool<input_output_tool> >
+class lpsconfcheck_tool : public prover_tool< rewriter_tool<parallel_tool<input_output_tool> > >
 {
   protected:
 
-    typedef prover_tool< rewriter_tool<input_output_tool> > super;
+    typedef prover_tool< rewriter_tool<parallel_tool<input_output_tool> > > super;
 
     /// \brief The name of a file containing an invariant that is used to check confluence.
     /// \brief If this string is 0, the constant true is used as invariant.
@@ -77,6 +78,10 @@ class lpsconfcheck_tool : public prover_tool< rewriter_tool<input_output_tool> >
     /// \brief a contradiction nor a tautology. If the string is empty, no files are written.
     std::string m_dot_file_name;
 
+    /// \brief The file in which proven confluence conditions are stored. If the string is empty, the
+    /// \brief results are not stored.
+    std::string m_results_file_name;
+
     /// \brief The maximal number of seconds spent on proving a single confluence condition.
     int m_time_limit;
 
@@ -110,6 +115,10 @@ class lpsconfcheck_tool : public prover_tool< rewriter_tool<input_output_tool> >
       {
         m_dot_file_name = parser.option_argument_as< std::string >("print-dot");
       }
+      if (parser.options.count("results"))
+      {
+        m_results_file_name = parser.option_argument_as< std::string >("results");
+      }
       if (parser.options.count("summand"))
       {
         m_summand_number = parser.option_argument_as< std::size_t >("summand");
@@ -177,6 +186,10 @@ class lpsconfcheck_tool : public prover_tool< rewriter_tool<input_output_tool> >
       add_option("print-dot", make_mandatory_argument("PREFIX"),
                  "save a .dot file of the resulting BDD in case two summands cannot be proven "
                  "confluent; PREFIX will be used as prefix of the output files", 'p').
+      add_option("results", make_file_argument("FILE"),
+                 "store the proven confluence conditions in FILE after each tau-summand, and reuse "
+                 "the results that are already stored in FILE; this allows an interrupted check to "
+                 "be resumed").
       add_option("time-limit", make_mandatory_argument("LIMIT"),
                  "spend at most LIMIT seconds on proving a single formula", 't').
       add_option("induction", "apply induction on lists", 'o');
@@ -238,7 +251,8 @@ class lpsconfcheck_tool : public prover_tool< rewriter_tool<input_output_tool> >
           spec, rewrite_strategy(),
           m_time_limit, m_path_eliminator, solver_type(),
           m_apply_induction, m_check_all, m_no_sums, m_conditions,
-          m_counter_example, m_generate_invariants, m_dot_file_name);
+          m_counter_example, m_generate_invariants, m_dot_file_name,
+          number_of_threads(), m_results_file_name);
 
         v_confluence_checker.check_confluence_and_mark(m_invariant, m_summand_number);
         save_lps(spec, output_filename());
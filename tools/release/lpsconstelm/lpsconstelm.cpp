@@ -11,6 +11,7 @@
 //mCRL2
 #include "mcrl2/lps/tools.h"
 #include "mcrl2/utilities/input_output_tool.h"
+#include "mcrl2/utilities/parallel_tool.h"
 #include "mcrl2/data/rewriter_tool.h"
 
 using namespace mcrl2;
@@ -20,11 +21,11 @@ using namespace mcrl2::utilities::tools;
 
 using mcrl2::data::tools::rewriter_tool;
 
-class lpsconstelm_tool: public rewriter_tool<input_output_tool >
+class lpsconstelm_tool: public rewriter_tool<parallel_tool<input_output_tool> >
 {
   protected:
 
-    typedef rewriter_tool<input_output_tool> super;
+    typedef rewriter_tool<parallel_tool<input_output_tool> > super;
 
     bool m_instantiate_free_variables = false;
     bool m_ignore_conditions = false;
@@ -85,7 +86,8 @@ class lpsconstelm_tool: public rewriter_tool<input_output_tool >
                   m_instantiate_free_variables,
                   m_ignore_conditions,
                   m_remove_trivial_summands,
-                  m_remove_singleton_sorts
+                  m_remove_singleton_sorts,
+                  number_of_threads()
                 );
       return true;
     }
@@ -11,6 +11,7 @@
 #include "mcrl2/lps/tools.h"
 
 #include "mcrl2/utilities/input_output_tool.h"
+#include "mcrl2/utilities/parallel_tool.h"
 #include "mcrl2/data/rewriter_tool.h"
 
 using namespace mcrl2::utilities;
@@ -18,11 +19,11 @@ using namespace mcrl2::utilities::tools;
 
 using mcrl2::data::tools::rewriter_tool;
 
-class suminst_tool: public rewriter_tool<input_output_tool>
+class suminst_tool: public rewriter_tool<parallel_tool<input_output_tool> >
 {
   protected:
 
-    typedef rewriter_tool<input_output_tool> super;
+    typedef rewriter_tool<parallel_tool<input_output_tool> > super;
 
     bool m_tau_summands_only;
     bool m_finite_sorts_only;
@@ -64,7 +65,8 @@ class suminst_tool: public rewriter_tool<input_output_tool>
         "Jeroen Keiren",
         "instantiate summation variables of an LPS",
         "Instantiate the summation variables of the linear process specification (LPS) "
-        "in INFILE and write the result to OUTFILE. If INFILE is not present, stdin is "
+        "in INFILE and write the result to OUTFILE. Summands that are equal to an "
+        "earlier summand are removed. If INFILE is not present, stdin is "
         "used. If OUTFILE is not present, stdout is used."
       )
     {}
@@ -78,7 +80,8 @@ class suminst_tool: public rewriter_tool<input_output_tool>
                              rewrite_strategy(),
                              m_sorts_string,
                              m_finite_sorts_only,
-                             m_tau_summands_only);
+                             m_tau_summands_only,
+                             number_of_threads());
       return true;
     }
 };
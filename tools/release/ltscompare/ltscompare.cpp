@@ -12,6 +12,7 @@
 #define AUTHOR "Muck van Weerdenburg"
 
 #include "mcrl2/utilities/input_tool.h"
+#include "mcrl2/utilities/parallel_tool.h"
 
 #include "mcrl2/lts/lts_algorithm.h"
 #include "mcrl2/lts/lts_io.h"
@@ -39,7 +40,7 @@ struct t_tool_options
   bool enable_preprocessing      = true;
 };
 
-typedef  input_tool ltscompare_base;
+typedef  parallel_tool<input_tool> ltscompare_base;
 class ltscompare_tool : public ltscompare_base
 {
   private:
@@ -114,7 +115,7 @@ class ltscompare_tool : public ltscompare_base
                      description(tool_options.preorder) << "..."
                      " using the " << print_exploration_strategy(tool_options.strategy) << " strategy.\n";
 
-        result = destructive_compare(l1, l2, tool_options.preorder, tool_options.generate_counter_examples, tool_options.counter_example_file, tool_options.structured_output, tool_options.strategy, tool_options.enable_preprocessing);
+        result = destructive_compare(l1, l2, tool_options.preorder, tool_options.generate_counter_examples, tool_options.counter_example_file, tool_options.structured_output, tool_options.strategy, tool_options.enable_preprocessing, number_of_threads());
 
         if (!tool_options.structured_output)
         {
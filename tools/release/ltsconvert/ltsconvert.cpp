@@ -12,6 +12,7 @@
 #define AUTHOR "Muck van Weerdenburg, Jan Friso Groote"
 
 #include "mcrl2/utilities/input_output_tool.h"
+#include "mcrl2/utilities/parallel_tool.h"
 #include "mcrl2/lts/lts_io.h"
 #include "mcrl2/lts/lts_algorithm.h"
 
@@ -91,14 +92,15 @@ class t_tool_options
 
 };
 
-class ltsconvert_tool : public input_output_tool
+typedef parallel_tool<input_output_tool> ltsconvert_base;
+class ltsconvert_tool : public ltsconvert_base
 {
   private:
     t_tool_options tool_options;
 
   public:
     ltsconvert_tool() :
-      input_output_tool(NAME,AUTHOR,
+      ltsconvert_base(NAME,AUTHOR,
                       "convert and optionally minimise an LTS",
                       "Convert the labelled transition system (LTS) from INFILE to OUTFILE in the\n"
                       "requested format after applying the selected minimisation method (default is\n"
@@ -142,7 +144,7 @@ class ltsconvert_tool : public input_output_tool
         mCRL2log(verbose) << "reducing LTS (modulo " <<  description(tool_options.equivalence) << ")..." << std::endl;
         mCRL2log(verbose) << "before reduction: " << l.num_states() << " states and " << l.num_transitions() << " transitions " << std::endl;
         timer().start("reduction");
-        reduce(l,tool_options.equivalence);
+        reduce(l,tool_options.equivalence,number_of_threads());
         timer().finish("reduction");
         mCRL2log(verbose) << "after reduction: " << l.num_states() << " states and " << l.num_transitions() << " transitions" << std::endl;
       }
@@ -152,7 +154,7 @@ class ltsconvert_tool : public input_output_tool
         mCRL2log(verbose) << "determinising LTS..." << std::endl;
         mCRL2log(verbose) << "before determinisation: " << l.num_states() << " states and " << l.num_transitions() << " transitions" << std::endl;
         timer().start("determinisation");
-        determinise(l);
+        determinise(l,number_of_threads());
         timer().finish("determinisation");
         mCRL2log(verbose) << "after determinisation: " << l.num_states() << " states and " << l.num_transitions() << " transitions" << std::endl;
       }
@@ -238,7 +240,7 @@ class ltsconvert_tool : public input_output_tool
   protected:
     void add_options(interface_description& desc)
     {
-      input_output_tool::add_options(desc);
+      ltsconvert_base::add_options(desc);
 
       desc.add_option("no-reach",
                       "do not perform a reachability check on the input LTS.");
@@ -295,7 +297,7 @@ class ltsconvert_tool : public input_output_tool
 
     void parse_options(const command_line_parser& parser)
     {
-      input_output_tool::parse_options(parser);
+      ltsconvert_base::parse_options(parser);
 
       if (parser.options.count("lps"))
       {
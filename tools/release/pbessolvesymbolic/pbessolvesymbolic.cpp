@@ -161,13 +161,18 @@ class pbessolvesymbolic_tool: public rewriter_tool<input_output_tool>
                       "'none' (default) no summand groups\n"
                       "'used' summands with the same variables are joined\n"
                       "'simple' summands with the same read/write variables are joined\n"
+                      "'auto' summands with a read/write pattern that is included in that of another summand are joined\n"
                       "a user defined list of summand groups separated by semicolons, e.g. '0; 1 3 4; 2 5'");
       desc.add_option("reorder", utilities::make_optional_argument("ORDER", "none"),
                       "'none' (default) no variable reordering\n"
                       "'random' variables are put in a random order\n"
+                      "'force' the FORCE heuristic is applied to the read/write patterns\n"
+                      "'sloan' the profile reduction heuristic of Sloan is applied to the read/write patterns\n"
+                      "'bandwidth' the bandwidth reducing reverse Cuthill-McKee heuristic is applied to the read/write patterns\n"
                       "'a user defined permutation e.g. '1 3 2 0 4'"
       );
-      desc.add_option("info", "print read/write information of the summands");
+      desc.add_option("info", "print read/write information of the summands, and compare the LDD sizes obtained with the variable order heuristics "
+                              "(using max-iterations breadth-first iterations, or 10 if max-iterations is not set)");
       desc.add_option("max-iterations", utilities::make_optional_argument("NUM", "0"), "limit number of breadth-first iterations to NUM");
       desc.add_option("print-nodesize", "print the number of LDD nodes in addition to the number of elements represented as 'elements[nodes]'");
       desc.add_option("saturation", "reduce the amount of breadth-first iterations by applying the transition groups until fixed point");
@@ -294,13 +299,15 @@ class pbessolvesymbolic_tool: public rewriter_tool<input_output_tool>
              )
     {}
 
-    void solve(pbes_system::pbesreach_algorithm& reach)
+    void solve(pbes_system::pbesreach_algorithm& reach, const pbes_system::pbes& pbesspec)
     {
       using namespace sylvan::ldds;
 
       if (options.info)
       {
         std::cout << symbolic::print_read_write_patterns(reach.read_write_group_patterns());
+        std::cout << std::endl;
+        symbolic::print_variable_order_comparison<pbes_system::pbesreach_algorithm>(std::cout, pbesspec, options);
       }
       else
       {
@@ -363,12 +370,12 @@ class pbessolvesymbolic_tool: public rewriter_tool<input_output_tool>
         if (options.solve_strategy == 0)
         {
           pbes_system::pbesreach_algorithm reach(pbesspec, options);
-          solve(reach);
+          solve(reach, pbesspec);
         }
         else
         {
           pbes_system::pbesreach_algorithm_partial reach(pbesspec, options);
-          solve(reach);
+          solve(reach, pbesspec);
         }
       }
 